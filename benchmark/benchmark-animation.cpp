@@ -0,0 +1,171 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "benchmark.hpp"
+#include <engine/animation/animation-sequence.hpp>
+#include <engine/animation/baked-clip.hpp>
+#include <engine/animation/skeleton.hpp>
+#include <engine/math/quaternion.hpp>
+#include <engine/math/transform.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <format>
+#include <print>
+#include <random>
+#include <vector>
+
+using namespace engine;
+using namespace engine::animation;
+
+namespace
+{
+	constexpr usize bone_count = 40;
+	constexpr usize key_count = 30;
+	constexpr usize clip_count = 4;
+	constexpr usize instance_count = 1000;
+	constexpr float clip_duration = 1.0f;
+	constexpr float time_step = 1.0f / 60.0f;
+
+	/// Pose buffer written by the output functions of the legacy animation tracks.
+	std::vector<math::transform<float>>* current_pose = nullptr;
+
+	/// Playback state of an animation instance.
+	struct instance
+	{
+		usize clip{};
+		float time{};
+		std::vector<u32> cursors;
+		std::vector<math::transform<float>> pose;
+	};
+
+	/// Generates a clip with translation and rotation tracks for each bone, as both a legacy animation sequence and a baked clip.
+	void make_clip(std::mt19937& rng, animation_sequence& sequence, baked_clip& clip)
+	{
+		std::uniform_real_distribution<float> value_distribution(-1.0f, 1.0f);
+
+		std::vector<float> times(key_count);
+		std::vector<float> values(key_count);
+		for (usize i = 0; i < key_count; ++i)
+		{
+			times[i] = clip_duration * static_cast<float>(i) / static_cast<float>(key_count - 1);
+		}
+
+		auto add_track = [&](usize bone_index, const char* property, usize channel_count)
+		{
+			const auto path = std::format("bone{}/{}", bone_index, property);
+			auto& track = sequence.tracks()[path];
+			const u32 first_channel = static_cast<u32>(clip.channels().size());
+
+			for (usize i = 0; i < channel_count; ++i)
+			{
+				auto& curve = track.channels().emplace_back();
+				for (usize j = 0; j < key_count; ++j)
+				{
+					values[j] = value_distribution(rng);
+					curve.keyframes().emplace(times[j], values[j]);
+				}
+
+				clip.add_channel(times, values);
+			}
+
+			clip.add_track(path, first_channel);
+
+			if (channel_count == 3)
+			{
+				track.output() = [bone_index](auto samples, auto&)
+				{
+					(*current_pose)[bone_index].translation = math::fvec3{samples[0], samples[1], samples[2]};
+				};
+			}
+			else
+			{
+				track.output() = [bone_index](auto samples, auto&)
+				{
+					(*current_pose)[bone_index].rotation = math::normalize(math::fquat{samples[0], samples[1], samples[2], samples[3]});
+				};
+			}
+		};
+
+		for (usize i = 0; i < bone_count; ++i)
+		{
+			add_track(i, "translation", 3);
+			add_track(i, "rotation_quaternion", 4);
+		}
+	}
+}
+
+int main(int, char*[])
+{
+	std::mt19937 rng(42);
+
+	// Generate skeleton
+	skeleton skeleton(bone_count);
+	for (usize i = 0; i < bone_count; ++i)
+	{
+		skeleton.bones()[i].rename(std::format("bone{}", i));
+	}
+
+	// Generate clips
+	std::vector<animation_sequence> sequences(clip_count);
+	std::vector<baked_clip> clips(clip_count);
+	for (usize i = 0; i < clip_count; ++i)
+	{
+		make_clip(rng, sequences[i], clips[i]);
+		clips[i].bind(skeleton);
+	}
+
+	// Generate instances with random clips and phases
+	std::uniform_int_distribution<usize> clip_distribution(0, clip_count - 1);
+	std::uniform_real_distribution<float> phase_distribution(0.0f, clip_duration);
+	std::vector<instance> instances(instance_count);
+	for (auto& instance: instances)
+	{
+		instance.clip = clip_distribution(rng);
+		instance.time = phase_distribution(rng);
+		instance.cursors.resize(clips[instance.clip].channels().size());
+		instance.pose.resize(bone_count, math::identity<math::transform<float>>);
+	}
+
+	const usize channel_count = clips[0].channels().size();
+	std::println("[animation] {} instances, {} bones, {} channels, {} keys per channel", instance_count, bone_count, channel_count, key_count);
+
+	// Advances the playback time of an instance, looping at the end of the clip
+	auto advance = [](instance& instance)
+	{
+		instance.time += time_step;
+		if (instance.time >= clip_duration)
+		{
+			instance.time -= clip_duration;
+		}
+	};
+
+	animation_context context{};
+	std::vector<float> sample_buffer(4);
+
+	benchmark_suite suite;
+	suite.benchmarks.emplace_back("animation_sequence sample (channels)", instance_count * channel_count, [&]()
+	{
+		for (auto& instance: instances)
+		{
+			advance(instance);
+			current_pose = &instance.pose;
+			for (const auto& [path, track]: sequences[instance.clip].tracks())
+			{
+				track.sample(instance.time, sample_buffer);
+				track.output()(sample_buffer, context);
+			}
+		}
+	});
+	suite.benchmarks.emplace_back("baked_clip sample (channels)", instance_count * channel_count, [&]()
+	{
+		for (auto& instance: instances)
+		{
+			advance(instance);
+			clips[instance.clip].sample(instance.time, instance.cursors, instance.pose);
+		}
+	});
+	const int failed = suite.run();
+
+	do_not_optimize(instances);
+
+	return failed;
+}
@@ -0,0 +1,112 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "benchmark.hpp"
+#include <engine/physics/gas/transmittance-lut.hpp>
+#include <engine/math/functions.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <algorithm>
+#include <chrono>
+#include <print>
+#include <vector>
+
+using namespace engine;
+using physics::gas::transmittance_lut;
+
+namespace
+{
+	/// Density profile of Earth's atmosphere.
+	constexpr transmittance_lut::profile earth_profile
+	{
+		.planet_radius = 6'371'000.0,
+		.upper_limit = 65'000.0,
+		.rayleigh_scale_height = 8'000.0,
+		.mie_scale_height = 1'200.0,
+		.ozone_lower_limit = 10'000.0,
+		.ozone_upper_limit = 40'000.0,
+		.ozone_mode = 25'000.0
+	};
+
+	/// Extinction coefficients of Earth's atmosphere, per unit of relative column density.
+	const math::dvec3 rayleigh_scattering{5.8e-6, 13.5e-6, 33.1e-6};
+	constexpr double mie_extinction = 4.4e-6;
+	const math::dvec3 ozone_absorption{0.65e-6, 1.88e-6, 0.085e-6};
+
+	/// Number of samples used by astronomy_system's per-tick integrator.
+	constexpr usize march_sample_count = 16;
+
+	/// Converts column densities to transmittance.
+	math::dvec3 transmittance(const math::dvec3& densities)
+	{
+		const math::dvec3 extinction = densities.x() * rayleigh_scattering + densities.y() * mie_extinction + densities.z() * ozone_absorption;
+		return {math::exp(-extinction.x()), math::exp(-extinction.y()), math::exp(-extinction.z())};
+	}
+}
+
+int main(int, char*[])
+{
+	// Build table
+	transmittance_lut lut;
+	const auto start = std::chrono::steady_clock::now();
+	lut.build(earth_profile);
+	const auto duration = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+	std::println("[transmittance_lut build] {:.2f} ms ({}x{}, {} samples)", duration.count(), transmittance_lut::default_resolution.x(), transmittance_lut::default_resolution.y(), transmittance_lut::default_sample_count);
+
+	// Generate sun directions above the horizon at observer elevations within the troposphere
+	constexpr usize query_count = 4096;
+	std::vector<double> radii(query_count);
+	std::vector<double> cos_zeniths(query_count);
+	for (usize i = 0; i < query_count; ++i)
+	{
+		radii[i] = earth_profile.planet_radius + static_cast<double>(i % 64) * 150.0;
+		cos_zeniths[i] = 1.0 - static_cast<double>(i) / static_cast<double>(query_count) * 1.02;
+	}
+
+	// Measure error of the table and of the per-tick integrator against a high-precision reference
+	double max_lut_error = 0.0;
+	double max_march_error = 0.0;
+	for (usize i = 0; i < query_count; ++i)
+	{
+		const auto densities = lut.lookup(radii[i], cos_zeniths[i]);
+		if (!densities)
+		{
+			continue;
+		}
+
+		const auto reference = transmittance(transmittance_lut::integrate(earth_profile, radii[i], cos_zeniths[i], 4096));
+		const auto lut_value = transmittance(*densities);
+		const auto march_value = transmittance(transmittance_lut::integrate(earth_profile, radii[i], cos_zeniths[i], march_sample_count));
+		for (usize j = 0; j < 3; ++j)
+		{
+			max_lut_error = std::max(max_lut_error, math::abs(lut_value[j] - reference[j]));
+			max_march_error = std::max(max_march_error, math::abs(march_value[j] - reference[j]));
+		}
+	}
+	std::println("[transmittance error] lut: {:.2e}, {}-sample march: {:.2e} (max absolute)", max_lut_error, march_sample_count, max_march_error);
+
+	// Measure per-query cost
+	double sum = 0.0;
+	benchmark_suite suite;
+	suite.benchmarks.emplace_back("ray march transmittance", query_count, [&]()
+	{
+		for (usize i = 0; i < query_count; ++i)
+		{
+			sum += transmittance(transmittance_lut::integrate(earth_profile, radii[i], cos_zeniths[i], march_sample_count)).x();
+		}
+	});
+	suite.benchmarks.emplace_back("transmittance_lut transmittance", query_count, [&]()
+	{
+		for (usize i = 0; i < query_count; ++i)
+		{
+			if (const auto densities = lut.lookup(radii[i], cos_zeniths[i]))
+			{
+				sum += transmittance(*densities).x();
+			}
+		}
+	});
+	const int failed = suite.run();
+
+	do_not_optimize(sum);
+
+	return failed;
+}
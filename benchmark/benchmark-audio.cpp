@@ -0,0 +1,125 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "benchmark.hpp"
+#include <engine/audio/sound-stream.hpp>
+#include <engine/audio/sound-system.hpp>
+#include <engine/audio/sound-wave.hpp>
+#include <engine/audio/streaming-sound-que.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <cstddef>
+#include <cstring>
+#include <format>
+#include <memory>
+#include <print>
+#include <span>
+#include <utility>
+#include <vector>
+
+using namespace engine;
+using namespace engine::audio;
+
+namespace
+{
+	constexpr u16 track_channels = 2;
+	constexpr u32 track_sample_rate = 44100;
+	constexpr usize track_seconds = 60;
+
+	/// Makes 16-bit PCM stereo WAV file data of an ambient-length track.
+	[[nodiscard]] std::vector<std::byte> make_track()
+	{
+		const usize frame_count = track_sample_rate * track_seconds;
+		const u32 data_size = static_cast<u32>(frame_count * track_channels * sizeof(i16));
+		const u32 byte_rate = track_sample_rate * track_channels * sizeof(i16);
+		const u16 block_align = track_channels * sizeof(i16);
+		const u16 bits_per_sample = 16;
+		const u16 pcm_format = 1;
+		const u32 fmt_size = 16;
+		const u32 riff_size = 36 + data_size;
+
+		std::vector<std::byte> data(44 + data_size);
+		std::byte* p = data.data();
+		const auto write = [&](const void* bytes, usize size)
+		{
+			std::memcpy(p, bytes, size);
+			p += size;
+		};
+
+		write("RIFF", 4);
+		write(&riff_size, 4);
+		write("WAVE", 4);
+		write("fmt ", 4);
+		write(&fmt_size, 4);
+		write(&pcm_format, 2);
+		write(&track_channels, 2);
+		write(&track_sample_rate, 4);
+		write(&byte_rate, 4);
+		write(&block_align, 2);
+		write(&bits_per_sample, 2);
+		write("data", 4);
+		write(&data_size, 4);
+
+		for (usize i = 0; i < frame_count * track_channels; ++i)
+		{
+			const auto sample = static_cast<i16>(static_cast<int>(i * 131 % 20000) - 10000);
+			write(&sample, sizeof(sample));
+		}
+
+		return data;
+	}
+
+	/// Fully decodes a track and uploads it to a single buffer, as the sound wave loader does.
+	[[nodiscard]] std::unique_ptr<sound_wave> load_sound_wave(const std::vector<std::byte>& track)
+	{
+		const sound_stream stream(track);
+		auto decoder = stream.open_decoder();
+
+		std::vector<i16> samples(stream.get_frame_count() * stream.get_channels());
+		decoder->read(samples);
+
+		return std::make_unique<sound_wave>(stream.get_channels(), stream.get_sample_rate(), 16, std::as_bytes(std::span{samples}));
+	}
+
+	/// Opens a track as a stream, and blocks until playback starts.
+	[[nodiscard]] std::unique_ptr<streaming_sound_que> load_streaming_sound_que(const std::vector<std::byte>& track)
+	{
+		auto que = std::make_unique<streaming_sound_que>(std::make_shared<sound_stream>(track));
+		que->play();
+		return que;
+	}
+}
+
+int main(int, char*[])
+{
+	sound_system system(sound_device_type::loopback);
+	const auto track = make_track();
+
+	// Measure growth of resident memory for each playback path, before benchmarking so that memory freed by earlier loads is not reused
+	const auto memory_growth = [](auto&& load)
+	{
+		const auto size = static_cast<std::ptrdiff_t>(resident_memory_size());
+		auto resource = load();
+		return std::pair{static_cast<std::ptrdiff_t>(resident_memory_size()) - size, std::move(resource)};
+	};
+	auto [que_memory_growth, que] = memory_growth([&]{return load_streaming_sound_que(track);});
+	auto [wave_memory_growth, wave] = memory_growth([&]{return load_sound_wave(track);});
+
+	benchmark_suite suite;
+	suite.benchmarks.emplace_back(std::format("sound_wave load {} s track (tracks)", track_seconds), 1, [&]()
+	{
+		auto wave = load_sound_wave(track);
+		do_not_optimize(wave);
+	});
+	suite.benchmarks.emplace_back(std::format("streaming_sound_que load {} s track (tracks)", track_seconds), 1, [&]()
+	{
+		auto que = load_streaming_sound_que(track);
+		do_not_optimize(que);
+	});
+	const int failed = suite.run();
+
+	std::println("[audio] {} s track: {} bytes encoded", track_seconds, track.size());
+	std::println("[audio] streaming_sound_que: {} bytes decoded, resident memory {:+} bytes", que->get_decoded_size(), que_memory_growth);
+	std::println("[audio] sound_wave: {} bytes decoded, resident memory {:+} bytes", wave->get_size(), wave_memory_growth);
+
+	return failed;
+}
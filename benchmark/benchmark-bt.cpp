@@ -0,0 +1,265 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "benchmark.hpp"
+#include <engine/ai/bt/bt.hpp>
+#include <engine/ai/bt/compiled-tree.hpp>
+#include <engine/ai/bt/scheduler.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <algorithm>
+#include <format>
+#include <memory>
+#include <print>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace engine;
+namespace bt = engine::ai::bt;
+
+namespace
+{
+	/// Number of agents.
+	constexpr usize agent_count = 50000;
+
+	/// Fraction of agents ticked per update in the time-sliced benchmark.
+	constexpr usize time_slice_count = 4;
+
+	/// Blackboard of an ant.
+	struct ant_blackboard
+	{
+		float energy{1.0f};
+		float hunger{0.0f};
+		float threat{0.0f};
+		float distance{0.0f};
+		u32 cargo{0};
+		u32 timer{0};
+	};
+
+	/// Owns the nodes of pointer behavior trees.
+	class tree_builder
+	{
+	public:
+		template <class Node>
+		Node* make()
+		{
+			auto node = std::make_unique<Node>();
+			auto pointer = node.get();
+			m_nodes.emplace_back(std::move(node));
+			return pointer;
+		}
+
+		bt::node<ant_blackboard>* action(bt::action<ant_blackboard>::function_type function)
+		{
+			auto node = make<bt::action<ant_blackboard>>();
+			node->function = std::move(function);
+			return node;
+		}
+
+		bt::node<ant_blackboard>* condition(bt::condition<ant_blackboard>::predicate_type predicate)
+		{
+			auto node = make<bt::condition<ant_blackboard>>();
+			node->predicate = std::move(predicate);
+			return node;
+		}
+
+		bt::node<ant_blackboard>* sequence(std::initializer_list<bt::node<ant_blackboard>*> children)
+		{
+			auto node = make<bt::sequence<ant_blackboard>>();
+			node->children.assign(children.begin(), children.end());
+			return node;
+		}
+
+		bt::node<ant_blackboard>* selector(std::initializer_list<bt::node<ant_blackboard>*> children)
+		{
+			auto node = make<bt::selector<ant_blackboard>>();
+			node->children.assign(children.begin(), children.end());
+			return node;
+		}
+
+		bt::node<ant_blackboard>* inverter(bt::node<ant_blackboard>* child)
+		{
+			auto node = make<bt::inverter<ant_blackboard>>();
+			node->child = child;
+			return node;
+		}
+
+	private:
+		std::vector<std::unique_ptr<bt::node<ant_blackboard>>> m_nodes;
+	};
+
+	/// Action which runs for a number of ticks.
+	[[nodiscard]] bt::action<ant_blackboard>::function_type wait(u32 tick_count)
+	{
+		return [tick_count](ant_blackboard& b)
+		{
+			if (++b.timer < tick_count)
+			{
+				return bt::status::running;
+			}
+			b.timer = 0;
+			return bt::status::success;
+		};
+	}
+
+	/// Builds the shared leaves and subtrees of the ant trees.
+	[[nodiscard]] bt::node<ant_blackboard>* make_survival_tree(tree_builder& t)
+	{
+		return t.selector
+		({
+			t.sequence
+			({
+				t.condition([](const ant_blackboard& b){return b.threat > 0.8f;}),
+				t.action([](ant_blackboard& b){b.distance += 2.0f; b.threat *= 0.5f; return bt::status::success;})
+			}),
+			t.sequence
+			({
+				t.condition([](const ant_blackboard& b){return b.hunger > 0.9f;}),
+				t.action(wait(3)),
+				t.action([](ant_blackboard& b){b.hunger = 0.0f; b.energy = 1.0f; return bt::status::success;})
+			})
+		});
+	}
+
+	/// Builds the tree of a forager, which fetches food.
+	[[nodiscard]] bt::node<ant_blackboard>* make_forager_tree(tree_builder& t)
+	{
+		return t.selector
+		({
+			make_survival_tree(t),
+			t.sequence
+			({
+				t.inverter(t.condition([](const ant_blackboard& b){return b.cargo > 0;})),
+				t.action([](ant_blackboard& b){b.distance += 1.0f; b.hunger += 0.01f; return b.distance < 20.0f ? bt::status::running : bt::status::success;}),
+				t.action([](ant_blackboard& b){b.cargo = 1; return bt::status::success;})
+			}),
+			t.sequence
+			({
+				t.action([](ant_blackboard& b){b.distance -= 1.0f; b.hunger += 0.01f; return b.distance > 0.0f ? bt::status::running : bt::status::success;}),
+				t.action([](ant_blackboard& b){b.cargo = 0; b.threat += 0.05f; return bt::status::success;})
+			})
+		});
+	}
+
+	/// Builds the tree of a nurse, which tends brood.
+	[[nodiscard]] bt::node<ant_blackboard>* make_nurse_tree(tree_builder& t)
+	{
+		return t.selector
+		({
+			make_survival_tree(t),
+			t.sequence
+			({
+				t.condition([](const ant_blackboard& b){return b.energy > 0.2f;}),
+				t.action(wait(5)),
+				t.action([](ant_blackboard& b){b.energy -= 0.05f; b.hunger += 0.02f; return bt::status::success;})
+			}),
+			t.action([](ant_blackboard& b){b.energy += 0.1f; return bt::status::success;})
+		});
+	}
+
+	/// Builds the tree of a soldier, which patrols.
+	[[nodiscard]] bt::node<ant_blackboard>* make_soldier_tree(tree_builder& t)
+	{
+		return t.selector
+		({
+			make_survival_tree(t),
+			t.sequence
+			({
+				t.action([](ant_blackboard& b){b.threat += 0.01f; b.hunger += 0.005f; return bt::status::success;}),
+				t.action(wait(8)),
+				t.action([](ant_blackboard& b){b.distance = -b.distance; return bt::status::success;})
+			})
+		});
+	}
+}
+
+int main(int, char*[])
+{
+	tree_builder builder;
+	const bt::node<ant_blackboard>* roots[] = {make_forager_tree(builder), make_nurse_tree(builder), make_soldier_tree(builder)};
+
+	// Agents with random initial state
+	std::mt19937 rng(42);
+	std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+	std::vector<ant_blackboard> blackboards(agent_count);
+	for (auto& blackboard: blackboards)
+	{
+		blackboard.hunger = distribution(rng);
+		blackboard.threat = distribution(rng);
+		blackboard.distance = 20.0f * distribution(rng);
+	}
+
+	// Pointer trees
+	auto pointer_blackboards = blackboards;
+
+	// Compiled trees, ticked in a loop on one thread
+	std::vector<std::shared_ptr<const bt::compiled_tree<ant_blackboard>>> trees;
+	for (const auto root: roots)
+	{
+		trees.emplace_back(std::make_shared<const bt::compiled_tree<ant_blackboard>>(*root));
+	}
+	auto compiled_blackboards = blackboards;
+	std::vector<u32> running_nodes(agent_count, bt::compiled_tree<ant_blackboard>::no_node);
+
+	// Compiled trees, ticked by schedulers
+	const usize thread_count = std::max(std::thread::hardware_concurrency(), 1u);
+	auto make_scheduler = [&](usize scheduler_thread_count)
+	{
+		auto scheduler = std::make_unique<bt::scheduler<ant_blackboard>>(scheduler_thread_count);
+		for (const auto& tree: trees)
+		{
+			scheduler->add_tree(tree);
+		}
+		for (usize i = 0; i < agent_count; ++i)
+		{
+			scheduler->add_agent(static_cast<u32>(i % trees.size()), blackboards[i]);
+		}
+		return scheduler;
+	};
+	auto single_threaded_scheduler = make_scheduler(1);
+	auto scheduler = make_scheduler(thread_count);
+	auto time_sliced_scheduler = make_scheduler(thread_count);
+
+	usize node_count = 0;
+	for (const auto& tree: trees)
+	{
+		node_count += tree->size();
+	}
+	std::println("[bt] {} agents, {} trees of {} nodes on average, {} threads", agent_count, trees.size(), node_count / trees.size(), thread_count);
+
+	benchmark_suite suite;
+
+	suite.benchmarks.emplace_back("pointer tree (ticks)", agent_count, [&]()
+	{
+		for (usize i = 0; i < agent_count; ++i)
+		{
+			do_not_optimize(roots[i % std::size(roots)]->execute(pointer_blackboards[i]));
+		}
+	});
+	suite.benchmarks.emplace_back("compiled_tree (ticks)", agent_count, [&]()
+	{
+		for (usize i = 0; i < agent_count; ++i)
+		{
+			do_not_optimize(trees[i % trees.size()]->tick(compiled_blackboards[i], running_nodes[i]));
+		}
+	});
+	suite.benchmarks.emplace_back("scheduler 1 thread (ticks)", agent_count, [&]()
+	{
+		single_threaded_scheduler->update();
+		do_not_optimize(single_threaded_scheduler->contexts().data());
+	});
+	suite.benchmarks.emplace_back(std::format("scheduler {} threads (ticks)", thread_count), agent_count, [&]()
+	{
+		scheduler->update();
+		do_not_optimize(scheduler->contexts().data());
+	});
+	suite.benchmarks.emplace_back(std::format("scheduler {} threads, 1/{} of agents per update (ticks)", thread_count, time_slice_count), agent_count / time_slice_count, [&]()
+	{
+		time_sliced_scheduler->update(agent_count / time_slice_count);
+		do_not_optimize(time_sliced_scheduler->contexts().data());
+	});
+
+	const int failed = suite.run();
+	return failed;
+}
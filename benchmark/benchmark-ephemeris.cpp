@@ -0,0 +1,182 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "benchmark.hpp"
+#include <engine/physics/orbit/ephemeris.hpp>
+#include <engine/physics/orbit/ephemeris-evaluator.hpp>
+#include <engine/physics/orbit/paged-ephemeris.hpp>
+#include <engine/resources/resource-manager.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <print>
+#include <vector>
+
+using namespace engine;
+
+namespace
+{
+	/// Coefficient table of the synthetic ephemeris, matching the layout of JPL DE421.
+	constexpr i32 coeff_table[13][3] =
+	{
+		{3, 14, 4}, {171, 10, 2}, {231, 13, 2}, {309, 11, 1}, {342, 8, 1}, {366, 7, 1}, {387, 6, 1},
+		{405, 6, 1}, {423, 6, 1}, {441, 13, 8}, {753, 11, 2}, {819, 10, 4}, {899, 10, 4}
+	};
+
+	/// Number of coefficients per record.
+	constexpr usize record_coeff_count = 1018;
+
+	/// Number of records in the synthetic ephemeris, spanning approximately 1,750 years.
+	constexpr usize record_count = 20000;
+
+	/// Writes a synthetic JPL DE file with the given number of records.
+	void write_synthetic_ephemeris(const std::filesystem::path& path)
+	{
+		const f64 start_jd = 2287184.5;
+		const f64 record_duration = 32.0;
+
+		std::vector<f64> record(record_coeff_count);
+		auto* bytes = reinterpret_cast<std::byte*>(record.data());
+
+		std::ofstream stream(path, std::ios::binary);
+
+		// Header record
+		const f64 time[3] = {start_jd, start_jd + record_duration * record_count, record_duration};
+		const i32 constant_count = 0;
+		const i32 denum = 421;
+		const i32 lpt[3] = {899, 10, 4};
+		std::memcpy(bytes + 0xA5C, time, sizeof(time));
+		std::memcpy(bytes + 0xA74, &constant_count, sizeof(constant_count));
+		std::memcpy(bytes + 0xA88, coeff_table, sizeof(i32) * 3 * 12);
+		std::memcpy(bytes + 0xB18, &denum, sizeof(denum));
+		std::memcpy(bytes + 0xB1C, lpt, sizeof(lpt));
+		stream.write(reinterpret_cast<const char*>(bytes), record.size() * sizeof(f64));
+
+		// Constants record
+		std::fill(record.begin(), record.end(), 0.0);
+		stream.write(reinterpret_cast<const char*>(bytes), record.size() * sizeof(f64));
+
+		// Coefficient records, with decaying coefficient magnitudes resembling real Chebyshev series
+		for (usize i = 0; i < record_count; ++i)
+		{
+			record[0] = start_jd + record_duration * static_cast<f64>(i);
+			record[1] = record[0] + record_duration;
+			for (usize j = 2; j < record_coeff_count; ++j)
+			{
+				record[j] = 1.0e8 / static_cast<f64>((j + i) % 13 + 1);
+			}
+			stream.write(reinterpret_cast<const char*>(bytes), record.size() * sizeof(f64));
+		}
+	}
+
+	/// Measures the duration and resident memory growth of loading a resource.
+	template <class T>
+	std::shared_ptr<T> measure_load(resources::resource_manager& resource_manager, const char* name)
+	{
+		const auto memory_before = resident_memory_size();
+		const auto start = std::chrono::steady_clock::now();
+		auto resource = resource_manager.load<T>("synthetic.eph");
+		const auto duration = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+		const auto memory_after = resident_memory_size();
+
+		std::println("[{} load] {:.2f} ms, {:.2f} MiB resident", name, duration.count(), static_cast<double>(memory_after - memory_before) / (1024.0 * 1024.0));
+
+		return resource;
+	}
+}
+
+int main(int, char*[])
+{
+	const auto directory = std::filesystem::temp_directory_path() / "antkeeper-benchmark-ephemeris";
+	std::filesystem::create_directories(directory);
+	write_synthetic_ephemeris(directory / "synthetic.eph");
+	std::println("[synthetic ephemeris] {:.1f} MiB, {} records", static_cast<double>(std::filesystem::file_size(directory / "synthetic.eph")) / (1024.0 * 1024.0), record_count);
+
+	int failed = 0;
+	{
+		resources::resource_manager resource_manager;
+		resource_manager.mount(directory);
+
+		// Query a narrow window in the middle of the ephemeris, as orbit_system does
+		constexpr usize batch_size = 1000;
+		const double window_start = 0.0;
+		double sum = 0.0;
+
+		// Paged ephemeris (loaded first, as the resource cache is keyed by path)
+		{
+			auto ephemeris = measure_load<physics::orbit::paged_ephemeris>(resource_manager, "paged_ephemeris");
+
+			benchmark_suite suite;
+			suite.benchmarks.emplace_back("paged_ephemeris::position (11 items)", batch_size * 11, [&]()
+			{
+				for (usize i = 0; i < batch_size; ++i)
+				{
+					const double t = window_start + static_cast<double>(i) * 0.01;
+					for (usize j = 0; j < 11; ++j)
+					{
+						sum += ephemeris->position(j, t).x();
+					}
+				}
+			});
+
+			// Batched evaluation of all items
+			physics::orbit::ephemeris_evaluator evaluator(ephemeris, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+			std::vector<math::dvec3> positions(11 * batch_size);
+			std::vector<math::dvec3> velocities(11 * batch_size);
+			std::vector<double> times(batch_size);
+			for (usize i = 0; i < batch_size; ++i)
+			{
+				times[i] = window_start + static_cast<double>(i) * 0.01;
+			}
+
+			suite.benchmarks.emplace_back("ephemeris_evaluator::sample positions (11 items)", batch_size * 11, [&]()
+			{
+				evaluator.sample(times, positions);
+				sum += positions.back().x();
+			});
+			suite.benchmarks.emplace_back("ephemeris_evaluator::sample positions+velocities (11 items)", batch_size * 11, [&]()
+			{
+				evaluator.sample(times, positions, velocities);
+				sum += velocities.back().x();
+			});
+			suite.benchmarks.emplace_back("ephemeris_evaluator::evaluate (11 items)", batch_size * 11, [&]()
+			{
+				for (usize i = 0; i < batch_size; ++i)
+				{
+					evaluator.evaluate(times[i], std::span{positions}.first(11));
+					sum += positions[0].x();
+				}
+			});
+			failed += suite.run();
+
+			std::println("[paged_ephemeris] {} records decoded", ephemeris->decoded_record_count());
+		}
+
+		// Fully-decoded ephemeris
+		{
+			auto ephemeris = measure_load<physics::orbit::ephemeris<double>>(resource_manager, "ephemeris");
+
+			benchmark_suite suite;
+			suite.benchmarks.emplace_back("trajectory::position (11 items)", batch_size * 11, [&]()
+			{
+				for (usize i = 0; i < batch_size; ++i)
+				{
+					const double t = window_start + static_cast<double>(i) * 0.01;
+					for (usize j = 0; j < 11; ++j)
+					{
+						sum += ephemeris->trajectories[j].position(t).x();
+					}
+				}
+			});
+			failed += suite.run();
+		}
+
+		do_not_optimize(sum);
+	}
+
+	std::filesystem::remove_all(directory);
+
+	return failed;
+}
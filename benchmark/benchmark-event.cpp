@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "benchmark.hpp"
+#include <engine/event/event.hpp>
+#include <engine/math/vector.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <memory>
+#include <vector>
+
+using namespace engine;
+
+namespace
+{
+	/// Message resembling an input event.
+	struct moved_message
+	{
+		math::fvec2 position;
+		math::fvec2 difference;
+	};
+
+	/// Second message type, to exercise multiple subscriber tables.
+	struct pressed_message
+	{
+		u32 button;
+	};
+
+	/// Number of messages sent per benchmark invocation.
+	constexpr usize batch_size = 10000;
+}
+
+int main(int, char*[])
+{
+	event::queue queue;
+	float sum = 0.0f;
+	u32 presses = 0;
+
+	std::vector<std::shared_ptr<event::subscription>> subscriptions;
+	for (int i = 0; i < 4; ++i)
+	{
+		subscriptions.emplace_back(queue.subscribe<moved_message>([&](const auto& m){sum += m.difference.x();}));
+		subscriptions.emplace_back(queue.subscribe<pressed_message>([&](const auto& m){presses += m.button;}));
+	}
+
+	benchmark_suite suite;
+
+	suite.benchmarks.emplace_back("dispatcher::dispatch (4 subscribers)", batch_size, [&]()
+	{
+		for (usize i = 0; i < batch_size; ++i)
+		{
+			queue.dispatch(moved_message{{1.0f, 2.0f}, {0.5f, 0.25f}});
+		}
+	});
+
+	suite.benchmarks.emplace_back("queue::enqueue", batch_size, [&]()
+	{
+		for (usize i = 0; i < batch_size; ++i)
+		{
+			queue.enqueue(moved_message{{1.0f, 2.0f}, {0.5f, 0.25f}});
+		}
+		queue.clear();
+	});
+
+	suite.benchmarks.emplace_back("queue::enqueue + flush (2 types, 4 subscribers each)", batch_size, [&]()
+	{
+		for (usize i = 0; i < batch_size; i += 2)
+		{
+			queue.enqueue(moved_message{{1.0f, 2.0f}, {0.5f, 0.25f}});
+			queue.enqueue(pressed_message{1});
+		}
+		queue.flush();
+	});
+
+	const auto failed = suite.run();
+	do_not_optimize(sum);
+	do_not_optimize(presses);
+
+	return failed;
+}
@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "benchmark.hpp"
+#include <engine/resources/resource-manager.hpp>
+#include <engine/type/font-cache.hpp>
+#include <engine/type/typeface.hpp>
+#include <engine/type/unicode.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <print>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace engine;
+
+namespace
+{
+	/// Font size, in pixels.
+	constexpr float font_size = 32.0f;
+
+	/// Returns the unique characters of a text file which are contained in a typeface.
+	[[nodiscard]] std::vector<char32_t> read_character_set(const std::filesystem::path& path, const type::typeface& typeface)
+	{
+		std::ifstream stream(path, std::ios::binary);
+		std::stringstream buffer;
+		buffer << stream.rdbuf();
+
+		auto characters = type::to_utf32(buffer.str());
+		std::sort(characters.begin(), characters.end());
+		characters.erase(std::unique(characters.begin(), characters.end()), characters.end());
+		std::erase_if(characters, [&](char32_t code){return code < U' ' || !typeface.has_glyph(code);});
+
+		return {characters.begin(), characters.end()};
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc < 2)
+	{
+		std::println("usage: {} <font file> [strings file]", argv[0]);
+		std::println("[font] no font file given, skipping");
+		return 0;
+	}
+
+	const std::filesystem::path font_path = argv[1];
+	const std::filesystem::path strings_path = (argc > 2) ? argv[2] : "res/localization/strings.csv";
+
+	const auto directory = std::filesystem::temp_directory_path() / "antkeeper-benchmark-font";
+	std::filesystem::create_directories(directory);
+
+	resources::resource_manager resource_manager;
+	resource_manager.mount(std::filesystem::absolute(font_path).parent_path());
+	resource_manager.mount(directory);
+	resource_manager.set_write_path(directory);
+
+	auto typeface = resource_manager.load<type::typeface>(font_path.filename());
+	if (!typeface)
+	{
+		return 1;
+	}
+
+	const auto characters = read_character_set(strings_path, *typeface);
+	std::println("[font] {} glyphs of \"{} {}\" at {} px", characters.size(), typeface->get_family_name(), typeface->get_style_name(), font_size);
+
+	std::vector<type::glyph> glyphs(characters.size());
+
+	benchmark_suite suite;
+	for (const bool sdf: {false, true})
+	{
+		suite.benchmarks.emplace_back(std::format("typeface::get_glyph{} (glyphs)", sdf ? " sdf" : ""), characters.size(), [&, sdf]()
+		{
+			for (usize i = 0; i < characters.size(); ++i)
+			{
+				glyphs[i] = typeface->get_glyph(characters[i], font_size, sdf);
+			}
+		});
+		suite.benchmarks.emplace_back(std::format("typeface::get_glyphs{} (glyphs)", sdf ? " sdf" : ""), characters.size(), [&, sdf]()
+		{
+			typeface->get_glyphs(characters, font_size, sdf, glyphs);
+		});
+	}
+	const int failed = suite.run();
+
+	// Save the SDF glyphs of the character set to a font cache, then time loading them back
+	{
+		type::font_cache cache;
+		cache.texture_dimensions = {2048, 2048};
+		typeface->get_glyphs(characters, font_size, true, glyphs);
+		for (usize i = 0; i < characters.size(); ++i)
+		{
+			cache.glyphs.emplace_back(characters[i], std::move(glyphs[i]));
+		}
+		resource_manager.save(cache, "benchmark.glyphs");
+	}
+
+	const auto start = std::chrono::steady_clock::now();
+	auto cache = resource_manager.load<type::font_cache>("benchmark.glyphs");
+	const auto duration = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+	std::println("[font_cache load] {:.2f} ms, {:.2f} KiB", duration.count(), static_cast<double>(std::filesystem::file_size(directory / "benchmark.glyphs")) / 1024.0);
+
+	std::filesystem::remove_all(directory);
+
+	return failed || !cache;
+}
@@ -0,0 +1,225 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "benchmark.hpp"
+#include <engine/geom/hyperoctree.hpp>
+#include <engine/geom/linear-hyperoctree.hpp>
+#include <engine/geom/morton.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <algorithm>
+#include <print>
+#include <random>
+#include <vector>
+
+using namespace engine;
+
+namespace
+{
+	/// Number of leaf locations from which trees are built.
+	constexpr usize location_count = 100000;
+
+	/// Number of nodes erased per erasure benchmark.
+	constexpr usize erase_count = 1000;
+
+	using ordered_tree = geom::hyperoctree<u32, 3, geom::hyperoctree_order::dfs_pre>;
+	using unordered_tree = geom::hyperoctree<u32, 3, geom::hyperoctree_order::unordered>;
+	using linear_tree = geom::linear_hyperoctree<u32, 3>;
+
+	/// Generates random node identifiers at the maximum depth, clustered like agents around a few centers.
+	[[nodiscard]] std::vector<u32> make_locations(std::mt19937& rng, usize count)
+	{
+		constexpr u32 resolution = linear_tree::resolution;
+		std::normal_distribution<float> offset_distribution(0.0f, resolution / 16.0f);
+		std::uniform_int_distribution<u32> center_distribution(resolution / 4, resolution * 3 / 4);
+
+		std::vector<u32> centers;
+		for (usize i = 0; i < 16 * 3; ++i)
+		{
+			centers.emplace_back(center_distribution(rng));
+		}
+
+		std::vector<u32> locations(count);
+		for (usize i = 0; i < count; ++i)
+		{
+			const u32* center = &centers[(i % 16) * 3];
+			u32 coordinates[3];
+			for (usize j = 0; j < 3; ++j)
+			{
+				coordinates[j] = static_cast<u32>(std::clamp(static_cast<float>(center[j]) + offset_distribution(rng), 0.0f, static_cast<float>(resolution - 1)));
+			}
+			locations[i] = linear_tree::node(linear_tree::max_depth, geom::morton_encode(coordinates[0], coordinates[1], coordinates[2]));
+		}
+		return locations;
+	}
+
+	/// Finds the deepest node in a hyperoctree which contains a location, by searching its ancestors.
+	template <class Tree>
+	[[nodiscard]] u32 find_container(const Tree& tree, u32 location)
+	{
+		u32 depth = Tree::max_depth;
+		while (depth && !tree.contains(Tree::ancestor(location, depth)))
+		{
+			--depth;
+		}
+		return Tree::ancestor(location, depth);
+	}
+}
+
+int main(int, char*[])
+{
+	std::mt19937 rng(42);
+	const auto locations = make_locations(rng, location_count);
+	const auto queries = make_locations(rng, location_count);
+
+	ordered_tree ordered;
+	unordered_tree unordered;
+	linear_tree linear;
+	for (const auto location: locations)
+	{
+		ordered.insert(location);
+		unordered.insert(location);
+	}
+	linear.insert(locations);
+
+	std::vector<u32> erased(locations.begin(), locations.begin() + erase_count);
+
+	std::println("[hyperoctree] {} locations at depth {}, {} nodes", location_count, linear_tree::max_depth, linear.size());
+
+	usize result = 0;
+
+	benchmark_suite suite;
+
+	suite.benchmarks.emplace_back("ordered build (locations)", location_count, [&]()
+	{
+		ordered.clear();
+		for (const auto location: locations)
+		{
+			ordered.insert(location);
+		}
+		do_not_optimize(ordered.size());
+	});
+	suite.benchmarks.emplace_back("unordered build (locations)", location_count, [&]()
+	{
+		unordered.clear();
+		for (const auto location: locations)
+		{
+			unordered.insert(location);
+		}
+		do_not_optimize(unordered.size());
+	});
+	suite.benchmarks.emplace_back("linear build (locations)", location_count, [&]()
+	{
+		linear.clear();
+		linear.insert(locations);
+		do_not_optimize(linear.size());
+	});
+
+	suite.benchmarks.emplace_back("ordered contains (lookups)", location_count, [&]()
+	{
+		result = 0;
+		for (const auto query: queries)
+		{
+			result += ordered.contains(query);
+		}
+		do_not_optimize(result);
+	});
+	suite.benchmarks.emplace_back("unordered contains (lookups)", location_count, [&]()
+	{
+		result = 0;
+		for (const auto query: queries)
+		{
+			result += unordered.contains(query);
+		}
+		do_not_optimize(result);
+	});
+	suite.benchmarks.emplace_back("linear contains (lookups)", location_count, [&]()
+	{
+		result = 0;
+		for (const auto query: queries)
+		{
+			result += linear.contains(query);
+		}
+		do_not_optimize(result);
+	});
+
+	suite.benchmarks.emplace_back("ordered find container (lookups)", location_count, [&]()
+	{
+		result = 0;
+		for (const auto query: queries)
+		{
+			result += find_container(ordered, query);
+		}
+		do_not_optimize(result);
+	});
+	suite.benchmarks.emplace_back("unordered find container (lookups)", location_count, [&]()
+	{
+		result = 0;
+		for (const auto query: queries)
+		{
+			result += find_container(unordered, query);
+		}
+		do_not_optimize(result);
+	});
+	suite.benchmarks.emplace_back("linear find container (lookups)", location_count, [&]()
+	{
+		result = 0;
+		for (const auto query: queries)
+		{
+			result += linear.find_container(query);
+		}
+		do_not_optimize(result);
+	});
+
+	suite.benchmarks.emplace_back("ordered traversal (nodes)", ordered.size(), [&]()
+	{
+		result = 0;
+		for (const auto node: ordered)
+		{
+			result += node;
+		}
+		do_not_optimize(result);
+	});
+	suite.benchmarks.emplace_back("unordered traversal (nodes)", unordered.size(), [&]()
+	{
+		result = 0;
+		for (const auto node: unordered)
+		{
+			result += node;
+		}
+		do_not_optimize(result);
+	});
+	suite.benchmarks.emplace_back("linear traversal (nodes)", linear.size(), [&]()
+	{
+		result = 0;
+		for (const auto node: linear)
+		{
+			result += node;
+		}
+		do_not_optimize(result);
+	});
+
+	// Erasure benchmarks include rebuilding the tree
+	suite.benchmarks.emplace_back("ordered build and erase (locations)", location_count, [&]()
+	{
+		ordered.clear();
+		for (const auto location: locations)
+		{
+			ordered.insert(location);
+		}
+		for (const auto node: erased)
+		{
+			ordered.erase(node);
+		}
+		do_not_optimize(ordered.size());
+	});
+	suite.benchmarks.emplace_back("linear build and erase (locations)", location_count, [&]()
+	{
+		linear.clear();
+		linear.insert(locations);
+		linear.erase(erased);
+		do_not_optimize(linear.size());
+	});
+
+	const int failed = suite.run();
+	return failed;
+}
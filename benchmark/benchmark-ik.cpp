@@ -0,0 +1,154 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "benchmark.hpp"
+#include <engine/animation/ik/ik-rig.hpp>
+#include <engine/animation/ik/solvers/ccd-ik-solver.hpp>
+#include <engine/animation/ik/solvers/batched-ccd-ik-solver.hpp>
+#include <engine/animation/skeleton.hpp>
+#include <engine/animation/skeleton-pose.hpp>
+#include <engine/math/euler-angles.hpp>
+#include <engine/scene/skeletal-mesh.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <memory>
+#include <print>
+#include <random>
+#include <vector>
+
+using namespace engine;
+using namespace engine::animation;
+
+namespace
+{
+	/// Number of bones in a leg chain: coxa, femur, tibia, and tarsus.
+	constexpr usize leg_bone_count = 4;
+
+	/// Number of leg chains solved per benchmark invocation, equivalent to 256 six-legged ants.
+	constexpr usize chain_count = 1536;
+
+	/// Constructs a skeleton with a body bone and a single leg chain.
+	skeleton make_leg_skeleton()
+	{
+		skeleton leg_skeleton(leg_bone_count + 1);
+		for (usize i = 1; i <= leg_bone_count; ++i)
+		{
+			leg_skeleton.bones()[i].reparent(&leg_skeleton.bones()[i - 1]);
+
+			auto transform = math::identity<math::transform<float>>;
+			transform.translation = {0.0f, 0.0f, i == 1 ? 0.2f : 0.5f};
+			leg_skeleton.rest_pose().set_relative_transform(i, transform);
+		}
+		leg_skeleton.rest_pose().update();
+
+		return leg_skeleton;
+	}
+
+	/// Constrains the rotation of a leg bone.
+	euler_ik_constraint make_leg_constraint()
+	{
+		euler_ik_constraint constraint;
+		constraint.set_rotation_sequence(math::rotation_sequence::zyx);
+		constraint.set_min_angles({-1.0f, -1.0f, -0.5f});
+		constraint.set_max_angles({1.0f, 1.0f, 0.5f});
+		return constraint;
+	}
+}
+
+int main(int, char*[])
+{
+	std::mt19937 rng(42);
+
+	const auto leg_skeleton = make_leg_skeleton();
+	const auto leg_constraint = make_leg_constraint();
+	const math::fvec3 effector_position{0.0f, 0.0f, 0.3f};
+	constexpr float goal_radius = 0.01f;
+	constexpr usize max_iterations = 10;
+
+	// Generate goals reachable within the constraints of the legs, by posing the legs with random joint angles
+	std::uniform_real_distribution<float> angle_distribution(-0.8f, 0.8f);
+	std::vector<math::fvec3> goals(chain_count);
+	skeleton_pose goal_pose = leg_skeleton.rest_pose();
+	for (auto& goal: goals)
+	{
+		for (usize j = 1; j <= leg_bone_count; ++j)
+		{
+			const math::fvec3 angles = math::fvec3{angle_distribution(rng), angle_distribution(rng), angle_distribution(rng) * 0.5f};
+			goal_pose.set_relative_rotation(j, math::euler_to_quat(leg_constraint.get_rotation_sequence(), angles));
+		}
+
+		goal = goal_pose.get_absolute_transform(leg_bone_count) * effector_position;
+	}
+
+	// Set up one IK rig per leg for the scalar solver
+	std::vector<std::unique_ptr<scene::skeletal_mesh>> meshes(chain_count);
+	std::vector<std::unique_ptr<ik_rig>> rigs(chain_count);
+	std::vector<std::shared_ptr<ccd_ik_solver>> solvers(chain_count);
+	for (usize i = 0; i < chain_count; ++i)
+	{
+		meshes[i] = std::make_unique<scene::skeletal_mesh>();
+		meshes[i]->get_pose() = leg_skeleton.rest_pose();
+
+		rigs[i] = std::make_unique<ik_rig>(*meshes[i]);
+		for (usize j = 1; j <= leg_bone_count; ++j)
+		{
+			rigs[i]->set_constraint(j, std::make_shared<euler_ik_constraint>(leg_constraint));
+		}
+
+		solvers[i] = std::make_shared<ccd_ik_solver>(*rigs[i], 1, leg_bone_count);
+		solvers[i]->set_max_iterations(max_iterations);
+		solvers[i]->set_effector_position(effector_position);
+		solvers[i]->set_goal_radius(goal_radius);
+		solvers[i]->set_goal_center(goals[i]);
+		rigs[i]->add_solver(solvers[i]);
+	}
+
+	// Set up the batched solver
+	batched_ccd_ik_solver batched_solver(leg_skeleton, 1, leg_bone_count);
+	batched_solver.set_max_iterations(max_iterations);
+	batched_solver.set_goal_radius(goal_radius);
+	for (usize j = 0; j < leg_bone_count; ++j)
+	{
+		batched_solver.set_constraint(j, leg_constraint);
+	}
+	batched_solver.resize(chain_count);
+	for (usize i = 0; i < chain_count; ++i)
+	{
+		batched_solver.set_effector_position(i, effector_position);
+	}
+
+	std::println("[ik] {} chains of {} bones, {} iterations max", chain_count, leg_bone_count, max_iterations);
+
+	benchmark_suite suite;
+	suite.benchmarks.emplace_back("ccd_ik_solver (chains)", chain_count, [&]()
+	{
+		for (usize i = 0; i < chain_count; ++i)
+		{
+			meshes[i]->get_pose() = leg_skeleton.rest_pose();
+			rigs[i]->solve();
+		}
+	});
+	suite.benchmarks.emplace_back("batched_ccd_ik_solver (chains)", chain_count, [&]()
+	{
+		for (usize i = 0; i < chain_count; ++i)
+		{
+			batched_solver.gather(i, leg_skeleton.rest_pose());
+			batched_solver.set_goal_center(i, goals[i]);
+		}
+		batched_solver.solve();
+	});
+	const int failed = suite.run();
+
+	// Report convergence
+	usize scalar_converged = 0;
+	usize batched_converged = 0;
+	for (usize i = 0; i < chain_count; ++i)
+	{
+		const auto& pose = meshes[i]->get_pose();
+		const auto scalar_effector_position = pose.get_absolute_transform(leg_bone_count) * effector_position;
+		scalar_converged += math::sqr_distance(scalar_effector_position, goals[i]) <= goal_radius * goal_radius;
+		batched_converged += batched_solver.is_converged(i);
+	}
+	std::println("[ik convergence] ccd_ik_solver: {}/{}, batched_ccd_ik_solver: {}/{}", scalar_converged, chain_count, batched_converged, chain_count);
+
+	return failed;
+}
@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "benchmark.hpp"
+#include <engine/debug/binary-log.hpp>
+#include <engine/debug/file-log.hpp>
+#include <engine/debug/log.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <filesystem>
+#include <memory>
+#include <print>
+
+using namespace engine;
+
+namespace
+{
+	/// Number of messages logged per benchmark invocation.
+	constexpr usize batch_size = 1000;
+
+	/// Total number of messages logged to the current sink.
+	usize message_count = 0;
+
+	/// Logs a batch of messages resembling typical engine output.
+	void log_batch()
+	{
+		for (usize i = 0; i < batch_size; ++i)
+		{
+			debug::log_info("Loaded resource \"{}\" ({} of {}) in {} ms", "models/worker-ant.mdl", i, batch_size, 1.25);
+		}
+		message_count += batch_size;
+	}
+}
+
+int main(int, char*[])
+{
+	const auto directory = std::filesystem::temp_directory_path() / "antkeeper-benchmark-log";
+	std::filesystem::create_directories(directory);
+	const auto text_path = directory / "log.tsv";
+	const auto binary_path = directory / "log.aklog";
+
+	int failed = 0;
+
+	// Text sink
+	{
+		message_count = 0;
+		auto sink = std::make_unique<debug::file_log>(text_path);
+
+		benchmark_suite suite;
+		suite.benchmarks.emplace_back("file_log messages", batch_size, log_batch);
+		failed += suite.run();
+
+		sink.reset();
+		std::println("[file_log] {:.1f} bytes/message", static_cast<double>(std::filesystem::file_size(text_path)) / static_cast<double>(message_count));
+	}
+
+	// Binary sink
+	{
+		message_count = 0;
+		auto sink = std::make_unique<debug::binary_log>(binary_path);
+
+		benchmark_suite suite;
+		suite.benchmarks.emplace_back("binary_log messages", batch_size, log_batch);
+		failed += suite.run();
+
+		sink.reset();
+		std::println("[binary_log] {:.1f} bytes/message", static_cast<double>(std::filesystem::file_size(binary_path)) / static_cast<double>(message_count));
+	}
+
+	std::filesystem::remove_all(directory);
+
+	return failed;
+}
@@ -0,0 +1,281 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "benchmark.hpp"
+#include <engine/ai/navmesh.hpp>
+#include <engine/ai/navmesh-flow-field.hpp>
+#include <engine/ai/navmesh-graph.hpp>
+#include <engine/ai/navmesh-path.hpp>
+#include <engine/ai/navmesh-path-service.hpp>
+#include <engine/geom/brep/mesh.hpp>
+#include <engine/geom/brep/operations.hpp>
+#include <engine/math/constants.hpp>
+#include <engine/math/quaternion.hpp>
+#include <engine/math/vector.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <cmath>
+#include <format>
+#include <memory>
+#include <print>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace engine;
+
+namespace
+{
+	/// Number of cells on each axis of the nest grid.
+	constexpr u32 nest_size = 256;
+
+	/// Number of cells between the walls which divide the nest into chambers.
+	constexpr u32 chamber_size = 32;
+
+	/// Number of path queries per batch, roughly those of a colony of foragers in one tick.
+	constexpr usize query_count = 512;
+
+	/// Number of agents heading to a common goal.
+	constexpr usize agent_count = 10000;
+
+	/// Number of agents which find their own path in each invocation of the per-agent pathfinding benchmark.
+	constexpr usize pathfinding_agent_count = 64;
+
+	/// Maximum angle through which agents turn toward their target direction in one tick.
+	constexpr float max_steering_angle = 0.1f;
+
+	/// Distance which agents travel in one tick.
+	constexpr float agent_step = 0.05f;
+
+	/// Agent heading to a common goal.
+	struct agent
+	{
+		u32 face;
+		math::fvec3 position;
+		math::fvec3 direction;
+	};
+
+	/// Agent wandering over the navmesh surface.
+	struct wanderer
+	{
+		u32 face;
+		math::fvec3 position;
+		math::fvec3 direction;
+		math::fvec3 surface_normal;
+	};
+
+	/// Returns `true` if a cell of the nest is solid.
+	[[nodiscard]] bool is_nest_cell_blocked(u32 x, u32 y)
+	{
+		// Walls between chambers, with a tunnel at alternating ends
+		if (x % chamber_size == chamber_size - 1)
+		{
+			const bool tunnel_at_top = (x / chamber_size) % 2;
+			return tunnel_at_top ? y < nest_size - 4 : y >= 4;
+		}
+
+		// Pillars within chambers
+		return x % 4 == 2 && y % 4 == 2;
+	}
+
+	/// Builds a navmesh mesh of chambers connected by tunnels, on gently undulating ground.
+	[[nodiscard]] std::unique_ptr<geom::brep::mesh> make_nest_mesh()
+	{
+		auto mesh_ptr = std::make_unique<geom::brep::mesh>();
+		auto& mesh = *mesh_ptr;
+		for (u32 i = 0; i < (nest_size + 1) * (nest_size + 1); ++i)
+		{
+			mesh.vertices().emplace_back();
+		}
+
+		auto& positions = static_cast<geom::brep::attribute<math::fvec3>&>(*mesh.vertices().attributes().emplace<math::fvec3>("position"));
+		for (u32 y = 0; y <= nest_size; ++y)
+		{
+			for (u32 x = 0; x <= nest_size; ++x)
+			{
+				const float fx = static_cast<float>(x);
+				const float fy = static_cast<float>(y);
+				positions[y * (nest_size + 1) + x] = {fx, fy, 0.5f * std::sin(fx * 0.1f) * std::cos(fy * 0.1f)};
+			}
+		}
+
+		for (u32 y = 0; y < nest_size; ++y)
+		{
+			for (u32 x = 0; x < nest_size; ++x)
+			{
+				if (is_nest_cell_blocked(x, y))
+				{
+					continue;
+				}
+
+				auto v00 = mesh.vertices()[y * (nest_size + 1) + x];
+				auto v10 = mesh.vertices()[y * (nest_size + 1) + x + 1];
+				auto v01 = mesh.vertices()[(y + 1) * (nest_size + 1) + x];
+				auto v11 = mesh.vertices()[(y + 1) * (nest_size + 1) + x + 1];
+
+				geom::brep::vertex* lower[] = {v00, v10, v11};
+				geom::brep::vertex* upper[] = {v00, v11, v01};
+				mesh.faces().emplace_back(lower);
+				mesh.faces().emplace_back(upper);
+			}
+		}
+
+		geom::brep::generate_vertex_normals(mesh);
+
+		return mesh_ptr;
+	}
+
+	/// Submits a batch of queries and resolves it.
+	void resolve_batch(ai::navmesh_path_service& service, const std::vector<ai::navmesh_path_request>& requests)
+	{
+		for (const auto& request: requests)
+		{
+			service.request(request);
+		}
+		service.update();
+		do_not_optimize(service.results().data());
+	}
+}
+
+int main(int, char*[])
+{
+	const auto mesh = make_nest_mesh();
+	const auto graph = std::make_shared<const ai::navmesh_graph>(*mesh);
+
+	// Queries between random points, within a chamber or to a neighboring chamber
+	std::mt19937 rng(42);
+	std::uniform_int_distribution<u32> face_distribution(0, static_cast<u32>(graph->size() - 1));
+	std::vector<ai::navmesh_path_request> requests(query_count);
+	for (auto& request: requests)
+	{
+		request.start_face = face_distribution(rng);
+		do
+		{
+			request.goal_face = face_distribution(rng);
+		}
+		while (math::distance(graph->faces()[request.start_face].centroid, graph->faces()[request.goal_face].centroid) > 1.5f * chamber_size);
+
+		request.start_point = graph->faces()[request.start_face].centroid;
+		request.goal_point = graph->faces()[request.goal_face].centroid;
+	}
+
+	const usize thread_count = std::max(std::thread::hardware_concurrency(), 1u);
+	std::println("[navmesh] {} faces, {} queries per batch, {} threads", graph->size(), query_count, thread_count);
+
+	ai::navmesh_path_service single_threaded_service(graph, 1);
+	single_threaded_service.set_cache_capacity(0);
+
+	ai::navmesh_path_service uncached_service(graph, thread_count);
+	uncached_service.set_cache_capacity(0);
+
+	ai::navmesh_path_service cached_service(graph, thread_count);
+	resolve_batch(cached_service, requests);
+
+	usize path_point_count = 0;
+	for (const auto& path: cached_service.results())
+	{
+		path_point_count += path.points.size();
+	}
+	std::println("[navmesh] {:.2f} waypoints per path", static_cast<double>(path_point_count) / static_cast<double>(query_count));
+
+	benchmark_suite suite;
+
+	suite.benchmarks.emplace_back("find_navmesh_path (queries)", query_count, [&]()
+	{
+		ai::navmesh_search search;
+		for (const auto& request: requests)
+		{
+			auto path = ai::find_navmesh_path(*graph, request, search);
+			do_not_optimize(path.points.data());
+		}
+	});
+	suite.benchmarks.emplace_back("navmesh_path_service 1 thread uncached (queries)", query_count, [&]()
+	{
+		resolve_batch(single_threaded_service, requests);
+	});
+	suite.benchmarks.emplace_back(std::format("navmesh_path_service {} threads uncached (queries)", thread_count), query_count, [&]()
+	{
+		resolve_batch(uncached_service, requests);
+	});
+	suite.benchmarks.emplace_back(std::format("navmesh_path_service {} threads cached (queries)", thread_count), query_count, [&]()
+	{
+		resolve_batch(cached_service, requests);
+	});
+
+	// Agents heading to the nest entrance
+	const u32 entrance_faces[] = {0, 1};
+	std::vector<agent> agents(agent_count);
+	for (auto& agent: agents)
+	{
+		agent.face = face_distribution(rng);
+		agent.position = graph->faces()[agent.face].centroid;
+		agent.direction = {1.0f, 0.0f, 0.0f};
+	}
+
+	ai::navmesh_flow_field_cache flow_field_cache(thread_count);
+	const auto flow_field = flow_field_cache.get(graph, entrance_faces);
+	flow_field_cache.update();
+
+	suite.benchmarks.emplace_back("navmesh_flow_field build (faces)", graph->size(), [&]()
+	{
+		ai::navmesh_flow_field field(graph, entrance_faces);
+		field.update();
+		do_not_optimize(field.directions().data());
+	});
+	suite.benchmarks.emplace_back(std::format("navmesh_flow_field steering {} agents (agents)", agent_count), agent_count, [&]()
+	{
+		for (auto& agent: agents)
+		{
+			const auto& target_direction = flow_field->direction(agent.face);
+			if (target_direction != math::fvec3{})
+			{
+				agent.direction = math::rotate_towards(agent.direction, target_direction, max_steering_angle) * agent.direction;
+			}
+		}
+		do_not_optimize(agents.data());
+	});
+	suite.benchmarks.emplace_back("per-agent pathfinding steering (agents)", pathfinding_agent_count, [&]()
+	{
+		ai::navmesh_search search;
+		for (usize i = 0; i < pathfinding_agent_count; ++i)
+		{
+			auto& agent = agents[i];
+			const auto path = ai::find_navmesh_path(*graph, {agent.face, agent.position, entrance_faces[0], graph->faces()[entrance_faces[0]].centroid}, search);
+			if (path.points.size() > 1)
+			{
+				const auto target_direction = math::normalize(path.points[1] - agent.position);
+				agent.direction = math::rotate_towards(agent.direction, target_direction, max_steering_angle) * agent.direction;
+			}
+		}
+		do_not_optimize(agents.data());
+	});
+
+	// Agents wandering the nest, turning when blocked by a wall
+	std::uniform_real_distribution<float> angle_distribution(0.0f, math::two_pi<float>);
+	std::vector<wanderer> wanderers(agent_count);
+	for (auto& wanderer: wanderers)
+	{
+		const float angle = angle_distribution(rng);
+		wanderer.face = face_distribution(rng);
+		wanderer.position = graph->faces()[wanderer.face].centroid;
+		wanderer.direction = {std::cos(angle), std::sin(angle), 0.0f};
+	}
+
+	suite.benchmarks.emplace_back(std::format("traverse_navmesh {} agents (agents)", agent_count), agent_count, [&]()
+	{
+		for (auto& wanderer: wanderers)
+		{
+			const auto traversal = ai::traverse_navmesh(*graph, wanderer.face, wanderer.position, wanderer.position + wanderer.direction * agent_step);
+			wanderer.surface_normal = ai::navmesh_surface_normal(graph->faces()[traversal.face], traversal.barycentric);
+			if (math::sqr_distance(traversal.closest_point, wanderer.position) < 1e-4f)
+			{
+				wanderer.direction = {-wanderer.direction.y(), wanderer.direction.x(), 0.0f};
+			}
+			wanderer.face = traversal.face;
+			wanderer.position = traversal.closest_point;
+		}
+		do_not_optimize(wanderers.data());
+	});
+
+	const int failed = suite.run();
+	return failed;
+}
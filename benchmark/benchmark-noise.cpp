@@ -0,0 +1,208 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "benchmark.hpp"
+#include <engine/noise/noise.hpp>
+#include <engine/math/simd/isa.hpp>
+#include <engine/math/vector.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <format>
+#include <print>
+#include <random>
+#include <vector>
+
+using namespace engine;
+using namespace engine::math::simd;
+
+namespace
+{
+	/// Number of grid samples on each axis of 2D benchmark grids.
+	constexpr u32 grid_size_2d = 64;
+
+	/// Number of grid samples on each axis of 3D benchmark grids.
+	constexpr u32 grid_size_3d = 16;
+
+	/// Number of samples processed per benchmark invocation.
+	constexpr usize sample_count = grid_size_2d * grid_size_2d;
+	static_assert(sample_count == grid_size_3d * grid_size_3d * grid_size_3d);
+
+	/// Distance between adjacent grid samples, roughly that of a texel in a generated noise texture.
+	constexpr float grid_spacing = 1.0f / 16.0f;
+
+	/// Number of fBm octaves.
+	constexpr usize octaves = 4;
+
+	/// Returns the name of an instruction set.
+	const char* get_isa_name(isa value)
+	{
+		return value == isa::avx2 ? "avx2" : "sse2";
+	}
+
+	/// Returns the positions of a grid.
+	template <usize N>
+	std::vector<math::vector<float, N>> make_grid_positions(u32 size)
+	{
+		std::vector<math::vector<float, N>> positions;
+		for (usize i = 0; i < sample_count; ++i)
+		{
+			math::vector<float, N> position;
+			usize index = i;
+			for (usize j = 0; j < N; ++j)
+			{
+				position[j] = static_cast<float>(index % size) * grid_spacing;
+				index /= size;
+			}
+			positions.emplace_back(position);
+		}
+		return positions;
+	}
+
+	/// Returns scattered random positions.
+	template <usize N>
+	std::vector<math::vector<float, N>> make_random_positions(std::mt19937& rng)
+	{
+		std::uniform_real_distribution<float> distribution(-100.0f, 100.0f);
+		std::vector<math::vector<float, N>> positions(sample_count);
+		for (auto& position: positions)
+		{
+			for (usize j = 0; j < N; ++j)
+			{
+				position[j] = distribution(rng);
+			}
+		}
+		return positions;
+	}
+}
+
+int main(int, char*[])
+{
+	std::mt19937 rng(42);
+
+	const auto grid_2d = make_grid_positions<2>(grid_size_2d);
+	const auto grid_3d = make_grid_positions<3>(grid_size_3d);
+	const auto random_2d = make_random_positions<2>(rng);
+	const auto random_3d = make_random_positions<3>(rng);
+	const math::uvec2 size_2d{grid_size_2d, grid_size_2d};
+	const math::uvec3 size_3d{grid_size_3d, grid_size_3d, grid_size_3d};
+	const math::fvec2 spacing_2d{grid_spacing, grid_spacing};
+	const math::fvec3 spacing_3d{grid_spacing, grid_spacing, grid_spacing};
+
+	std::vector<float> values(sample_count);
+	std::vector<u32> ids(sample_count);
+
+	benchmark_suite suite;
+
+	// Scalar loops
+	suite.benchmarks.emplace_back("scalar simplex 2d (samples)", sample_count, [&]()
+	{
+		for (usize i = 0; i < sample_count; ++i)
+		{
+			values[i] = noise::simplex<float, 2>(grid_2d[i]);
+		}
+		do_not_optimize(values.data());
+	});
+	suite.benchmarks.emplace_back("scalar simplex 3d (samples)", sample_count, [&]()
+	{
+		for (usize i = 0; i < sample_count; ++i)
+		{
+			values[i] = noise::simplex<float, 3>(grid_3d[i]);
+		}
+		do_not_optimize(values.data());
+	});
+	suite.benchmarks.emplace_back("scalar fbm 2d (samples)", sample_count, [&]()
+	{
+		for (usize i = 0; i < sample_count; ++i)
+		{
+			values[i] = noise::fbm<float, 2>(grid_2d[i], octaves, 2.0f, 0.5f);
+		}
+		do_not_optimize(values.data());
+	});
+	suite.benchmarks.emplace_back("scalar voronoi_f1 2d (samples)", sample_count, [&]()
+	{
+		for (usize i = 0; i < sample_count; ++i)
+		{
+			ids[i] = std::get<2>(noise::voronoi_f1<float, 2>(grid_2d[i]));
+		}
+		do_not_optimize(ids.data());
+	});
+	suite.benchmarks.emplace_back("scalar voronoi_f1 3d (samples)", sample_count, [&]()
+	{
+		for (usize i = 0; i < sample_count; ++i)
+		{
+			ids[i] = std::get<2>(noise::voronoi_f1<float, 3>(grid_3d[i]));
+		}
+		do_not_optimize(ids.data());
+	});
+
+	// Batch functions, for each supported instruction set
+	std::vector<isa> isas{isa::sse2};
+	if (get_supported_isa() == isa::avx2)
+	{
+		isas.emplace_back(isa::avx2);
+	}
+	for (const auto value: isas)
+	{
+		const auto name = get_isa_name(value);
+
+		suite.benchmarks.emplace_back(std::format("{} simplex 2d random (samples)", name), sample_count, [&, value]()
+		{
+			set_isa(value);
+			noise::batch::simplex(random_2d, values);
+			do_not_optimize(values.data());
+		});
+		suite.benchmarks.emplace_back(std::format("{} simplex 2d grid (samples)", name), sample_count, [&, value]()
+		{
+			set_isa(value);
+			noise::batch::simplex_grid({}, spacing_2d, size_2d, values);
+			do_not_optimize(values.data());
+		});
+		suite.benchmarks.emplace_back(std::format("{} simplex 3d random (samples)", name), sample_count, [&, value]()
+		{
+			set_isa(value);
+			noise::batch::simplex(random_3d, values);
+			do_not_optimize(values.data());
+		});
+		suite.benchmarks.emplace_back(std::format("{} simplex 3d grid (samples)", name), sample_count, [&, value]()
+		{
+			set_isa(value);
+			noise::batch::simplex_grid({}, spacing_3d, size_3d, values);
+			do_not_optimize(values.data());
+		});
+		suite.benchmarks.emplace_back(std::format("{} fbm 2d grid (samples)", name), sample_count, [&, value]()
+		{
+			set_isa(value);
+			noise::batch::fbm_grid({}, spacing_2d, size_2d, octaves, 2.0f, 0.5f, values);
+			do_not_optimize(values.data());
+		});
+		suite.benchmarks.emplace_back(std::format("{} voronoi_f1 2d random (samples)", name), sample_count, [&, value]()
+		{
+			set_isa(value);
+			noise::batch::voronoi_f1(random_2d, 1.0f, {}, {}, {}, ids);
+			do_not_optimize(ids.data());
+		});
+		suite.benchmarks.emplace_back(std::format("{} voronoi_f1 2d grid (samples)", name), sample_count, [&, value]()
+		{
+			set_isa(value);
+			noise::batch::voronoi_f1_grid({}, spacing_2d, size_2d, 1.0f, {}, {}, {}, ids);
+			do_not_optimize(ids.data());
+		});
+		suite.benchmarks.emplace_back(std::format("{} voronoi_f1 3d random (samples)", name), sample_count, [&, value]()
+		{
+			set_isa(value);
+			noise::batch::voronoi_f1(random_3d, 1.0f, {}, {}, {}, ids);
+			do_not_optimize(ids.data());
+		});
+		suite.benchmarks.emplace_back(std::format("{} voronoi_f1 3d grid (samples)", name), sample_count, [&, value]()
+		{
+			set_isa(value);
+			noise::batch::voronoi_f1_grid({}, spacing_3d, size_3d, 1.0f, {}, {}, {}, ids);
+			do_not_optimize(ids.data());
+		});
+	}
+
+	const int failed = suite.run();
+
+	std::println("[noise] supported instruction set: {}", get_isa_name(get_supported_isa()));
+
+	return failed;
+}
@@ -0,0 +1,156 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "benchmark.hpp"
+#include <engine/ai/pheromone-field.hpp>
+#include <engine/math/simd/isa.hpp>
+#include <engine/math/vector.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <format>
+#include <print>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace engine;
+using namespace engine::math::simd;
+
+namespace
+{
+	/// Number of cells on each horizontal axis of the field.
+	constexpr u32 field_size = 512;
+
+	/// Number of cells on the vertical axis of the field.
+	constexpr u32 field_height = 32;
+
+	/// Number of foraging trails radiating from the nest.
+	constexpr usize trail_count = 64;
+
+	/// Number of foragers depositing trail pheromone.
+	constexpr usize agent_count = 10000;
+
+	/// Fixed timestep, in seconds.
+	constexpr float timestep = 1.0f / 60.0f;
+
+	/// Number of warm-up updates, after which the number of allocated tiles is roughly stable.
+	constexpr usize warm_up_update_count = 240;
+
+	/// Returns the name of an instruction set.
+	const char* get_isa_name(isa value)
+	{
+		return value == isa::avx2 ? "avx2" : "sse2";
+	}
+
+	/// Foragers spread along trails between the nest and food sources.
+	struct colony
+	{
+		std::vector<math::fvec3> positions;
+		std::vector<math::fvec3> velocities;
+	};
+
+	[[nodiscard]] colony make_colony(std::mt19937& rng)
+	{
+		const math::fvec3 nest{field_size * 0.5f, field_size * 0.5f, field_height * 0.5f};
+
+		std::uniform_real_distribution<float> unit_distribution(0.0f, 1.0f);
+		std::vector<math::fvec3> food_sources;
+		for (usize i = 0; i < trail_count; ++i)
+		{
+			const float angle = unit_distribution(rng) * 6.2831853f;
+			const float distance = (0.2f + 0.25f * unit_distribution(rng)) * field_size;
+			food_sources.emplace_back(nest + math::fvec3{std::cos(angle) * distance, std::sin(angle) * distance, 0.0f});
+		}
+
+		colony result;
+		for (usize i = 0; i < agent_count; ++i)
+		{
+			const auto& food = food_sources[i % trail_count];
+			const float t = unit_distribution(rng);
+			result.positions.emplace_back(nest + (food - nest) * t);
+			result.velocities.emplace_back((food - nest) * ((i & 1) ? 0.05f : -0.05f));
+		}
+		return result;
+	}
+
+	/// Moves foragers along their trails, and deposits trail pheromone at their positions.
+	void step_colony(colony& colony, ai::pheromone_field& field)
+	{
+		for (usize i = 0; i < colony.positions.size(); ++i)
+		{
+			auto& position = colony.positions[i];
+			position += colony.velocities[i] * timestep;
+			field.deposit(0, position, 1.0f);
+			if (i % 64 == 0)
+			{
+				field.deposit(1, position, 4.0f);
+			}
+		}
+	}
+}
+
+int main(int, char*[])
+{
+	std::mt19937 rng(42);
+
+	// Trail, alarm, and recruitment pheromones
+	const ai::pheromone_channel channels[] =
+	{
+		{0.5f, 0.05f},
+		{4.0f, 0.5f},
+		{1.0f, 0.2f}
+	};
+
+	const usize thread_count = std::max(std::thread::hardware_concurrency(), 1u);
+	const usize field_cell_count = static_cast<usize>(field_size) * field_size * field_height * std::size(channels);
+
+	benchmark_suite suite;
+
+	std::vector<isa> isas{isa::sse2};
+	if (get_supported_isa() == isa::avx2)
+	{
+		isas.emplace_back(isa::avx2);
+	}
+
+	for (const auto value: isas)
+	{
+		set_isa(value);
+
+		// Field and colony state persist across benchmark invocations, so the field remains near its steady state
+		auto field = std::make_shared<ai::pheromone_field>(math::fvec3{}, 1.0f, math::uvec3{field_size, field_size, field_height}, channels, thread_count);
+		auto colony = std::make_shared<::colony>(make_colony(rng));
+		for (usize i = 0; i < warm_up_update_count; ++i)
+		{
+			step_colony(*colony, *field);
+			field->update(timestep);
+		}
+
+		const usize updated_cell_count = field->get_updated_cell_count();
+		std::println("[pheromone] {}: {} of {} tiles allocated, {} of {} cells updated per step ({} threads)", get_isa_name(value), field->get_tile_count(), field_cell_count / std::size(channels) / ai::pheromone_field::tile_cell_count, updated_cell_count, field_cell_count, thread_count);
+
+		suite.benchmarks.emplace_back(std::format("{} pheromone_field update (cells)", get_isa_name(value)), updated_cell_count, [field, colony, value]()
+		{
+			set_isa(value);
+			step_colony(*colony, *field);
+			field->update(timestep);
+		});
+
+		if (value == isa::sse2)
+		{
+			suite.benchmarks.emplace_back(std::format("pheromone_field sample and gradient {} agents (agents)", agent_count), agent_count, [field, colony]()
+			{
+				math::fvec3 sum{};
+				for (const auto& position: colony->positions)
+				{
+					sum += field->gradient(0, position) * field->sample(0, position);
+				}
+				do_not_optimize(sum);
+			});
+		}
+	}
+
+	const int failed = suite.run();
+
+	set_isa(get_supported_isa());
+
+	return failed;
+}
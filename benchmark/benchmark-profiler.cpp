@@ -0,0 +1,75 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "benchmark.hpp"
+#include <engine/debug/profiler.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <print>
+#include <vector>
+
+using namespace engine;
+
+namespace
+{
+	/// Number of scopes per benchmark invocation. Collected after each invocation, as the game does after each frame.
+	constexpr usize batch_size = 4096;
+}
+
+int main(int, char*[])
+{
+	auto& profiler = debug::default_profiler();
+	std::vector<debug::profile_event> events;
+	events.reserve(batch_size);
+	usize collected_count = 0;
+
+	std::println("[profiler] profile scopes compiled {}", debug::g_profiler_enabled ? "in" : "out");
+
+	benchmark_suite suite;
+
+	suite.benchmarks.emplace_back("profile_scope (disabled)", batch_size, [&]()
+	{
+		profiler.set_enabled(false);
+		for (usize i = 0; i < batch_size; ++i)
+		{
+			debug::profile_scope scope("disabled");
+		}
+	});
+
+	suite.benchmarks.emplace_back("profile_scope (enabled) + collect", batch_size, [&]()
+	{
+		profiler.set_enabled(true);
+		for (usize i = 0; i < batch_size; ++i)
+		{
+			debug::profile_scope scope("enabled");
+		}
+		profiler.set_enabled(false);
+
+		events.clear();
+		collected_count += profiler.collect(events);
+	});
+
+	suite.benchmarks.emplace_back("profile_scope (enabled, nested) + collect", batch_size, [&]()
+	{
+		profiler.set_enabled(true);
+		for (usize i = 0; i < batch_size; i += 4)
+		{
+			debug::profile_scope a("a");
+			{
+				debug::profile_scope b("b");
+				{
+					debug::profile_scope c("c");
+					debug::profile_scope d("d");
+				}
+			}
+		}
+		profiler.set_enabled(false);
+
+		events.clear();
+		collected_count += profiler.collect(events);
+	});
+
+	const int failed = suite.run();
+	do_not_optimize(collected_count);
+
+	return failed;
+}
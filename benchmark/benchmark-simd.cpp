@@ -0,0 +1,152 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "benchmark.hpp"
+#include <engine/math/simd/batch.hpp>
+#include <engine/math/simd/isa.hpp>
+#include <engine/math/matrix.hpp>
+#include <engine/math/quaternion.hpp>
+#include <engine/math/vector.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <format>
+#include <print>
+#include <random>
+#include <vector>
+
+using namespace engine;
+using namespace engine::math::simd;
+
+namespace
+{
+	/// Number of elements processed per benchmark invocation.
+	constexpr usize element_count = 4096;
+
+	/// Returns the name of an instruction set.
+	const char* get_isa_name(isa value)
+	{
+		return value == isa::avx2 ? "avx2" : "sse2";
+	}
+}
+
+int main(int, char*[])
+{
+	std::mt19937 rng(42);
+	std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+	std::vector<math::fmat4> matrices(element_count);
+	std::vector<math::fmat4> other_matrices(element_count);
+	std::vector<math::fmat4> matrix_results(element_count);
+	std::vector<math::fquat> rotations(element_count);
+	std::vector<math::fquat> other_rotations(element_count);
+	std::vector<math::fquat> rotation_results(element_count);
+	std::vector<math::fvec3> vectors(element_count);
+	std::vector<math::fvec3> vector_results(element_count);
+	for (usize i = 0; i < element_count; ++i)
+	{
+		for (usize j = 0; j < 4; ++j)
+		{
+			for (usize k = 0; k < 4; ++k)
+			{
+				matrices[i][j][k] = distribution(rng);
+				other_matrices[i][j][k] = distribution(rng);
+			}
+		}
+		rotations[i] = math::normalize(math::fquat{distribution(rng), distribution(rng), distribution(rng), distribution(rng)});
+		other_rotations[i] = math::normalize(math::fquat{distribution(rng), distribution(rng), distribution(rng), distribution(rng)});
+		vectors[i] = {distribution(rng), distribution(rng), distribution(rng)};
+	}
+
+	benchmark_suite suite;
+
+	// Scalar loops
+	suite.benchmarks.emplace_back("scalar transform_points (points)", element_count, [&]()
+	{
+		for (usize i = 0; i < element_count; ++i)
+		{
+			const auto& v = vectors[i];
+			const auto p = matrices[i] * math::fvec4{v[0], v[1], v[2], 1.0f};
+			vector_results[i] = {p[0], p[1], p[2]};
+		}
+		do_not_optimize(vector_results.data());
+	});
+	suite.benchmarks.emplace_back("scalar multiply_matrices (matrices)", element_count, [&]()
+	{
+		for (usize i = 0; i < element_count; ++i)
+		{
+			matrix_results[i] = matrices[i] * other_matrices[i];
+		}
+		do_not_optimize(matrix_results.data());
+	});
+	suite.benchmarks.emplace_back("scalar multiply_quaternions (quaternions)", element_count, [&]()
+	{
+		for (usize i = 0; i < element_count; ++i)
+		{
+			rotation_results[i] = rotations[i] * other_rotations[i];
+		}
+		do_not_optimize(rotation_results.data());
+	});
+	suite.benchmarks.emplace_back("scalar rotate_vectors (vectors)", element_count, [&]()
+	{
+		for (usize i = 0; i < element_count; ++i)
+		{
+			vector_results[i] = rotations[i] * vectors[i];
+		}
+		do_not_optimize(vector_results.data());
+	});
+	suite.benchmarks.emplace_back("scalar normalize_vectors (vectors)", element_count, [&]()
+	{
+		for (usize i = 0; i < element_count; ++i)
+		{
+			vector_results[i] = math::normalize(vectors[i]);
+		}
+		do_not_optimize(vector_results.data());
+	});
+
+	// Batch functions, for each supported instruction set
+	std::vector<isa> isas{isa::sse2};
+	if (get_supported_isa() == isa::avx2)
+	{
+		isas.emplace_back(isa::avx2);
+	}
+	for (const auto value: isas)
+	{
+		const auto name = get_isa_name(value);
+
+		suite.benchmarks.emplace_back(std::format("{} transform_points (points)", name), element_count, [&, value]()
+		{
+			set_isa(value);
+			batch::transform_points(matrices, vectors, vector_results);
+			do_not_optimize(vector_results.data());
+		});
+		suite.benchmarks.emplace_back(std::format("{} multiply_matrices (matrices)", name), element_count, [&, value]()
+		{
+			set_isa(value);
+			batch::multiply_matrices(matrices, other_matrices, matrix_results);
+			do_not_optimize(matrix_results.data());
+		});
+		suite.benchmarks.emplace_back(std::format("{} multiply_quaternions (quaternions)", name), element_count, [&, value]()
+		{
+			set_isa(value);
+			batch::multiply_quaternions(rotations, other_rotations, rotation_results);
+			do_not_optimize(rotation_results.data());
+		});
+		suite.benchmarks.emplace_back(std::format("{} rotate_vectors (vectors)", name), element_count, [&, value]()
+		{
+			set_isa(value);
+			batch::rotate_vectors(rotations, vectors, vector_results);
+			do_not_optimize(vector_results.data());
+		});
+		suite.benchmarks.emplace_back(std::format("{} normalize_vectors (vectors)", name), element_count, [&, value]()
+		{
+			set_isa(value);
+			batch::normalize_vectors(vectors, vector_results);
+			do_not_optimize(vector_results.data());
+		});
+	}
+
+	const int failed = suite.run();
+
+	std::println("[simd] supported instruction set: {}", get_isa_name(get_supported_isa()));
+
+	return failed;
+}
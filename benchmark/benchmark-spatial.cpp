@@ -0,0 +1,144 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "benchmark.hpp"
+#include <engine/ai/steering/agent.hpp>
+#include <engine/ai/steering/behavior/alignment.hpp>
+#include <engine/ai/steering/behavior/cohesion.hpp>
+#include <engine/ai/steering/behavior/separation.hpp>
+#include <engine/geom/spatial-grid.hpp>
+#include <engine/math/vector.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <engine/utility/worker-pool.hpp>
+#include <format>
+#include <print>
+#include <random>
+#include <vector>
+
+using namespace engine;
+
+namespace
+{
+	/// Number of agents.
+	constexpr usize agent_count = 100000;
+
+	/// Edge length of the cube in which agents are scattered, chosen so that agents have about 20 neighbors within the query radius.
+	constexpr float world_size = 28.0f;
+
+	/// Radius of neighbor queries.
+	constexpr float query_radius = 1.0f;
+
+	/// Number of queries answered by brute force.
+	constexpr usize brute_force_query_count = 1000;
+
+	/// Number of nearest neighbors found by k-nearest queries.
+	constexpr usize neighbor_count = 8;
+}
+
+int main(int, char*[])
+{
+	// Scatter agents
+	std::mt19937 rng(42);
+	std::uniform_real_distribution<float> position_distribution(0.0f, world_size);
+	std::uniform_real_distribution<float> velocity_distribution(-1.0f, 1.0f);
+	std::vector<ai::steering::agent> agents(agent_count);
+	std::vector<math::fvec3> positions(agent_count);
+	for (usize i = 0; i < agent_count; ++i)
+	{
+		auto& agent = agents[i];
+		agent.position = {position_distribution(rng), position_distribution(rng), position_distribution(rng)};
+		agent.velocity = {velocity_distribution(rng), velocity_distribution(rng), velocity_distribution(rng)};
+		agent.max_force = 1.0f;
+		positions[i] = agent.position;
+	}
+
+	geom::spatial_grid grid(query_radius);
+	grid.build(positions);
+
+	std::vector<u32> neighbors;
+	usize total_neighbor_count = 0;
+	for (usize i = 0; i < agent_count; ++i)
+	{
+		neighbors.clear();
+		grid.find_in_radius(positions[i], query_radius, neighbors);
+		total_neighbor_count += neighbors.size();
+	}
+
+	worker_pool pool;
+	std::vector<std::vector<u32>> thread_neighbors(pool.get_thread_count());
+	std::vector<math::fvec3> forces(agent_count);
+
+	std::println("[spatial] {} agents, radius {}, {:.1f} neighbors per query on average, {} threads", agent_count, query_radius, static_cast<double>(total_neighbor_count) / agent_count, pool.get_thread_count());
+
+	usize result_count = 0;
+
+	benchmark_suite suite;
+
+	suite.benchmarks.emplace_back("spatial_grid build (points)", agent_count, [&]()
+	{
+		grid.build(positions);
+		do_not_optimize(grid.size());
+	});
+	suite.benchmarks.emplace_back("brute force radius query (queries)", brute_force_query_count, [&]()
+	{
+		result_count = 0;
+		for (usize i = 0; i < brute_force_query_count; ++i)
+		{
+			for (const auto& position: positions)
+			{
+				result_count += math::sqr_distance(position, positions[i]) <= query_radius * query_radius;
+			}
+		}
+		do_not_optimize(result_count);
+	});
+	suite.benchmarks.emplace_back("spatial_grid radius query (queries)", agent_count, [&]()
+	{
+		result_count = 0;
+		for (usize i = 0; i < agent_count; ++i)
+		{
+			neighbors.clear();
+			grid.find_in_radius(positions[i], query_radius, neighbors);
+			result_count += neighbors.size();
+		}
+		do_not_optimize(result_count);
+	});
+	suite.benchmarks.emplace_back(std::format("spatial_grid radius query, {} threads (queries)", pool.get_thread_count()), agent_count, [&]()
+	{
+		pool.parallel_for(agent_count / 256, [&](usize chunk, usize thread_index)
+		{
+			auto& results = thread_neighbors[thread_index];
+			for (usize i = chunk * 256, end = i + 256; i < end; ++i)
+			{
+				results.clear();
+				grid.find_in_radius(positions[i], query_radius, results);
+			}
+		});
+		do_not_optimize(thread_neighbors.data());
+	});
+	suite.benchmarks.emplace_back(std::format("spatial_grid {}-nearest query (queries)", neighbor_count), agent_count, [&]()
+	{
+		geom::spatial_grid::neighbor nearest[neighbor_count];
+		result_count = 0;
+		for (usize i = 0; i < agent_count; ++i)
+		{
+			result_count += grid.find_nearest(positions[i], nearest);
+		}
+		do_not_optimize(result_count);
+	});
+	suite.benchmarks.emplace_back("rebuild and flock (agents)", agent_count, [&]()
+	{
+		grid.build(positions);
+		for (usize i = 0; i < agent_count; ++i)
+		{
+			neighbors.clear();
+			grid.find_in_radius(positions[i], query_radius, neighbors);
+			forces[i] = ai::steering::behavior::separation(agents[i], agents, neighbors) +
+				ai::steering::behavior::cohesion(agents[i], agents, neighbors) +
+				ai::steering::behavior::alignment(agents[i], agents, neighbors);
+		}
+		do_not_optimize(forces.data());
+	});
+
+	const int failed = suite.run();
+	return failed;
+}
@@ -0,0 +1,252 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "benchmark.hpp"
+#include <engine/i18n/packed-string-map.hpp>
+#include <engine/i18n/string-map.hpp>
+#include <engine/hash/fnv.hpp>
+#include <engine/utility/json.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <memory>
+#include <print>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace engine;
+
+namespace
+{
+	/// Parses CSV text into rows of fields.
+	[[nodiscard]] std::vector<std::vector<std::string>> parse_csv(const std::string& text)
+	{
+		std::vector<std::vector<std::string>> rows(1);
+		std::string field;
+		bool quoted = false;
+
+		for (usize i = 0; i < text.size(); ++i)
+		{
+			const char c = text[i];
+			if (quoted)
+			{
+				if (c != '"')
+				{
+					field += c;
+				}
+				else if (i + 1 < text.size() && text[i + 1] == '"')
+				{
+					field += '"';
+					++i;
+				}
+				else
+				{
+					quoted = false;
+				}
+			}
+			else if (c == '"')
+			{
+				quoted = true;
+			}
+			else if (c == ',')
+			{
+				rows.back().emplace_back(std::move(field));
+				field.clear();
+			}
+			else if (c == '\n')
+			{
+				rows.back().emplace_back(std::move(field));
+				field.clear();
+				rows.emplace_back();
+			}
+			else if (c != '\r')
+			{
+				field += c;
+			}
+		}
+
+		if (!field.empty() || !rows.back().empty())
+		{
+			rows.back().emplace_back(std::move(field));
+		}
+		else
+		{
+			rows.pop_back();
+		}
+
+		return rows;
+	}
+
+	/// Reads a file with a single read.
+	[[nodiscard]] std::pair<std::unique_ptr<std::byte[]>, usize> read_file(const std::filesystem::path& path)
+	{
+		std::ifstream stream(path, std::ios::binary | std::ios::ate);
+		const auto size = static_cast<usize>(stream.tellg());
+		auto data = std::make_unique_for_overwrite<std::byte[]>(size);
+		stream.seekg(0);
+		stream.read(reinterpret_cast<char*>(data.get()), static_cast<std::streamsize>(size));
+		return {std::move(data), size};
+	}
+
+	/// Strings of one language, in each format.
+	struct language_strings
+	{
+		std::string tag;
+		json json_map;
+		i18n::string_map string_map;
+		i18n::packed_string_map packed_map;
+	};
+}
+
+int main(int argc, char* argv[])
+{
+	const std::filesystem::path strings_path = (argc > 1) ? argv[1] : "res/localization/strings.csv";
+	if (!std::filesystem::exists(strings_path))
+	{
+		std::println("usage: {} [strings file]", argv[0]);
+		std::println("[strings] strings file \"{}\" not found, skipping", strings_path.string());
+		return 0;
+	}
+
+	// Read the string table, with keys in the first column and languages from the third column
+	std::stringstream buffer;
+	buffer << std::ifstream(strings_path, std::ios::binary).rdbuf();
+	const auto rows = parse_csv(buffer.str());
+
+	std::vector<std::string> keys;
+	std::vector<language_strings> languages;
+	for (usize i = 2; i < rows[0].size(); ++i)
+	{
+		languages.emplace_back().tag = rows[0][i];
+	}
+	for (usize i = 1; i < rows.size(); ++i)
+	{
+		const auto& row = rows[i];
+		if (row.empty() || row[0].empty())
+		{
+			continue;
+		}
+
+		keys.emplace_back(row[0]);
+		const auto key_hash = hash::fnv1a32<char>(row[0]);
+		for (usize j = 0; j < languages.size(); ++j)
+		{
+			const std::string value = (j + 2 < row.size()) ? row[j + 2] : std::string{};
+
+			// As exported by tools/strings-to-json.py and tools/strings-to-bin.py
+			languages[j].json_map[row[0]] = value.empty() ? json(nullptr) : json(value);
+			languages[j].string_map[key_hash] = value.empty() ? '$' + row[0] : value;
+		}
+	}
+
+	// Write each language in each format
+	const auto directory = std::filesystem::temp_directory_path() / "antkeeper-benchmark-strings";
+	std::filesystem::create_directories(directory);
+	usize json_size = 0;
+	usize packed_size = 0;
+	for (auto& language: languages)
+	{
+		language.packed_map = i18n::packed_string_map(language.string_map);
+
+		const auto json_text = language.json_map.dump(1, '\t', false);
+		std::ofstream(directory / std::format("strings.{}.json", language.tag), std::ios::binary).write(json_text.data(), static_cast<std::streamsize>(json_text.size()));
+		json_size += json_text.size();
+
+		const auto blob = language.packed_map.blob();
+		std::ofstream(directory / std::format("strings.{}.bin", language.tag), std::ios::binary).write(reinterpret_cast<const char*>(blob.data()), static_cast<std::streamsize>(blob.size()));
+		packed_size += blob.size();
+	}
+
+	std::println("[strings] {} languages, {} keys, {:.2f} KiB json, {:.2f} KiB packed", languages.size(), keys.size(), static_cast<double>(json_size) / 1024.0, static_cast<double>(packed_size) / 1024.0);
+
+	std::vector<hash::fnv32_t> key_hashes;
+	for (const auto& key: keys)
+	{
+		key_hashes.emplace_back(hash::fnv1a32<char>(key));
+	}
+	const usize lookup_count = keys.size() * languages.size();
+
+	benchmark_suite suite;
+
+	// Loading every language, as when switching languages
+	suite.benchmarks.emplace_back("json load (languages)", languages.size(), [&]()
+	{
+		for (const auto& language: languages)
+		{
+			auto [data, size] = read_file(directory / std::format("strings.{}.json", language.tag));
+			auto map = json::parse(reinterpret_cast<const char*>(data.get()), reinterpret_cast<const char*>(data.get()) + size, nullptr, true, true);
+			do_not_optimize(&map);
+		}
+	});
+	suite.benchmarks.emplace_back("packed_string_map load (languages)", languages.size(), [&]()
+	{
+		for (const auto& language: languages)
+		{
+			auto [data, size] = read_file(directory / std::format("strings.{}.bin", language.tag));
+			i18n::packed_string_map map(std::move(data), size);
+			do_not_optimize(&map);
+		}
+	});
+
+	// Looking up every string of every language by its key
+	suite.benchmarks.emplace_back("json lookup (lookups)", lookup_count, [&]()
+	{
+		for (const auto& language: languages)
+		{
+			for (const auto& key: keys)
+			{
+				if (auto it = language.json_map.find(key); it != language.json_map.end() && it->is_string())
+				{
+					do_not_optimize(it->get_ref<const std::string&>().data());
+				}
+			}
+		}
+	});
+	suite.benchmarks.emplace_back("string_map lookup (lookups)", lookup_count, [&]()
+	{
+		for (const auto& language: languages)
+		{
+			for (const auto& key: keys)
+			{
+				if (auto it = language.string_map.find(hash::fnv1a32<char>(key)); it != language.string_map.end())
+				{
+					do_not_optimize(it->second.data());
+				}
+			}
+		}
+	});
+	suite.benchmarks.emplace_back("packed_string_map lookup (lookups)", lookup_count, [&]()
+	{
+		for (const auto& language: languages)
+		{
+			for (const auto& key: keys)
+			{
+				if (const auto value = language.packed_map.find(hash::fnv1a32<char>(key)))
+				{
+					do_not_optimize(value->data());
+				}
+			}
+		}
+	});
+	suite.benchmarks.emplace_back("packed_string_map lookup prehashed (lookups)", lookup_count, [&]()
+	{
+		for (const auto& language: languages)
+		{
+			for (const auto key: key_hashes)
+			{
+				if (const auto value = language.packed_map.find(key))
+				{
+					do_not_optimize(value->data());
+				}
+			}
+		}
+	});
+
+	const int failed = suite.run();
+
+	std::filesystem::remove_all(directory);
+
+	return failed;
+}
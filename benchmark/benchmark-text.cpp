@@ -0,0 +1,146 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "benchmark.hpp"
+#include <engine/type/text-layout.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <algorithm>
+#include <format>
+#include <print>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+using namespace engine;
+using namespace engine::type;
+
+namespace
+{
+	constexpr usize console_line_count = 200;
+	constexpr usize console_window_count = 1000;
+
+	/// Font with the metrics of a small debug font, without a typeface or texture (null pipeline).
+	class benchmark_font
+	{
+	public:
+		benchmark_font()
+		{
+			m_metrics.linespace = 14.6f;
+
+			for (char32_t code = 0; code < 128; ++code)
+			{
+				auto& g = m_glyphs[code];
+				g.horizontal_bearings = {1.0f, 10.0f};
+				g.horizontal_advance = 8.4f;
+				g.bitmap_dimensions = {7, 11};
+				g.bitmap_position = {(code % 16) * 8, (code / 16) * 12};
+			}
+		}
+
+		[[nodiscard]] const font_metrics& get_metrics() const noexcept
+		{
+			return m_metrics;
+		}
+
+		usize cache_glyphs(std::u32string_view)
+		{
+			return 0;
+		}
+
+		[[nodiscard]] const glyph* get_cached_glyph(char32_t code) const
+		{
+			auto it = m_glyphs.find(code);
+			return it != m_glyphs.end() ? &it->second : &m_glyphs.at(0);
+		}
+
+		[[nodiscard]] math::fvec2 get_kerning(char32_t, char32_t) const
+		{
+			return {};
+		}
+
+		[[nodiscard]] math::uvec2 get_texture_dimensions() const
+		{
+			return {128, 128};
+		}
+
+	private:
+		font_metrics m_metrics{};
+		std::unordered_map<char32_t, glyph> m_glyphs;
+	};
+
+	/// Returns the number of vertices modified by the last update of a text layout, then clears its modified ranges.
+	usize take_modified_vertex_count(basic_text_layout<benchmark_font>& layout)
+	{
+		usize count = 0;
+		for (const auto& [first, last]: layout.get_modified_ranges())
+		{
+			count += last - first;
+		}
+		layout.clear_modified_ranges();
+		return count;
+	}
+}
+
+int main(int, char*[])
+{
+	benchmark_font font;
+
+	// Generate a scrolling console log, in which lines repeat with a period of `console_window_count` lines so that the last window scrolls into the first
+	std::string console_log;
+	std::vector<usize> console_line_offsets;
+	for (usize i = 0; i <= console_window_count + console_line_count; ++i)
+	{
+		const auto j = i % console_window_count;
+		console_line_offsets.emplace_back(console_log.size());
+		console_log += std::format("[{:02}:{:02}:{:02}] debug: loaded resource \"model-{}.mdl\" in {} ms\n", j / 3600 % 24, j / 60 % 60, j % 60, j, j * 7 % 100);
+	}
+	const auto console_window = [&](usize i) -> std::string_view
+	{
+		i %= console_window_count;
+		return std::string_view{console_log}.substr(console_line_offsets[i], console_line_offsets[i + console_line_count] - console_line_offsets[i]);
+	};
+
+	// Generate frame time counter strings
+	std::vector<std::string> frame_times;
+	for (usize i = 0; i < 1000; ++i)
+	{
+		frame_times.emplace_back(std::format("{:5.02f}ms / {:5.02f} FPS\nAnimation LODs: {} / {} / {} / {}", 16.0 + (i % 37) * 0.01, 1000.0 / (16.0 + (i % 37) * 0.01), 12, i % 5, 3, 0));
+	}
+
+	basic_text_layout<benchmark_font> console;
+	console.set_font(&font);
+	basic_text_layout<benchmark_font> counter;
+	counter.set_font(&font);
+
+	usize frame = 0;
+	usize modified_vertex_counts[3]{};
+	usize update_counts[3]{};
+
+	benchmark_suite suite;
+	suite.benchmarks.emplace_back(std::format("text_layout full {}-line console (lines)", console_line_count), console_line_count, [&]()
+	{
+		basic_text_layout<benchmark_font> layout;
+		layout.set_font(&font);
+		layout.set_content(console_window(frame++));
+		modified_vertex_counts[0] += take_modified_vertex_count(layout);
+		++update_counts[0];
+	});
+	suite.benchmarks.emplace_back(std::format("text_layout scroll {}-line console (lines)", console_line_count), console_line_count, [&]()
+	{
+		console.set_content(console_window(frame++));
+		modified_vertex_counts[1] += take_modified_vertex_count(console);
+		++update_counts[1];
+	});
+	suite.benchmarks.emplace_back("text_layout frame time counter (updates)", 1, [&]()
+	{
+		counter.set_content(frame_times[frame++ % frame_times.size()]);
+		modified_vertex_counts[2] += take_modified_vertex_count(counter);
+		++update_counts[2];
+	});
+	const int failed = suite.run();
+
+	std::println("[text] mean modified vertices per update: {} full, {} scroll, {} counter", modified_vertex_counts[0] / std::max<usize>(update_counts[0], 1), modified_vertex_counts[1] / std::max<usize>(update_counts[1], 1), modified_vertex_counts[2] / std::max<usize>(update_counts[2], 1));
+
+	return failed;
+}
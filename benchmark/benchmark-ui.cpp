@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "benchmark.hpp"
+#include <engine/ui/batch-builder.hpp>
+#include <engine/render/material.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <format>
+#include <memory>
+#include <print>
+#include <random>
+#include <vector>
+
+using namespace engine;
+using namespace engine::ui;
+
+namespace
+{
+	constexpr usize label_count = 2000;
+	constexpr usize characters_per_label = 12;
+	constexpr usize material_count = 3;
+	constexpr usize dirty_label_count = 20;
+
+	/// Makes a label-like batch item with one quad per character.
+	[[nodiscard]] batch_item make_label(std::mt19937& rng, std::shared_ptr<render::material> material)
+	{
+		std::uniform_real_distribution<float> position_distribution(0.0f, 1920.0f);
+
+		batch_item item;
+		item.vertex_count = characters_per_label * 6;
+		item.vertices.resize(item.vertex_count * floats_per_batch_vertex);
+		for (usize i = 0; i < item.vertex_count; ++i)
+		{
+			float* v = item.vertices.data() + i * floats_per_batch_vertex;
+			v[0] = static_cast<float>(i / 6) * 12.0f;
+			v[1] = static_cast<float>(i % 2) * 16.0f;
+			v[2] = v[0] / 2048.0f;
+			v[3] = v[1] / 2048.0f;
+			v[4] = v[5] = v[6] = v[7] = 1.0f;
+		}
+		item.translation = {position_distribution(rng), position_distribution(rng)};
+		item.material = std::move(material);
+		return item;
+	}
+}
+
+int main(int, char*[])
+{
+	std::mt19937 rng(42);
+
+	// Labels are spread over the fonts of a typical menu, with no GPU resources (null pipeline)
+	std::vector<std::shared_ptr<render::material>> materials(material_count);
+	for (auto& material: materials)
+	{
+		material = std::make_shared<render::material>();
+	}
+
+	std::vector<batch_item> labels;
+	labels.reserve(label_count);
+	for (usize i = 0; i < label_count; ++i)
+	{
+		labels.emplace_back(make_label(rng, materials[i % material_count]));
+	}
+
+	batch_builder builder;
+	for (auto& label: labels)
+	{
+		builder.insert(label);
+	}
+	builder.build();
+
+	std::println("[ui] {} labels, {} vertices: {} render operations batched, {} unbatched", label_count, builder.get_vertex_count(), builder.get_ranges().size(), label_count);
+
+	usize frame = 0;
+	usize modified_vertex_count = 0;
+
+	benchmark_suite suite;
+	suite.benchmarks.emplace_back("batch_builder::build layout (labels)", label_count, [&]()
+	{
+		// Re-inserting a label invalidates the layout of the batch
+		builder.erase(labels[frame % label_count]);
+		builder.insert(labels[frame % label_count]);
+		do_not_optimize(builder.build());
+		++frame;
+	});
+	suite.benchmarks.emplace_back("batch_builder::build all moved (labels)", label_count, [&]()
+	{
+		for (auto& label: labels)
+		{
+			label.translation.x() += 1.0f;
+			builder.invalidate(label);
+		}
+		do_not_optimize(builder.build());
+	});
+	suite.benchmarks.emplace_back(std::format("batch_builder::build {} moved (labels)", dirty_label_count), dirty_label_count, [&]()
+	{
+		for (usize i = 0; i < dirty_label_count; ++i)
+		{
+			auto& label = labels[(frame * dirty_label_count + i) % label_count];
+			label.translation.y() += 1.0f;
+			builder.invalidate(label);
+		}
+		modified_vertex_count = 0;
+		for (const auto& [first, last]: builder.build())
+		{
+			modified_vertex_count += last - first;
+		}
+		++frame;
+	});
+	suite.benchmarks.emplace_back("batch_builder::build clean (labels)", label_count, [&]()
+	{
+		do_not_optimize(builder.build());
+	});
+	const int failed = suite.run();
+
+	std::println("[ui] {} moved labels modify {} of {} vertices", dirty_label_count, modified_vertex_count, builder.get_vertex_count());
+
+	return failed;
+}
@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#if defined(_WIN32)
+	#define WIN32_LEAN_AND_MEAN
+	#include <windows.h>
+	#include <psapi.h>
+#else
+	#include <fstream>
+	#include <unistd.h>
+#endif
+#include "benchmark.hpp"
+#include <print>
+
+int benchmark_suite::run()
+{
+	int failed = 0;
+
+	for (const auto& benchmark: benchmarks)
+	{
+		try
+		{
+			using clock = std::chrono::steady_clock;
+
+			// Warm up
+			benchmark.function();
+
+			// Repeat until the minimum duration has elapsed
+			std::size_t iterations = 0;
+			const auto start = clock::now();
+			auto elapsed = std::chrono::duration<double>::zero();
+			do
+			{
+				benchmark.function();
+				++iterations;
+				elapsed = clock::now() - start;
+			}
+			while (elapsed < min_duration);
+
+			const auto items = static_cast<double>(iterations * benchmark.items);
+			std::println("[{}] {:.4g} items/s ({:.4g} ns/item)", benchmark.name, items / elapsed.count(), elapsed.count() * 1e9 / items);
+		}
+		catch (const std::exception& e)
+		{
+			std::println("[FAILED] {}: {}", benchmark.name, e.what());
+			++failed;
+		}
+		catch (...)
+		{
+			std::println("[FAILED] {}: Unknown exception.", benchmark.name);
+			++failed;
+		}
+	}
+
+	return failed;
+}
+
+std::size_t resident_memory_size()
+{
+#if defined(_WIN32)
+
+	PROCESS_MEMORY_COUNTERS counters{};
+	if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+	{
+		return counters.WorkingSetSize;
+	}
+	return 0;
+
+#else
+
+	std::size_t size_pages = 0;
+	std::size_t resident_pages = 0;
+	std::ifstream statm("/proc/self/statm");
+	if (statm >> size_pages >> resident_pages)
+	{
+		return resident_pages * static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+	}
+	return 0;
+
+#endif
+}
@@ -0,0 +1,48 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+/// Individual benchmark case.
+struct benchmark_case
+{
+	/// Name of the benchmark case.
+	std::string name;
+
+	/// Number of items processed by each invocation of the benchmark function.
+	std::size_t items{1};
+
+	/// Benchmark function.
+	std::function<void()> function;
+};
+
+/// Set of related benchmarks.
+struct benchmark_suite
+{
+	/// Runs all benchmarks in the suite, repeating each until the minimum duration has elapsed, and prints their throughput.
+	/// @return Number of failed benchmarks.
+	int run();
+
+	/// Minimum duration for which each benchmark is repeated.
+	std::chrono::duration<double> min_duration{0.5};
+
+	std::vector<benchmark_case> benchmarks;
+};
+
+/// Returns the resident memory size of the current process, in bytes, or `0` if it could not be determined.
+[[nodiscard]] std::size_t resident_memory_size();
+
+/// Prevents the compiler from optimizing away the computation of a value.
+/// @param value Value to keep.
+template <class T>
+inline void do_not_optimize(const T& value)
+{
+	static const volatile void* sink;
+	sink = &value;
+}
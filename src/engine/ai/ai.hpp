@@ -3,9 +3,16 @@
 
 #pragma once
 
-#include <engine/ai/bt.hpp>
-#include <engine/ai/steering.hpp>
+#include <engine/ai/bt/bt.hpp>
+#include <engine/ai/bt/compiled-tree.hpp>
+#include <engine/ai/bt/scheduler.hpp>
+#include <engine/ai/steering/steering.hpp>
 #include <engine/ai/navmesh.hpp>
+#include <engine/ai/navmesh-flow-field.hpp>
+#include <engine/ai/navmesh-graph.hpp>
+#include <engine/ai/navmesh-path.hpp>
+#include <engine/ai/navmesh-path-service.hpp>
+#include <engine/ai/pheromone-field.hpp>
 
 /// Artificial intelligence (AI)
 namespace engine::ai {}
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <engine/utility/sized-types.hpp>
 #include <list>
 #include <functional>
 
@@ -22,6 +23,18 @@ namespace engine::ai::bt
 		running
 	};
 
+	/// Behavior tree node types.
+	enum class node_type: u8
+	{
+		action,
+		condition,
+		inverter,
+		repeater,
+		succeeder,
+		sequence,
+		selector
+	};
+
 	/// Abstract base class for behavior tree nodes.
 	/// @tparam T Data type on which nodes operate.
 	template <class T>
@@ -35,6 +48,9 @@ namespace engine::ai::bt
 		/// Executes a node's function and returns its status.
 		/// @param context Context data on which the node will operate.
 		virtual status execute(context_type& context) const = 0;
+
+		/// Returns the node type.
+		[[nodiscard]] virtual node_type type() const noexcept = 0;
 	};
 
 	/// Behavior tree node with no children.
@@ -63,8 +79,9 @@ namespace engine::ai::bt
 	struct action: public leaf_node<T>
 	{
 		~action() override = default;
-		status execute(node<T>::context_type& context) const override;
-		using function_type = std::function<status(node<T>::context_type&)>;
+		status execute(typename node<T>::context_type& context) const override;
+		[[nodiscard]] inline node_type type() const noexcept override { return node_type::action; }
+		using function_type = std::function<status(typename node<T>::context_type&)>;
 		function_type function;
 	};
 
@@ -73,8 +90,9 @@ namespace engine::ai::bt
 	struct condition: public leaf_node<T>
 	{
 		~condition() override = default;
-		status execute(node<T>::context_type& context) const override;
-		using predicate_type = std::function<status(const node<T>::context_type&)>;
+		status execute(typename node<T>::context_type& context) const override;
+		[[nodiscard]] inline node_type type() const noexcept override { return node_type::condition; }
+		using predicate_type = std::function<bool(const typename node<T>::context_type&)>;
 		predicate_type predicate;
 	};
 
@@ -83,7 +101,8 @@ namespace engine::ai::bt
 	struct inverter: public decorator_node<T>
 	{
 		~inverter() override = default;
-		status execute(node<T>::context_type& context) const override;
+		status execute(typename node<T>::context_type& context) const override;
+		[[nodiscard]] inline node_type type() const noexcept override { return node_type::inverter; }
 	};
 
 	/// Attempts to execute a child node `n` times or until the child fails.
@@ -91,7 +110,8 @@ namespace engine::ai::bt
 	struct repeater: public decorator_node<T>
 	{
 		~repeater() override = default;
-		status execute(node<T>::context_type& context) const override;
+		status execute(typename node<T>::context_type& context) const override;
+		[[nodiscard]] inline node_type type() const noexcept override { return node_type::repeater; }
 		int n;
 	};
 
@@ -100,7 +120,8 @@ namespace engine::ai::bt
 	struct succeeder: public decorator_node<T>
 	{
 		~succeeder() override = default;
-		status execute(node<T>::context_type& context) const override;
+		status execute(typename node<T>::context_type& context) const override;
+		[[nodiscard]] inline node_type type() const noexcept override { return node_type::succeeder; }
 	};
 
 	/// Attempts to execute each child node sequentially until one fails. If all children are executed successfully, `status::success` will be returned. Otherwise if any children fail, `status::failure` will be returned.
@@ -108,7 +129,8 @@ namespace engine::ai::bt
 	struct sequence: public composite_node<T>
 	{
 		~sequence() override = default;
-		status execute(node<T>::context_type& context) const override;
+		status execute(typename node<T>::context_type& context) const override;
+		[[nodiscard]] inline node_type type() const noexcept override { return node_type::sequence; }
 	};
 
 	/// Attempts to execute each child node sequentially until one succeeds. If a child succeeds, `status::success` will be returned. Otherwise if all children fail, `status::failure` will be returned.
@@ -116,7 +138,8 @@ namespace engine::ai::bt
 	struct selector: public composite_node<T>
 	{
 		~selector() override = default;
-		status execute(node<T>::context_type& context) const override;
+		status execute(typename node<T>::context_type& context) const override;
+		[[nodiscard]] inline node_type type() const noexcept override { return node_type::selector; }
 	};
 
 	template <class T>
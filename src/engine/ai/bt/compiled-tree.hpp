@@ -0,0 +1,240 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <engine/ai/bt/bt.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <algorithm>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace engine::ai::bt
+{
+	/// Behavior tree node in a compiled node array.
+	/// @details Nodes are stored in pre-order, so the first child of a node immediately follows it and each following sibling begins where the subtree of the previous sibling ends.
+	struct compiled_node
+	{
+		/// Index one past the last node in the subtree of this node.
+		u32 end;
+
+		/// Index of the function of a leaf node, or the number of repetitions of a repeater node.
+		u32 argument;
+
+		/// Type of the node.
+		node_type type;
+	};
+
+	/// Behavior tree flattened into a contiguous node array, which can be ticked for many agents concurrently.
+	/// @tparam T Data type on which nodes operate.
+	/// @details A compiled tree holds no per-agent state. Instead, each agent keeps the index of the leaf node which was running at the end of its last tick, and sequences and selectors resume from the child which contains that leaf rather than from their first child.
+	template <class T>
+	class compiled_tree
+	{
+	public:
+		/// Data type on which nodes operate.
+		using context_type = T;
+
+		/// Action function type.
+		using action_function_type = action<T>::function_type;
+
+		/// Condition predicate type.
+		using predicate_type = condition<T>::predicate_type;
+
+		/// Index which denotes the absence of a node.
+		static constexpr u32 no_node = ~u32{0};
+
+		/// Constructs an empty compiled tree.
+		compiled_tree() noexcept = default;
+
+		/// Compiles a behavior tree.
+		/// @param root Root node of the tree. Each node must be an instance of the class in bt.hpp which matches its node type.
+		/// @exception std::invalid_argument Tree has an unsupported node type, a decorator without a child, or a leaf without a function.
+		explicit compiled_tree(const node<T>& root)
+		{
+			compile(&root);
+		}
+
+		/// Ticks the tree for one agent.
+		/// @param context Context data of the agent.
+		/// @param[in,out] running_node Index of the leaf node which was running at the end of the agent's previous tick, or compiled_tree::no_node. Updated to the leaf node which is running at the end of this tick.
+		/// @return Status of the root node.
+		status tick(context_type& context, u32& running_node) const
+		{
+			if (m_nodes.empty())
+			{
+				return status::failure;
+			}
+
+			const u32 resume_node = running_node;
+			running_node = no_node;
+
+			const auto result = execute(0, context, resume_node, running_node);
+			if (result != status::running)
+			{
+				running_node = no_node;
+			}
+
+			return result;
+		}
+
+		/// Returns the nodes of the tree, in pre-order.
+		[[nodiscard]] inline std::span<const compiled_node> nodes() const noexcept
+		{
+			return m_nodes;
+		}
+
+		/// Returns the number of nodes in the tree.
+		[[nodiscard]] inline usize size() const noexcept
+		{
+			return m_nodes.size();
+		}
+
+		/// Returns `true` if the tree has no nodes.
+		[[nodiscard]] inline bool empty() const noexcept
+		{
+			return m_nodes.empty();
+		}
+
+	private:
+		/// Appends a node and its subtree to the node array.
+		void compile(const node<T>* source)
+		{
+			if (!source)
+			{
+				throw std::invalid_argument("Behavior tree decorator has no child.");
+			}
+
+			const auto index = static_cast<u32>(m_nodes.size());
+			m_nodes.emplace_back();
+
+			const auto type = source->type();
+			u32 argument = 0;
+			switch (type)
+			{
+				case node_type::action:
+				{
+					const auto& leaf = static_cast<const action<T>&>(*source);
+					if (!leaf.function)
+					{
+						throw std::invalid_argument("Behavior tree action has no function.");
+					}
+					argument = static_cast<u32>(m_actions.size());
+					m_actions.emplace_back(leaf.function);
+					break;
+				}
+
+				case node_type::condition:
+				{
+					const auto& leaf = static_cast<const condition<T>&>(*source);
+					if (!leaf.predicate)
+					{
+						throw std::invalid_argument("Behavior tree condition has no predicate.");
+					}
+					argument = static_cast<u32>(m_predicates.size());
+					m_predicates.emplace_back(leaf.predicate);
+					break;
+				}
+
+				case node_type::repeater:
+					argument = static_cast<u32>(std::max(static_cast<const repeater<T>&>(*source).n, 0));
+					[[fallthrough]];
+
+				case node_type::inverter:
+				case node_type::succeeder:
+					compile(static_cast<const decorator_node<T>&>(*source).child);
+					break;
+
+				case node_type::sequence:
+				case node_type::selector:
+					for (const node<T>* child: static_cast<const composite_node<T>&>(*source).children)
+					{
+						compile(child);
+					}
+					break;
+
+				default:
+					throw std::invalid_argument("Unsupported behavior tree node type.");
+			}
+
+			m_nodes[index] = {static_cast<u32>(m_nodes.size()), argument, type};
+		}
+
+		/// Executes a node.
+		status execute(u32 index, context_type& context, u32 resume_node, u32& running_node) const
+		{
+			const auto& node = m_nodes[index];
+			switch (node.type)
+			{
+				case node_type::action:
+				{
+					const auto result = m_actions[node.argument](context);
+					if (result == status::running)
+					{
+						running_node = index;
+					}
+					return result;
+				}
+
+				case node_type::condition:
+					return m_predicates[node.argument](context) ? status::success : status::failure;
+
+				case node_type::inverter:
+				{
+					const auto result = execute(index + 1, context, resume_node, running_node);
+					return (result == status::success) ? status::failure : (result == status::failure) ? status::success : result;
+				}
+
+				case node_type::repeater:
+				{
+					// Repeat until the child fails or is running
+					auto result = status::success;
+					for (u32 i = 0; i < node.argument && result == status::success; ++i)
+					{
+						result = execute(index + 1, context, resume_node, running_node);
+						resume_node = no_node;
+					}
+					return result;
+				}
+
+				case node_type::succeeder:
+					execute(index + 1, context, resume_node, running_node);
+					return status::success;
+
+				case node_type::sequence:
+				case node_type::selector:
+				default:
+				{
+					// Sequences continue while children succeed, selectors while children fail
+					const auto continue_status = (node.type == node_type::sequence) ? status::success : status::failure;
+
+					// Skip children before the one which was running
+					u32 child = index + 1;
+					if (resume_node > index && resume_node < node.end)
+					{
+						while (m_nodes[child].end <= resume_node)
+						{
+							child = m_nodes[child].end;
+						}
+					}
+
+					for (; child < node.end; child = m_nodes[child].end)
+					{
+						const auto result = execute(child, context, resume_node, running_node);
+						if (result != continue_status)
+						{
+							return result;
+						}
+					}
+
+					return continue_status;
+				}
+			}
+		}
+
+		std::vector<compiled_node> m_nodes;
+		std::vector<action_function_type> m_actions;
+		std::vector<predicate_type> m_predicates;
+	};
+}
@@ -0,0 +1,209 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <engine/ai/bt/compiled-tree.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <engine/utility/worker-pool.hpp>
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace engine::ai::bt
+{
+	/// Ticks the behavior trees of many agents, in parallel and in time slices.
+	/// @tparam T Data type on which nodes operate, which serves as the blackboard of an agent.
+	/// @details Agent blackboards and running states are stored in contiguous arrays, and agents reference their compiled tree by index. Each update ticks a budgeted number of agents in round-robin order, so that every agent is ticked once per `ceil(agent_count / budget)` updates.
+	/// @warning Agents are ticked concurrently. Tree functions must only modify the blackboard of the agent on which they operate.
+	template <class T>
+	class scheduler
+	{
+	public:
+		/// Data type on which nodes operate.
+		using context_type = T;
+
+		/// Compiled tree type.
+		using tree_type = compiled_tree<T>;
+
+		/// Constructs a scheduler.
+		/// @param thread_count Number of threads which tick agents, including the calling thread. If `0`, the number of hardware threads will be used.
+		explicit scheduler(usize thread_count = 0):
+			m_pool(thread_count)
+		{}
+
+		/// Adds a tree which agents can run.
+		/// @param tree Compiled tree.
+		/// @return Index of the tree.
+		/// @exception std::invalid_argument Tree is `nullptr`.
+		u32 add_tree(std::shared_ptr<const tree_type> tree)
+		{
+			if (!tree)
+			{
+				throw std::invalid_argument("Behavior tree is null.");
+			}
+
+			m_trees.emplace_back(std::move(tree));
+			return static_cast<u32>(m_trees.size() - 1);
+		}
+
+		/// Adds an agent.
+		/// @param tree Index of the tree which the agent runs.
+		/// @param context Blackboard of the agent.
+		/// @return Index of the agent.
+		/// @exception std::out_of_range Invalid tree index.
+		usize add_agent(u32 tree, context_type context)
+		{
+			if (tree >= m_trees.size())
+			{
+				throw std::out_of_range("Behavior tree index out of range.");
+			}
+
+			m_contexts.emplace_back(std::move(context));
+			m_states.push_back({tree, tree_type::no_node, status::success});
+			return m_contexts.size() - 1;
+		}
+
+		/// Removes an agent by moving the last agent into its place.
+		/// @param index Index of the agent to remove. The last agent takes this index.
+		void remove_agent(usize index)
+		{
+			if (index != m_contexts.size() - 1)
+			{
+				m_contexts[index] = std::move(m_contexts.back());
+				m_states[index] = m_states.back();
+			}
+			m_contexts.pop_back();
+			m_states.pop_back();
+			m_cursor = m_contexts.empty() ? 0 : m_cursor % m_contexts.size();
+		}
+
+		/// Changes the tree which an agent runs. The agent starts the new tree from its root.
+		/// @param index Index of the agent.
+		/// @param tree Index of the tree.
+		/// @exception std::out_of_range Invalid tree index.
+		void set_agent_tree(usize index, u32 tree)
+		{
+			if (tree >= m_trees.size())
+			{
+				throw std::out_of_range("Behavior tree index out of range.");
+			}
+
+			m_states[index] = {tree, tree_type::no_node, status::success};
+		}
+
+		/// Removes all agents and trees.
+		void clear()
+		{
+			m_trees.clear();
+			m_contexts.clear();
+			m_states.clear();
+			m_cursor = 0;
+		}
+
+		/// Ticks agents which are next in round-robin order.
+		/// @param max_agent_count Maximum number of agents to tick.
+		/// @return Number of agents ticked.
+		usize update(usize max_agent_count = std::numeric_limits<usize>::max())
+		{
+			const usize agent_count = m_contexts.size();
+			const usize tick_count = std::min(max_agent_count, agent_count);
+			if (!tick_count)
+			{
+				return 0;
+			}
+
+			const usize first = m_cursor;
+			const usize chunk_count = (tick_count + chunk_size - 1) / chunk_size;
+			m_pool.parallel_for
+			(
+				chunk_count,
+				[&](usize chunk, usize)
+				{
+					const usize begin = chunk * chunk_size;
+					const usize end = std::min(begin + chunk_size, tick_count);
+					for (usize i = begin; i < end; ++i)
+					{
+						usize index = first + i;
+						if (index >= agent_count)
+						{
+							index -= agent_count;
+						}
+
+						auto& state = m_states[index];
+						state.last_status = m_trees[state.tree]->tick(m_contexts[index], state.running_node);
+					}
+				}
+			);
+
+			m_cursor = (first + tick_count) % agent_count;
+			return tick_count;
+		}
+
+		/// Returns the blackboard of an agent.
+		/// @param index Index of the agent.
+		[[nodiscard]] inline context_type& context(usize index) noexcept
+		{
+			return m_contexts[index];
+		}
+
+		/// @copydoc context(usize)
+		[[nodiscard]] inline const context_type& context(usize index) const noexcept
+		{
+			return m_contexts[index];
+		}
+
+		/// Returns the blackboards of all agents.
+		[[nodiscard]] inline std::span<context_type> contexts() noexcept
+		{
+			return m_contexts;
+		}
+
+		/// Returns the status of the root node of an agent's tree at the end of its last tick, or status::success if the agent has not been ticked.
+		/// @param index Index of the agent.
+		[[nodiscard]] inline status get_status(usize index) const noexcept
+		{
+			return m_states[index].last_status;
+		}
+
+		/// Returns the index of the tree which an agent runs.
+		/// @param index Index of the agent.
+		[[nodiscard]] inline u32 get_agent_tree(usize index) const noexcept
+		{
+			return m_states[index].tree;
+		}
+
+		/// Returns the number of agents.
+		[[nodiscard]] inline usize size() const noexcept
+		{
+			return m_contexts.size();
+		}
+
+		/// Returns the number of threads which tick agents, including the calling thread.
+		[[nodiscard]] inline usize get_thread_count() const noexcept
+		{
+			return m_pool.get_thread_count();
+		}
+
+	private:
+		/// Running state of an agent.
+		struct agent_state
+		{
+			u32 tree;
+			u32 running_node;
+			status last_status;
+		};
+
+		/// Number of agents ticked by a thread at a time.
+		static constexpr usize chunk_size = 256;
+
+		std::vector<std::shared_ptr<const tree_type>> m_trees;
+		std::vector<context_type> m_contexts;
+		std::vector<agent_state> m_states;
+		usize m_cursor{0};
+		worker_pool m_pool;
+	};
+}
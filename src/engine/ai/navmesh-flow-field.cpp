@@ -0,0 +1,151 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <engine/ai/navmesh-flow-field.hpp>
+#include <engine/math/functions.hpp>
+#include <algorithm>
+
+namespace engine::ai
+{
+	namespace
+	{
+		/// Orders open list nodes so the nearest node is at the front of a heap.
+		struct node_compare
+		{
+			template <class T>
+			[[nodiscard]] inline bool operator()(const T& a, const T& b) const noexcept
+			{
+				return a.distance > b.distance;
+			}
+		};
+	}
+
+	navmesh_flow_field::navmesh_flow_field(std::shared_ptr<const navmesh_graph> graph, std::span<const u32> goal_faces):
+		m_graph(std::move(graph)),
+		m_goal_faces(goal_faces.begin(), goal_faces.end())
+	{
+		const usize face_count = m_graph->size();
+		m_directions.assign(face_count, math::fvec3{});
+		m_distances.assign(face_count, std::numeric_limits<float>::infinity());
+		m_settled.assign(face_count, false);
+
+		for (const auto face: m_goal_faces)
+		{
+			if (face < face_count && m_distances[face] != 0.0f)
+			{
+				m_distances[face] = 0.0f;
+				m_open.emplace_back(0.0f, face);
+			}
+		}
+	}
+
+	bool navmesh_flow_field::update(usize max_face_count)
+	{
+		const auto faces = m_graph->faces();
+
+		for (usize settled_count = 0; settled_count < max_face_count && !m_open.empty();)
+		{
+			std::pop_heap(m_open.begin(), m_open.end(), node_compare{});
+			const auto current = m_open.back();
+			m_open.pop_back();
+
+			// Skip nodes which have been superseded by a shorter distance
+			if (m_settled[current.face])
+			{
+				continue;
+			}
+			m_settled[current.face] = true;
+			++settled_count;
+
+			const auto& face = faces[current.face];
+			math::fvec3 direction{};
+			for (const auto neighbor: face.neighbors)
+			{
+				if (neighbor == navmesh_graph::no_face)
+				{
+					continue;
+				}
+
+				const auto offset = faces[neighbor].centroid - face.centroid;
+				const float length = math::length(offset);
+
+				if (m_settled[neighbor])
+				{
+					// Descend toward settled neighbors, weighted by slope
+					if (m_distances[neighbor] < current.distance)
+					{
+						direction += offset * ((current.distance - m_distances[neighbor]) / (length * length));
+					}
+				}
+				else if (const float distance = current.distance + length; distance < m_distances[neighbor])
+				{
+					m_distances[neighbor] = distance;
+					m_open.emplace_back(distance, neighbor);
+					std::push_heap(m_open.begin(), m_open.end(), node_compare{});
+				}
+			}
+
+			// Project direction onto the face
+			direction -= face.normal * math::dot(direction, face.normal);
+			if (const float sqr_length = math::sqr_length(direction); sqr_length > 0.0f)
+			{
+				m_directions[current.face] = direction / math::sqrt(sqr_length);
+			}
+		}
+
+		// Discard stale nodes, so the field is complete once every reachable face is settled
+		while (!m_open.empty() && m_settled[m_open.front().face])
+		{
+			std::pop_heap(m_open.begin(), m_open.end(), node_compare{});
+			m_open.pop_back();
+		}
+
+		return is_complete();
+	}
+
+	navmesh_flow_field_cache::navmesh_flow_field_cache(usize thread_count):
+		m_pool(thread_count)
+	{}
+
+	std::shared_ptr<const navmesh_flow_field> navmesh_flow_field_cache::get(const std::shared_ptr<const navmesh_graph>& graph, std::span<const u32> goal_faces)
+	{
+		std::vector<u32> sorted_goal_faces(goal_faces.begin(), goal_faces.end());
+		std::sort(sorted_goal_faces.begin(), sorted_goal_faces.end());
+		sorted_goal_faces.erase(std::unique(sorted_goal_faces.begin(), sorted_goal_faces.end()), sorted_goal_faces.end());
+
+		auto& field = m_fields[{graph.get(), sorted_goal_faces}];
+		if (!field)
+		{
+			field = std::make_shared<navmesh_flow_field>(graph, sorted_goal_faces);
+		}
+
+		return field;
+	}
+
+	void navmesh_flow_field_cache::update(usize max_face_count)
+	{
+		m_incomplete_fields.clear();
+		for (const auto& [key, field]: m_fields)
+		{
+			if (!field->is_complete())
+			{
+				m_incomplete_fields.emplace_back(field.get());
+			}
+		}
+
+		m_pool.parallel_for(m_incomplete_fields.size(), [&](usize i, usize)
+		{
+			m_incomplete_fields[i]->update(max_face_count);
+		});
+	}
+
+	void navmesh_flow_field_cache::remove_unused()
+	{
+		std::erase_if(m_fields, [](const auto& pair){return pair.second.use_count() == 1;});
+	}
+
+	void navmesh_flow_field_cache::clear()
+	{
+		m_fields.clear();
+	}
+}
@@ -0,0 +1,133 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <engine/ai/navmesh-graph.hpp>
+#include <engine/math/vector.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <engine/utility/worker-pool.hpp>
+#include <limits>
+#include <map>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace engine::ai
+{
+	/// Per-face field of directions toward the nearest of a set of goal faces, shared by every agent heading to those goals.
+	/// @details Distances are propagated outward from the goal faces with Dijkstra's algorithm over face centroids. When a face is settled, its direction is the slope-weighted average of the directions toward its settled neighbors, projected onto the face. As every neighbor nearer to the goals has been settled by then, the field can be built incrementally over several updates.
+	class navmesh_flow_field
+	{
+	public:
+		/// Constructs an empty flow field.
+		navmesh_flow_field() noexcept = default;
+
+		/// Constructs a flow field toward a set of goal faces. The field is built by update().
+		/// @param graph Navmesh graph.
+		/// @param goal_faces Indices of the goal faces.
+		navmesh_flow_field(std::shared_ptr<const navmesh_graph> graph, std::span<const u32> goal_faces);
+
+		/// Continues building the flow field.
+		/// @param max_face_count Maximum number of faces to settle.
+		/// @return `true` if the field is complete, `false` otherwise.
+		bool update(usize max_face_count = std::numeric_limits<usize>::max());
+
+		/// Returns `true` if every face which can reach a goal has been settled.
+		[[nodiscard]] inline bool is_complete() const noexcept
+		{
+			return m_open.empty();
+		}
+
+		/// Returns the direction of travel on a face, which is a unit vector in the plane of the face, or a zero vector if the face is a goal face, unreachable, or not yet settled.
+		/// @param face Index of a face.
+		[[nodiscard]] inline const math::fvec3& direction(u32 face) const noexcept
+		{
+			return m_directions[face];
+		}
+
+		/// Returns the distance from the centroid of a face to the nearest goal face centroid, or infinity if the face is unreachable or not yet reached.
+		/// @param face Index of a face.
+		[[nodiscard]] inline float distance(u32 face) const noexcept
+		{
+			return m_distances[face];
+		}
+
+		/// Returns the directions of travel of all faces.
+		[[nodiscard]] inline std::span<const math::fvec3> directions() const noexcept
+		{
+			return m_directions;
+		}
+
+		/// Returns the distances of all faces.
+		[[nodiscard]] inline std::span<const float> distances() const noexcept
+		{
+			return m_distances;
+		}
+
+		/// Returns the indices of the goal faces.
+		[[nodiscard]] inline std::span<const u32> goal_faces() const noexcept
+		{
+			return m_goal_faces;
+		}
+
+		/// Returns the navmesh graph.
+		[[nodiscard]] inline const std::shared_ptr<const navmesh_graph>& get_graph() const noexcept
+		{
+			return m_graph;
+		}
+
+	private:
+		/// Open list node.
+		struct node
+		{
+			float distance;
+			u32 face;
+		};
+
+		std::shared_ptr<const navmesh_graph> m_graph;
+		std::vector<u32> m_goal_faces;
+		std::vector<math::fvec3> m_directions;
+		std::vector<float> m_distances;
+		std::vector<bool> m_settled;
+		std::vector<node> m_open;
+	};
+
+	/// Cache of navmesh flow fields, keyed by navmesh graph and goal faces, which are built incrementally across worker threads.
+	/// @details Each cached flow field holds its graph, so no other graph can be allocated at the address of a graph while the cache holds fields over it.
+	class navmesh_flow_field_cache
+	{
+	public:
+		/// Constructs a navmesh flow field cache.
+		/// @param thread_count Number of threads which build flow fields, including the thread which calls update(). If `0`, the number of hardware threads will be used.
+		explicit navmesh_flow_field_cache(usize thread_count = 0);
+
+		/// Returns the flow field over a navmesh graph toward a set of goal faces, creating it if it is not cached. New flow fields are built by subsequent updates.
+		/// @param graph Navmesh graph.
+		/// @param goal_faces Indices of the goal faces, in any order.
+		/// @return Shared flow field.
+		[[nodiscard]] std::shared_ptr<const navmesh_flow_field> get(const std::shared_ptr<const navmesh_graph>& graph, std::span<const u32> goal_faces);
+
+		/// Continues building incomplete flow fields, in parallel.
+		/// @param max_face_count Maximum number of faces to settle in each flow field.
+		void update(usize max_face_count = std::numeric_limits<usize>::max());
+
+		/// Removes flow fields which are referenced only by the cache.
+		void remove_unused();
+
+		/// Removes all flow fields.
+		void clear();
+
+		/// Returns the number of cached flow fields.
+		[[nodiscard]] inline usize size() const noexcept
+		{
+			return m_fields.size();
+		}
+
+	private:
+		std::map<std::pair<const navmesh_graph*, std::vector<u32>>, std::shared_ptr<navmesh_flow_field>> m_fields;
+		std::vector<navmesh_flow_field*> m_incomplete_fields;
+		worker_pool m_pool;
+	};
+}
@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <engine/ai/navmesh-graph.hpp>
+#include <engine/math/functions.hpp>
+#include <stdexcept>
+
+namespace brep = engine::geom::brep;
+
+namespace engine::ai
+{
+	navmesh_graph::navmesh_graph(const brep::mesh& mesh)
+	{
+		const auto& vertex_positions = mesh.vertices().attributes().at<math::fvec3>("position");
+
+		const brep::attribute<math::fvec3>* vertex_normals = nullptr;
+		if (mesh.vertices().attributes().contains("normal"))
+		{
+			vertex_normals = &mesh.vertices().attributes().at<math::fvec3>("normal");
+		}
+
+		// Pack vertex positions and adjacency
+		m_faces.resize(mesh.faces().size());
+		for (const brep::face* mesh_face: mesh.faces())
+		{
+			if (mesh_face->loops().size() != 3)
+			{
+				throw std::invalid_argument("Navmesh faces must be triangles.");
+			}
+
+			auto& face = m_faces[mesh_face->index()];
+
+			usize i = 0;
+			for (const brep::loop* loop: mesh_face->loops())
+			{
+				const auto vertex_index = loop->vertex()->index();
+				face.vertices[i] = vertex_positions[vertex_index];
+				if (vertex_normals)
+				{
+					face.vertex_normals[i] = (*vertex_normals)[vertex_index];
+				}
+
+				// Find the face on the other side of the loop edge
+				face.neighbors[i] = no_face;
+				if (loop->edge()->loops().size() == 2)
+				{
+					const brep::loop* symmetric_loop = loop->edge()->loops().front();
+					if (symmetric_loop == loop)
+					{
+						symmetric_loop = loop->edge()->loops().back();
+					}
+					face.neighbors[i] = static_cast<u32>(symmetric_loop->face()->index());
+				}
+
+				++i;
+			}
+
+			const auto& [a, b, c] = face.vertices;
+			const auto ab = b - a;
+			const auto ac = c - a;
+			face.centroid = (a + b + c) / 3.0f;
+			face.normal = math::normalize(math::cross(ab, ac));
+			if (!vertex_normals)
+			{
+				face.vertex_normals = {face.normal, face.normal, face.normal};
+			}
+
+			for (usize j = 0; j < 3; ++j)
+			{
+				face.edge_directions[j] = math::normalize(face.vertices[(j + 1) % 3] - face.vertices[j]);
+			}
+
+			// Fold the barycentric solve of the face into two basis vectors
+			const float ab_dot_ab = math::dot(ab, ab);
+			const float ab_dot_ac = math::dot(ab, ac);
+			const float ac_dot_ac = math::dot(ac, ac);
+			const float denominator = ab_dot_ab * ac_dot_ac - ab_dot_ac * ab_dot_ac;
+			const float inverse_denominator = denominator != 0.0f ? 1.0f / denominator : 0.0f;
+			face.barycentric_basis[0] = (ab * ac_dot_ac - ac * ab_dot_ac) * inverse_denominator;
+			face.barycentric_basis[1] = (ac * ab_dot_ab - ab * ab_dot_ac) * inverse_denominator;
+		}
+
+		// Find rotations between adjacent faces, once every face normal is known
+		for (auto& face: m_faces)
+		{
+			for (usize i = 0; i < 3; ++i)
+			{
+				face.edge_rotations[i] = face.neighbors[i] != no_face ? math::rotation(face.normal, m_faces[face.neighbors[i]].normal) : math::identity<math::fquat>;
+			}
+		}
+	}
+}
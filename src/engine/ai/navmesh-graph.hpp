@@ -0,0 +1,102 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <engine/geom/brep/mesh.hpp>
+#include <engine/math/quaternion.hpp>
+#include <engine/math/vector.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <array>
+#include <span>
+#include <vector>
+
+namespace engine::ai
+{
+	/// Flattened face adjacency graph of a triangular navmesh, which can be searched and traversed concurrently.
+	/// @details Everything a search or traversal step needs from a face is stored contiguously in that face's record, so that neither touches the B-rep mesh.
+	class navmesh_graph
+	{
+	public:
+		/// Index which denotes the absence of a face.
+		static constexpr u32 no_face = ~u32{0};
+
+		/// Navmesh face.
+		struct face
+		{
+			/// Vertex positions, in counterclockwise order about the face normal.
+			std::array<math::fvec3, 3> vertices;
+
+			/// Indices of the faces which share each edge, or navmesh_graph::no_face if the edge is a boundary edge. Edge `i` connects vertex `i` to vertex `(i + 1) % 3`.
+			std::array<u32, 3> neighbors;
+
+			/// Centroid of the face.
+			math::fvec3 centroid;
+
+			/// Unit normal of the face.
+			math::fvec3 normal;
+
+			/// Unit directions of the edges.
+			std::array<math::fvec3, 3> edge_directions;
+
+			/// Rotations from the normal of the face to the normals of the faces across each edge.
+			std::array<math::fquat, 3> edge_rotations;
+
+			/// Vertex normals, which are interpolated to find the smooth surface normal of a point on the face.
+			std::array<math::fvec3, 3> vertex_normals;
+
+			/// Vectors whose dot products with the offset of a point from vertex `0` give the barycentric coordinates of vertices `1` and `2`.
+			std::array<math::fvec3, 2> barycentric_basis;
+		};
+
+		/// Constructs an empty navmesh graph.
+		navmesh_graph() noexcept = default;
+
+		/// Constructs a navmesh graph from a B-rep mesh.
+		/// @param mesh Triangular B-rep mesh with the math::fvec3 vertex attribute "position" and, optionally, the math::fvec3 vertex attribute "normal". If the mesh has no vertex normals, face normals are used in their place. Face indices of the graph match those of the mesh.
+		/// @exception std::invalid_argument Mesh has a face which is not a triangle.
+		explicit navmesh_graph(const geom::brep::mesh& mesh);
+
+		/// Returns the faces of the graph.
+		[[nodiscard]] inline constexpr std::span<const face> faces() const noexcept
+		{
+			return m_faces;
+		}
+
+		/// Returns the number of faces in the graph.
+		[[nodiscard]] inline constexpr usize size() const noexcept
+		{
+			return m_faces.size();
+		}
+
+		/// Returns `true` if the graph has no faces.
+		[[nodiscard]] inline constexpr bool empty() const noexcept
+		{
+			return m_faces.empty();
+		}
+
+	private:
+		std::vector<face> m_faces;
+	};
+
+	/// Calculates the barycentric coordinates of a point on a navmesh face.
+	/// @param face Navmesh face.
+	/// @param point Point in the plane of the face.
+	/// @return Barycentric coordinates of @p point.
+	[[nodiscard]] inline math::fvec3 navmesh_barycentric(const navmesh_graph::face& face, const math::fvec3& point) noexcept
+	{
+		const auto offset = point - face.vertices[0];
+		const float v = math::dot(offset, face.barycentric_basis[0]);
+		const float w = math::dot(offset, face.barycentric_basis[1]);
+		return {1.0f - v - w, v, w};
+	}
+
+	/// Interpolates the vertex normals of a navmesh face.
+	/// @param face Navmesh face.
+	/// @param barycentric Barycentric coordinates of a point on the face.
+	/// @return Unit surface normal at the point.
+	[[nodiscard]] inline math::fvec3 navmesh_surface_normal(const navmesh_graph::face& face, const math::fvec3& barycentric) noexcept
+	{
+		return math::normalize(face.vertex_normals[0] * barycentric.x() + face.vertex_normals[1] * barycentric.y() + face.vertex_normals[2] * barycentric.z());
+	}
+}
@@ -0,0 +1,126 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <engine/ai/navmesh-path-service.hpp>
+#include <utility>
+
+namespace engine::ai
+{
+	namespace
+	{
+		/// Returns the corridor cache key of a start and goal face pair.
+		[[nodiscard]] inline constexpr u64 make_cache_key(u32 start_face, u32 goal_face) noexcept
+		{
+			return (static_cast<u64>(start_face) << 32) | goal_face;
+		}
+	}
+
+	navmesh_path_service::navmesh_path_service(std::shared_ptr<const navmesh_graph> graph, usize thread_count):
+		m_graph(std::move(graph)),
+		m_pool(thread_count)
+	{
+		m_searches.resize(m_pool.get_thread_count());
+	}
+
+	usize navmesh_path_service::request(const navmesh_path_request& request)
+	{
+		m_requests.emplace_back(request);
+		return m_requests.size() - 1;
+	}
+
+	void navmesh_path_service::update()
+	{
+		const auto& graph = *m_graph;
+
+		// Find the cached corridor of each request, and gather one search job for each uncached face pair
+		std::unordered_map<u64, usize> job_indices;
+		std::vector<usize> request_jobs(m_requests.size());
+		m_jobs.clear();
+		m_corridors.assign(m_requests.size(), nullptr);
+		m_cache_hit_count = 0;
+		for (usize i = 0; i < m_requests.size(); ++i)
+		{
+			const auto& request = m_requests[i];
+			const auto key = make_cache_key(request.start_face, request.goal_face);
+			if (auto it = m_cache.find(key); it != m_cache.end())
+			{
+				m_corridors[i] = &it->second;
+				++m_cache_hit_count;
+			}
+			else
+			{
+				const auto [job_it, inserted] = job_indices.try_emplace(key, m_jobs.size());
+				if (inserted)
+				{
+					m_jobs.emplace_back(request.start_face, request.goal_face);
+				}
+				request_jobs[i] = job_it->second;
+			}
+		}
+
+		// Search corridors
+		m_pool.parallel_for(m_jobs.size(), [&](usize job_index, usize thread_index)
+		{
+			auto& job = m_jobs[job_index];
+			m_searches[thread_index].find_corridor(graph, job.start_face, job.goal_face, job.corridor);
+		});
+
+		// Point requests at the corridors of their search jobs
+		for (usize i = 0; i < m_requests.size(); ++i)
+		{
+			if (!m_corridors[i])
+			{
+				m_corridors[i] = &m_jobs[request_jobs[i]].corridor;
+			}
+		}
+
+		// Smooth paths through their corridors
+		m_results.resize(m_requests.size());
+		m_pool.parallel_for(m_requests.size(), [&](usize request_index, usize)
+		{
+			const auto& request = m_requests[request_index];
+			const auto& corridor = *m_corridors[request_index];
+			auto& result = m_results[request_index];
+
+			result.faces.assign(corridor.begin(), corridor.end());
+			smooth_navmesh_path(graph, corridor, request.start_point, request.goal_point, result.points);
+		});
+
+		// Cache new corridors, clearing the cache if it would overflow
+		if (m_cache.size() + m_jobs.size() > m_cache_capacity)
+		{
+			m_cache.clear();
+		}
+		for (auto& job: m_jobs)
+		{
+			if (m_cache.size() >= m_cache_capacity)
+			{
+				break;
+			}
+			m_cache.try_emplace(make_cache_key(job.start_face, job.goal_face), std::move(job.corridor));
+		}
+
+		m_requests.clear();
+		m_corridors.clear();
+	}
+
+	void navmesh_path_service::set_graph(std::shared_ptr<const navmesh_graph> graph)
+	{
+		m_graph = std::move(graph);
+		m_cache.clear();
+	}
+
+	void navmesh_path_service::set_cache_capacity(usize capacity)
+	{
+		m_cache_capacity = capacity;
+		if (m_cache.size() > m_cache_capacity)
+		{
+			m_cache.clear();
+		}
+	}
+
+	void navmesh_path_service::clear_cache()
+	{
+		m_cache.clear();
+	}
+}
@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <engine/ai/navmesh-graph.hpp>
+#include <engine/ai/navmesh-path.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <engine/utility/worker-pool.hpp>
+#include <memory>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace engine::ai
+{
+	/// Resolves batches of navmesh path queries across worker threads.
+	/// @details Queries are submitted with request() and resolved together by update(), typically once per tick. Face corridors are cached by start and goal face, so only the funnel smoothing of a cached path is recomputed for new start and goal points.
+	class navmesh_path_service
+	{
+	public:
+		/// Default maximum number of cached face corridors.
+		static constexpr usize default_cache_capacity = 4096;
+
+		/// Constructs a navmesh path service.
+		/// @param graph Navmesh graph to search.
+		/// @param thread_count Number of threads which resolve queries, including the thread which calls update(). If `0`, the number of hardware threads will be used.
+		explicit navmesh_path_service(std::shared_ptr<const navmesh_graph> graph, usize thread_count = 0);
+
+		/// Submits a path query, to be resolved by the next update().
+		/// @param request Path query.
+		/// @return Ticket with which to retrieve the result after the next update().
+		usize request(const navmesh_path_request& request);
+
+		/// Resolves all submitted queries, replacing the results of the previous update.
+		void update();
+
+		/// Returns the result of a query resolved by the last update().
+		/// @param ticket Ticket returned by request().
+		[[nodiscard]] inline const navmesh_path& result(usize ticket) const noexcept
+		{
+			return m_results[ticket];
+		}
+
+		/// Returns the results of the queries resolved by the last update(), indexed by ticket.
+		[[nodiscard]] inline std::span<const navmesh_path> results() const noexcept
+		{
+			return m_results;
+		}
+
+		/// Replaces the navmesh graph and clears the corridor cache.
+		/// @param graph Navmesh graph to search.
+		void set_graph(std::shared_ptr<const navmesh_graph> graph);
+
+		/// Sets the maximum number of cached face corridors. When the cache is full, it is cleared before new corridors are added.
+		/// @param capacity Maximum number of cached corridors, or `0` to disable caching.
+		void set_cache_capacity(usize capacity);
+
+		/// Removes all cached face corridors.
+		void clear_cache();
+
+		/// Returns the navmesh graph.
+		[[nodiscard]] inline const std::shared_ptr<const navmesh_graph>& get_graph() const noexcept
+		{
+			return m_graph;
+		}
+
+		/// Returns the number of threads which resolve queries, including the thread which calls update().
+		[[nodiscard]] inline usize get_thread_count() const noexcept
+		{
+			return m_pool.get_thread_count();
+		}
+
+		/// Returns the maximum number of cached face corridors.
+		[[nodiscard]] inline usize get_cache_capacity() const noexcept
+		{
+			return m_cache_capacity;
+		}
+
+		/// Returns the number of cached face corridors.
+		[[nodiscard]] inline usize get_cache_size() const noexcept
+		{
+			return m_cache.size();
+		}
+
+		/// Returns the number of queries in the last update whose corridors were found in the cache.
+		[[nodiscard]] inline usize get_cache_hit_count() const noexcept
+		{
+			return m_cache_hit_count;
+		}
+
+	private:
+		/// Corridor search of one start and goal face pair.
+		struct search_job
+		{
+			u32 start_face;
+			u32 goal_face;
+			std::vector<u32> corridor;
+		};
+
+		std::shared_ptr<const navmesh_graph> m_graph;
+
+		std::vector<navmesh_path_request> m_requests;
+		std::vector<navmesh_path> m_results;
+		std::vector<search_job> m_jobs;
+		std::vector<const std::vector<u32>*> m_corridors;
+		std::vector<navmesh_search> m_searches;
+
+		std::unordered_map<u64, std::vector<u32>> m_cache;
+		usize m_cache_capacity{default_cache_capacity};
+		usize m_cache_hit_count{0};
+
+		worker_pool m_pool;
+	};
+}
@@ -0,0 +1,228 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <engine/ai/navmesh-path.hpp>
+#include <engine/math/functions.hpp>
+#include <algorithm>
+
+namespace engine::ai
+{
+	namespace
+	{
+		/// Edge of a face corridor, as seen when travelling along the corridor.
+		struct portal
+		{
+			math::fvec3 left;
+			math::fvec3 right;
+			math::fvec3 normal;
+		};
+
+		/// Returns twice the signed area of a triangle about a normal, which is positive if `c` lies to the right of the ray from `a` through `b`.
+		[[nodiscard]] inline float triangle_area2(const math::fvec3& a, const math::fvec3& b, const math::fvec3& c, const math::fvec3& normal) noexcept
+		{
+			return math::dot(math::cross(c - a, b - a), normal);
+		}
+
+		/// Returns `true` if two points are approximately equal.
+		[[nodiscard]] inline bool points_equal(const math::fvec3& a, const math::fvec3& b) noexcept
+		{
+			return math::sqr_distance(a, b) < 1e-6f;
+		}
+
+		/// Orders open list nodes so the node with the lowest estimated cost is at the front of a heap.
+		struct node_compare
+		{
+			template <class T>
+			[[nodiscard]] inline bool operator()(const T& a, const T& b) const noexcept
+			{
+				return a.estimated_cost > b.estimated_cost;
+			}
+		};
+	}
+
+	bool navmesh_search::find_corridor(const navmesh_graph& graph, u32 start_face, u32 goal_face, std::vector<u32>& corridor)
+	{
+		corridor.clear();
+
+		const auto faces = graph.faces();
+		if (start_face >= faces.size() || goal_face >= faces.size())
+		{
+			return false;
+		}
+
+		// Resize working memory, and advance the stamp which marks faces visited by this search
+		if (m_visit_stamps.size() != faces.size())
+		{
+			m_costs.resize(faces.size());
+			m_parents.resize(faces.size());
+			m_visit_stamps.assign(faces.size(), 0);
+			m_stamp = 0;
+		}
+		if (!++m_stamp)
+		{
+			std::fill(m_visit_stamps.begin(), m_visit_stamps.end(), 0);
+			m_stamp = 1;
+		}
+
+		const auto& goal_centroid = faces[goal_face].centroid;
+
+		m_costs[start_face] = 0.0f;
+		m_parents[start_face] = navmesh_graph::no_face;
+		m_visit_stamps[start_face] = m_stamp;
+		m_open.clear();
+		m_open.emplace_back(math::distance(faces[start_face].centroid, goal_centroid), 0.0f, start_face);
+
+		while (!m_open.empty())
+		{
+			std::pop_heap(m_open.begin(), m_open.end(), node_compare{});
+			const auto current = m_open.back();
+			m_open.pop_back();
+
+			// Skip nodes which have been superseded by a cheaper path
+			if (current.cost > m_costs[current.face])
+			{
+				continue;
+			}
+
+			if (current.face == goal_face)
+			{
+				for (u32 face = goal_face; face != navmesh_graph::no_face; face = m_parents[face])
+				{
+					corridor.emplace_back(face);
+				}
+				std::reverse(corridor.begin(), corridor.end());
+				return true;
+			}
+
+			const auto& face = faces[current.face];
+			for (const auto neighbor: face.neighbors)
+			{
+				if (neighbor == navmesh_graph::no_face)
+				{
+					continue;
+				}
+
+				const auto& neighbor_centroid = faces[neighbor].centroid;
+				const float cost = current.cost + math::distance(face.centroid, neighbor_centroid);
+				if (m_visit_stamps[neighbor] != m_stamp || cost < m_costs[neighbor])
+				{
+					m_costs[neighbor] = cost;
+					m_parents[neighbor] = current.face;
+					m_visit_stamps[neighbor] = m_stamp;
+
+					m_open.emplace_back(cost + math::distance(neighbor_centroid, goal_centroid), cost, neighbor);
+					std::push_heap(m_open.begin(), m_open.end(), node_compare{});
+				}
+			}
+		}
+
+		return false;
+	}
+
+	void smooth_navmesh_path(const navmesh_graph& graph, std::span<const u32> corridor, const math::fvec3& start_point, const math::fvec3& goal_point, std::vector<math::fvec3>& points)
+	{
+		points.clear();
+		if (corridor.empty())
+		{
+			return;
+		}
+
+		const auto faces = graph.faces();
+
+		// Build portals from the shared edges of consecutive corridor faces
+		std::vector<portal> portals;
+		portals.reserve(corridor.size() + 1);
+		portals.emplace_back(start_point, start_point, faces[corridor.front()].normal);
+		for (usize i = 1; i < corridor.size(); ++i)
+		{
+			const auto& face = faces[corridor[i - 1]];
+			const auto edge = static_cast<usize>(std::find(face.neighbors.begin(), face.neighbors.end(), corridor[i]) - face.neighbors.begin());
+			portals.emplace_back(face.vertices[(edge + 1) % 3], face.vertices[edge], face.normal);
+		}
+		portals.emplace_back(goal_point, goal_point, faces[corridor.back()].normal);
+
+		// Simple stupid funnel algorithm
+		math::fvec3 apex = start_point;
+		math::fvec3 funnel_left = start_point;
+		math::fvec3 funnel_right = start_point;
+		usize apex_index = 0;
+		usize left_index = 0;
+		usize right_index = 0;
+
+		points.emplace_back(start_point);
+
+		for (usize i = 1; i < portals.size(); ++i)
+		{
+			const auto& [left, right, normal] = portals[i];
+
+			// Narrow the right side of the funnel
+			if (triangle_area2(apex, funnel_right, right, normal) <= 0.0f)
+			{
+				if (points_equal(apex, funnel_right) || triangle_area2(apex, funnel_left, right, normal) > 0.0f)
+				{
+					funnel_right = right;
+					right_index = i;
+				}
+				else
+				{
+					// Right side crossed the left side, so the left side becomes a corner of the path
+					apex = funnel_left;
+					apex_index = left_index;
+					points.emplace_back(apex);
+
+					funnel_left = apex;
+					funnel_right = apex;
+					left_index = apex_index;
+					right_index = apex_index;
+					i = apex_index;
+					continue;
+				}
+			}
+
+			// Narrow the left side of the funnel
+			if (triangle_area2(apex, funnel_left, left, normal) >= 0.0f)
+			{
+				if (points_equal(apex, funnel_left) || triangle_area2(apex, funnel_right, left, normal) < 0.0f)
+				{
+					funnel_left = left;
+					left_index = i;
+				}
+				else
+				{
+					// Left side crossed the right side, so the right side becomes a corner of the path
+					apex = funnel_right;
+					apex_index = right_index;
+					points.emplace_back(apex);
+
+					funnel_left = apex;
+					funnel_right = apex;
+					left_index = apex_index;
+					right_index = apex_index;
+					i = apex_index;
+					continue;
+				}
+			}
+		}
+
+		if (!points_equal(points.back(), goal_point) || points.size() == 1)
+		{
+			points.emplace_back(goal_point);
+		}
+	}
+
+	navmesh_path find_navmesh_path(const navmesh_graph& graph, const navmesh_path_request& request, navmesh_search& search)
+	{
+		navmesh_path path;
+		if (search.find_corridor(graph, request.start_face, request.goal_face, path.faces))
+		{
+			smooth_navmesh_path(graph, path.faces, request.start_point, request.goal_point, path.points);
+		}
+		return path;
+	}
+
+	navmesh_path find_navmesh_path(const navmesh_graph& graph, const navmesh_path_request& request)
+	{
+		navmesh_search search;
+		return find_navmesh_path(graph, request, search);
+	}
+}
@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <engine/ai/navmesh-graph.hpp>
+#include <engine/math/vector.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <span>
+#include <vector>
+
+namespace engine::ai
+{
+	/// Navmesh path query.
+	struct navmesh_path_request
+	{
+		/// Index of the face on which the path starts.
+		u32 start_face{navmesh_graph::no_face};
+
+		/// Point on the start face at which the path starts.
+		math::fvec3 start_point{};
+
+		/// Index of the face on which the path ends.
+		u32 goal_face{navmesh_graph::no_face};
+
+		/// Point on the goal face at which the path ends.
+		math::fvec3 goal_point{};
+	};
+
+	/// Path across a navmesh.
+	struct navmesh_path
+	{
+		/// Waypoints of the path, from the start point to the goal point. Empty if no path was found.
+		std::vector<math::fvec3> points;
+
+		/// Indices of the faces crossed by the path, from the start face to the goal face.
+		std::vector<u32> faces;
+
+		/// Returns `true` if no path was found.
+		[[nodiscard]] inline bool empty() const noexcept
+		{
+			return points.empty();
+		}
+	};
+
+	/// Reusable working memory for A* searches of a navmesh graph.
+	/// @note Each thread which searches concurrently requires its own search object.
+	class navmesh_search
+	{
+	public:
+		/// Finds the sequence of adjacent faces which connects two faces with the shortest distance between face centroids.
+		/// @param graph Navmesh graph to search.
+		/// @param start_face Index of the start face.
+		/// @param goal_face Index of the goal face.
+		/// @param[out] corridor Indices of the faces from the start face to the goal face, or empty if the goal face is unreachable.
+		/// @return `true` if a corridor was found, `false` otherwise.
+		bool find_corridor(const navmesh_graph& graph, u32 start_face, u32 goal_face, std::vector<u32>& corridor);
+
+	private:
+		/// Open list node.
+		struct node
+		{
+			float estimated_cost;
+			float cost;
+			u32 face;
+		};
+
+		std::vector<float> m_costs;
+		std::vector<u32> m_parents;
+		std::vector<u32> m_visit_stamps;
+		std::vector<node> m_open;
+		u32 m_stamp{0};
+	};
+
+	/// Shortens a path through a corridor of faces into straight segments between corridor edge vertices, with the simple stupid funnel algorithm.
+	/// @param graph Navmesh graph.
+	/// @param corridor Indices of adjacent faces, from the face of the start point to the face of the goal point.
+	/// @param start_point Start point.
+	/// @param goal_point Goal point.
+	/// @param[out] points Waypoints of the path, from the start point to the goal point.
+	/// @note On curved surfaces, funnel turns are measured about the normal of the face before each corridor edge.
+	void smooth_navmesh_path(const navmesh_graph& graph, std::span<const u32> corridor, const math::fvec3& start_point, const math::fvec3& goal_point, std::vector<math::fvec3>& points);
+
+	/// Finds a smoothed path across a navmesh.
+	/// @param graph Navmesh graph.
+	/// @param request Path query.
+	/// @param search Search working memory.
+	/// @return Path, which is empty if the goal is unreachable.
+	[[nodiscard]] navmesh_path find_navmesh_path(const navmesh_graph& graph, const navmesh_path_request& request, navmesh_search& search);
+
+	/// @copydoc find_navmesh_path(const navmesh_graph&, const navmesh_path_request&, navmesh_search&)
+	[[nodiscard]] navmesh_path find_navmesh_path(const navmesh_graph& graph, const navmesh_path_request& request);
+}
@@ -7,15 +7,11 @@
 #include <engine/geom/coordinates.hpp>
 #include <engine/geom/closest-point.hpp>
 
-namespace brep = engine::geom::brep;
-
 namespace engine::ai
 {
-	navmesh_traversal traverse_navmesh(const brep::mesh& mesh, brep::face* face, const math::fvec3& start, const math::fvec3& end)
+	navmesh_traversal traverse_navmesh(const navmesh_graph& graph, u32 face, const math::fvec3& start, const math::fvec3& end)
 	{
-		// Get vertex positions and face normals
-		const auto& vertex_positions = mesh.vertices().attributes().at<math::fvec3>("position");
-		const auto& face_normals = mesh.faces().attributes().at<math::fvec3>("normal");
+		const auto faces = graph.faces();
 	
 		// Init traversal result
 		navmesh_traversal traversal;
@@ -26,15 +22,12 @@ namespace engine::ai
 		math::fvec3 traversal_direction = math::normalize(end - start);
 		math::fvec3 closest_point;
 	
-		brep::edge* previous_closest_edge{};
+		u32 previous_face = navmesh_graph::no_face;
 	
 		do
 		{
-			// Get vertex positions of face
-			auto loop_it = face->loops().begin();
-			const auto& a = vertex_positions[loop_it->vertex()->index()];
-			const auto& b = vertex_positions[(++loop_it)->vertex()->index()];
-			const auto& c = vertex_positions[(++loop_it)->vertex()->index()];
+			const auto& current_face = faces[face];
+			const auto& [a, b, c] = current_face.vertices;
 		
 			// Find closest point on face to target point
 			std::tie(closest_point, region) = geom::closest_point(a, b, c, target_point);
@@ -46,134 +39,87 @@ namespace engine::ai
 				break;
 			}
 		
-			brep::loop* closest_loop;
+			usize closest_edge;
 		
 			// If point is on an edge
 			if (geom::is_edge_region(region))
 			{
-				// Get index of the edge
-				const auto edge_index = geom::edge_index(region);
-			
-				// Get pointer to the edge's loop
-				loop_it = face->loops().begin();
-				std::advance(loop_it, edge_index);
-				closest_loop = *loop_it;
+				closest_edge = geom::edge_index(region);
 			
 				// If edge is a boundary edge
-				if (closest_loop->edge()->loops().size() == 1)
+				if (current_face.neighbors[closest_edge] == navmesh_graph::no_face)
 				{
 					// Abort traversal
-					traversal.feature = closest_loop->edge();
 					break;
 				}
 			}
 			else
 			{
-				// Point is on a vertex, get index of vertex on which point lies
-				const auto vertex_index = geom::vertex_index(region);
-			
-				// Get pointer to loop originating at the vertex
-				loop_it = face->loops().begin();
-				std::advance(loop_it, vertex_index);
-				brep::loop* loop = *loop_it;
+				// Point is on a vertex, get indices of the edges which originate and terminate at the vertex
+				const usize current_edge = geom::vertex_index(region);
+				const usize previous_edge = (current_edge + 2) % 3;
 			
-				// If previous loop edge is a boundary edge
-				if (loop->previous()->edge()->loops().size() == 1)
+				// If previous edge is a boundary edge
+				if (current_face.neighbors[previous_edge] == navmesh_graph::no_face)
 				{
-					// If current loop edge is also a boundary edge
-					if (loop->edge()->loops().size() == 1)
+					// If current edge is also a boundary edge
+					if (current_face.neighbors[current_edge] == navmesh_graph::no_face)
 					{
 						// Abort traversal
-						traversal.feature = loop->edge();
 						break;
 					}
 				
-					// Select current loop
-					closest_loop = loop;
+					// Select current edge
+					closest_edge = current_edge;
 				}
-				// If current loop edge is a boundary edge
-				else if (loop->edge()->loops().size() == 1)
+				// If current edge is a boundary edge
+				else if (current_face.neighbors[current_edge] == navmesh_graph::no_face)
 				{
-					// Select previous loop
-					closest_loop = loop->previous();
+					// Select previous edge
+					closest_edge = previous_edge;
 				}
 				else
-				// Neither loop edge is a boundary edge
+				// Neither edge is a boundary edge
 				{
-					// Calculate direction of current loop edge
-					const auto current_direction = math::normalize
-					(
-						vertex_positions[loop->next()->vertex()->index()] -
-						vertex_positions[loop->vertex()->index()]
-					);
-				
-					// Calculate direction of previous loop edge
-					const auto previous_direction = math::normalize
-					(
-						vertex_positions[loop->vertex()->index()] -
-						vertex_positions[loop->previous()->vertex()->index()]
-					);
-				
-					// Select loop with minimal angle between edge and traversal direction
-					if (math::abs(math::dot(traversal_direction, current_direction)) <
-						math::abs(math::dot(traversal_direction, previous_direction)))
+					// Select edge with minimal angle between edge and traversal direction
+					if (math::abs(math::dot(traversal_direction, current_face.edge_directions[current_edge])) <
+						math::abs(math::dot(traversal_direction, current_face.edge_directions[previous_edge])))
 					{
-						closest_loop = loop;
+						closest_edge = current_edge;
 					}
 					else
 					{
-						closest_loop = loop->previous();
+						closest_edge = previous_edge;
 					}
 				}
 			}
 		
-			// Get edge of closest loop
-			brep::edge* closest_edge = closest_loop->edge();
+			// Get face across the closest edge
+			const u32 next_face = current_face.neighbors[closest_edge];
 		
-			// If closest edge is previous closest edge
-			if (closest_edge == previous_closest_edge)
+			// If crossing the closest edge would return to the previous face
+			if (next_face == previous_face)
 			{
-				// Abort traversal
-				traversal.feature = closest_edge;
+				// Abort traversal to prevent infinite loops
 				break;
 			}
 		
-			// Remember closest edge to prevent infinite loops
-			previous_closest_edge = closest_edge;
-		
-			// Find a loop and face that shares the closest edge
-			brep::loop* symmetric_loop = closest_edge->loops().front();
-			if (symmetric_loop == closest_loop)
-			{
-				symmetric_loop = closest_edge->loops().back();
-			}
-			brep::face* symmetric_face = symmetric_loop->face();
-		
-			// Find quaternion representing rotation from normal of first face to normal of second face
-			const auto& n0 = face_normals[face->index()];
-			const auto& n1 = face_normals[symmetric_face->index()];
-			const auto rotation = math::rotation(n0, n1);
-		
-			// Rotate target point
+			// Rotate target point and traversal direction from the plane of the current face to the plane of the next face
+			const auto& rotation = current_face.edge_rotations[closest_edge];
 			target_point = rotation * (target_point - closest_point) + closest_point;
-		
-			// Rotate traversal direction
 			traversal_direction = rotation * traversal_direction;
 		
 			// Move to next face
-			face = symmetric_face;
+			previous_face = face;
+			face = next_face;
 		}
 		while (true);
 	
-		traversal.feature = face;
+		traversal.face = face;
 		traversal.target_point = target_point;
 		traversal.closest_point = closest_point;
-	
-		auto loop_it = face->loops().begin();
-		const auto& a = vertex_positions[loop_it->vertex()->index()];
-		const auto& b = vertex_positions[(++loop_it)->vertex()->index()];
-		const auto& c = vertex_positions[(++loop_it)->vertex()->index()];
-		traversal.barycentric = geom::cartesian_to_barycentric(traversal.closest_point, a, b, c);
+		traversal.closest_region = region;
+		traversal.barycentric = navmesh_barycentric(faces[face], closest_point);
 	
 		return traversal;
 	}
@@ -3,18 +3,19 @@
 
 #pragma once
 
+#include <engine/ai/navmesh-graph.hpp>
 #include <engine/geom/primitives/point.hpp>
 #include <engine/geom/coordinates.hpp>
-#include <engine/geom/brep/mesh.hpp>
-#include <engine/geom/brep/feature.hpp>
 #include <engine/math/vector.hpp>
+#include <engine/utility/sized-types.hpp>
 
 namespace engine::ai
 {
 	/// Navmesh traversal results.
 	struct navmesh_traversal
 	{
-		engine::geom::brep::feature feature;
+		/// Index of the face on which the traversal ended.
+		u32 face;
 		geom::point<float, 3> barycentric;
 		geom::point<float, 3> target_point;
 		geom::point<float, 3> closest_point;
@@ -22,6 +23,10 @@ namespace engine::ai
 	};
 
 	/// @fn ai::traverse_navmesh
-	/// Moves a point along the surface of a mesh.
-	[[nodiscard]] navmesh_traversal traverse_navmesh(const engine::geom::brep::mesh& mesh, engine::geom::brep::face* face, const math::fvec3& start, const math::fvec3& end);
+	/// Moves a point along the surface of a navmesh.
+	/// @param graph Navmesh graph.
+	/// @param face Index of the face on which the point starts.
+	/// @param start Starting point, on @p face.
+	/// @param end Point toward which to move.
+	[[nodiscard]] navmesh_traversal traverse_navmesh(const navmesh_graph& graph, u32 face, const math::fvec3& start, const math::fvec3& end);
 }
@@ -0,0 +1,15 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// This translation unit is compiled with AVX2 and FMA code generation enabled, and must only be entered after checking math::simd::get_supported_isa().
+
+#include <engine/ai/pheromone-kernels.hpp>
+
+static_assert(ENGINE_MATH_SIMD_AVX2, "pheromone-field-avx2.cpp must be compiled with AVX2 and FMA enabled.");
+
+namespace engine::ai::pheromone_kernels::avx2
+{
+	ENGINE_AI_DEFINE_PHEROMONE_KERNELS(8)
+}
+
+#undef ENGINE_AI_DEFINE_PHEROMONE_KERNELS
@@ -0,0 +1,385 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <engine/ai/pheromone-field.hpp>
+#include <engine/ai/pheromone-kernels.hpp>
+#include <engine/math/simd/isa.hpp>
+#include <engine/math/functions.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+namespace engine::ai::pheromone_kernels::sse2
+{
+	ENGINE_AI_DEFINE_PHEROMONE_KERNELS(4)
+}
+
+#undef ENGINE_AI_DEFINE_PHEROMONE_KERNELS
+
+namespace engine::ai
+{
+	namespace
+	{
+		using pheromone_kernels::padded_tile_size;
+		using pheromone_kernels::padded_tile_cell_count;
+
+		static_assert(pheromone_kernels::tile_size == pheromone_field::tile_size);
+
+		/// Maximum diffusion rate of a stable explicit diffusion step in three dimensions.
+		constexpr float max_stable_alpha = 1.0f / 6.0f;
+
+		/// Returns the index of a cell in a tile.
+		[[nodiscard]] inline constexpr usize tile_cell_index(usize x, usize y, usize z) noexcept
+		{
+			return (z * pheromone_field::tile_size + y) * pheromone_field::tile_size + x;
+		}
+
+		/// Returns the index of a cell in a padded tile, with coordinates on `[-1, tile_size]`.
+		[[nodiscard]] inline constexpr usize padded_cell_index(isize x, isize y, isize z) noexcept
+		{
+			return static_cast<usize>(((z + 1) * static_cast<isize>(padded_tile_size) + (y + 1)) * static_cast<isize>(padded_tile_size) + (x + 1));
+		}
+
+		/// Diffuses one channel of a tile with the kernel of the selected instruction set.
+		[[nodiscard]] inline float diffuse(const float* source, float* destination, float alpha, float decay) noexcept
+		{
+			if (math::simd::get_isa() == math::simd::isa::avx2)
+			{
+				return pheromone_kernels::avx2::diffuse(source, destination, alpha, decay);
+			}
+
+			return pheromone_kernels::sse2::diffuse(source, destination, alpha, decay);
+		}
+	}
+
+	pheromone_field::pheromone_field(const math::fvec3& origin, float cell_size, const math::uvec3& size, std::span<const pheromone_channel> channels, usize thread_count):
+		m_origin(origin),
+		m_cell_size(cell_size),
+		m_tile_counts((size + (tile_size - 1)) / tile_size),
+		m_channels(channels.begin(), channels.end()),
+		m_pool(thread_count)
+	{
+		if (!(cell_size > 0.0f))
+		{
+			throw std::invalid_argument("Pheromone field cell size must be positive.");
+		}
+		if (!size.x() || !size.y() || !size.z())
+		{
+			throw std::invalid_argument("Pheromone field must have at least one cell.");
+		}
+		if (m_channels.empty())
+		{
+			throw std::invalid_argument("Pheromone field must have at least one channel.");
+		}
+
+		m_directory.assign(static_cast<usize>(m_tile_counts.x()) * m_tile_counts.y() * m_tile_counts.z(), ~u32{0});
+		m_padded_tiles.resize(m_pool.get_thread_count(), std::vector<float>(padded_tile_cell_count));
+	}
+
+	void pheromone_field::deposit(usize channel, const math::fvec3& position, float amount)
+	{
+		const auto cell = position_to_cell(position);
+		const auto directory_index = find_directory_index(cell);
+		if (directory_index < 0)
+		{
+			return;
+		}
+
+		const u32 local[3] = {cell.x() % tile_size, cell.y() % tile_size, cell.z() % tile_size};
+		auto& tile = allocate_tile(static_cast<u32>(directory_index));
+		tile.data[(m_buffer * m_channels.size() + channel) * tile_cell_count + tile_cell_index(local[0], local[1], local[2])] += amount;
+
+		// Allocate neighboring tiles which share a face with the cell, so the deposit diffuses across tile boundaries from the next step
+		const u32 tile_coordinates[3] = {cell.x() / tile_size, cell.y() / tile_size, cell.z() / tile_size};
+		const u32 strides[3] = {1, m_tile_counts.x(), m_tile_counts.x() * m_tile_counts.y()};
+		for (usize axis = 0; axis < 3; ++axis)
+		{
+			if (!local[axis] && tile_coordinates[axis])
+			{
+				allocate_tile(static_cast<u32>(directory_index) - strides[axis]);
+			}
+			else if (local[axis] == tile_size - 1 && tile_coordinates[axis] + 1 < m_tile_counts[axis])
+			{
+				allocate_tile(static_cast<u32>(directory_index) + strides[axis]);
+			}
+		}
+	}
+
+	void pheromone_field::update(float dt)
+	{
+		m_updated_cell_count = 0;
+		if (m_tiles.empty() || !(dt > 0.0f))
+		{
+			return;
+		}
+
+		// Divide the timestep into substeps which are stable for every channel
+		const float sqr_cell_size = m_cell_size * m_cell_size;
+		float max_alpha = 0.0f;
+		for (const auto& channel: m_channels)
+		{
+			max_alpha = std::max(max_alpha, channel.diffusion_rate * dt / sqr_cell_size);
+		}
+		const auto substep_count = std::max(static_cast<usize>(std::ceil(max_alpha / max_stable_alpha)), usize{1});
+		const float substep_dt = dt / static_cast<float>(substep_count);
+
+		std::vector<float> alphas;
+		std::vector<float> decays;
+		for (const auto& channel: m_channels)
+		{
+			alphas.emplace_back(std::min(channel.diffusion_rate * substep_dt / sqr_cell_size, max_stable_alpha));
+			decays.emplace_back(std::exp(-channel.evaporation_rate * substep_dt));
+		}
+
+		std::vector<u32> spawned_directory_indices;
+		for (usize substep = 0; substep < substep_count && !m_tiles.empty(); ++substep)
+		{
+			// Step tiles in parallel, writing into the other buffer
+			m_pool.parallel_for(m_tiles.size(), [&](usize i, usize thread_index)
+			{
+				step_tile(m_tiles[i], m_padded_tiles[thread_index], alphas, decays);
+			});
+			m_updated_cell_count += m_tiles.size() * tile_cell_count * m_channels.size();
+			m_buffer ^= 1;
+
+			// Find unallocated neighbors into which pheromone has diffused
+			spawned_directory_indices.clear();
+			for (const auto& tile: m_tiles)
+			{
+				if (!tile.boundary_mask)
+				{
+					continue;
+				}
+
+				const u32 tile_x = tile.directory_index % m_tile_counts.x();
+				const u32 tile_y = (tile.directory_index / m_tile_counts.x()) % m_tile_counts.y();
+				const u32 tile_z = tile.directory_index / (m_tile_counts.x() * m_tile_counts.y());
+				const u32 coordinates[3] = {tile_x, tile_y, tile_z};
+				const u32 strides[3] = {1, m_tile_counts.x(), m_tile_counts.x() * m_tile_counts.y()};
+
+				for (usize face = 0; face < 6; ++face)
+				{
+					const usize axis = face / 2;
+					const bool positive = face % 2;
+					if (!(tile.boundary_mask & (1u << face)) || (positive ? coordinates[axis] + 1 >= m_tile_counts[axis] : !coordinates[axis]))
+					{
+						continue;
+					}
+
+					const u32 neighbor = positive ? tile.directory_index + strides[axis] : tile.directory_index - strides[axis];
+					if (m_directory[neighbor] == ~u32{0})
+					{
+						spawned_directory_indices.emplace_back(neighbor);
+					}
+				}
+			}
+
+			// Release idle tiles
+			for (usize i = 0; i < m_tiles.size();)
+			{
+				if (m_tiles[i].peak >= m_min_concentration)
+				{
+					++i;
+					continue;
+				}
+
+				auto& tile = m_tiles[i];
+				m_directory[tile.directory_index] = ~u32{0};
+				std::fill_n(tile.data.get(), 2 * m_channels.size() * tile_cell_count, 0.0f);
+				m_free_tile_data.emplace_back(std::move(tile.data));
+
+				if (i + 1 != m_tiles.size())
+				{
+					tile = std::move(m_tiles.back());
+					m_directory[tile.directory_index] = static_cast<u32>(i);
+				}
+				m_tiles.pop_back();
+			}
+
+			// Allocate tiles into which pheromone has diffused
+			for (const auto directory_index: spawned_directory_indices)
+			{
+				allocate_tile(directory_index);
+			}
+		}
+	}
+
+	void pheromone_field::clear()
+	{
+		for (auto& tile: m_tiles)
+		{
+			m_directory[tile.directory_index] = ~u32{0};
+			std::fill_n(tile.data.get(), 2 * m_channels.size() * tile_cell_count, 0.0f);
+			m_free_tile_data.emplace_back(std::move(tile.data));
+		}
+		m_tiles.clear();
+	}
+
+	float pheromone_field::sample(usize channel, const math::fvec3& position) const noexcept
+	{
+		return get_concentration(channel, position_to_cell(position));
+	}
+
+	math::fvec3 pheromone_field::gradient(usize channel, const math::fvec3& position) const noexcept
+	{
+		const auto cell = position_to_cell(position);
+		const float scale = 0.5f / m_cell_size;
+
+		math::fvec3 result;
+		for (usize i = 0; i < 3; ++i)
+		{
+			auto lower = cell;
+			auto upper = cell;
+			--lower[i];
+			++upper[i];
+			result[i] = (get_concentration(channel, upper) - get_concentration(channel, lower)) * scale;
+		}
+
+		return result;
+	}
+
+	float pheromone_field::get_concentration(usize channel, const math::ivec3& cell) const noexcept
+	{
+		const float* data = find_tile_data(find_directory_index(cell), channel);
+		if (!data)
+		{
+			return 0.0f;
+		}
+
+		return data[tile_cell_index(cell.x() % tile_size, cell.y() % tile_size, cell.z() % tile_size)];
+	}
+
+	isize pheromone_field::find_directory_index(const math::ivec3& cell) const noexcept
+	{
+		const auto size = get_size();
+		if (cell.x() < 0 || cell.y() < 0 || cell.z() < 0 || static_cast<u32>(cell.x()) >= size.x() || static_cast<u32>(cell.y()) >= size.y() || static_cast<u32>(cell.z()) >= size.z())
+		{
+			return -1;
+		}
+
+		const usize tile_x = static_cast<usize>(cell.x()) / tile_size;
+		const usize tile_y = static_cast<usize>(cell.y()) / tile_size;
+		const usize tile_z = static_cast<usize>(cell.z()) / tile_size;
+		return static_cast<isize>((tile_z * m_tile_counts.y() + tile_y) * m_tile_counts.x() + tile_x);
+	}
+
+	math::ivec3 pheromone_field::position_to_cell(const math::fvec3& position) const noexcept
+	{
+		const auto cell = math::floor((position - m_origin) / m_cell_size);
+		return {static_cast<int>(cell.x()), static_cast<int>(cell.y()), static_cast<int>(cell.z())};
+	}
+
+	pheromone_field::tile& pheromone_field::allocate_tile(u32 directory_index)
+	{
+		if (const auto tile_index = m_directory[directory_index]; tile_index != ~u32{0})
+		{
+			return m_tiles[tile_index];
+		}
+
+		std::unique_ptr<float[]> data;
+		if (!m_free_tile_data.empty())
+		{
+			data = std::move(m_free_tile_data.back());
+			m_free_tile_data.pop_back();
+		}
+		else
+		{
+			data = std::make_unique<float[]>(2 * m_channels.size() * tile_cell_count);
+		}
+
+		m_directory[directory_index] = static_cast<u32>(m_tiles.size());
+		return m_tiles.emplace_back(directory_index, std::move(data), 0.0f, 0u);
+	}
+
+	const float* pheromone_field::find_tile_data(isize directory_index, usize channel) const noexcept
+	{
+		if (directory_index < 0 || m_directory[directory_index] == ~u32{0})
+		{
+			return nullptr;
+		}
+
+		return m_tiles[m_directory[directory_index]].data.get() + (m_buffer * m_channels.size() + channel) * tile_cell_count;
+	}
+
+	void pheromone_field::step_tile(tile& tile, std::span<float> padded, std::span<const float> alphas, std::span<const float> decays) const noexcept
+	{
+		const isize tile_x = tile.directory_index % m_tile_counts.x();
+		const isize tile_y = (tile.directory_index / m_tile_counts.x()) % m_tile_counts.y();
+		const isize tile_z = tile.directory_index / (m_tile_counts.x() * m_tile_counts.y());
+		const isize x_stride = 1;
+		const isize y_stride = m_tile_counts.x();
+		const isize z_stride = static_cast<isize>(m_tile_counts.x()) * m_tile_counts.y();
+		const isize directory_index = tile.directory_index;
+
+		constexpr isize n = tile_size;
+
+		tile.peak = 0.0f;
+		tile.boundary_mask = 0;
+
+		for (usize channel = 0; channel < m_channels.size(); ++channel)
+		{
+			const float* source = find_tile_data(directory_index, channel);
+			float* destination = tile.data.get() + ((m_buffer ^ 1) * m_channels.size() + channel) * tile_cell_count;
+
+			// Copy tile into padded tile
+			for (isize z = 0; z < n; ++z)
+			{
+				for (isize y = 0; y < n; ++y)
+				{
+					std::memcpy(&padded[padded_cell_index(0, y, z)], source + tile_cell_index(0, y, z), tile_size * sizeof(float));
+				}
+			}
+
+			// Copy adjacent layers of neighboring tiles into the padding, or mirror the tile's own boundary layers where there are no neighbors
+			const float* neighbors[6] =
+			{
+				tile_x > 0 ? find_tile_data(directory_index - x_stride, channel) : nullptr,
+				tile_x + 1 < m_tile_counts.x() ? find_tile_data(directory_index + x_stride, channel) : nullptr,
+				tile_y > 0 ? find_tile_data(directory_index - y_stride, channel) : nullptr,
+				tile_y + 1 < m_tile_counts.y() ? find_tile_data(directory_index + y_stride, channel) : nullptr,
+				tile_z > 0 ? find_tile_data(directory_index - z_stride, channel) : nullptr,
+				tile_z + 1 < m_tile_counts.z() ? find_tile_data(directory_index + z_stride, channel) : nullptr
+			};
+			for (isize j = 0; j < n; ++j)
+			{
+				for (isize i = 0; i < n; ++i)
+				{
+					padded[padded_cell_index(-1, i, j)] = neighbors[0] ? neighbors[0][tile_cell_index(n - 1, i, j)] : source[tile_cell_index(0, i, j)];
+					padded[padded_cell_index(n, i, j)] = neighbors[1] ? neighbors[1][tile_cell_index(0, i, j)] : source[tile_cell_index(n - 1, i, j)];
+					padded[padded_cell_index(i, -1, j)] = neighbors[2] ? neighbors[2][tile_cell_index(i, n - 1, j)] : source[tile_cell_index(i, 0, j)];
+					padded[padded_cell_index(i, n, j)] = neighbors[3] ? neighbors[3][tile_cell_index(i, 0, j)] : source[tile_cell_index(i, n - 1, j)];
+					padded[padded_cell_index(i, j, -1)] = neighbors[4] ? neighbors[4][tile_cell_index(i, j, n - 1)] : source[tile_cell_index(i, j, 0)];
+					padded[padded_cell_index(i, j, n)] = neighbors[5] ? neighbors[5][tile_cell_index(i, j, 0)] : source[tile_cell_index(i, j, n - 1)];
+				}
+			}
+
+			tile.peak = std::max(tile.peak, diffuse(padded.data(), destination, alphas[channel], decays[channel]));
+
+			// Find faces across which pheromone should spread into unallocated tiles
+			for (usize face = 0; face < 6; ++face)
+			{
+				if (neighbors[face] || (tile.boundary_mask & (1u << face)))
+				{
+					continue;
+				}
+
+				const usize axis = face / 2;
+				const isize layer = (face % 2) ? n - 1 : 0;
+				for (isize j = 0; j < n; ++j)
+				{
+					for (isize i = 0; i < n; ++i)
+					{
+						const usize index = axis == 0 ? tile_cell_index(layer, i, j) : axis == 1 ? tile_cell_index(i, layer, j) : tile_cell_index(i, j, layer);
+						if (destination[index] >= m_min_concentration)
+						{
+							tile.boundary_mask |= 1u << face;
+							i = n;
+							j = n;
+						}
+					}
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,172 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <engine/math/vector.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <engine/utility/worker-pool.hpp>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace engine::ai
+{
+	/// Properties of a pheromone.
+	struct pheromone_channel
+	{
+		/// Diffusion coefficient, in square units per second.
+		float diffusion_rate{};
+
+		/// Fraction of concentration which evaporates per second, as an exponential decay rate.
+		float evaporation_rate{};
+	};
+
+	/// Sparse 3D grid of pheromone concentrations which diffuse and evaporate over time.
+	/// @details The grid is divided into tiles of 8x8x8 cells, which are allocated when pheromone is deposited in them or diffuses into them, and released once every concentration in them has fallen below the minimum concentration. Only allocated tiles are updated, so idle regions cost nothing. Tiles are updated in parallel with SIMD kernels, and concentrations are conserved across tile boundaries. Cells outside of the grid, and cells of unallocated tiles, are treated as closed boundaries.
+	class pheromone_field
+	{
+	public:
+		/// Number of cells on each edge of a tile.
+		static constexpr u32 tile_size = 8;
+
+		/// Number of cells in a tile.
+		static constexpr usize tile_cell_count = tile_size * tile_size * tile_size;
+
+		/// Constructs a pheromone field.
+		/// @param origin Position of the minimum corner of the grid.
+		/// @param cell_size Length of the edges of each cell.
+		/// @param size Number of cells on each axis, which is rounded up to a multiple of the tile size.
+		/// @param channels Properties of each pheromone channel.
+		/// @param thread_count Number of threads which update tiles, including the thread which calls update(). If `0`, the number of hardware threads will be used.
+		/// @exception std::invalid_argument Nonpositive cell size, empty grid, or no channels.
+		pheromone_field(const math::fvec3& origin, float cell_size, const math::uvec3& size, std::span<const pheromone_channel> channels, usize thread_count = 0);
+
+		/// Adds pheromone to the cell which contains a position. Positions outside of the grid are ignored.
+		/// @param channel Index of a pheromone channel.
+		/// @param position Position of the deposit.
+		/// @param amount Concentration to add.
+		void deposit(usize channel, const math::fvec3& position, float amount);
+
+		/// Diffuses and evaporates pheromones.
+		/// @param dt Timestep, in seconds. If the timestep is too long for a stable diffusion step, it is divided into substeps.
+		void update(float dt);
+
+		/// Removes all pheromone and releases all tiles.
+		void clear();
+
+		/// Returns the concentration of a pheromone in the cell which contains a position.
+		/// @param channel Index of a pheromone channel.
+		/// @param position Position at which to sample.
+		/// @return Concentration, or `0` if the position is outside of the grid.
+		[[nodiscard]] float sample(usize channel, const math::fvec3& position) const noexcept;
+
+		/// Returns the concentration gradient of a pheromone at the cell which contains a position, by central differences.
+		/// @param channel Index of a pheromone channel.
+		/// @param position Position at which to sample.
+		/// @return Concentration gradient, in concentration per unit length.
+		[[nodiscard]] math::fvec3 gradient(usize channel, const math::fvec3& position) const noexcept;
+
+		/// Returns the concentration of a pheromone in a cell.
+		/// @param channel Index of a pheromone channel.
+		/// @param cell Coordinates of a cell.
+		/// @return Concentration, or `0` if the cell is outside of the grid.
+		[[nodiscard]] float get_concentration(usize channel, const math::ivec3& cell) const noexcept;
+
+		/// Sets the concentration below which tiles are considered idle and released.
+		/// @param concentration Minimum concentration.
+		inline void set_min_concentration(float concentration) noexcept
+		{
+			m_min_concentration = concentration;
+		}
+
+		/// Returns the concentration below which tiles are considered idle and released.
+		[[nodiscard]] inline float get_min_concentration() const noexcept
+		{
+			return m_min_concentration;
+		}
+
+		/// Returns the position of the minimum corner of the grid.
+		[[nodiscard]] inline const math::fvec3& get_origin() const noexcept
+		{
+			return m_origin;
+		}
+
+		/// Returns the length of the edges of each cell.
+		[[nodiscard]] inline float get_cell_size() const noexcept
+		{
+			return m_cell_size;
+		}
+
+		/// Returns the number of cells on each axis.
+		[[nodiscard]] inline math::uvec3 get_size() const noexcept
+		{
+			return m_tile_counts * tile_size;
+		}
+
+		/// Returns the number of pheromone channels.
+		[[nodiscard]] inline usize get_channel_count() const noexcept
+		{
+			return m_channels.size();
+		}
+
+		/// Returns the number of allocated tiles.
+		[[nodiscard]] inline usize get_tile_count() const noexcept
+		{
+			return m_tiles.size();
+		}
+
+		/// Returns the number of cells updated by the last update, summed over channels and substeps.
+		[[nodiscard]] inline usize get_updated_cell_count() const noexcept
+		{
+			return m_updated_cell_count;
+		}
+
+	private:
+		/// Allocated tile.
+		struct tile
+		{
+			/// Index of the tile in the tile directory.
+			u32 directory_index;
+
+			/// Concentrations, indexed by buffer, channel, and cell.
+			std::unique_ptr<float[]> data;
+
+			/// Maximum concentration after the last step.
+			float peak;
+
+			/// Bit mask of the faces whose cells exceeded the minimum concentration after the last step, in the order -x, +x, -y, +y, -z, +z.
+			u32 boundary_mask;
+		};
+
+		/// Returns the directory index of the tile which contains a cell, or `-1` if the cell is outside of the grid.
+		[[nodiscard]] isize find_directory_index(const math::ivec3& cell) const noexcept;
+
+		/// Returns the cell which contains a position.
+		[[nodiscard]] math::ivec3 position_to_cell(const math::fvec3& position) const noexcept;
+
+		/// Returns the tile with a directory index, allocating it if necessary.
+		tile& allocate_tile(u32 directory_index);
+
+		/// Diffuses and evaporates all channels of a tile.
+		void step_tile(tile& tile, std::span<float> padded, std::span<const float> alphas, std::span<const float> decays) const noexcept;
+
+		/// Returns the concentrations of a channel of a tile in the current buffer, or `nullptr` if the tile is not allocated.
+		[[nodiscard]] const float* find_tile_data(isize directory_index, usize channel) const noexcept;
+
+		math::fvec3 m_origin;
+		float m_cell_size;
+		math::uvec3 m_tile_counts;
+		std::vector<pheromone_channel> m_channels;
+		float m_min_concentration{1e-4f};
+
+		std::vector<u32> m_directory;
+		std::vector<tile> m_tiles;
+		std::vector<std::unique_ptr<float[]>> m_free_tile_data;
+		usize m_buffer{0};
+		usize m_updated_cell_count{0};
+
+		std::vector<std::vector<float>> m_padded_tiles;
+		worker_pool m_pool;
+	};
+}
@@ -0,0 +1,97 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <engine/math/simd/packet.hpp>
+#include <engine/utility/sized-types.hpp>
+
+namespace engine::ai::pheromone_kernels
+{
+	/// Number of cells on each edge of a pheromone field tile.
+	inline constexpr usize tile_size = 8;
+
+	/// Number of cells on each edge of a padded tile, which includes one layer of neighboring cells.
+	inline constexpr usize padded_tile_size = tile_size + 2;
+
+	/// Number of cells in a padded tile.
+	inline constexpr usize padded_tile_cell_count = padded_tile_size * padded_tile_size * padded_tile_size;
+}
+
+// Diffusion kernels are compiled once per instruction set, in translation units with different code generation flags. Each instantiation is declared here in the namespace of its instruction set, and selected at runtime by the pheromone field.
+#define ENGINE_AI_DECLARE_PHEROMONE_KERNELS(isa_name) \
+	namespace engine::ai::pheromone_kernels::isa_name \
+	{ \
+		float diffuse(const float* source, float* destination, float alpha, float decay) noexcept; \
+	}
+
+ENGINE_AI_DECLARE_PHEROMONE_KERNELS(sse2)
+ENGINE_AI_DECLARE_PHEROMONE_KERNELS(avx2)
+
+#undef ENGINE_AI_DECLARE_PHEROMONE_KERNELS
+
+// Defines the kernels declared above for one instruction set, with a packet width of `W`
+#define ENGINE_AI_DEFINE_PHEROMONE_KERNELS(W) \
+	float diffuse(const float* source, float* destination, float alpha, float decay) noexcept \
+	{ \
+		return diffuse_kernel<W>(source, destination, alpha, decay); \
+	}
+
+namespace engine::ai::pheromone_kernels::ENGINE_MATH_SIMD_ISA
+{
+	using namespace math::simd;
+
+	/// Diffuses and evaporates one channel of a tile, with an explicit finite difference step of the heat equation followed by exponential decay.
+	/// @tparam W Packet width.
+	/// @param source Padded tile of concentrations.
+	/// @param[out] destination Unpadded tile of new concentrations.
+	/// @param alpha Diffusion rate, multiplied by the timestep and divided by the square of the cell size. Must not exceed `1/6`.
+	/// @param decay Fraction of concentration which remains after evaporation.
+	/// @return Maximum new concentration.
+	template <usize W>
+	[[nodiscard]] float diffuse_kernel(const float* source, float* destination, float alpha, float decay) noexcept
+	{
+		static_assert(tile_size % W == 0);
+
+		constexpr usize row_stride = padded_tile_size;
+		constexpr usize slice_stride = padded_tile_size * padded_tile_size;
+
+		const auto alpha_packet = make_packet<W>(alpha);
+		const auto decay_packet = make_packet<W>(decay);
+		const auto six = make_packet<W>(6.0f);
+		auto peak = make_packet<W>(0.0f);
+
+		for (usize z = 0; z < tile_size; ++z)
+		{
+			for (usize y = 0; y < tile_size; ++y)
+			{
+				const float* row = source + (z + 1) * slice_stride + (y + 1) * row_stride + 1;
+				float* output = destination + (z * tile_size + y) * tile_size;
+
+				for (usize x = 0; x < tile_size; x += W)
+				{
+					const float* cell = row + x;
+					const auto center = load_packet<W>(cell);
+					const auto neighbor_sum =
+						(load_packet<W>(cell - 1) + load_packet<W>(cell + 1)) +
+						(load_packet<W>(cell - row_stride) + load_packet<W>(cell + row_stride)) +
+						(load_packet<W>(cell - slice_stride) + load_packet<W>(cell + slice_stride));
+
+					const auto value = fma(alpha_packet, neighbor_sum - six * center, center) * decay_packet;
+					store_packet(value, output + x);
+					peak = max(peak, value);
+				}
+			}
+		}
+
+		alignas(32) float lanes[W];
+		store_packet(peak, lanes);
+		float result = lanes[0];
+		for (usize i = 1; i < W; ++i)
+		{
+			result = lanes[i] > result ? lanes[i] : result;
+		}
+
+		return result;
+	}
+}
@@ -0,0 +1,28 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <engine/ai/steering/behavior/alignment.hpp>
+
+namespace engine::ai::steering::behavior
+{
+	math::fvec3 alignment(const agent& agent, std::span<const steering::agent> agents, std::span<const u32> neighbors)
+	{
+		math::fvec3 velocity = {0, 0, 0};
+		usize count = 0;
+		for (const u32 i: neighbors)
+		{
+			if (&agents[i] != &agent)
+			{
+				velocity += agents[i].velocity;
+				++count;
+			}
+		}
+
+		if (!count)
+		{
+			return {0, 0, 0};
+		}
+
+		return velocity / static_cast<float>(count) - agent.velocity;
+	}
+}
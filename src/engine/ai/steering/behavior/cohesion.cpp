@@ -0,0 +1,29 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <engine/ai/steering/behavior/cohesion.hpp>
+#include <engine/ai/steering/behavior/seek.hpp>
+
+namespace engine::ai::steering::behavior
+{
+	math::fvec3 cohesion(const agent& agent, std::span<const steering::agent> agents, std::span<const u32> neighbors)
+	{
+		math::fvec3 center = {0, 0, 0};
+		usize count = 0;
+		for (const u32 i: neighbors)
+		{
+			if (&agents[i] != &agent)
+			{
+				center += agents[i].position;
+				++count;
+			}
+		}
+
+		if (!count)
+		{
+			return {0, 0, 0};
+		}
+
+		return seek(agent, center / static_cast<float>(count));
+	}
+}
@@ -0,0 +1,19 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <engine/math/vector.hpp>
+#include <engine/ai/steering/agent.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <span>
+
+namespace engine::ai::steering::behavior
+{
+	/// Steers an agent toward the center of its neighbors.
+	/// @param agent Autonomous agent to steer.
+	/// @param agents Agents which @p neighbors index.
+	/// @param neighbors Indices of the neighbors of the agent. The agent itself may be included, and is ignored.
+	/// @return Cohesion force.
+	[[nodiscard]] math::fvec3 cohesion(const agent& agent, std::span<const steering::agent> agents, std::span<const u32> neighbors);
+}
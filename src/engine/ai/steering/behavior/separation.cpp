@@ -0,0 +1,33 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <engine/ai/steering/behavior/separation.hpp>
+#include <engine/math/functions.hpp>
+
+namespace engine::ai::steering::behavior
+{
+	math::fvec3 separation(const agent& agent, std::span<const steering::agent> agents, std::span<const u32> neighbors)
+	{
+		// Sum offsets from neighbors, weighted by inverse distance
+		math::fvec3 repulsion = {0, 0, 0};
+		for (const u32 i: neighbors)
+		{
+			const math::fvec3 difference = agent.position - agents[i].position;
+			const float sqr_distance = math::dot(difference, difference);
+			if (sqr_distance)
+			{
+				repulsion += difference / sqr_distance;
+			}
+		}
+
+		math::fvec3 force = {0, 0, 0};
+		const float sqr_length = math::dot(repulsion, repulsion);
+		if (sqr_length)
+		{
+			force = repulsion * (agent.max_force / math::sqrt(sqr_length));
+			force -= agent.velocity;
+		}
+
+		return force;
+	}
+}
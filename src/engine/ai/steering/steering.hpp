@@ -4,8 +4,11 @@
 #pragma once
 
 #include <engine/ai/steering/agent.hpp>
+#include <engine/ai/steering/behavior/alignment.hpp>
+#include <engine/ai/steering/behavior/cohesion.hpp>
 #include <engine/ai/steering/behavior/flee.hpp>
 #include <engine/ai/steering/behavior/seek.hpp>
+#include <engine/ai/steering/behavior/separation.hpp>
 #include <engine/ai/steering/behavior/wander.hpp>
 
 /// Autonomous agent steering.
@@ -0,0 +1,325 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <nlohmann/json.hpp>
+#include <engine/animation/baked-clip.hpp>
+#include <engine/animation/skeleton.hpp>
+#include <engine/animation/skeleton-pose.hpp>
+#include <engine/resources/deserializer.hpp>
+#include <engine/resources/deserialize-error.hpp>
+#include <engine/resources/resource-loader.hpp>
+#include <engine/math/euler-angles.hpp>
+#include <engine/math/functions.hpp>
+#include <engine/math/quaternion.hpp>
+#include <algorithm>
+#include <format>
+#include <stdexcept>
+#include <string_view>
+
+namespace engine::animation
+{
+	u32 baked_clip::add_channel(std::span<const float> times, std::span<const float> values, baked_interpolation interpolation)
+	{
+		if (times.empty() || times.size() != values.size())
+		{
+			throw std::invalid_argument("Failed to add baked animation channel: mismatched or empty keys.");
+		}
+
+		if (!std::is_sorted(times.begin(), times.end()))
+		{
+			throw std::invalid_argument("Failed to add baked animation channel: key times not sorted.");
+		}
+
+		auto& channel = m_channels.emplace_back();
+		channel.first_key = static_cast<u32>(m_key_times.size());
+		channel.key_count = static_cast<u32>(times.size());
+		channel.interpolation = interpolation;
+
+		m_key_times.insert(m_key_times.end(), times.begin(), times.end());
+		m_key_values.insert(m_key_values.end(), values.begin(), values.end());
+
+		m_duration = math::max(m_duration, times.back());
+
+		return static_cast<u32>(m_channels.size() - 1);
+	}
+
+	void baked_clip::add_track(const std::string& path, u32 first_channel)
+	{
+		// Split path into bone name and property name
+		const auto separator = path.rfind('/');
+		if (separator == std::string::npos || separator == 0 || separator + 1 == path.size())
+		{
+			throw std::invalid_argument(std::format("Failed to add baked animation track: invalid data path \"{}\".", path));
+		}
+
+		const auto property_name = std::string_view(path).substr(separator + 1);
+
+		auto& track = m_tracks.emplace_back();
+		track.path = path;
+		track.first_channel = first_channel;
+
+		if (property_name == "translation")
+		{
+			track.property = baked_bone_property::translation;
+		}
+		else if (property_name == "rotation_quaternion")
+		{
+			track.property = baked_bone_property::rotation_quaternion;
+		}
+		else if (property_name == "rotation_euler")
+		{
+			track.property = baked_bone_property::rotation_euler;
+		}
+		else if (property_name == "scale")
+		{
+			track.property = baked_bone_property::scale;
+		}
+		else
+		{
+			m_tracks.pop_back();
+			throw std::invalid_argument(std::format("Failed to add baked animation track: unsupported property \"{}\".", property_name));
+		}
+
+		if (first_channel + channel_count(track.property) > m_channels.size())
+		{
+			m_tracks.pop_back();
+			throw std::out_of_range("Failed to add baked animation track: track channels not in clip.");
+		}
+	}
+
+	void baked_clip::bind(const animation::skeleton& skeleton)
+	{
+		for (auto& track: m_tracks)
+		{
+			const auto bone_name = track.path.substr(0, track.path.rfind('/'));
+
+			const auto bone_it = skeleton.bones().find(bone_name);
+			if (bone_it == skeleton.bones().end())
+			{
+				throw std::runtime_error(std::format("Failed to bind baked animation track to bone: bone \"{}\" not found.", bone_name));
+			}
+
+			track.bone_index = bone_it->index();
+		}
+	}
+
+	void baked_clip::sample(float time, std::span<u32> cursors, std::span<math::transform<float>> pose) const
+	{
+		for (const auto& track: m_tracks)
+		{
+			sample_track(track, time, cursors, pose[track.bone_index]);
+		}
+	}
+
+	void baked_clip::sample(float time, std::span<u32> cursors, skeleton_pose& pose) const
+	{
+		for (const auto& track: m_tracks)
+		{
+			auto transform = pose.get_relative_transform(track.bone_index);
+			sample_track(track, time, cursors, transform);
+			pose.set_relative_transform(track.bone_index, transform);
+		}
+	}
+
+	float baked_clip::evaluate(usize index, float time, u32& cursor) const noexcept
+	{
+		const auto& channel = m_channels[index];
+		const float* times = m_key_times.data() + channel.first_key;
+		const float* values = m_key_values.data() + channel.first_key;
+		const u32 last = channel.key_count - 1;
+
+		// Clamp to first and last keys
+		if (!(time > times[0]))
+		{
+			cursor = 0;
+			return values[0];
+		}
+		if (time >= times[last])
+		{
+			cursor = last;
+			return values[last];
+		}
+
+		// Find key k such that times[k] <= time < times[k + 1], starting from the cached key
+		u32 k = cursor < last ? cursor : 0;
+		if (times[k] > time)
+		{
+			// Playback has moved backwards, such as when looping
+			k = static_cast<u32>(std::upper_bound(times, times + last, time) - times - 1);
+		}
+		else
+		{
+			// Step forward a few keys, falling back to a binary search after a seek
+			for (u32 steps = 0; times[k + 1] <= time; ++k)
+			{
+				if (++steps == 4)
+				{
+					k = static_cast<u32>(std::upper_bound(times + k + 1, times + last, time) - times - 1);
+					break;
+				}
+			}
+		}
+
+		cursor = k;
+
+		switch (channel.interpolation)
+		{
+			case baked_interpolation::constant:
+				return values[k];
+
+			case baked_interpolation::linear:
+			default:
+				return math::lerp(values[k], values[k + 1], (time - times[k]) / (times[k + 1] - times[k]));
+		}
+	}
+
+	void baked_clip::sample_track(const track& track, float time, std::span<u32> cursors, math::transform<float>& transform) const noexcept
+	{
+		const auto first = track.first_channel;
+
+		switch (track.property)
+		{
+			case baked_bone_property::translation:
+				transform.translation =
+				{
+					evaluate(first, time, cursors[first]),
+					evaluate(first + 1, time, cursors[first + 1]),
+					evaluate(first + 2, time, cursors[first + 2])
+				};
+				break;
+
+			case baked_bone_property::rotation_quaternion:
+				transform.rotation = math::normalize(math::fquat
+				{
+					evaluate(first, time, cursors[first]),
+					evaluate(first + 1, time, cursors[first + 1]),
+					evaluate(first + 2, time, cursors[first + 2]),
+					evaluate(first + 3, time, cursors[first + 3])
+				});
+				break;
+
+			case baked_bone_property::rotation_euler:
+				transform.rotation = math::euler_xyz_to_quat(math::fvec3
+				{
+					evaluate(first, time, cursors[first]),
+					evaluate(first + 1, time, cursors[first + 1]),
+					evaluate(first + 2, time, cursors[first + 2])
+				});
+				break;
+
+			case baked_bone_property::scale:
+				transform.scale =
+				{
+					evaluate(first, time, cursors[first]),
+					evaluate(first + 1, time, cursors[first + 1]),
+					evaluate(first + 2, time, cursors[first + 2])
+				};
+				break;
+		}
+	}
+}
+
+namespace engine::resources
+{
+	using namespace engine::animation;
+
+	/// Deserializes a baked clip from an animation sequence file.
+	/// @param[out] clip Baked clip to deserialize.
+	/// @param[in,out] ctx Deserialize context.
+	/// @throw deserialize_error Read error.
+	template <>
+	void deserializer<baked_clip>::deserialize(baked_clip& clip, deserialize_context& ctx)
+	{
+		// Read file into buffer
+		std::string file_buffer(ctx.size(), '\0');
+		ctx.read8(reinterpret_cast<std::byte*>(file_buffer.data()), ctx.size());
+
+		// Parse JSON from file buffer
+		const auto json = nlohmann::json::parse(file_buffer, nullptr, true, true);
+
+		// Check version string
+		const auto& version = json.at("version").get_ref<const std::string&>();
+		if (version != "1.0.0")
+		{
+			throw deserialize_error(std::format("Unsupported animation format (version {}).", version));
+		}
+
+		// Set clip name
+		clip.name() = json.at("name").get_ref<const std::string&>();
+
+		std::vector<float> times;
+		std::vector<float> values;
+
+		// Load tracks
+		for (const auto& [track_path, track_element] : json.at("tracks").items())
+		{
+			const auto& channels_element = track_element.at("channels");
+
+			const u32 first_channel = static_cast<u32>(clip.channels().size());
+
+			// Load channels
+			for (const auto& channel_element: channels_element)
+			{
+				// Determine interpolation mode
+				baked_interpolation interpolation;
+				const auto& interpolation_mode = channel_element.at("interpolation").get_ref<const std::string&>();
+				if (interpolation_mode == "linear")
+				{
+					interpolation = baked_interpolation::linear;
+				}
+				else if (interpolation_mode == "constant")
+				{
+					interpolation = baked_interpolation::constant;
+				}
+				else
+				{
+					throw deserialize_error(std::format("Animation channel has unsupported interpolation mode (\"{}\").", interpolation_mode));
+				}
+
+				// Load keyframes
+				const auto& keyframes_element = channel_element.at("keyframes");
+				times.clear();
+				values.clear();
+				for (usize j = 0; j + 1 < keyframes_element.size(); j += 2)
+				{
+					times.emplace_back(keyframes_element.at(j).get<float>());
+					values.emplace_back(keyframes_element.at(j + 1).get<float>());
+				}
+
+				try
+				{
+					clip.add_channel(times, values, interpolation);
+				}
+				catch (const std::invalid_argument& e)
+				{
+					throw deserialize_error(e.what());
+				}
+			}
+
+			// Add track
+			try
+			{
+				clip.add_track(track_path, first_channel);
+			}
+			catch (const std::logic_error& e)
+			{
+				throw deserialize_error(e.what());
+			}
+
+			if (channels_element.size() != baked_clip::channel_count(clip.tracks().back().property))
+			{
+				throw deserialize_error(std::format("Animation track \"{}\" has an unexpected number of channels ({}).", track_path, channels_element.size()));
+			}
+		}
+	}
+
+	template <>
+	std::unique_ptr<baked_clip> resource_loader<baked_clip>::load(resource_manager&, std::shared_ptr<deserialize_context> ctx)
+	{
+		auto resource = std::make_unique<baked_clip>();
+
+		deserializer<baked_clip>().deserialize(*resource, *ctx);
+
+		return resource;
+	}
+}
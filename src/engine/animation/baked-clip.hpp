@@ -0,0 +1,170 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <engine/math/transform.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace engine::animation
+{
+	class skeleton;
+	class skeleton_pose;
+
+	/// Interpolation modes of baked animation channels.
+	enum class baked_interpolation: u8
+	{
+		/// Value of the preceding key.
+		constant,
+
+		/// Linear interpolation between the preceding and following keys.
+		linear
+	};
+
+	/// Bone properties which can be animated by a baked animation track.
+	enum class baked_bone_property: u8
+	{
+		/// Relative translation, with three channels.
+		translation,
+
+		/// Relative rotation, as a quaternion with four channels, in `w, x, y, z` order.
+		rotation_quaternion,
+
+		/// Relative rotation, as XYZ Euler angles with three channels.
+		rotation_euler,
+
+		/// Relative scale, with three channels.
+		scale
+	};
+
+	/// Skeletal animation clip, baked into a cache-friendly representation for fast sampling.
+	/// @details Unlike an animation_sequence, the keys of all channels of a baked clip are stored in two contiguous arrays of key times and key values, interpolation is dispatched by enumeration rather than through function objects, and tracks are bound to bone indices rather than invoking output functions. Playback state is kept outside of the clip, in per-channel key cursors, so that a single clip may be shared by any number of concurrently playing instances.
+	/// @see animation_sequence
+	class baked_clip
+	{
+	public:
+		/// Channel of a baked clip.
+		struct channel
+		{
+			/// Index of the first key of the channel in the key arrays of the clip.
+			u32 first_key{};
+
+			/// Number of keys in the channel.
+			u32 key_count{};
+
+			/// Interpolation mode of the channel.
+			baked_interpolation interpolation{baked_interpolation::linear};
+		};
+
+		/// Track of a baked clip, which animates one property of one bone.
+		struct track
+		{
+			/// Data path of the track, in the form `<bone name>/<property name>`.
+			std::string path;
+
+			/// Index of the animated bone, resolved by bind().
+			usize bone_index{};
+
+			/// Animated bone property.
+			baked_bone_property property{};
+
+			/// Index of the first channel of the track.
+			u32 first_channel{};
+		};
+
+		/// Returns the number of channels which animate a bone property.
+		/// @param property Bone property.
+		/// @return Number of channels.
+		[[nodiscard]] static constexpr usize channel_count(baked_bone_property property) noexcept
+		{
+			return property == baked_bone_property::rotation_quaternion ? 4 : 3;
+		}
+
+		/// Adds a channel to the clip.
+		/// @param times Key times, sorted in ascending order.
+		/// @param values Key values.
+		/// @param interpolation Interpolation mode of the channel.
+		/// @return Index of the added channel.
+		/// @exception std::invalid_argument Channel has no keys, or a different number of key times and key values.
+		u32 add_channel(std::span<const float> times, std::span<const float> values, baked_interpolation interpolation = baked_interpolation::linear);
+
+		/// Adds a track to the clip.
+		/// @param path Data path of the track, in the form `<bone name>/<property name>`.
+		/// @param first_channel Index of the first channel of the track. The track uses `channel_count(property)` consecutive channels.
+		/// @exception std::invalid_argument Invalid data path.
+		/// @exception std::out_of_range Track channels not in clip.
+		void add_track(const std::string& path, u32 first_channel);
+
+		/// Resolves the bone indices of the tracks of the clip.
+		/// @param skeleton Skeleton to which the clip should be bound.
+		/// @exception std::runtime_error Bone not found.
+		void bind(const animation::skeleton& skeleton);
+
+		/// Samples all tracks of the clip into a pose buffer.
+		/// @param time Time at which to sample the clip, clamped to the clip's keys.
+		/// @param[in,out] cursors Key cursors of each channel, which cache the most recently used key of each channel. Must hold `channels().size()` elements, initially zero, which are retained between calls to accelerate monotonic playback.
+		/// @param[in,out] pose Relative bone transforms, indexed by bone. Properties of bones which are not animated by the clip are left unchanged.
+		void sample(float time, std::span<u32> cursors, std::span<math::transform<float>> pose) const;
+
+		/// Samples all tracks of the clip into a skeleton pose.
+		/// @param time Time at which to sample the clip, clamped to the clip's keys.
+		/// @param[in,out] cursors Key cursors of each channel.
+		/// @param[in,out] pose Skeleton pose.
+		void sample(float time, std::span<u32> cursors, skeleton_pose& pose) const;
+
+		/// Returns the channels of the clip.
+		[[nodiscard]] inline const std::vector<channel>& channels() const noexcept
+		{
+			return m_channels;
+		}
+
+		/// Returns the tracks of the clip.
+		[[nodiscard]] inline const std::vector<track>& tracks() const noexcept
+		{
+			return m_tracks;
+		}
+
+		/// Returns the non-negative duration of the clip, in seconds.
+		[[nodiscard]] inline float duration() const noexcept
+		{
+			return m_duration;
+		}
+
+		/// Returns a reference to the name of the clip.
+		[[nodiscard]] inline constexpr auto& name() noexcept
+		{
+			return m_name;
+		}
+
+		/// @copydoc name()
+		[[nodiscard]] inline constexpr const auto& name() const noexcept
+		{
+			return m_name;
+		}
+
+	private:
+		/// Evaluates a channel at a given time.
+		/// @param index Index of the channel.
+		/// @param time Evaluation time.
+		/// @param[in,out] cursor Key cursor of the channel.
+		/// @return Value of the channel at @p time.
+		[[nodiscard]] float evaluate(usize index, float time, u32& cursor) const noexcept;
+
+		/// Samples a track into a bone transform.
+		/// @param track Track to sample.
+		/// @param time Sample time.
+		/// @param[in,out] cursors Key cursors of each channel.
+		/// @param[in,out] transform Relative bone transform.
+		void sample_track(const track& track, float time, std::span<u32> cursors, math::transform<float>& transform) const noexcept;
+
+		std::string m_name;
+		std::vector<float> m_key_times;
+		std::vector<float> m_key_values;
+		std::vector<channel> m_channels;
+		std::vector<track> m_tracks;
+		float m_duration{};
+	};
+}
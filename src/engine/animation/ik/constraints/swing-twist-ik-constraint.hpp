@@ -22,6 +22,30 @@ namespace engine::animation
 		/// @param max_angle Maximum twist angle, in radians.
 		void set_twist_limit(float min_angle, float max_angle);
 
+		/// Returns the cosine of half of the minimum twist angle.
+		[[nodiscard]] inline constexpr float get_cos_half_twist_min() const noexcept
+		{
+			return m_cos_half_twist_min;
+		}
+
+		/// Returns the sine of half of the minimum twist angle.
+		[[nodiscard]] inline constexpr float get_sin_half_twist_min() const noexcept
+		{
+			return m_sin_half_twist_min;
+		}
+
+		/// Returns the cosine of half of the maximum twist angle.
+		[[nodiscard]] inline constexpr float get_cos_half_twist_max() const noexcept
+		{
+			return m_cos_half_twist_max;
+		}
+
+		/// Returns the sine of half of the maximum twist angle.
+		[[nodiscard]] inline constexpr float get_sin_half_twist_max() const noexcept
+		{
+			return m_sin_half_twist_max;
+		}
+
 	private:
 		float m_cos_half_twist_min{0};
 		float m_sin_half_twist_min{-1};
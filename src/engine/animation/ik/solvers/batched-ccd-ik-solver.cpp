@@ -0,0 +1,721 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <engine/animation/ik/solvers/batched-ccd-ik-solver.hpp>
+#include <engine/animation/skeleton.hpp>
+#include <engine/animation/skeleton-pose.hpp>
+#include <engine/debug/contract.hpp>
+#include <engine/math/constants.hpp>
+#include <engine/math/quaternion.hpp>
+#include <algorithm>
+#include <stdexcept>
+#include <emmintrin.h>
+
+namespace engine::animation
+{
+	namespace
+	{
+		/// Field offsets of a transform in a group.
+		enum transform_field: usize
+		{
+			translation_x,
+			translation_y,
+			translation_z,
+			rotation_w,
+			rotation_x,
+			rotation_y,
+			rotation_z,
+			scale_x,
+			scale_y,
+			scale_z,
+			transform_field_count
+		};
+
+		/// Number of fields of the effector position and goal center.
+		constexpr usize target_field_count = 6;
+
+		struct lane_vec3
+		{
+			__m128 x;
+			__m128 y;
+			__m128 z;
+		};
+
+		struct lane_quat
+		{
+			__m128 w;
+			__m128 x;
+			__m128 y;
+			__m128 z;
+		};
+
+		struct lane_transform
+		{
+			lane_vec3 translation;
+			lane_quat rotation;
+			lane_vec3 scale;
+		};
+
+		[[nodiscard]] inline __m128 select(__m128 mask, __m128 a, __m128 b) noexcept
+		{
+			return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+		}
+
+		[[nodiscard]] inline __m128 copysign(__m128 magnitude, __m128 sign) noexcept
+		{
+			const __m128 sign_mask = _mm_set1_ps(-0.0f);
+			return _mm_or_ps(_mm_andnot_ps(sign_mask, magnitude), _mm_and_ps(sign_mask, sign));
+		}
+
+		[[nodiscard]] inline __m128 abs(__m128 x) noexcept
+		{
+			return _mm_andnot_ps(_mm_set1_ps(-0.0f), x);
+		}
+
+		[[nodiscard]] inline lane_vec3 operator+(const lane_vec3& a, const lane_vec3& b) noexcept
+		{
+			return {_mm_add_ps(a.x, b.x), _mm_add_ps(a.y, b.y), _mm_add_ps(a.z, b.z)};
+		}
+
+		[[nodiscard]] inline lane_vec3 operator-(const lane_vec3& a, const lane_vec3& b) noexcept
+		{
+			return {_mm_sub_ps(a.x, b.x), _mm_sub_ps(a.y, b.y), _mm_sub_ps(a.z, b.z)};
+		}
+
+		[[nodiscard]] inline lane_vec3 operator*(const lane_vec3& a, const lane_vec3& b) noexcept
+		{
+			return {_mm_mul_ps(a.x, b.x), _mm_mul_ps(a.y, b.y), _mm_mul_ps(a.z, b.z)};
+		}
+
+		[[nodiscard]] inline lane_vec3 operator*(const lane_vec3& a, __m128 b) noexcept
+		{
+			return {_mm_mul_ps(a.x, b), _mm_mul_ps(a.y, b), _mm_mul_ps(a.z, b)};
+		}
+
+		[[nodiscard]] inline __m128 dot(const lane_vec3& a, const lane_vec3& b) noexcept
+		{
+			return _mm_add_ps(_mm_add_ps(_mm_mul_ps(a.x, b.x), _mm_mul_ps(a.y, b.y)), _mm_mul_ps(a.z, b.z));
+		}
+
+		[[nodiscard]] inline lane_vec3 cross(const lane_vec3& a, const lane_vec3& b) noexcept
+		{
+			return
+			{
+				_mm_sub_ps(_mm_mul_ps(a.y, b.z), _mm_mul_ps(a.z, b.y)),
+				_mm_sub_ps(_mm_mul_ps(a.z, b.x), _mm_mul_ps(a.x, b.z)),
+				_mm_sub_ps(_mm_mul_ps(a.x, b.y), _mm_mul_ps(a.y, b.x))
+			};
+		}
+
+		[[nodiscard]] inline lane_vec3 normalize(const lane_vec3& v) noexcept
+		{
+			return v * _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(dot(v, v)));
+		}
+
+		[[nodiscard]] inline lane_vec3 select(__m128 mask, const lane_vec3& a, const lane_vec3& b) noexcept
+		{
+			return {select(mask, a.x, b.x), select(mask, a.y, b.y), select(mask, a.z, b.z)};
+		}
+
+		[[nodiscard]] inline lane_quat select(__m128 mask, const lane_quat& a, const lane_quat& b) noexcept
+		{
+			return {select(mask, a.w, b.w), select(mask, a.x, b.x), select(mask, a.y, b.y), select(mask, a.z, b.z)};
+		}
+
+		[[nodiscard]] inline lane_quat operator*(const lane_quat& a, const lane_quat& b) noexcept
+		{
+			return
+			{
+				_mm_sub_ps(_mm_sub_ps(_mm_mul_ps(a.w, b.w), _mm_mul_ps(a.x, b.x)), _mm_add_ps(_mm_mul_ps(a.y, b.y), _mm_mul_ps(a.z, b.z))),
+				_mm_add_ps(_mm_add_ps(_mm_mul_ps(a.w, b.x), _mm_mul_ps(b.w, a.x)), _mm_sub_ps(_mm_mul_ps(a.y, b.z), _mm_mul_ps(a.z, b.y))),
+				_mm_add_ps(_mm_add_ps(_mm_mul_ps(a.w, b.y), _mm_mul_ps(b.w, a.y)), _mm_sub_ps(_mm_mul_ps(a.z, b.x), _mm_mul_ps(a.x, b.z))),
+				_mm_add_ps(_mm_add_ps(_mm_mul_ps(a.w, b.z), _mm_mul_ps(b.w, a.z)), _mm_sub_ps(_mm_mul_ps(a.x, b.y), _mm_mul_ps(a.y, b.x)))
+			};
+		}
+
+		[[nodiscard]] inline lane_quat conjugate(const lane_quat& q) noexcept
+		{
+			const __m128 sign_mask = _mm_set1_ps(-0.0f);
+			return {q.w, _mm_xor_ps(q.x, sign_mask), _mm_xor_ps(q.y, sign_mask), _mm_xor_ps(q.z, sign_mask)};
+		}
+
+		[[nodiscard]] inline lane_quat normalize(const lane_quat& q) noexcept
+		{
+			const __m128 sqr_length = _mm_add_ps(_mm_add_ps(_mm_mul_ps(q.w, q.w), _mm_mul_ps(q.x, q.x)), _mm_add_ps(_mm_mul_ps(q.y, q.y), _mm_mul_ps(q.z, q.z)));
+			const __m128 rcp_length = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(sqr_length));
+			return {_mm_mul_ps(q.w, rcp_length), _mm_mul_ps(q.x, rcp_length), _mm_mul_ps(q.y, rcp_length), _mm_mul_ps(q.z, rcp_length)};
+		}
+
+		/// Rotates a vector by a unit quaternion.
+		[[nodiscard]] inline lane_vec3 rotate(const lane_quat& q, const lane_vec3& v) noexcept
+		{
+			const lane_vec3 u{q.x, q.y, q.z};
+			const lane_vec3 t = cross(u, v);
+			const __m128 two = _mm_set1_ps(2.0f);
+			return v + (t * _mm_mul_ps(two, q.w)) + (cross(u, t) * two);
+		}
+
+		/// Transforms a point by a transform.
+		[[nodiscard]] inline lane_vec3 transform_point(const lane_transform& t, const lane_vec3& v) noexcept
+		{
+			return t.translation + rotate(t.rotation, t.scale * v);
+		}
+
+		/// Combines two transforms.
+		[[nodiscard]] inline lane_transform combine(const lane_transform& x, const lane_transform& y) noexcept
+		{
+			return {transform_point(x, y.translation), normalize(x.rotation * y.rotation), x.scale * y.scale};
+		}
+
+		/// Constructs quaternions representing the minimum rotations from unit vectors to unit vectors.
+		/// @see math::rotation()
+		[[nodiscard]] lane_quat rotation(const lane_vec3& from, const lane_vec3& to, float tolerance) noexcept
+		{
+			const __m128 one = _mm_set1_ps(1.0f);
+			const __m128 zero = _mm_setzero_ps();
+			const __m128 cos_theta = dot(from, to);
+
+			// Minimum rotation
+			const __m128 r = _mm_add_ps(cos_theta, one);
+			const lane_vec3 i = cross(from, to);
+			const __m128 rcp_length = _mm_div_ps(one, _mm_sqrt_ps(_mm_add_ps(r, r)));
+			lane_quat q{_mm_mul_ps(r, rcp_length), _mm_mul_ps(i.x, rcp_length), _mm_mul_ps(i.y, rcp_length), _mm_mul_ps(i.z, rcp_length)};
+
+			// Codirectional vectors, identity rotation
+			const __m128 codirectional = _mm_cmpge_ps(cos_theta, _mm_set1_ps(1.0f - tolerance));
+			q = select(codirectional, lane_quat{one, zero, zero, zero}, q);
+
+			// Opposing vectors, 180 degree rotation about an axis orthogonal to the source vector
+			const __m128 opposing = _mm_cmple_ps(cos_theta, _mm_set1_ps(tolerance - 1.0f));
+			if (_mm_movemask_ps(opposing))
+			{
+				const __m128 s = copysign(one, from.z);
+				const __m128 a = _mm_div_ps(_mm_set1_ps(-1.0f), _mm_add_ps(s, from.z));
+				const lane_quat flip
+				{
+					zero,
+					_mm_add_ps(one, _mm_mul_ps(_mm_mul_ps(s, _mm_mul_ps(from.x, from.x)), a)),
+					_mm_mul_ps(s, _mm_mul_ps(_mm_mul_ps(from.x, from.y), a)),
+					_mm_sub_ps(zero, _mm_mul_ps(s, from.x))
+				};
+				q = select(opposing, flip, q);
+			}
+
+			return q;
+		}
+
+		/// Approximates the arctangent of `y / x`, with a maximum error of about 1e-7 radians.
+		/// @see Moshier, S. L. (1992). Cephes Mathematical Library, `atanf`.
+		[[nodiscard]] __m128 atan2(__m128 y, __m128 x) noexcept
+		{
+			const __m128 zero = _mm_setzero_ps();
+			const __m128 one = _mm_set1_ps(1.0f);
+
+			// Reduce |y / x| to [0, tan(pi / 8)]
+			const __m128 ax = abs(x);
+			const __m128 ay = abs(y);
+			const __m128 swap = _mm_cmpgt_ps(ay, ax);
+			const __m128 numerator = select(swap, ax, ay);
+			const __m128 denominator = select(swap, ay, ax);
+			__m128 t = _mm_div_ps(numerator, denominator);
+			t = select(_mm_cmpeq_ps(denominator, zero), zero, t);
+			const __m128 shift = _mm_cmpgt_ps(t, _mm_set1_ps(0.4142135623730950f));
+			t = select(shift, _mm_div_ps(_mm_sub_ps(t, one), _mm_add_ps(t, one)), t);
+
+			// Evaluate polynomial
+			const __m128 z = _mm_mul_ps(t, t);
+			__m128 p = _mm_set1_ps(8.05374449538e-2f);
+			p = _mm_sub_ps(_mm_mul_ps(p, z), _mm_set1_ps(1.38776856032e-1f));
+			p = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(1.99777106478e-1f));
+			p = _mm_sub_ps(_mm_mul_ps(p, z), _mm_set1_ps(3.33329491539e-1f));
+			__m128 angle = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(p, z), t), t);
+			angle = _mm_add_ps(angle, _mm_and_ps(shift, _mm_set1_ps(math::pi<float> * 0.25f)));
+
+			// Restore octant and quadrant
+			angle = select(swap, _mm_sub_ps(_mm_set1_ps(math::half_pi<float>), angle), angle);
+			angle = select(_mm_cmplt_ps(x, zero), _mm_sub_ps(_mm_set1_ps(math::pi<float>), angle), angle);
+			return copysign(angle, y);
+		}
+
+		/// Approximates the arccosine of values in `[-1, 1]`, with a maximum error of about 1e-7 radians.
+		/// @see Moshier, S. L. (1992). Cephes Mathematical Library, `asinf`.
+		[[nodiscard]] __m128 acos(__m128 x) noexcept
+		{
+			const __m128 one = _mm_set1_ps(1.0f);
+			const __m128 half = _mm_set1_ps(0.5f);
+
+			// Reduce |x| to [0, 0.5]
+			const __m128 ax = _mm_min_ps(abs(x), one);
+			const __m128 large = _mm_cmpgt_ps(ax, half);
+			const __m128 z = select(large, _mm_mul_ps(half, _mm_sub_ps(one, ax)), _mm_mul_ps(ax, ax));
+			const __m128 t = select(large, _mm_sqrt_ps(z), ax);
+
+			// Evaluate arcsine polynomial
+			__m128 p = _mm_set1_ps(4.2163199048e-2f);
+			p = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(2.4181311049e-2f));
+			p = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(4.5470025998e-2f));
+			p = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(7.4953002686e-2f));
+			p = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(1.6666752422e-1f));
+			__m128 asin = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(p, z), t), t);
+			asin = select(large, _mm_sub_ps(_mm_set1_ps(math::half_pi<float>), _mm_add_ps(asin, asin)), asin);
+
+			// acos(x) = pi / 2 - asin(x)
+			return _mm_sub_ps(_mm_set1_ps(math::half_pi<float>), copysign(asin, x));
+		}
+
+		/// Approximates the sine and cosine of angles in `[-pi, pi]`, with a maximum error of about 1e-7.
+		/// @see Moshier, S. L. (1992). Cephes Mathematical Library, `sinf` and `cosf`.
+		void sincos(__m128 x, __m128& sin, __m128& cos) noexcept
+		{
+			// Reduce angle to [-pi / 4, pi / 4]
+			const __m128i q = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(2.0f / math::pi<float>)));
+			const __m128 quadrant = _mm_cvtepi32_ps(q);
+			__m128 r = _mm_sub_ps(x, _mm_mul_ps(quadrant, _mm_set1_ps(1.5703125f)));
+			r = _mm_sub_ps(r, _mm_mul_ps(quadrant, _mm_set1_ps(4.837512969970703125e-4f)));
+			r = _mm_sub_ps(r, _mm_mul_ps(quadrant, _mm_set1_ps(7.549789948768648e-8f)));
+			const __m128 z = _mm_mul_ps(r, r);
+
+			// Evaluate polynomials
+			__m128 s = _mm_set1_ps(-1.9515295891e-4f);
+			s = _mm_add_ps(_mm_mul_ps(s, z), _mm_set1_ps(8.3321608736e-3f));
+			s = _mm_sub_ps(_mm_mul_ps(s, z), _mm_set1_ps(1.6666654611e-1f));
+			s = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(s, z), r), r);
+
+			__m128 c = _mm_set1_ps(2.443315711809948e-5f);
+			c = _mm_sub_ps(_mm_mul_ps(c, z), _mm_set1_ps(1.388731625493765e-3f));
+			c = _mm_add_ps(_mm_mul_ps(c, z), _mm_set1_ps(4.166664568298827e-2f));
+			c = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(_mm_mul_ps(c, z), z), _mm_mul_ps(_mm_set1_ps(0.5f), z)), _mm_set1_ps(1.0f));
+
+			// Map quadrant to sine and cosine
+			const __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(q, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+			const __m128 sin_sign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(q, _mm_set1_epi32(2)), 30));
+			const __m128 cos_sign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(q, _mm_set1_epi32(1)), _mm_set1_epi32(2)), 30));
+			sin = _mm_xor_ps(select(swap, c, s), sin_sign);
+			cos = _mm_xor_ps(select(swap, s, c), cos_sign);
+		}
+
+		/// Constructs a quaternion representing a rotation about a coordinate axis.
+		[[nodiscard]] inline lane_quat axis_rotation(int axis, __m128 angle) noexcept
+		{
+			__m128 s;
+			__m128 c;
+			sincos(_mm_mul_ps(angle, _mm_set1_ps(0.5f)), s, c);
+
+			const __m128 zero = _mm_setzero_ps();
+			return {c, axis == 0 ? s : zero, axis == 1 ? s : zero, axis == 2 ? s : zero};
+		}
+
+		/// Returns the vector component of a quaternion with the given axis index.
+		[[nodiscard]] inline __m128 component(const lane_quat& q, int axis) noexcept
+		{
+			return axis == 0 ? q.x : (axis == 1 ? q.y : q.z);
+		}
+
+		/// Vectorized euler_ik_constraint::solve().
+		void solve_euler_constraint(lane_quat& q, math::rotation_sequence sequence, const math::fvec3& min_angles, const math::fvec3& max_angles) noexcept
+		{
+			// Derive Euler angles from quaternion, as in math::euler_from_quat()
+			const auto axes = math::rotation_axes<int>(sequence);
+			const bool proper = axes[0] == axes[2];
+			const int i = axes[0];
+			const int j = axes[1];
+			const int k = proper ? 3 - i - j : axes[2];
+			const float sign = static_cast<float>(((i - j) * (j - k) * (k - i)) >> 1);
+
+			__m128 a = q.w;
+			__m128 b = component(q, i);
+			__m128 c = component(q, j);
+			__m128 d = _mm_mul_ps(component(q, k), _mm_set1_ps(sign));
+			if (!proper)
+			{
+				a = _mm_sub_ps(a, component(q, j));
+				b = _mm_add_ps(b, d);
+				c = _mm_add_ps(c, q.w);
+				d = _mm_sub_ps(d, component(q, i));
+			}
+
+			const __m128 aa_bb = _mm_add_ps(_mm_mul_ps(a, a), _mm_mul_ps(b, b));
+			const __m128 cc_dd = _mm_add_ps(_mm_mul_ps(c, c), _mm_mul_ps(d, d));
+			__m128 angle1 = acos(_mm_sub_ps(_mm_div_ps(_mm_add_ps(aa_bb, aa_bb), _mm_add_ps(aa_bb, cc_dd)), _mm_set1_ps(1.0f)));
+
+			const __m128 half_sum = atan2(b, a);
+			const __m128 half_diff = atan2(_mm_sub_ps(_mm_setzero_ps(), d), c);
+			const __m128 tolerance = _mm_set1_ps(1e-6f);
+			const __m128 singular0 = _mm_cmple_ps(abs(angle1), tolerance);
+			const __m128 singular1 = _mm_andnot_ps(singular0, _mm_cmple_ps(abs(_mm_sub_ps(angle1, _mm_set1_ps(math::pi<float>))), tolerance));
+			const __m128 singular = _mm_or_ps(singular0, singular1);
+
+			__m128 angle0 = _mm_andnot_ps(singular, _mm_add_ps(half_sum, half_diff));
+			__m128 angle2 = _mm_sub_ps(half_sum, half_diff);
+			angle2 = select(singular0, _mm_add_ps(half_sum, half_sum), angle2);
+			angle2 = select(singular1, _mm_mul_ps(half_diff, _mm_set1_ps(-2.0f)), angle2);
+
+			if (!proper)
+			{
+				angle2 = _mm_mul_ps(angle2, _mm_set1_ps(sign));
+				angle1 = _mm_sub_ps(angle1, _mm_set1_ps(math::half_pi<float>));
+			}
+
+			// Constrain Euler angles
+			angle0 = _mm_min_ps(_mm_max_ps(angle0, _mm_set1_ps(min_angles[0])), _mm_set1_ps(max_angles[0]));
+			angle1 = _mm_min_ps(_mm_max_ps(angle1, _mm_set1_ps(min_angles[1])), _mm_set1_ps(max_angles[1]));
+			angle2 = _mm_min_ps(_mm_max_ps(angle2, _mm_set1_ps(min_angles[2])), _mm_set1_ps(max_angles[2]));
+
+			// Rebuild quaternion from constrained Euler angles, as in math::euler_to_quat()
+			const __m128 old_w = q.w;
+			q = axis_rotation(axes[2], angle2) * axis_rotation(axes[1], angle1) * axis_rotation(axes[0], angle0);
+
+			// Restore quaternion sign
+			q.w = copysign(q.w, old_w);
+		}
+
+		/// Vectorized swing_twist_ik_constraint::solve().
+		void solve_swing_twist_constraint(lane_quat& q, float cos_half_twist_min, float sin_half_twist_min, float cos_half_twist_max, float sin_half_twist_max) noexcept
+		{
+			const __m128 zero = _mm_setzero_ps();
+			const __m128 one = _mm_set1_ps(1.0f);
+
+			// Decompose rotation into swing and twist components about the z-axis, as in math::swing_twist()
+			const __m128 sqr_length_twist = _mm_add_ps(_mm_mul_ps(q.w, q.w), _mm_mul_ps(q.z, q.z));
+			const __m128 no_twist = _mm_cmple_ps(sqr_length_twist, _mm_set1_ps(1e-6f));
+			const __m128 twist_scale = _mm_div_ps(copysign(one, q.z), _mm_sqrt_ps(sqr_length_twist));
+			lane_quat twist{_mm_mul_ps(q.w, twist_scale), zero, zero, _mm_mul_ps(q.z, twist_scale)};
+			lane_quat swing = normalize(q * conjugate(twist));
+			twist = select(no_twist, lane_quat{one, zero, zero, zero}, twist);
+			swing = select(no_twist, q, swing);
+
+			// Limit twist
+			const __m128 below_min = _mm_cmplt_ps(twist.w, _mm_set1_ps(cos_half_twist_min));
+			const __m128 above_max = _mm_andnot_ps(below_min, _mm_cmpgt_ps(twist.w, _mm_set1_ps(cos_half_twist_max)));
+			twist.w = select(below_min, _mm_set1_ps(cos_half_twist_min), select(above_max, _mm_set1_ps(cos_half_twist_max), twist.w));
+			twist.z = select(below_min, _mm_set1_ps(sin_half_twist_min), select(above_max, _mm_set1_ps(sin_half_twist_max), twist.z));
+
+			// Re-compose rotation from swing and twist components
+			q = normalize(swing * twist);
+		}
+
+		[[nodiscard]] inline lane_vec3 load_vec3(const float* x) noexcept
+		{
+			constexpr auto w = batched_ccd_ik_solver::lane_width;
+			return {_mm_loadu_ps(x), _mm_loadu_ps(x + w), _mm_loadu_ps(x + w * 2)};
+		}
+
+		[[nodiscard]] inline lane_quat load_quat(const float* x) noexcept
+		{
+			constexpr auto w = batched_ccd_ik_solver::lane_width;
+			return {_mm_loadu_ps(x), _mm_loadu_ps(x + w), _mm_loadu_ps(x + w * 2), _mm_loadu_ps(x + w * 3)};
+		}
+
+		inline void store_quat(float* x, const lane_quat& q) noexcept
+		{
+			constexpr auto w = batched_ccd_ik_solver::lane_width;
+			_mm_storeu_ps(x, q.w);
+			_mm_storeu_ps(x + w, q.x);
+			_mm_storeu_ps(x + w * 2, q.y);
+			_mm_storeu_ps(x + w * 3, q.z);
+		}
+
+		[[nodiscard]] inline lane_transform load_transform(const float* x) noexcept
+		{
+			constexpr auto w = batched_ccd_ik_solver::lane_width;
+			return {load_vec3(x + translation_x * w), load_quat(x + rotation_w * w), load_vec3(x + scale_x * w)};
+		}
+	}
+
+	batched_ccd_ik_solver::batched_ccd_ik_solver(const skeleton& skeleton, usize root_bone_index, usize effector_bone_index)
+	{
+		// Collect bone chain from effector to root
+		for (auto bone_index = effector_bone_index;; )
+		{
+			m_bone_indices.insert(m_bone_indices.begin(), bone_index);
+			if (bone_index == root_bone_index)
+			{
+				break;
+			}
+
+			const auto parent_bone = skeleton.bones()[bone_index].parent();
+			if (!parent_bone)
+			{
+				throw std::invalid_argument("Invalid bone chain");
+			}
+
+			bone_index = parent_bone->index();
+		}
+
+		if (m_bone_indices.size() > max_bone_count)
+		{
+			throw std::invalid_argument("Bone chain too long");
+		}
+
+		if (const auto base_bone = skeleton.bones()[root_bone_index].parent())
+		{
+			m_base_bone_index = base_bone->index();
+			m_has_base_bone = true;
+		}
+
+		m_constraints.resize(m_bone_indices.size());
+		m_group_field_count = transform_field_count * (m_bone_indices.size() + 1) + target_field_count;
+	}
+
+	void batched_ccd_ik_solver::solve()
+	{
+		const usize group_count = (m_chain_count + lane_width - 1) / lane_width;
+		for (usize i = 0; i < group_count; ++i)
+		{
+			solve_group(i);
+		}
+	}
+
+	void batched_ccd_ik_solver::solve_group(usize group)
+	{
+		const usize bone_count = m_bone_indices.size();
+		const usize effector_field = transform_field_count * (bone_count + 1);
+
+		// Load chain transforms
+		lane_transform base = load_transform(lanes(group, 0));
+		lane_transform relative[max_bone_count];
+		lane_transform absolute[max_bone_count];
+		for (usize i = 0; i < bone_count; ++i)
+		{
+			relative[i] = load_transform(lanes(group, transform_field_count * (i + 1)));
+			absolute[i] = combine(i ? absolute[i - 1] : base, relative[i]);
+		}
+		const lane_vec3 effector_offset = load_vec3(lanes(group, effector_field));
+		const lane_vec3 goal_center = load_vec3(lanes(group, effector_field + 3));
+		const __m128 sqr_goal_radius = _mm_set1_ps(m_sqr_goal_radius);
+
+		// Padding lanes are never active
+		const usize lane_count = std::min(lane_width, m_chain_count - group * lane_width);
+		__m128 active = _mm_castsi128_ps(_mm_cmplt_epi32(_mm_setr_epi32(0, 1, 2, 3), _mm_set1_epi32(static_cast<int>(lane_count))));
+
+		bool converged = false;
+		for (usize iteration = 0; iteration < m_max_iterations && !converged; ++iteration)
+		{
+			for (usize j = bone_count; j--; )
+			{
+				// Transform end effector position into pose-space
+				const lane_vec3 effector_position = transform_point(absolute[bone_count - 1], effector_offset);
+
+				// Deactivate lanes with end effectors within goal radius
+				const lane_vec3 effector_delta = effector_position - goal_center;
+				active = _mm_andnot_ps(_mm_cmple_ps(dot(effector_delta, effector_delta), sqr_goal_radius), active);
+				if (!_mm_movemask_ps(active))
+				{
+					converged = true;
+					break;
+				}
+
+				// Find pose-space rotation of current bone that brings effector closer to goal
+				const auto& bone_position = absolute[j].translation;
+				const lane_vec3 effector_direction = normalize(effector_position - bone_position);
+				const lane_vec3 goal_direction = normalize(goal_center - bone_position);
+				const lane_quat delta = rotation(effector_direction, goal_direction, 1e-5f);
+
+				// Transform rotation into the frame of the parent bone
+				const auto& parent_rotation = j ? absolute[j - 1].rotation : base.rotation;
+				lane_quat bone_rotation = normalize(conjugate(parent_rotation) * delta * absolute[j].rotation);
+
+				// Apply current bone constraints to rotation
+				const auto& constraint = m_constraints[j];
+				if (constraint.type == constraint_type::euler)
+				{
+					solve_euler_constraint(bone_rotation, constraint.rotation_sequence, constraint.min_angles, constraint.max_angles);
+				}
+				else if (constraint.type == constraint_type::swing_twist)
+				{
+					solve_swing_twist_constraint(bone_rotation, constraint.cos_half_twist_min, constraint.sin_half_twist_min, constraint.cos_half_twist_max, constraint.sin_half_twist_max);
+				}
+
+				// Rotate current bone of active lanes, and update the absolute transforms of it and its descendants
+				relative[j].rotation = select(active, bone_rotation, relative[j].rotation);
+				for (usize k = j; k < bone_count; ++k)
+				{
+					absolute[k] = combine(k ? absolute[k - 1] : base, relative[k]);
+				}
+			}
+		}
+
+		// Check convergence after the last iteration
+		if (!converged)
+		{
+			const lane_vec3 effector_delta = transform_point(absolute[bone_count - 1], effector_offset) - goal_center;
+			active = _mm_andnot_ps(_mm_cmple_ps(dot(effector_delta, effector_delta), sqr_goal_radius), active);
+		}
+
+		// Store bone rotations
+		for (usize i = 0; i < bone_count; ++i)
+		{
+			store_quat(lanes(group, transform_field_count * (i + 1) + rotation_w), relative[i].rotation);
+		}
+
+		// Store convergence flags
+		const int active_mask = _mm_movemask_ps(active);
+		for (usize i = 0; i < lane_count; ++i)
+		{
+			m_converged[group * lane_width + i] = !(active_mask & (1 << i));
+		}
+	}
+
+	void batched_ccd_ik_solver::resize(usize count)
+	{
+		const usize group_count = (count + lane_width - 1) / lane_width;
+		m_data.resize(group_count * m_group_field_count * lane_width);
+		m_converged.resize(count);
+
+		// Init new chains and padding lanes with identity transforms
+		for (usize i = m_chain_count; i < group_count * lane_width; ++i)
+		{
+			write_transform(i, 0, math::identity<math::transform<float>>);
+			for (usize j = 0; j < m_bone_indices.size(); ++j)
+			{
+				write_transform(i, transform_field_count * (j + 1), math::identity<math::transform<float>>);
+			}
+		}
+
+		m_chain_count = count;
+	}
+
+	void batched_ccd_ik_solver::gather(usize chain, const skeleton_pose& pose)
+	{
+		set_base_transform(chain, m_has_base_bone ? pose.get_absolute_transform(m_base_bone_index) : math::identity<math::transform<float>>);
+		for (usize i = 0; i < m_bone_indices.size(); ++i)
+		{
+			set_bone_transform(chain, i, pose.get_relative_transform(m_bone_indices[i]));
+		}
+	}
+
+	void batched_ccd_ik_solver::scatter(usize chain, skeleton_pose& pose) const
+	{
+		for (usize i = 0; i < m_bone_indices.size(); ++i)
+		{
+			pose.set_relative_rotation(m_bone_indices[i], get_bone_rotation(chain, i));
+		}
+	}
+
+	void batched_ccd_ik_solver::set_base_transform(usize chain, const math::transform<float>& transform)
+	{
+		debug::precondition(chain < m_chain_count);
+		write_transform(chain, 0, transform);
+	}
+
+	void batched_ccd_ik_solver::set_bone_transform(usize chain, usize bone, const math::transform<float>& transform)
+	{
+		debug::precondition(chain < m_chain_count);
+		debug::precondition(bone < m_bone_indices.size());
+		write_transform(chain, transform_field_count * (bone + 1), transform);
+	}
+
+	void batched_ccd_ik_solver::set_effector_position(usize chain, const math::fvec3& position)
+	{
+		debug::precondition(chain < m_chain_count);
+		const usize field = transform_field_count * (m_bone_indices.size() + 1);
+		float* x = lanes(chain / lane_width, field) + chain % lane_width;
+		x[0] = position.x();
+		x[lane_width] = position.y();
+		x[lane_width * 2] = position.z();
+	}
+
+	void batched_ccd_ik_solver::set_goal_center(usize chain, const math::fvec3& center)
+	{
+		debug::precondition(chain < m_chain_count);
+		const usize field = transform_field_count * (m_bone_indices.size() + 1) + 3;
+		float* x = lanes(chain / lane_width, field) + chain % lane_width;
+		x[0] = center.x();
+		x[lane_width] = center.y();
+		x[lane_width * 2] = center.z();
+	}
+
+	math::fquat batched_ccd_ik_solver::get_bone_rotation(usize chain, usize bone) const
+	{
+		debug::precondition(chain < m_chain_count);
+		debug::precondition(bone < m_bone_indices.size());
+		const float* x = lanes(chain / lane_width, transform_field_count * (bone + 1) + rotation_w) + chain % lane_width;
+		return {x[0], x[lane_width], x[lane_width * 2], x[lane_width * 3]};
+	}
+
+	math::fvec3 batched_ccd_ik_solver::get_effector_position(usize chain) const
+	{
+		debug::precondition(chain < m_chain_count);
+
+		const usize group = chain / lane_width;
+		const usize lane = chain % lane_width;
+		auto read_transform = [&](usize first_field) -> math::transform<float>
+		{
+			const float* x = lanes(group, first_field) + lane;
+			return
+			{
+				{x[translation_x * lane_width], x[translation_y * lane_width], x[translation_z * lane_width]},
+				{x[rotation_w * lane_width], x[rotation_x * lane_width], x[rotation_y * lane_width], x[rotation_z * lane_width]},
+				{x[scale_x * lane_width], x[scale_y * lane_width], x[scale_z * lane_width]}
+			};
+		};
+
+		auto transform = read_transform(0);
+		for (usize i = 0; i < m_bone_indices.size(); ++i)
+		{
+			transform = math::mul(transform, read_transform(transform_field_count * (i + 1)));
+		}
+
+		const float* effector = lanes(group, transform_field_count * (m_bone_indices.size() + 1)) + lane;
+		return math::mul(transform, math::fvec3{effector[0], effector[lane_width], effector[lane_width * 2]});
+	}
+
+	void batched_ccd_ik_solver::set_constraint(usize bone, const euler_ik_constraint& constraint)
+	{
+		auto& c = m_constraints[bone];
+		c.type = constraint_type::euler;
+		c.rotation_sequence = constraint.get_rotation_sequence();
+		c.min_angles = constraint.get_min_angles();
+		c.max_angles = constraint.get_max_angles();
+	}
+
+	void batched_ccd_ik_solver::set_constraint(usize bone, const swing_twist_ik_constraint& constraint)
+	{
+		auto& c = m_constraints[bone];
+		c.type = constraint_type::swing_twist;
+		c.cos_half_twist_min = constraint.get_cos_half_twist_min();
+		c.sin_half_twist_min = constraint.get_sin_half_twist_min();
+		c.cos_half_twist_max = constraint.get_cos_half_twist_max();
+		c.sin_half_twist_max = constraint.get_sin_half_twist_max();
+	}
+
+	void batched_ccd_ik_solver::clear_constraint(usize bone)
+	{
+		m_constraints[bone].type = constraint_type::none;
+	}
+
+	void batched_ccd_ik_solver::constrain(usize bone, float* w, float* x, float* y, float* z) const
+	{
+		lane_quat q{_mm_loadu_ps(w), _mm_loadu_ps(x), _mm_loadu_ps(y), _mm_loadu_ps(z)};
+
+		const auto& constraint = m_constraints[bone];
+		if (constraint.type == constraint_type::euler)
+		{
+			solve_euler_constraint(q, constraint.rotation_sequence, constraint.min_angles, constraint.max_angles);
+		}
+		else if (constraint.type == constraint_type::swing_twist)
+		{
+			solve_swing_twist_constraint(q, constraint.cos_half_twist_min, constraint.sin_half_twist_min, constraint.cos_half_twist_max, constraint.sin_half_twist_max);
+		}
+
+		_mm_storeu_ps(w, q.w);
+		_mm_storeu_ps(x, q.x);
+		_mm_storeu_ps(y, q.y);
+		_mm_storeu_ps(z, q.z);
+	}
+
+	void batched_ccd_ik_solver::write_transform(usize chain, usize first_field, const math::transform<float>& transform)
+	{
+		float* x = lanes(chain / lane_width, first_field) + chain % lane_width;
+		x[translation_x * lane_width] = transform.translation.x();
+		x[translation_y * lane_width] = transform.translation.y();
+		x[translation_z * lane_width] = transform.translation.z();
+		x[rotation_w * lane_width] = transform.rotation.w();
+		x[rotation_x * lane_width] = transform.rotation.x();
+		x[rotation_y * lane_width] = transform.rotation.y();
+		x[rotation_z * lane_width] = transform.rotation.z();
+		x[scale_x * lane_width] = transform.scale.x();
+		x[scale_y * lane_width] = transform.scale.y();
+		x[scale_z * lane_width] = transform.scale.z();
+	}
+}
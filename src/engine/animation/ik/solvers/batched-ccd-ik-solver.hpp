@@ -0,0 +1,221 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <engine/animation/ik/constraints/euler-ik-constraint.hpp>
+#include <engine/animation/ik/constraints/swing-twist-ik-constraint.hpp>
+#include <engine/math/euler-angles.hpp>
+#include <engine/math/transform.hpp>
+#include <engine/math/vector.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <vector>
+
+namespace engine::animation
+{
+	class skeleton;
+	class skeleton_pose;
+
+	/// Cyclic Coordinate Descent (CCD) IK solver which solves many bone chains of the same topology at once.
+	/// @details Chains are packed into groups of lane_width chains, stored in structure-of-arrays form, and solved in SIMD lanes. Each lane stops updating once its end effector reaches its goal, and a group stops iterating once all of its lanes have converged.
+	///
+	/// Unlike ccd_ik_solver, rotations are applied to bones in the frame of their parent bone, and the solver operates on its own copy of chain transforms, which are gathered from and scattered to skeleton poses.
+	///
+	/// @see ccd_ik_solver
+	class batched_ccd_ik_solver
+	{
+	public:
+		/// Number of chains solved at once.
+		static inline constexpr usize lane_width = 4;
+
+		/// Maximum number of bones in a chain.
+		static inline constexpr usize max_bone_count = 16;
+
+		/// Constructs a batched CCD IK solver.
+		/// @param skeleton Skeleton of the chains.
+		/// @param root_bone_index Index of the first bone in the bone chain.
+		/// @param effector_bone_index Index of the last bone in the bone chain.
+		/// @exception std::invalid_argument Invalid bone chain.
+		batched_ccd_ik_solver(const skeleton& skeleton, usize root_bone_index, usize effector_bone_index);
+
+		/// @name Solving
+		/// @{
+
+		/// Solves all chains.
+		void solve();
+
+		/// Sets the maximum number of solving iterations.
+		/// @param iterations Maximum number of solving iterations.
+		inline void set_max_iterations(usize iterations) noexcept
+		{
+			m_max_iterations = iterations;
+		}
+
+		/// Sets the radius of the IK goals of all chains.
+		/// @param radius IK goal radius.
+		inline void set_goal_radius(float radius) noexcept
+		{
+			m_sqr_goal_radius = radius * radius;
+		}
+
+		/// Returns the maximum number of solving iterations.
+		[[nodiscard]] inline usize get_max_iterations() const noexcept
+		{
+			return m_max_iterations;
+		}
+
+		/// @}
+
+		/// @name Chains
+		/// @{
+
+		/// Sets the number of chains.
+		/// @param count Number of chains. New chains are initialized with identity transforms.
+		void resize(usize count);
+
+		/// Loads the base transform and bone transforms of a chain from a skeleton pose.
+		/// @param chain Index of the chain.
+		/// @param pose Skeleton pose of the chain.
+		void gather(usize chain, const skeleton_pose& pose);
+
+		/// Stores the bone rotations of a chain in a skeleton pose.
+		/// @param chain Index of the chain.
+		/// @param[out] pose Skeleton pose of the chain.
+		void scatter(usize chain, skeleton_pose& pose) const;
+
+		/// Sets the base transform of a chain.
+		/// @param chain Index of the chain.
+		/// @param transform Pose-space transform of the parent of the first bone in the chain.
+		void set_base_transform(usize chain, const math::transform<float>& transform);
+
+		/// Sets the relative transform of a bone in a chain.
+		/// @param chain Index of the chain.
+		/// @param bone Index of the bone in the chain, with `0` being the first bone.
+		/// @param transform Transform of the bone, relative to its parent.
+		void set_bone_transform(usize chain, usize bone, const math::transform<float>& transform);
+
+		/// Sets the position of the end effector of a chain.
+		/// @param chain Index of the chain.
+		/// @param position Position of the end effector, relative to the last bone in the chain.
+		void set_effector_position(usize chain, const math::fvec3& position);
+
+		/// Sets the center of the IK goal of a chain.
+		/// @param chain Index of the chain.
+		/// @param center IK goal center, in pose-space.
+		void set_goal_center(usize chain, const math::fvec3& center);
+
+		/// Returns the rotation of a bone in a chain, relative to its parent.
+		/// @param chain Index of the chain.
+		/// @param bone Index of the bone in the chain.
+		[[nodiscard]] math::fquat get_bone_rotation(usize chain, usize bone) const;
+
+		/// Returns the pose-space position of the end effector of a chain.
+		/// @param chain Index of the chain.
+		[[nodiscard]] math::fvec3 get_effector_position(usize chain) const;
+
+		/// Returns `true` if the end effector of a chain reached its goal in the last call to solve(), `false` otherwise.
+		/// @param chain Index of the chain.
+		[[nodiscard]] inline bool is_converged(usize chain) const noexcept
+		{
+			return m_converged[chain];
+		}
+
+		/// Returns the number of chains.
+		[[nodiscard]] inline usize size() const noexcept
+		{
+			return m_chain_count;
+		}
+
+		/// Returns the number of bones in each chain.
+		[[nodiscard]] inline usize get_bone_count() const noexcept
+		{
+			return m_bone_indices.size();
+		}
+
+		/// Returns the skeleton indices of the bones in each chain, from the first bone to the last.
+		[[nodiscard]] inline const std::vector<usize>& get_bone_indices() const noexcept
+		{
+			return m_bone_indices;
+		}
+
+		/// @}
+
+		/// @name Constraints
+		/// @{
+
+		/// Constrains a bone of all chains with an Euler angle constraint.
+		/// @param bone Index of the bone in the chain.
+		/// @param constraint Constraint to apply.
+		void set_constraint(usize bone, const euler_ik_constraint& constraint);
+
+		/// Constrains a bone of all chains with a swing-twist constraint.
+		/// @param bone Index of the bone in the chain.
+		/// @param constraint Constraint to apply.
+		void set_constraint(usize bone, const swing_twist_ik_constraint& constraint);
+
+		/// Removes the constraint of a bone.
+		/// @param bone Index of the bone in the chain.
+		void clear_constraint(usize bone);
+
+		/// Applies the constraint of a bone to a group of rotations.
+		/// @param bone Index of the bone in the chain.
+		/// @param[in,out] w,x,y,z Components of lane_width bone rotations.
+		/// @note This function exposes the vectorized constraint implementations for testing.
+		void constrain(usize bone, float* w, float* x, float* y, float* z) const;
+
+		/// @}
+
+	private:
+		/// Type of a bone constraint.
+		enum class constraint_type: u8
+		{
+			none,
+			euler,
+			swing_twist
+		};
+
+		/// Parameters of a bone constraint.
+		struct bone_constraint
+		{
+			constraint_type type{constraint_type::none};
+			math::rotation_sequence rotation_sequence{math::rotation_sequence::xyz};
+			math::fvec3 min_angles{};
+			math::fvec3 max_angles{};
+			float cos_half_twist_min{};
+			float sin_half_twist_min{};
+			float cos_half_twist_max{};
+			float sin_half_twist_max{};
+		};
+
+		/// Solves one group of chains.
+		/// @param group Index of the group.
+		void solve_group(usize group);
+
+		/// Returns a pointer to the lanes of a field of a group.
+		[[nodiscard]] inline float* lanes(usize group, usize field) noexcept
+		{
+			return m_data.data() + (group * m_group_field_count + field) * lane_width;
+		}
+
+		/// @copydoc lanes(usize, usize)
+		[[nodiscard]] inline const float* lanes(usize group, usize field) const noexcept
+		{
+			return m_data.data() + (group * m_group_field_count + field) * lane_width;
+		}
+
+		/// Writes a transform into the lanes of a group.
+		void write_transform(usize chain, usize first_field, const math::transform<float>& transform);
+
+		std::vector<usize> m_bone_indices;
+		usize m_base_bone_index{};
+		bool m_has_base_bone{false};
+		std::vector<bone_constraint> m_constraints;
+		usize m_max_iterations{10};
+		float m_sqr_goal_radius{1e-5f};
+
+		usize m_chain_count{};
+		usize m_group_field_count{};
+		std::vector<float> m_data;
+		std::vector<u8> m_converged;
+	};
+}
@@ -6,8 +6,10 @@
 #include <engine/audio/listener.hpp>
 #include <engine/audio/playback-state.hpp>
 #include <engine/audio/sound-que.hpp>
+#include <engine/audio/sound-stream.hpp>
 #include <engine/audio/sound-system.hpp>
 #include <engine/audio/sound-wave.hpp>
+#include <engine/audio/streaming-sound-que.hpp>
 
 /// Audio interface.
 namespace engine::audio {}
@@ -274,6 +274,8 @@ namespace engine::audio
 		/// @}
 
 	private:
+		friend class streaming_sound_que;
+
 		std::shared_ptr<sound_wave> m_sound_wave;
 	
 		bool m_looping{false};
@@ -0,0 +1,457 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <dr_wav.h>
+
+#define OV_EXCLUDE_STATIC_CALLBACKS
+#include <vorbis/vorbisfile.h>
+
+#include <engine/audio/sound-stream.hpp>
+#include <engine/resources/deserialize-error.hpp>
+#include <engine/resources/resource-loader.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdio>
+#include <cstring>
+#include <format>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace engine::audio
+{
+	namespace
+	{
+		/// WAV file shared by the decoders of a stream, and the position of the next byte to be read by one decoder.
+		struct wav_file_source
+		{
+			resources::deserialize_context* file{};
+			std::mutex* mutex{};
+			usize size{0};
+			usize position{0};
+		};
+
+		/// dr_wav file read callback.
+		size_t wav_file_read(void* user_data, void* buffer, size_t bytes_to_read)
+		{
+			auto& source = *static_cast<wav_file_source*>(user_data);
+
+			try
+			{
+				// Seek to the position of this decoder, as other decoders may have moved the file position
+				std::lock_guard lock(*source.mutex);
+				source.file->seek(source.position);
+				const auto bytes_read = source.file->read8(static_cast<std::byte*>(buffer), bytes_to_read);
+				source.position += bytes_read;
+
+				return bytes_read;
+			}
+			catch (const std::exception&)
+			{
+				return 0;
+			}
+		}
+
+		/// dr_wav file seek callback.
+		drwav_bool32 wav_file_seek(void* user_data, int offset, drwav_seek_origin origin)
+		{
+			auto& source = *static_cast<wav_file_source*>(user_data);
+
+			i64 position;
+			if (origin == DRWAV_SEEK_SET)
+			{
+				position = offset;
+			}
+			else if (origin == DRWAV_SEEK_CUR)
+			{
+				position = static_cast<i64>(source.position) + offset;
+			}
+			else if (origin == DRWAV_SEEK_END)
+			{
+				position = static_cast<i64>(source.size) + offset;
+			}
+			else
+			{
+				return DRWAV_FALSE;
+			}
+
+			if (position < 0 || position > static_cast<i64>(source.size))
+			{
+				return DRWAV_FALSE;
+			}
+
+			source.position = static_cast<usize>(position);
+
+			return DRWAV_TRUE;
+		}
+
+		/// dr_wav file tell callback.
+		drwav_bool32 wav_file_tell(void* user_data, drwav_int64* cursor)
+		{
+			*cursor = static_cast<drwav_int64>(static_cast<wav_file_source*>(user_data)->position);
+			return DRWAV_TRUE;
+		}
+
+		/// Decodes WAV data with dr_wav.
+		class wav_decoder: public sound_decoder
+		{
+		public:
+			/// Opens WAV data in memory.
+			explicit wav_decoder(std::span<const std::byte> data)
+			{
+				if (!drwav_init_memory(&m_wav, data.data(), data.size(), nullptr))
+				{
+					throw std::runtime_error("dr_wav failed to open WAV data");
+				}
+			}
+
+			/// Opens a WAV file, which may be shared with other decoders.
+			wav_decoder(resources::deserialize_context& file, std::mutex& file_mutex):
+				m_source{&file, &file_mutex, file.size()}
+			{
+				if (!drwav_init(&m_wav, &wav_file_read, &wav_file_seek, &wav_file_tell, &m_source, nullptr))
+				{
+					throw std::runtime_error("dr_wav failed to open WAV file");
+				}
+			}
+
+			~wav_decoder() override
+			{
+				drwav_uninit(&m_wav);
+			}
+
+			wav_decoder(const wav_decoder&) = delete;
+			wav_decoder& operator=(const wav_decoder&) = delete;
+
+			usize read(std::span<i16> samples) override
+			{
+				return static_cast<usize>(drwav_read_pcm_frames_s16(&m_wav, samples.size() / m_wav.channels, samples.data()));
+			}
+
+			void seek(usize frame) override
+			{
+				if (!drwav_seek_to_pcm_frame(&m_wav, frame))
+				{
+					throw std::runtime_error(std::format("dr_wav failed to seek to PCM frame {}", frame));
+				}
+			}
+
+			[[nodiscard]] inline u32 get_channels() const noexcept
+			{
+				return static_cast<u32>(m_wav.channels);
+			}
+
+			[[nodiscard]] inline u32 get_sample_rate() const noexcept
+			{
+				return static_cast<u32>(m_wav.sampleRate);
+			}
+
+			[[nodiscard]] inline usize get_frame_count() const noexcept
+			{
+				return static_cast<usize>(m_wav.totalPCMFrameCount);
+			}
+
+		private:
+			wav_file_source m_source;
+			drwav m_wav{};
+		};
+
+		/// Ogg/Vorbis data and the position of the next byte to be read by Vorbisfile.
+		struct vorbis_data_source
+		{
+			std::span<const std::byte> data;
+			usize position{0};
+		};
+
+		/// Vorbisfile in-memory read callback.
+		size_t vorbis_data_read(void* ptr, size_t size, size_t nmemb, void* datasource)
+		{
+			if (!size || !nmemb)
+			{
+				return 0;
+			}
+
+			auto& source = *static_cast<vorbis_data_source*>(datasource);
+			const auto count = std::min(nmemb, (source.data.size() - source.position) / size);
+			std::memcpy(ptr, source.data.data() + source.position, count * size);
+			source.position += count * size;
+
+			return count;
+		}
+
+		/// Vorbisfile in-memory seek callback.
+		int vorbis_data_seek(void* datasource, ogg_int64_t offset, int whence)
+		{
+			auto& source = *static_cast<vorbis_data_source*>(datasource);
+
+			ogg_int64_t position;
+			if (whence == SEEK_SET)
+			{
+				position = offset;
+			}
+			else if (whence == SEEK_CUR)
+			{
+				position = static_cast<ogg_int64_t>(source.position) + offset;
+			}
+			else if (whence == SEEK_END)
+			{
+				position = static_cast<ogg_int64_t>(source.data.size()) + offset;
+			}
+			else
+			{
+				return -1;
+			}
+
+			if (position < 0 || position > static_cast<ogg_int64_t>(source.data.size()))
+			{
+				return -1;
+			}
+
+			source.position = static_cast<usize>(position);
+
+			return 0;
+		}
+
+		/// Vorbisfile in-memory tell callback.
+		long vorbis_data_tell(void* datasource)
+		{
+			return static_cast<long>(static_cast<vorbis_data_source*>(datasource)->position);
+		}
+
+		/// Decodes Ogg/Vorbis data with Vorbisfile.
+		class vorbis_decoder: public sound_decoder
+		{
+		public:
+			explicit vorbis_decoder(std::span<const std::byte> data):
+				m_source{data}
+			{
+				static const ov_callbacks vorbis_data_callbacks
+				{
+					&vorbis_data_read,
+					&vorbis_data_seek,
+					nullptr,
+					&vorbis_data_tell
+				};
+
+				if (auto error = ov_open_callbacks(&m_source, &m_file, nullptr, 0, vorbis_data_callbacks); error != 0)
+				{
+					throw std::runtime_error(std::format("Vorbisfile failed to open Ogg/Vorbis data: error code {}", error));
+				}
+
+				const vorbis_info* info = ov_info(&m_file, -1);
+				if (!info)
+				{
+					ov_clear(&m_file);
+					throw std::runtime_error("Vorbisfile failed to provide Ogg/Vorbis data information");
+				}
+
+				m_channels = static_cast<u32>(info->channels);
+				m_sample_rate = static_cast<u32>(info->rate);
+				m_frame_count = static_cast<usize>(std::max<ogg_int64_t>(ov_pcm_total(&m_file, -1), 0));
+			}
+
+			~vorbis_decoder() override
+			{
+				ov_clear(&m_file);
+			}
+
+			vorbis_decoder(const vorbis_decoder&) = delete;
+			vorbis_decoder& operator=(const vorbis_decoder&) = delete;
+
+			usize read(std::span<i16> samples) override
+			{
+				auto bytes = std::as_writable_bytes(samples.first(samples.size() - samples.size() % m_channels));
+				usize total_bytes_read = 0;
+
+				while (total_bytes_read < bytes.size())
+				{
+					int bitstream = 0;
+					const auto bytes_read = ov_read
+					(
+						&m_file,
+						reinterpret_cast<char*>(bytes.data() + total_bytes_read),
+						static_cast<int>(std::min<usize>(bytes.size() - total_bytes_read, 1 << 20)),
+						std::endian::native == std::endian::big,
+						sizeof(i16),
+						1,
+						&bitstream
+					);
+
+					if (bytes_read == 0)
+					{
+						break;
+					}
+					else if (bytes_read == OV_HOLE)
+					{
+						// Skip interruptions in the data
+						continue;
+					}
+					else if (bytes_read < 0)
+					{
+						throw std::runtime_error(std::format("Vorbisfile failed to decode Ogg/Vorbis data: error code {}", bytes_read));
+					}
+
+					total_bytes_read += static_cast<usize>(bytes_read);
+				}
+
+				return total_bytes_read / (sizeof(i16) * m_channels);
+			}
+
+			void seek(usize frame) override
+			{
+				if (auto error = ov_pcm_seek(&m_file, static_cast<ogg_int64_t>(frame)); error != 0)
+				{
+					throw std::runtime_error(std::format("Vorbisfile failed to seek to PCM frame {}: error code {}", frame, error));
+				}
+			}
+
+			[[nodiscard]] inline u32 get_channels() const noexcept
+			{
+				return m_channels;
+			}
+
+			[[nodiscard]] inline u32 get_sample_rate() const noexcept
+			{
+				return m_sample_rate;
+			}
+
+			[[nodiscard]] inline usize get_frame_count() const noexcept
+			{
+				return m_frame_count;
+			}
+
+		private:
+			vorbis_data_source m_source;
+			OggVorbis_File m_file{};
+			u32 m_channels{};
+			u32 m_sample_rate{};
+			usize m_frame_count{};
+		};
+
+		/// Returns `true` if data begins with a four-character code.
+		[[nodiscard]] bool has_fourcc(std::span<const std::byte> data, const char* fourcc)
+		{
+			return data.size() >= 4 && std::memcmp(data.data(), fourcc, 4) == 0;
+		}
+
+		/// Returns `true` if data begins with a WAV four-character code.
+		[[nodiscard]] bool is_wav(std::span<const std::byte> data)
+		{
+			return has_fourcc(data, "RIFF") || has_fourcc(data, "RF64") || has_fourcc(data, "riff");
+		}
+	}
+
+	sound_stream::sound_stream(std::vector<std::byte> data):
+		m_data(std::move(data)),
+		m_size(m_data.size())
+	{
+		// Detect format
+		if (is_wav(m_data))
+		{
+			m_format = format::wav;
+		}
+		else if (has_fourcc(m_data, "OggS"))
+		{
+			m_format = format::vorbis;
+		}
+		else
+		{
+			throw std::runtime_error("Sound stream data format not recognized");
+		}
+
+		read_info();
+	}
+
+	sound_stream::sound_stream(std::shared_ptr<resources::deserialize_context> file):
+		m_size(file->size())
+	{
+		// Detect format
+		std::array<std::byte, 4> fourcc{};
+		file->read8(fourcc.data(), std::min(fourcc.size(), m_size));
+		file->seek(0);
+		if (is_wav(fourcc))
+		{
+			m_format = format::wav;
+
+			// Read uncompressed WAV data from the file as it is decoded
+			m_file = std::move(file);
+		}
+		else if (has_fourcc(fourcc, "OggS"))
+		{
+			m_format = format::vorbis;
+
+			// Read compressed Ogg/Vorbis data into memory
+			m_data.resize(m_size);
+			file->read8(m_data.data(), m_data.size());
+		}
+		else
+		{
+			throw std::runtime_error("Sound stream data format not recognized");
+		}
+
+		read_info();
+	}
+
+	void sound_stream::read_info()
+	{
+		const auto decoder = open_decoder();
+		if (m_format == format::wav)
+		{
+			const auto& wav = static_cast<const wav_decoder&>(*decoder);
+			m_channels = wav.get_channels();
+			m_sample_rate = wav.get_sample_rate();
+			m_frame_count = wav.get_frame_count();
+		}
+		else
+		{
+			const auto& vorbis = static_cast<const vorbis_decoder&>(*decoder);
+			m_channels = vorbis.get_channels();
+			m_sample_rate = vorbis.get_sample_rate();
+			m_frame_count = vorbis.get_frame_count();
+		}
+
+		if (!m_channels || !m_sample_rate)
+		{
+			throw std::runtime_error(std::format("Invalid sound stream format ({}-channel, {} Hz)", m_channels, m_sample_rate));
+		}
+
+		m_duration = static_cast<float>(static_cast<double>(m_frame_count) / m_sample_rate);
+	}
+
+	std::unique_ptr<sound_decoder> sound_stream::open_decoder() const
+	{
+		if (m_format == format::wav)
+		{
+			if (m_file)
+			{
+				return std::make_unique<wav_decoder>(*m_file, m_file_mutex);
+			}
+
+			return std::make_unique<wav_decoder>(m_data);
+		}
+		else
+		{
+			return std::make_unique<vorbis_decoder>(m_data);
+		}
+	}
+}
+
+namespace engine::resources
+{
+	template <>
+	std::unique_ptr<audio::sound_stream> resource_loader<audio::sound_stream>::load(resource_manager&, std::shared_ptr<deserialize_context> ctx)
+	{
+		try
+		{
+			return std::make_unique<audio::sound_stream>(std::move(ctx));
+		}
+		catch (const std::runtime_error& e)
+		{
+			throw deserialize_error(e.what());
+		}
+	}
+}
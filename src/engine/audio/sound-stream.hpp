@@ -0,0 +1,118 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <engine/resources/deserialize-context.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+
+namespace engine::audio
+{
+	/// Incrementally decodes encoded sound data into signed 16-bit PCM samples.
+	class sound_decoder
+	{
+	public:
+		/// Destructs a sound decoder.
+		virtual ~sound_decoder() = default;
+
+		/// Decodes PCM frames at the current position and advances the position.
+		/// @param[out] samples Destination of the interleaved samples. The number of decoded frames is at most the size of the destination divided by the number of channels.
+		/// @return Number of decoded frames. Fewer frames than requested are only decoded at the end of the sound.
+		/// @exception std::runtime_error Failed to decode sound data.
+		virtual usize read(std::span<i16> samples) = 0;
+
+		/// Sets the position of the decoder.
+		/// @param frame Index of the next PCM frame to decode.
+		/// @exception std::runtime_error Failed to seek.
+		virtual void seek(usize frame) = 0;
+	};
+
+	/// Encoded sound data which is decoded during playback, rather than in its entirety when loaded.
+	/// @details Supports WAV and Ogg/Vorbis data. Samples are decoded to signed 16-bit PCM.
+	/// @see streaming_sound_que
+	class sound_stream
+	{
+	public:
+		/// Constructs a sound stream from data in memory.
+		/// @param data WAV or Ogg/Vorbis file data.
+		/// @exception std::runtime_error Sound data format not recognized.
+		/// @exception std::runtime_error Failed to open sound data.
+		explicit sound_stream(std::vector<std::byte> data);
+
+		/// Constructs a sound stream from a file.
+		/// @param file WAV or Ogg/Vorbis file. WAV data is read from the file as it is decoded, while compressed Ogg/Vorbis data is read into memory.
+		/// @exception std::runtime_error Sound data format not recognized.
+		/// @exception std::runtime_error Failed to open sound data.
+		explicit sound_stream(std::shared_ptr<resources::deserialize_context> file);
+
+		sound_stream(const sound_stream&) = delete;
+		sound_stream(sound_stream&&) = delete;
+		sound_stream& operator=(const sound_stream&) = delete;
+		sound_stream& operator=(sound_stream&&) = delete;
+
+		/// Opens a decoder for the sound data, positioned at the first frame.
+		/// @return Sound decoder. The decoder references the sound data of the stream and must not outlive it.
+		/// @exception std::runtime_error Failed to open sound data.
+		[[nodiscard]] std::unique_ptr<sound_decoder> open_decoder() const;
+
+		/// Returns the number of channels in the sound stream.
+		[[nodiscard]] inline constexpr auto get_channels() const noexcept
+		{
+			return m_channels;
+		}
+
+		/// Returns the sample rate of the sound stream.
+		[[nodiscard]] inline constexpr auto get_sample_rate() const noexcept
+		{
+			return m_sample_rate;
+		}
+
+		/// Returns the number of PCM frames in the sound stream.
+		[[nodiscard]] inline constexpr auto get_frame_count() const noexcept
+		{
+			return m_frame_count;
+		}
+
+		/// Returns the duration of the sound stream, in seconds.
+		[[nodiscard]] inline constexpr auto get_duration() const noexcept
+		{
+			return m_duration;
+		}
+
+		/// Returns the size of the encoded sound data, in bytes.
+		[[nodiscard]] inline constexpr auto get_size() const noexcept
+		{
+			return m_size;
+		}
+
+		/// Returns the size of the encoded sound data held in memory, in bytes.
+		[[nodiscard]] inline auto get_resident_size() const noexcept
+		{
+			return m_data.size();
+		}
+
+	private:
+		enum class format
+		{
+			wav,
+			vorbis
+		};
+
+		/// Reads the info of the sound data.
+		void read_info();
+
+		std::vector<std::byte> m_data;
+		std::shared_ptr<resources::deserialize_context> m_file;
+		mutable std::mutex m_file_mutex;
+		usize m_size{};
+		format m_format{};
+		u32 m_channels{};
+		u32 m_sample_rate{};
+		usize m_frame_count{};
+		float m_duration{};
+	};
+}
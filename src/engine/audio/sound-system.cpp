@@ -3,33 +3,74 @@
 
 #include <AL/al.h>
 #include <AL/alc.h>
+#include <AL/alext.h>
 #include <engine/audio/sound-system.hpp>
+#include <engine/debug/contract.hpp>
 #include <format>
 #include <stdexcept>
 
 namespace engine::audio
 {
-	sound_system::sound_system()
+	sound_system::sound_system(sound_device_type device_type):
+		m_device_type(device_type)
 	{
-		// Open audio device
-		ALCdevice* alc_device = alcOpenDevice(nullptr);
-		if (!alc_device)
-		{
-			throw std::runtime_error("OpenAL failed to open playback device.");
-		}
-	
-		// Get playback device name
-		if (alcIsExtensionPresent(alc_device, "ALC_ENUMERATE_ALL_EXT"))
+		ALCdevice* alc_device = nullptr;
+		const ALCint* alc_attributes = nullptr;
+
+		if (m_device_type == sound_device_type::loopback)
 		{
-			m_playback_device_name = alcGetString(alc_device, ALC_ALL_DEVICES_SPECIFIER);
+			// Load loopback extension functions
+			if (!alcIsExtensionPresent(nullptr, "ALC_SOFT_loopback"))
+			{
+				throw std::runtime_error("OpenAL loopback extension not present.");
+			}
+			auto alc_loopback_open_device = reinterpret_cast<LPALCLOOPBACKOPENDEVICESOFT>(alcGetProcAddress(nullptr, "alcLoopbackOpenDeviceSOFT"));
+			m_alc_render_samples = reinterpret_cast<void*>(alcGetProcAddress(nullptr, "alcRenderSamplesSOFT"));
+			if (!alc_loopback_open_device || !m_alc_render_samples)
+			{
+				throw std::runtime_error("OpenAL failed to load loopback extension functions.");
+			}
+
+			// Open loopback device
+			alc_device = alc_loopback_open_device(nullptr);
+			if (!alc_device)
+			{
+				throw std::runtime_error("OpenAL failed to open loopback device.");
+			}
+			m_playback_device_name = "Loopback";
+
+			// Render stereo 16-bit samples
+			static constexpr ALCint loopback_attributes[] =
+			{
+				ALC_FORMAT_CHANNELS_SOFT, ALC_STEREO_SOFT,
+				ALC_FORMAT_TYPE_SOFT, ALC_SHORT_SOFT,
+				ALC_FREQUENCY, static_cast<ALCint>(loopback_sample_rate),
+				0
+			};
+			alc_attributes = loopback_attributes;
 		}
-		if (m_playback_device_name.empty() || alcGetError(alc_device) != AL_NO_ERROR)
+		else
 		{
-			m_playback_device_name = alcGetString(alc_device, ALC_DEVICE_SPECIFIER);
+			// Open audio device
+			alc_device = alcOpenDevice(nullptr);
+			if (!alc_device)
+			{
+				throw std::runtime_error("OpenAL failed to open playback device.");
+			}
+
+			// Get playback device name
+			if (alcIsExtensionPresent(alc_device, "ALC_ENUMERATE_ALL_EXT"))
+			{
+				m_playback_device_name = alcGetString(alc_device, ALC_ALL_DEVICES_SPECIFIER);
+			}
+			if (m_playback_device_name.empty() || alcGetError(alc_device) != AL_NO_ERROR)
+			{
+				m_playback_device_name = alcGetString(alc_device, ALC_DEVICE_SPECIFIER);
+			}
 		}
 	
 		// Create OpenAL context
-		ALCcontext* alc_context = alcCreateContext(alc_device, nullptr);
+		ALCcontext* alc_context = alcCreateContext(alc_device, alc_attributes);
 		if (!alc_context)
 		{
 			alcCloseDevice(alc_device);
@@ -52,6 +93,13 @@ namespace engine::audio
 		m_listener = std::make_unique<listener>();
 	}
 
+	void sound_system::render(std::span<i16> samples)
+	{
+		debug::precondition(m_device_type == sound_device_type::loopback);
+
+		reinterpret_cast<LPALCRENDERSAMPLESSOFT>(m_alc_render_samples)(reinterpret_cast<ALCdevice*>(m_alc_device), samples.data(), static_cast<ALCsizei>(samples.size() / 2));
+	}
+
 	sound_system::~sound_system()
 	{
 		alcMakeContextCurrent(nullptr);
@@ -4,17 +4,34 @@
 #pragma once
 
 #include <engine/audio/listener.hpp>
+#include <engine/utility/sized-types.hpp>
 #include <memory>
+#include <span>
 #include <string>
 
 namespace engine::audio
 {
+	/// Types of sound devices.
+	enum class sound_device_type
+	{
+		/// Default playback device.
+		playback,
+
+		/// Loopback device, which renders samples on request rather than to a playback device. Used for headless execution and testing.
+		loopback
+	};
+
 	/// Sound system.
 	class sound_system
 	{
 	public:
+		/// Sample rate of loopback devices, in hertz.
+		static constexpr u32 loopback_sample_rate = 44100;
+
 		/// Constructs a sound system.
-		sound_system();
+		/// @param device_type Type of sound device to open.
+		/// @exception std::runtime_error OpenAL failed to open device.
+		explicit sound_system(sound_device_type device_type = sound_device_type::playback);
 	
 		/// Destructs a sound system.
 		~sound_system();
@@ -30,6 +47,17 @@ namespace engine::audio
 			return m_playback_device_name;
 		}
 	
+		/// Renders samples with a loopback device.
+		/// @param[out] samples Destination of interleaved stereo signed 16-bit samples, at the loopback sample rate.
+		/// @warning Requires a loopback device.
+		void render(std::span<i16> samples);
+
+		/// Returns the type of the sound device.
+		[[nodiscard]] inline constexpr auto get_device_type() const noexcept
+		{
+			return m_device_type;
+		}
+
 		/// Returns the listener.
 		[[nodiscard]] inline constexpr auto& get_listener() noexcept
 		{
@@ -43,10 +71,12 @@ namespace engine::audio
 		}
 
 	private:
+		sound_device_type m_device_type;
 		std::string m_playback_device_name;
 		std::unique_ptr<listener> m_listener;
 	
 		void* m_alc_device{};
 		void* m_alc_context{};
+		void* m_alc_render_samples{};
 	};
 }
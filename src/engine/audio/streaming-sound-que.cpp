@@ -0,0 +1,421 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <AL/al.h>
+#include <engine/audio/streaming-sound-que.hpp>
+#include <engine/debug/log.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <algorithm>
+#include <format>
+#include <functional>
+#include <stdexcept>
+
+namespace engine::audio
+{
+	streaming_sound_que::streaming_sound_que(std::shared_ptr<sound_stream> stream)
+	{
+		// Generate buffers
+		alGenBuffers(static_cast<ALsizei>(buffer_count), m_al_buffers);
+		if (auto error = alGetError(); error != AL_NO_ERROR)
+		{
+			throw std::runtime_error(std::format("OpenAL failed to generate buffers: {}", alGetString(error)));
+		}
+		m_free_al_buffers.assign(std::begin(m_al_buffers), std::end(m_al_buffers));
+
+		// Set sound stream
+		try
+		{
+			set_sound_stream(std::move(stream));
+		}
+		catch (...)
+		{
+			alDeleteBuffers(static_cast<ALsizei>(buffer_count), m_al_buffers);
+			throw;
+		}
+	}
+
+	streaming_sound_que::~streaming_sound_que()
+	{
+		stop_decoding();
+
+		// Detach buffers from source before deleting them
+		alSourceStop(m_que.m_al_source);
+		alSourcei(m_que.m_al_source, AL_BUFFER, AL_NONE);
+		alDeleteBuffers(static_cast<ALsizei>(buffer_count), m_al_buffers);
+	}
+
+	void streaming_sound_que::play()
+	{
+		if (!m_sound_stream || m_playback_state == playback_state::playing)
+		{
+			return;
+		}
+
+		unqueue_buffers();
+
+		if (m_queued_frames.empty())
+		{
+			// Restart from the beginning if the end of the stream was reached
+			bool end_of_stream;
+			{
+				std::lock_guard lock(m_mutex);
+				end_of_stream = m_end_of_stream && m_decoded_chunks.empty();
+			}
+			if (end_of_stream)
+			{
+				restart_decoding(0);
+			}
+
+			wait_for_first_chunk();
+		}
+
+		queue_buffers();
+		alSourcePlay(m_que.m_al_source);
+		m_playback_state = playback_state::playing;
+	}
+
+	void streaming_sound_que::stop()
+	{
+		if (!m_sound_stream)
+		{
+			return;
+		}
+
+		unqueue_all_buffers();
+		restart_decoding(0);
+		m_playback_state = playback_state::stopped;
+	}
+
+	void streaming_sound_que::rewind()
+	{
+		seek_frames(0);
+	}
+
+	void streaming_sound_que::pause()
+	{
+		if (m_playback_state == playback_state::playing)
+		{
+			alSourcePause(m_que.m_al_source);
+			m_playback_state = playback_state::paused;
+		}
+	}
+
+	void streaming_sound_que::seek_seconds(float seconds)
+	{
+		if (!m_sound_stream)
+		{
+			return;
+		}
+
+		seek_frames(static_cast<usize>(std::max(0.0, static_cast<double>(seconds) * m_sound_stream->get_sample_rate())));
+	}
+
+	void streaming_sound_que::seek_frames(usize frames)
+	{
+		if (!m_sound_stream)
+		{
+			return;
+		}
+
+		if (frames > m_sound_stream->get_frame_count())
+		{
+			throw std::out_of_range(std::format("Streaming sound que seek position out of range ({} > {} frames).", frames, m_sound_stream->get_frame_count()));
+		}
+
+		unqueue_all_buffers();
+		restart_decoding(frames);
+
+		if (m_playback_state == playback_state::playing)
+		{
+			wait_for_first_chunk();
+			queue_buffers();
+			alSourcePlay(m_que.m_al_source);
+		}
+	}
+
+	void streaming_sound_que::set_looping(bool looping)
+	{
+		if (m_looping != looping)
+		{
+			{
+				std::lock_guard lock(m_mutex);
+				m_looping = looping;
+			}
+			m_condition.notify_all();
+		}
+	}
+
+	void streaming_sound_que::update()
+	{
+		if (!m_sound_stream)
+		{
+			return;
+		}
+
+		unqueue_buffers();
+		queue_buffers();
+
+		if (m_playback_state == playback_state::playing)
+		{
+			ALint al_source_state;
+			alGetSourcei(m_que.m_al_source, AL_SOURCE_STATE, &al_source_state);
+
+			if (al_source_state != AL_PLAYING)
+			{
+				if (!m_queued_frames.empty())
+				{
+					// Resume after the source ran out of buffers
+					alSourcePlay(m_que.m_al_source);
+				}
+				else
+				{
+					std::lock_guard lock(m_mutex);
+					if (m_end_of_stream && m_decoded_chunks.empty())
+					{
+						// End of stream reached
+						m_playback_state = playback_state::stopped;
+					}
+				}
+			}
+		}
+	}
+
+	float streaming_sound_que::get_playback_position_seconds() const
+	{
+		if (!m_sound_stream)
+		{
+			return 0.0f;
+		}
+
+		return static_cast<float>(static_cast<double>(get_playback_position_frames()) / m_sound_stream->get_sample_rate());
+	}
+
+	usize streaming_sound_que::get_playback_position_frames() const
+	{
+		if (!m_sound_stream || m_queued_frames.empty())
+		{
+			return m_start_frame;
+		}
+
+		ALint al_sample_offset;
+		alGetSourcei(m_que.m_al_source, AL_SAMPLE_OFFSET, &al_sample_offset);
+
+		return (m_queued_frames.front().first + static_cast<usize>(al_sample_offset)) % std::max<usize>(m_sound_stream->get_frame_count(), 1);
+	}
+
+	void streaming_sound_que::set_sound_stream(std::shared_ptr<sound_stream> stream)
+	{
+		if (m_sound_stream == stream)
+		{
+			return;
+		}
+
+		// Stop playback of the previous stream
+		stop_decoding();
+		unqueue_all_buffers();
+		m_playback_state = playback_state::stopped;
+		m_decoder.reset();
+		m_sound_stream.reset();
+		m_start_frame = 0;
+
+		if (!stream)
+		{
+			return;
+		}
+
+		// Determine OpenAL format
+		if (stream->get_channels() == 1)
+		{
+			m_al_format = AL_FORMAT_MONO16;
+		}
+		else if (stream->get_channels() == 2)
+		{
+			m_al_format = AL_FORMAT_STEREO16;
+		}
+		else
+		{
+			throw std::runtime_error(std::format("OpenAL does not support sound stream format ({}-channel, 16 bps)", stream->get_channels()));
+		}
+
+		m_decoder = stream->open_decoder();
+		m_sound_stream = std::move(stream);
+
+		// Begin decoding ahead of playback
+		restart_decoding(0);
+	}
+
+	usize streaming_sound_que::get_decoded_size() const noexcept
+	{
+		if (!m_sound_stream)
+		{
+			return 0;
+		}
+
+		// Decoded chunks, plus the copies of chunks held by buffers
+		return 2 * buffer_count * frames_per_buffer * m_sound_stream->get_channels() * sizeof(i16);
+	}
+
+	void streaming_sound_que::decode(std::stop_token stop_token)
+	{
+		const auto channels = m_sound_stream->get_channels();
+		const auto frame_count = m_sound_stream->get_frame_count();
+
+		std::unique_lock lock(m_mutex);
+		while (!stop_token.stop_requested())
+		{
+			// Wait for a free chunk
+			if (!m_condition.wait(lock, stop_token, [&]{return m_decoded_chunks.size() < buffer_count && (!m_end_of_stream || m_looping);}) || stop_token.stop_requested())
+			{
+				break;
+			}
+
+			const bool looping = m_looping;
+
+			chunk c;
+			if (!m_free_samples.empty())
+			{
+				c.samples = std::move(m_free_samples.back());
+				m_free_samples.pop_back();
+			}
+
+			lock.unlock();
+
+			// Decode chunk, wrapping around to the beginning of the stream if looping
+			c.samples.resize(frames_per_buffer * channels);
+			c.first_frame = m_decode_frame;
+			bool end_of_stream = false;
+			try
+			{
+				while (c.frame_count < frames_per_buffer)
+				{
+					const auto frames_read = m_decoder->read(std::span{c.samples}.subspan(c.frame_count * channels));
+					c.frame_count += frames_read;
+					m_decode_frame += frames_read;
+
+					if (frames_read == 0)
+					{
+						if (looping && frame_count && m_decode_frame)
+						{
+							m_decoder->seek(0);
+							m_decode_frame = 0;
+						}
+						else
+						{
+							end_of_stream = true;
+							break;
+						}
+					}
+				}
+			}
+			catch (const std::exception& e)
+			{
+				log_error("Failed to decode sound stream: {}", e.what());
+				end_of_stream = true;
+			}
+
+			lock.lock();
+
+			if (c.frame_count)
+			{
+				m_decoded_chunks.emplace_back(std::move(c));
+			}
+			m_end_of_stream = end_of_stream;
+
+			m_condition.notify_all();
+		}
+	}
+
+	void streaming_sound_que::restart_decoding(usize frame)
+	{
+		stop_decoding();
+
+		// Discard decoded chunks
+		for (auto& c: m_decoded_chunks)
+		{
+			m_free_samples.emplace_back(std::move(c.samples));
+		}
+		m_decoded_chunks.clear();
+		m_end_of_stream = false;
+
+		m_decoder->seek(frame);
+		m_decode_frame = frame;
+		m_start_frame = frame;
+
+		m_decode_thread = std::jthread(std::bind_front(&streaming_sound_que::decode, this));
+	}
+
+	void streaming_sound_que::stop_decoding()
+	{
+		if (m_decode_thread.joinable())
+		{
+			m_decode_thread.request_stop();
+			m_decode_thread.join();
+		}
+	}
+
+	void streaming_sound_que::unqueue_buffers()
+	{
+		ALint processed_count = 0;
+		alGetSourcei(m_que.m_al_source, AL_BUFFERS_PROCESSED, &processed_count);
+
+		for (ALint i = 0; i < processed_count && !m_queued_frames.empty(); ++i)
+		{
+			ALuint al_buffer;
+			alSourceUnqueueBuffers(m_que.m_al_source, 1, &al_buffer);
+			m_free_al_buffers.emplace_back(al_buffer);
+
+			// Advance the playback position to the end of the unqueued buffer
+			const auto [first_frame, frame_count] = m_queued_frames.front();
+			m_start_frame = (first_frame + frame_count) % std::max<usize>(m_sound_stream->get_frame_count(), 1);
+			m_queued_frames.pop_front();
+		}
+	}
+
+	void streaming_sound_que::unqueue_all_buffers()
+	{
+		// All queued buffers are processed once the source is stopped
+		alSourceStop(m_que.m_al_source);
+		unqueue_buffers();
+	}
+
+	void streaming_sound_que::queue_buffers()
+	{
+		bool queued = false;
+
+		{
+			std::lock_guard lock(m_mutex);
+			while (!m_free_al_buffers.empty() && !m_decoded_chunks.empty())
+			{
+				auto& c = m_decoded_chunks.front();
+
+				const auto al_buffer = m_free_al_buffers.back();
+				alBufferData
+				(
+					al_buffer,
+					m_al_format,
+					c.samples.data(),
+					static_cast<ALsizei>(c.frame_count * m_sound_stream->get_channels() * sizeof(i16)),
+					static_cast<ALsizei>(m_sound_stream->get_sample_rate())
+				);
+				alSourceQueueBuffers(m_que.m_al_source, 1, &al_buffer);
+				m_free_al_buffers.pop_back();
+				m_queued_frames.emplace_back(c.first_frame, c.frame_count);
+
+				m_free_samples.emplace_back(std::move(c.samples));
+				m_decoded_chunks.pop_front();
+				queued = true;
+			}
+		}
+
+		if (queued)
+		{
+			m_condition.notify_all();
+		}
+	}
+
+	void streaming_sound_que::wait_for_first_chunk()
+	{
+		std::unique_lock lock(m_mutex);
+		m_condition.wait(lock, [&]{return !m_decoded_chunks.empty() || m_end_of_stream;});
+	}
+}
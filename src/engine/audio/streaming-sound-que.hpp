@@ -0,0 +1,200 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <engine/audio/playback-state.hpp>
+#include <engine/audio/sound-que.hpp>
+#include <engine/audio/sound-stream.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace engine::audio
+{
+	/// Sound source which plays a sound stream.
+	/// @details Sound data is decoded in chunks on a background thread, and uploaded to a small ring of buffers which are queued on the source. update() must be called regularly, at least once per frame, to recycle played buffers.
+	class streaming_sound_que
+	{
+	public:
+		/// Number of buffers queued on the source.
+		static constexpr usize buffer_count = 4;
+
+		/// Number of PCM frames decoded into each buffer.
+		static constexpr usize frames_per_buffer = 8192;
+
+		/// Constructs a streaming sound que.
+		/// @param stream Sound stream to play.
+		explicit streaming_sound_que(std::shared_ptr<sound_stream> stream = nullptr);
+
+		/// Destructs a streaming sound que.
+		~streaming_sound_que();
+
+		streaming_sound_que(const streaming_sound_que&) = delete;
+		streaming_sound_que(streaming_sound_que&&) = delete;
+		streaming_sound_que& operator=(const streaming_sound_que&) = delete;
+		streaming_sound_que& operator=(streaming_sound_que&&) = delete;
+
+		/// @name Playback
+		/// @{
+
+		/// Plays the streaming sound que. If the end of the stream was reached, playback restarts from the beginning of the stream.
+		void play();
+
+		/// Stops the streaming sound que and rewinds it to the beginning of the stream.
+		void stop();
+
+		/// Rewinds the streaming sound que.
+		void rewind();
+
+		/// Pauses the streaming sound que.
+		void pause();
+
+		/// Sets the playback position of the streaming sound que.
+		/// @param seconds Offset from the start of the stream, in seconds.
+		/// @exception std::out_of_range Seek position out of range.
+		void seek_seconds(float seconds);
+
+		/// Sets the playback position of the streaming sound que.
+		/// @param frames Offset from the start of the stream, in PCM frames.
+		/// @exception std::out_of_range Seek position out of range.
+		void seek_frames(usize frames);
+
+		/// Sets whether the streaming sound que should repeat indefinitely.
+		/// @param looping `true` if the streaming sound que should repeat indefinitely, `false` otherwise.
+		void set_looping(bool looping);
+
+		/// Recycles played buffers and queues newly decoded buffers on the source.
+		void update();
+
+		/// Returns the playback state of the streaming sound que.
+		/// @note The end of a stream is detected by update().
+		[[nodiscard]] inline constexpr playback_state get_playback_state() const noexcept
+		{
+			return m_playback_state;
+		}
+
+		/// Returns `true` if the streaming sound que is stopped, `false` otherwise.
+		[[nodiscard]] inline constexpr bool is_stopped() const noexcept
+		{
+			return m_playback_state == playback_state::stopped;
+		}
+
+		/// Returns `true` if the streaming sound que is playing, `false` otherwise.
+		[[nodiscard]] inline constexpr bool is_playing() const noexcept
+		{
+			return m_playback_state == playback_state::playing;
+		}
+
+		/// Returns `true` if the streaming sound que is paused, `false` otherwise.
+		[[nodiscard]] inline constexpr bool is_paused() const noexcept
+		{
+			return m_playback_state == playback_state::paused;
+		}
+
+		/// Returns the playback position, in seconds.
+		[[nodiscard]] float get_playback_position_seconds() const;
+
+		/// Returns the playback position, in PCM frames.
+		[[nodiscard]] usize get_playback_position_frames() const;
+
+		/// Returns `true` if the streaming sound que is looping, `false` otherwise.
+		[[nodiscard]] inline constexpr bool is_looping() const noexcept
+		{
+			return m_looping;
+		}
+
+		/// @}
+
+		/// @name Sound stream
+		/// @{
+
+		/// Sets the sound stream played by the streaming sound que. Playback is stopped.
+		/// @param stream Sound stream to play. If `nullptr`, no sound will be emitted.
+		/// @exception std::runtime_error OpenAL does not support the sound stream format.
+		void set_sound_stream(std::shared_ptr<sound_stream> stream);
+
+		/// Returns the sound stream played by the streaming sound que.
+		[[nodiscard]] inline constexpr const auto& get_sound_stream() const noexcept
+		{
+			return m_sound_stream;
+		}
+
+		/// Returns the maximum size of the decoded sample data held by the streaming sound que and its buffers, in bytes.
+		[[nodiscard]] usize get_decoded_size() const noexcept;
+
+		/// @}
+
+		/// Returns the sound que which emits the stream, through which its spatial, directional, gain, and pitch properties are set.
+		/// @warning Playback must be controlled through the streaming sound que rather than the sound que.
+		[[nodiscard]] inline constexpr auto& get_que() noexcept
+		{
+			return m_que;
+		}
+
+		/// @copydoc get_que() noexcept
+		[[nodiscard]] inline constexpr const auto& get_que() const noexcept
+		{
+			return m_que;
+		}
+
+	private:
+		/// Decoded PCM frames.
+		struct chunk
+		{
+			std::vector<i16> samples;
+			usize frame_count{0};
+			usize first_frame{0};
+		};
+
+		/// Decodes chunks until stopped.
+		void decode(std::stop_token stop_token);
+
+		/// Stops decoding, then restarts decoding at a frame.
+		void restart_decoding(usize frame);
+
+		/// Stops decoding.
+		void stop_decoding();
+
+		/// Unqueues played buffers from the source.
+		void unqueue_buffers();
+
+		/// Stops the source and unqueues all buffers.
+		void unqueue_all_buffers();
+
+		/// Queues decoded chunks on the source.
+		void queue_buffers();
+
+		/// Blocks until the first chunk has been decoded, or the end of the stream has been reached.
+		void wait_for_first_chunk();
+
+		sound_que m_que;
+		std::shared_ptr<sound_stream> m_sound_stream;
+		std::unique_ptr<sound_decoder> m_decoder;
+		int m_al_format{};
+
+		unsigned int m_al_buffers[buffer_count]{};
+		std::vector<unsigned int> m_free_al_buffers;
+		std::deque<std::pair<usize, usize>> m_queued_frames;
+		usize m_start_frame{0};
+		playback_state m_playback_state{playback_state::stopped};
+
+		// State shared with the decode thread
+		std::mutex m_mutex;
+		std::condition_variable_any m_condition;
+		std::deque<chunk> m_decoded_chunks;
+		std::vector<std::vector<i16>> m_free_samples;
+		bool m_looping{false};
+		bool m_end_of_stream{false};
+
+		// State owned by the decode thread while it runs
+		usize m_decode_frame{0};
+		std::jthread m_decode_thread;
+	};
+}
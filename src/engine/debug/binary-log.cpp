@@ -0,0 +1,361 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <engine/debug/binary-log.hpp>
+#include <engine/debug/contract.hpp>
+#include <engine/debug/log-message-severity.hpp>
+#include <engine/debug/logger.hpp>
+#include <engine/hash/combine-hash.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <iterator>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+namespace
+{
+	using namespace engine;
+
+	/// Binary log record kinds.
+	enum class record_kind: u8
+	{
+		message,
+		location,
+		thread,
+		time_zone
+	};
+
+	/// Appends a record tag byte to a buffer.
+	/// @param buffer Record buffer.
+	/// @param kind Record kind.
+	/// @param severity Message severity, if any.
+	void write_tag(std::string& buffer, record_kind kind, debug::log_message_severity severity = {})
+	{
+		buffer.push_back(static_cast<char>((std::to_underlying(kind) << 4) | (std::to_underlying(severity) & 0xf)));
+	}
+
+	/// Appends an unsigned LEB128 varint to a buffer.
+	/// @param buffer Record buffer.
+	/// @param value Value to encode.
+	void write_varint(std::string& buffer, u64 value)
+	{
+		while (value >= 0x80)
+		{
+			buffer.push_back(static_cast<char>((value & 0x7f) | 0x80));
+			value >>= 7;
+		}
+		buffer.push_back(static_cast<char>(value));
+	}
+
+	/// Appends a zigzag-encoded signed varint to a buffer.
+	/// @param buffer Record buffer.
+	/// @param value Value to encode.
+	void write_signed_varint(std::string& buffer, i64 value)
+	{
+		write_varint(buffer, (static_cast<u64>(value) << 1) ^ static_cast<u64>(value >> 63));
+	}
+
+	/// Appends a size-prefixed string to a buffer.
+	/// @param buffer Record buffer.
+	/// @param string String to append.
+	void write_string(std::string& buffer, std::string_view string)
+	{
+		write_varint(buffer, string.size());
+		buffer.append(string);
+	}
+
+	/// Appends a little-endian integer to a buffer.
+	/// @param buffer Record buffer.
+	/// @param value Value to encode.
+	template <class T>
+	void write_fixed(std::string& buffer, T value)
+	{
+		for (usize i = 0; i < sizeof(T); ++i)
+		{
+			buffer.push_back(static_cast<char>((static_cast<u64>(value) >> (i * 8)) & 0xff));
+		}
+	}
+
+	/// Reads binary log records from a buffer. Reads past the end of the buffer return zero and mark the reader as truncated.
+	class record_reader
+	{
+	public:
+		explicit record_reader(std::string_view data, usize offset) noexcept:
+			m_data{data},
+			m_offset{offset}
+		{}
+
+		[[nodiscard]] u8 read_byte() noexcept
+		{
+			if (m_offset >= m_data.size())
+			{
+				m_truncated = true;
+				return 0;
+			}
+
+			return static_cast<u8>(m_data[m_offset++]);
+		}
+
+		[[nodiscard]] u64 read_varint() noexcept
+		{
+			u64 value = 0;
+			for (u32 shift = 0; shift < 64; shift += 7)
+			{
+				const u8 byte = read_byte();
+				value |= static_cast<u64>(byte & 0x7f) << shift;
+				if (byte < 0x80)
+				{
+					break;
+				}
+			}
+
+			return value;
+		}
+
+		[[nodiscard]] i64 read_signed_varint() noexcept
+		{
+			const u64 value = read_varint();
+			return static_cast<i64>(value >> 1) ^ -static_cast<i64>(value & 1);
+		}
+
+		[[nodiscard]] std::string_view read_string() noexcept
+		{
+			const u64 size = read_varint();
+			if (size > m_data.size() - m_offset)
+			{
+				m_truncated = true;
+				m_offset = m_data.size();
+				return {};
+			}
+
+			const auto string = m_data.substr(m_offset, static_cast<usize>(size));
+			m_offset += static_cast<usize>(size);
+			return string;
+		}
+
+		template <class T>
+		[[nodiscard]] T read_fixed() noexcept
+		{
+			u64 value = 0;
+			for (usize i = 0; i < sizeof(T); ++i)
+			{
+				value |= static_cast<u64>(read_byte()) << (i * 8);
+			}
+
+			return static_cast<T>(value);
+		}
+
+		[[nodiscard]] inline usize offset() const noexcept
+		{
+			return m_offset;
+		}
+
+		[[nodiscard]] inline bool at_end() const noexcept
+		{
+			return m_offset >= m_data.size();
+		}
+
+		[[nodiscard]] inline bool truncated() const noexcept
+		{
+			return m_truncated;
+		}
+
+	private:
+		std::string_view m_data;
+		usize m_offset;
+		bool m_truncated{false};
+	};
+}
+
+namespace engine::debug
+{
+	usize binary_log::location_key_hash::operator()(const std::pair<const char*, u32>& key) const noexcept
+	{
+		return static_cast<usize>(hash::combine_hash(static_cast<u64>(reinterpret_cast<std::uintptr_t>(key.first)), static_cast<u64>(key.second)));
+	}
+
+	binary_log::binary_log(const std::filesystem::path& path)
+	{
+		// Open log file
+		m_output_stream.open(path.string(), std::ios::binary);
+		if (!m_output_stream.is_open())
+		{
+			throw std::runtime_error(std::format("Failed to open log file \"{}\"", path.string()));
+		}
+
+		// Base all message times on the time at which the log was opened
+		m_previous_time = std::chrono::floor<std::chrono::milliseconds>(std::chrono::system_clock::now());
+
+		// Write log file header
+		m_record_buffer = "AKBL";
+		write_fixed(m_record_buffer, version);
+		write_fixed(m_record_buffer, static_cast<i64>(m_previous_time.time_since_epoch().count()));
+		m_output_stream.write(m_record_buffer.data(), static_cast<std::streamsize>(m_record_buffer.size()));
+		if (!m_output_stream.good())
+		{
+			throw std::runtime_error(std::format("Failed to write to log file \"{}\"", path.string()));
+		}
+
+		// Get current time zone
+		m_time_zone = std::chrono::current_zone();
+
+		// Subscribe to log messages from default logger
+		m_message_logged_subscription = default_logger().message_logged_channel().subscribe
+		(
+			[this](const auto& event)
+			{
+				this->message_logged(event);
+			}
+		);
+
+		debug::postcondition(m_time_zone);
+	}
+
+	binary_log::~binary_log()
+	{}
+
+	void binary_log::message_logged(const message_logged_event& event)
+	{
+		debug::precondition(m_time_zone);
+
+		// Round time to the millisecond
+		const auto time = std::chrono::floor<std::chrono::milliseconds>(event.time);
+
+		std::lock_guard lock(m_mutex);
+		m_record_buffer.clear();
+
+		// Query time zone only when the time leaves the interval of the cached time zone info
+		if (time < m_time_zone_info.begin || time >= m_time_zone_info.end)
+		{
+			const auto previous_offset = m_time_zone_info.offset;
+			m_time_zone_info = m_time_zone->get_info(std::chrono::floor<std::chrono::seconds>(time));
+			if (m_time_zone_info.offset != previous_offset)
+			{
+				write_tag(m_record_buffer, record_kind::time_zone);
+				write_signed_varint(m_record_buffer, m_time_zone_info.offset.count());
+			}
+		}
+
+		// Intern thread ID
+		const auto [thread_it, thread_inserted] = m_thread_ids.try_emplace(event.thread_id, static_cast<u32>(m_thread_ids.size()));
+		if (thread_inserted)
+		{
+			write_tag(m_record_buffer, record_kind::thread);
+			write_varint(m_record_buffer, thread_it->second);
+			write_string(m_record_buffer, std::format("{}", event.thread_id));
+		}
+
+		// Intern source location
+		const auto [location_it, location_inserted] = m_location_ids.try_emplace({event.location.file_name(), event.location.line()}, static_cast<u32>(m_location_ids.size()));
+		if (location_inserted)
+		{
+			write_tag(m_record_buffer, record_kind::location);
+			write_varint(m_record_buffer, location_it->second);
+			write_varint(m_record_buffer, event.location.line());
+			write_string(m_record_buffer, std::filesystem::path(event.location.file_name()).filename().string());
+		}
+
+		// Encode message
+		write_tag(m_record_buffer, record_kind::message, event.severity);
+		write_signed_varint(m_record_buffer, (time - m_previous_time).count());
+		write_varint(m_record_buffer, location_it->second);
+		write_varint(m_record_buffer, thread_it->second);
+		write_string(m_record_buffer, event.message);
+		m_previous_time = time;
+
+		m_output_stream.write(m_record_buffer.data(), static_cast<std::streamsize>(m_record_buffer.size()));
+	}
+
+	usize binary_log_to_tsv(std::istream& input, std::ostream& output)
+	{
+		const std::string data{std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>()};
+
+		// Read log file header
+		if (data.size() < 16 || !data.starts_with("AKBL"))
+		{
+			throw std::runtime_error("Not a binary log");
+		}
+		record_reader reader(data, 4);
+		if (const auto file_version = reader.read_fixed<u32>(); file_version != binary_log::version)
+		{
+			throw std::runtime_error(std::format("Unsupported binary log version {}", file_version));
+		}
+		auto time = std::chrono::sys_time<std::chrono::milliseconds>{std::chrono::milliseconds{reader.read_fixed<i64>()}};
+
+		std::unordered_map<u64, std::pair<std::string_view, u64>> locations;
+		std::unordered_map<u64, std::string_view> threads;
+		std::chrono::seconds utc_offset{0};
+		usize message_count = 0;
+
+		output << "time\tseverity\tfile\tline\tthread\tmessage";
+
+		while (!reader.at_end())
+		{
+			const u8 tag = reader.read_byte();
+			switch (static_cast<record_kind>(tag >> 4))
+			{
+				case record_kind::message:
+				{
+					const auto delta = std::chrono::milliseconds{reader.read_signed_varint()};
+					const auto location_id = reader.read_varint();
+					const auto thread_id = reader.read_varint();
+					const auto message = reader.read_string();
+					if (reader.truncated())
+					{
+						return message_count;
+					}
+
+					time += delta;
+					const auto& [file_name, line] = locations[location_id];
+
+					// Format local time in the same way as the text log
+					const auto local_time = time + utc_offset;
+					const auto local_seconds = std::chrono::floor<std::chrono::seconds>(local_time);
+					const auto offset_minutes = std::chrono::abs(std::chrono::duration_cast<std::chrono::minutes>(utc_offset)).count();
+					output << std::format
+					(
+						"\n{:%FT%T}.{:03}{}{:02}:{:02}\t{}\t{}\t{}\t{}\t{}",
+						local_seconds,
+						(local_time - local_seconds).count(),
+						utc_offset < std::chrono::seconds::zero() ? '-' : '+',
+						offset_minutes / 60,
+						offset_minutes % 60,
+						debug::log_message_severity_to_string(static_cast<debug::log_message_severity>(tag & 0xf)),
+						file_name,
+						line,
+						threads[thread_id],
+						message
+					);
+					++message_count;
+					break;
+				}
+
+				case record_kind::location:
+				{
+					const auto location_id = reader.read_varint();
+					const auto line = reader.read_varint();
+					locations[location_id] = {reader.read_string(), line};
+					break;
+				}
+
+				case record_kind::thread:
+				{
+					const auto thread_id = reader.read_varint();
+					threads[thread_id] = reader.read_string();
+					break;
+				}
+
+				case record_kind::time_zone:
+					utc_offset = std::chrono::seconds{reader.read_signed_varint()};
+					break;
+
+				default:
+					throw std::runtime_error(std::format("Unknown binary log record kind {} at offset {}", tag >> 4, reader.offset() - 1));
+			}
+		}
+
+		return message_count;
+	}
+}
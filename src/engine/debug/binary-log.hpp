@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <engine/debug/log-events.hpp>
+#include <engine/event/subscription.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+namespace engine::debug
+{
+	/// @name Logging
+	/// @{
+
+	/// Logs messages to a compact, append-only binary file.
+	///
+	/// @details A binary log file begins with a 16-byte header consisting of the magic bytes `AKBL`, a little-endian `u32` format version, and a little-endian `i64` base time, in milliseconds since the Unix epoch. The header is followed by a stream of records. Each record begins with a tag byte, the upper four bits of which identify the record kind and the lower four bits of which hold the message severity. All integers within records are unsigned LEB128 varints, with signed quantities zigzag-encoded.
+	///
+	/// | Kind | Record             | Fields                                                                       |
+	/// | ---- | ------------------ | ---------------------------------------------------------------------------- |
+	/// | 0    | Message            | time delta (ms, signed), location ID, thread ID, message size, message bytes |
+	/// | 1    | Source location    | location ID, line, file name size, file name bytes                           |
+	/// | 2    | Thread             | thread ID, thread name size, thread name bytes                               |
+	/// | 3    | Time zone offset   | UTC offset (s, signed)                                                       |
+	///
+	/// Source locations and threads are interned: their definition records are written once, immediately before the first message which references them. Message time deltas are relative to the time of the preceding message, or the base time for the first message.
+	///
+	/// @see tools/binary-log-to-tsv.py
+	class binary_log
+	{
+	public:
+		/// Binary log format version.
+		static inline constexpr u32 version = 1;
+
+		/// Opens a binary log.
+		/// @param path Path to the log file.
+		/// @exception std::runtime_error Failed to open log file.
+		/// @exception std::runtime_error Failed to write to log file.
+		/// @exception std::runtime_error Failed to get current time zone.
+		explicit binary_log(const std::filesystem::path& path);
+
+		/// Closes a binary log.
+		~binary_log();
+
+	private:
+		/// Hashes interned source location keys.
+		struct location_key_hash
+		{
+			[[nodiscard]] usize operator()(const std::pair<const char*, u32>& key) const noexcept;
+		};
+
+		/// Logs a message to a file.
+		void message_logged(const message_logged_event& event);
+
+		binary_log(const binary_log&) = delete;
+		binary_log(binary_log&&) = delete;
+		binary_log& operator=(const binary_log&) = delete;
+		binary_log& operator=(binary_log&&) = delete;
+
+		std::ofstream m_output_stream;
+		std::mutex m_mutex;
+		std::string m_record_buffer;
+		const std::chrono::time_zone* m_time_zone{};
+		std::chrono::sys_info m_time_zone_info{};
+		std::chrono::sys_time<std::chrono::milliseconds> m_previous_time{};
+		std::unordered_map<std::pair<const char*, u32>, u32, location_key_hash> m_location_ids;
+		std::unordered_map<std::thread::id, u32> m_thread_ids;
+		std::shared_ptr<event::subscription> m_message_logged_subscription;
+	};
+
+	/// Converts a binary log to the TSV layout written by file_log.
+	/// @param input Binary log input stream.
+	/// @param output TSV output stream.
+	/// @return Number of messages converted.
+	/// @exception std::runtime_error Input is not a binary log.
+	/// @exception std::runtime_error Unsupported binary log format version.
+	/// @exception std::runtime_error Unknown record kind.
+	/// @note A truncated final record, such as one left by a crash, is ignored.
+	usize binary_log_to_tsv(std::istream& input, std::ostream& output);
+
+	/// @}
+}
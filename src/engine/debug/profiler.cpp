@@ -0,0 +1,169 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <engine/debug/profiler.hpp>
+#include <algorithm>
+#include <format>
+
+namespace engine::debug
+{
+	namespace
+	{
+		/// Source of unique profiler IDs, so that thread-local buffer caches are never matched to a different profiler at a reused address.
+		std::atomic<u64> g_next_profiler_id{1};
+
+		/// Ring buffer of the calling thread in the profiler which it most recently recorded to.
+		struct thread_buffer_cache
+		{
+			u64 profiler_id{0};
+			void* buffer{nullptr};
+		};
+		thread_local thread_buffer_cache t_buffer_cache;
+
+		/// Writes a string as a JSON string literal.
+		void write_json_string(std::ostream& stream, const char* string)
+		{
+			stream.put('"');
+			for (const char* c = string; *c; ++c)
+			{
+				switch (*c)
+				{
+					case '"':
+						stream << "\\\"";
+						break;
+					case '\\':
+						stream << "\\\\";
+						break;
+					default:
+						if (static_cast<unsigned char>(*c) < 0x20)
+						{
+							stream << std::format("\\u{:04x}", static_cast<unsigned>(*c));
+						}
+						else
+						{
+							stream.put(*c);
+						}
+						break;
+				}
+			}
+			stream.put('"');
+		}
+	}
+
+	profiler::profiler():
+		m_id(g_next_profiler_id.fetch_add(1, std::memory_order_relaxed)),
+		m_epoch(clock_type::now())
+	{}
+
+	profiler::~profiler() = default;
+
+	void profiler::record(const char* name, clock_type::time_point begin, clock_type::time_point end, u32 depth)
+	{
+		auto& buffer = get_thread_buffer();
+
+		// Only the owning thread writes the head, so it can be loaded relaxed
+		const u64 head = buffer.head.load(std::memory_order_relaxed);
+		buffer.events[head & (buffer_capacity - 1)] =
+		{
+			name,
+			std::chrono::duration_cast<std::chrono::nanoseconds>(begin - m_epoch).count(),
+			std::chrono::duration_cast<std::chrono::nanoseconds>(end - m_epoch).count(),
+			buffer.thread,
+			depth
+		};
+		buffer.head.store(head + 1, std::memory_order_release);
+	}
+
+	usize profiler::collect(std::vector<profile_event>& events)
+	{
+		std::lock_guard lock(m_mutex);
+
+		const usize initial_size = events.size();
+		for (const auto& buffer: m_buffers)
+		{
+			const u64 head = buffer->head.load(std::memory_order_acquire);
+			u64 tail = buffer->tail;
+
+			// Skip events which were overwritten before this collection
+			if (head - tail > buffer_capacity)
+			{
+				m_dropped_event_count += head - tail - buffer_capacity;
+				tail = head - buffer_capacity;
+			}
+
+			const usize first = events.size();
+			for (u64 i = tail; i < head; ++i)
+			{
+				events.emplace_back(buffer->events[i & (buffer_capacity - 1)]);
+			}
+
+			// Discard events which were overwritten while they were being copied
+			const u64 current_head = buffer->head.load(std::memory_order_acquire);
+			if (current_head - tail > buffer_capacity)
+			{
+				const u64 overwritten_count = std::min(current_head - buffer_capacity, head) - tail;
+				events.erase(events.begin() + static_cast<std::ptrdiff_t>(first), events.begin() + static_cast<std::ptrdiff_t>(first + overwritten_count));
+				m_dropped_event_count += overwritten_count;
+			}
+
+			buffer->tail = head;
+		}
+
+		return events.size() - initial_size;
+	}
+
+	profiler::thread_buffer& profiler::get_thread_buffer()
+	{
+		if (t_buffer_cache.profiler_id == m_id)
+		{
+			return *static_cast<thread_buffer*>(t_buffer_cache.buffer);
+		}
+
+		std::lock_guard lock(m_mutex);
+
+		// Find the buffer of the calling thread, in case the thread has since recorded to another profiler
+		const auto thread_id = std::this_thread::get_id();
+		for (const auto& buffer: m_buffers)
+		{
+			if (buffer->thread_id == thread_id)
+			{
+				t_buffer_cache = {m_id, buffer.get()};
+				return *buffer;
+			}
+		}
+
+		// Allocate a buffer for the calling thread
+		auto buffer = std::make_unique<thread_buffer>();
+		buffer->events = std::make_unique<profile_event[]>(buffer_capacity);
+		buffer->thread_id = thread_id;
+		buffer->thread = static_cast<u32>(m_buffers.size());
+		t_buffer_cache = {m_id, buffer.get()};
+		return *m_buffers.emplace_back(std::move(buffer));
+	}
+
+	profiler& default_profiler() noexcept
+	{
+		static profiler instance;
+		return instance;
+	}
+
+	void write_chrome_trace(std::ostream& stream, std::span<const profile_event> events)
+	{
+		stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+		// Write complete events, with times in microseconds
+		for (auto i = events.begin(); i != events.end(); ++i)
+		{
+			if (i != events.begin())
+			{
+				stream.put(',');
+			}
+
+			stream << "\n{\"name\":";
+			write_json_string(stream, i->name);
+			stream << std::format(",\"ph\":\"X\",\"pid\":0,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}", i->thread, static_cast<double>(i->begin) * 1e-3, static_cast<double>(i->end - i->begin) * 1e-3);
+		}
+
+		stream << "\n]}\n";
+	}
+}
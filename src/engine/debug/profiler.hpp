@@ -0,0 +1,182 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <engine/config.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace engine::debug
+{
+	/// @name Profiling
+	/// @{
+
+	/// `true` if profiling is compiled in. If `false`, profile scopes compile to nothing.
+	inline constexpr bool g_profiler_enabled = config::debug_profiler_enabled;
+
+	/// Timed scope recorded by a profiler.
+	struct profile_event
+	{
+		/// Name of the scope.
+		const char* name;
+
+		/// Time at which the scope began, in nanoseconds since the profiler epoch.
+		i64 begin;
+
+		/// Time at which the scope ended, in nanoseconds since the profiler epoch.
+		i64 end;
+
+		/// Index of the thread which recorded the scope, in order of the first scope recorded by each thread.
+		u32 thread;
+
+		/// Number of enclosing scopes on the recording thread.
+		u32 depth;
+	};
+
+	/// Records timed scopes from any number of threads into per-thread ring buffers.
+	/// @details Each thread writes to its own ring buffer without locking. Events which are overwritten before they are collected are counted as dropped.
+	class profiler
+	{
+	public:
+		/// Clock type.
+		using clock_type = std::chrono::steady_clock;
+
+		/// Maximum number of uncollected events per thread.
+		static constexpr usize buffer_capacity = usize{1} << 14;
+
+		/// Constructs a disabled profiler.
+		profiler();
+
+		/// Destructs a profiler.
+		~profiler();
+
+		profiler(const profiler&) = delete;
+		profiler(profiler&&) = delete;
+		profiler& operator=(const profiler&) = delete;
+		profiler& operator=(profiler&&) = delete;
+
+		/// Enables or disables recording.
+		/// @param enabled `true` if scopes should be recorded, `false` otherwise.
+		inline void set_enabled(bool enabled) noexcept
+		{
+			m_enabled.store(enabled, std::memory_order_relaxed);
+		}
+
+		/// Records a scope on the calling thread.
+		/// @param name Name of the scope. Must outlive the profiler, as with a string literal.
+		/// @param begin Time at which the scope began.
+		/// @param end Time at which the scope ended.
+		/// @param depth Number of enclosing scopes.
+		void record(const char* name, clock_type::time_point begin, clock_type::time_point end, u32 depth);
+
+		/// Appends the events recorded since the last collection to a vector, ordered by thread and then by end time.
+		/// @param[out] events Vector to which events are appended.
+		/// @return Number of events appended.
+		/// @note Should be called while no other threads are recording, such as between frames. Events which are overwritten while they are being collected are dropped.
+		usize collect(std::vector<profile_event>& events);
+
+		/// Returns `true` if scopes are recorded.
+		[[nodiscard]] inline bool is_enabled() const noexcept
+		{
+			return m_enabled.load(std::memory_order_relaxed);
+		}
+
+		/// Returns the time from which event times are measured.
+		[[nodiscard]] inline clock_type::time_point get_epoch() const noexcept
+		{
+			return m_epoch;
+		}
+
+		/// Returns the number of events which were overwritten before they were collected.
+		[[nodiscard]] inline u64 get_dropped_event_count() const noexcept
+		{
+			return m_dropped_event_count;
+		}
+
+	private:
+		/// Ring buffer of the events of one thread.
+		struct thread_buffer
+		{
+			std::unique_ptr<profile_event[]> events;
+			std::atomic<u64> head{0};
+			u64 tail{0};
+			std::thread::id thread_id;
+			u32 thread{0};
+		};
+
+		/// Returns the ring buffer of the calling thread, allocating it if necessary.
+		[[nodiscard]] thread_buffer& get_thread_buffer();
+
+		std::atomic<bool> m_enabled{false};
+		u64 m_id;
+		clock_type::time_point m_epoch;
+		std::mutex m_mutex;
+		std::vector<std::unique_ptr<thread_buffer>> m_buffers;
+		u64 m_dropped_event_count{0};
+	};
+
+	/// Returns the default profiler.
+	[[nodiscard]] profiler& default_profiler() noexcept;
+
+	/// Records the duration of its lifetime to the default profiler, if the profiler is enabled.
+	/// @details If profiling is compiled out, profile scopes are empty and have no effect.
+	class profile_scope
+	{
+	public:
+		/// Begins a scope.
+		/// @param name Name of the scope. Must outlive the profiler, as with a string literal.
+		explicit inline profile_scope([[maybe_unused]] const char* name) noexcept
+		{
+			if constexpr (g_profiler_enabled)
+			{
+				if (default_profiler().is_enabled())
+				{
+					m_name = name;
+					m_depth = s_depth++;
+					m_begin = profiler::clock_type::now();
+				}
+			}
+		}
+
+		/// Ends a scope and records it.
+		inline ~profile_scope()
+		{
+			if constexpr (g_profiler_enabled)
+			{
+				if (m_name)
+				{
+					default_profiler().record(m_name, m_begin, profiler::clock_type::now(), m_depth);
+					--s_depth;
+				}
+			}
+		}
+
+		profile_scope(const profile_scope&) = delete;
+		profile_scope(profile_scope&&) = delete;
+		profile_scope& operator=(const profile_scope&) = delete;
+		profile_scope& operator=(profile_scope&&) = delete;
+
+	private:
+		/// Number of open scopes on the calling thread.
+		static inline thread_local u32 s_depth{0};
+
+		const char* m_name{nullptr};
+		u32 m_depth{0};
+		profiler::clock_type::time_point m_begin;
+	};
+
+	/// Writes events in the Chrome trace event format, which can be opened by chrome://tracing or Perfetto.
+	/// @param stream Output stream.
+	/// @param events Events to write.
+	void write_chrome_trace(std::ostream& stream, std::span<const profile_event> events);
+
+	/// @}
+}
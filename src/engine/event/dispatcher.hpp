@@ -3,13 +3,14 @@
 
 #pragma once
 
+#include <engine/event/message-type.hpp>
 #include <engine/event/subscriber.hpp>
 #include <engine/event/subscription.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <algorithm>
 #include <memory>
-#include <any>
-#include <map>
-#include <typeindex>
 #include <utility>
+#include <vector>
 
 namespace engine::event
 {
@@ -19,7 +20,7 @@ namespace engine::event
 	public:
 		/// Destructs a dispatcher.
 		virtual ~dispatcher() = default;
-	
+
 		/// Subscribes a function object to messages dispatched by this dispatcher.
 		/// @tparam T Message type.
 		/// @param subscriber Function object to subscribe.
@@ -27,39 +28,126 @@ namespace engine::event
 		template <class T>
 		[[nodiscard]] std::shared_ptr<subscription> subscribe(subscriber<T>&& subscriber)
 		{
-			// Allocate shared pointer to std::any object containing subscriber
-			auto shared_subscriber = std::make_shared<std::any>(std::make_any<event::subscriber<T>>(std::move(subscriber)));
-		
-			// Append subscriber to subscriber list and store iterator
-			auto iterator = m_subscribers.emplace(std::type_index(typeid(T)), shared_subscriber);
-		
-			// Construct and return a shared subscription object which removes the subscriber from the subscriber list when unsubscribed or destructed
+			auto& table = get_subscriber_table<T>();
+
+			// Allocate shared subscriber and append it to the subscriber table of the message type
+			auto shared_subscriber = std::make_shared<event::subscriber<T>>(std::move(subscriber));
+			table.subscribers.emplace_back(shared_subscriber);
+
+			// Construct and return a shared subscription object which removes the subscriber from the subscriber table when unsubscribed or destructed
 			return std::make_shared<subscription>
 			(
 				std::static_pointer_cast<void>(shared_subscriber),
-				[this, iterator = std::move(iterator)]()
+				[&table, raw_subscriber = shared_subscriber.get()]()
 				{
-					this->m_subscribers.erase(iterator);
+					table.remove(raw_subscriber);
 				}
 			);
 		}
-	
+
 		/// Dispatches a message to subscribers of the message type.
 		/// @tparam T Message type.
 		/// @param message Message to dispatch.
 		template <class T>
 		void dispatch(const T& message) const
 		{
-			// For each subscriber of the given message type
-			const auto range = m_subscribers.equal_range(std::type_index(typeid(T)));
-			for (auto i = range.first; i != range.second; ++i)
+			const auto id = message_type_id<T>();
+			if (id < m_subscriber_tables.size() && m_subscriber_tables[id])
 			{
-				// Send message to subscriber
-				std::any_cast<subscriber<T>>(*(i->second))(message);
+				static_cast<subscriber_table<T>&>(*m_subscriber_tables[id]).dispatch(message);
 			}
 		}
 
 	private:
-		std::multimap<std::type_index, std::shared_ptr<std::any>> m_subscribers;
+		/// Type-erased base of per-message-type subscriber tables.
+		struct subscriber_table_base
+		{
+			virtual ~subscriber_table_base() = default;
+		};
+
+		/// Contiguous array of the subscribers to a single message type.
+		/// @tparam T Message type.
+		template <class T>
+		struct subscriber_table final: subscriber_table_base
+		{
+			/// Sends a message to each subscriber, in subscription order.
+			/// @param message Message to send.
+			void dispatch(const T& message)
+			{
+				// Defer compaction of unsubscribed entries until the outermost dispatch has finished, so that subscribers may unsubscribe during dispatch
+				struct dispatch_scope
+				{
+					subscriber_table& table;
+
+					~dispatch_scope()
+					{
+						if (!--table.dispatch_depth && !table.removed.empty())
+						{
+							std::erase(table.subscribers, nullptr);
+							table.removed.clear();
+						}
+					}
+				};
+
+				++dispatch_depth;
+				dispatch_scope scope{*this};
+
+				// Index rather than iterate, as subscribers may be appended during dispatch
+				for (usize i = 0; i < subscribers.size(); ++i)
+				{
+					if (const auto* subscriber = subscribers[i].get())
+					{
+						(*subscriber)(message);
+					}
+				}
+			}
+
+			/// Removes a subscriber from the table.
+			/// @param subscriber Subscriber to remove.
+			void remove(const event::subscriber<T>* subscriber)
+			{
+				const auto it = std::find_if(subscribers.begin(), subscribers.end(), [subscriber](const auto& s){return s.get() == subscriber;});
+				if (it == subscribers.end())
+				{
+					return;
+				}
+
+				if (dispatch_depth)
+				{
+					// Keep the subscriber alive, as it may currently be executing
+					removed.emplace_back(std::move(*it));
+				}
+				else
+				{
+					subscribers.erase(it);
+				}
+			}
+
+			std::vector<std::shared_ptr<event::subscriber<T>>> subscribers;
+			std::vector<std::shared_ptr<event::subscriber<T>>> removed;
+			usize dispatch_depth{};
+		};
+
+		/// Returns the subscriber table of a message type, constructing it if necessary.
+		/// @tparam T Message type.
+		template <class T>
+		[[nodiscard]] subscriber_table<T>& get_subscriber_table()
+		{
+			const auto id = message_type_id<T>();
+			if (id >= m_subscriber_tables.size())
+			{
+				m_subscriber_tables.resize(id + 1);
+			}
+
+			auto& table = m_subscriber_tables[id];
+			if (!table)
+			{
+				table = std::make_unique<subscriber_table<T>>();
+			}
+
+			return static_cast<subscriber_table<T>&>(*table);
+		}
+
+		std::vector<std::unique_ptr<subscriber_table_base>> m_subscriber_tables;
 	};
 }
@@ -0,0 +1,14 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <engine/event/message-type.hpp>
+#include <atomic>
+
+namespace engine::event
+{
+	usize next_message_type_id() noexcept
+	{
+		static std::atomic<usize> id{0};
+		return id++;
+	}
+}
@@ -0,0 +1,22 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <engine/utility/sized-types.hpp>
+
+namespace engine::event
+{
+	/// Returns the next unused message type ID.
+	[[nodiscard]] usize next_message_type_id() noexcept;
+
+	/// Returns the ID of a message type.
+	/// @tparam T Message type.
+	/// @return Small, dense ID which is unique to @p T for the lifetime of the process, suitable for indexing per-type tables.
+	template <class T>
+	[[nodiscard]] inline usize message_type_id() noexcept
+	{
+		static const usize id = next_message_type_id();
+		return id;
+	}
+}
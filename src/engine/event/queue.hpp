@@ -4,56 +4,189 @@
 #pragma once
 
 #include <engine/event/dispatcher.hpp>
-#include <list>
-#include <functional>
+#include <engine/event/message-type.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <memory>
+#include <utility>
+#include <vector>
 
 namespace engine::event
 {
 	/// Collects messages from publishers to be dispatched to subscribers when desired.
+	/// @details Messages are stored by value in contiguous per-type ring buffers, alongside a sequence of message type IDs which preserves FIFO order across types. Once the buffers have grown to accommodate the peak number of queued messages, enqueueing a message performs no heap allocation.
 	class queue: public dispatcher
 	{
 	public:
 		/// Destructs a queue.
 		~queue() override = default;
-	
+
 		/// Adds a message to the queue, to be distributed later.
 		/// @tparam T Message type.
 		/// @param message Message to enqueue.
 		template <class T>
 		void enqueue(const T& message)
 		{
-			m_messages.emplace_back
-			(
-				[this, message]()
-				{
-					this->dispatch<T>(message);
-				}
-			);
+			get_message_ring<T>().push_back(message);
+			m_sequence.emplace_back(message_type_id<T>());
 		}
-	
+
 		/// Dispatches queued messages, in FIFO order, to subscribers.
 		void flush()
 		{
-			while (!m_messages.empty())
+			// Messages enqueued during the flush are dispatched by the same flush
+			while (m_sequence_head < m_sequence.size())
 			{
-				m_messages.front()();
-				m_messages.pop_front();
+				const auto id = m_sequence[m_sequence_head++];
+				m_message_rings[id]->dispatch_front(*this);
 			}
+
+			m_sequence.clear();
+			m_sequence_head = 0;
 		}
-	
+
 		/// Removes all messages from the queue.
 		void clear()
 		{
-			m_messages.clear();
+			for (auto& ring: m_message_rings)
+			{
+				if (ring)
+				{
+					ring->clear();
+				}
+			}
+
+			m_sequence.clear();
+			m_sequence_head = 0;
 		}
-	
+
 		/// Returns `true` if there are no messages in the queue, `false` otherwise.
 		[[nodiscard]] inline bool empty() const noexcept
 		{
-			return m_messages.empty();
+			return m_sequence_head == m_sequence.size();
 		}
 
 	private:
-		std::list<std::function<void()>> m_messages;
+		/// Type-erased base of per-message-type ring buffers.
+		class message_ring_base
+		{
+		public:
+			virtual ~message_ring_base() = default;
+
+			/// Removes the oldest message from the ring and dispatches it.
+			/// @param target Dispatcher through which the message is dispatched.
+			virtual void dispatch_front(const dispatcher& target) = 0;
+
+			/// Destroys all messages in the ring, retaining its capacity.
+			virtual void clear() noexcept = 0;
+		};
+
+		/// Growable ring buffer of messages of a single type.
+		/// @tparam T Message type.
+		template <class T>
+		class message_ring final: public message_ring_base
+		{
+		public:
+			message_ring() = default;
+			message_ring(const message_ring&) = delete;
+			message_ring& operator=(const message_ring&) = delete;
+
+			~message_ring() override
+			{
+				clear();
+				if (m_data)
+				{
+					std::allocator<T>{}.deallocate(m_data, m_capacity);
+				}
+			}
+
+			/// Appends a copy of a message to the ring.
+			/// @param message Message to append.
+			void push_back(const T& message)
+			{
+				if (m_size == m_capacity)
+				{
+					grow();
+				}
+
+				std::construct_at(m_data + ((m_head + m_size) & (m_capacity - 1)), message);
+				++m_size;
+			}
+
+			void dispatch_front(const dispatcher& target) override
+			{
+				// Move the message out of the ring before dispatch, as subscribers may enqueue messages of the same type
+				T* front = m_data + m_head;
+				T message = std::move(*front);
+				std::destroy_at(front);
+				m_head = (m_head + 1) & (m_capacity - 1);
+				--m_size;
+
+				target.dispatch<T>(message);
+			}
+
+			void clear() noexcept override
+			{
+				for (; m_size; --m_size)
+				{
+					std::destroy_at(m_data + m_head);
+					m_head = (m_head + 1) & (m_capacity - 1);
+				}
+
+				m_head = 0;
+			}
+
+		private:
+			/// Doubles the capacity of the ring, linearizing its contents.
+			void grow()
+			{
+				const usize new_capacity = m_capacity ? m_capacity * 2 : 16;
+				T* new_data = std::allocator<T>{}.allocate(new_capacity);
+
+				for (usize i = 0; i < m_size; ++i)
+				{
+					T* element = m_data + ((m_head + i) & (m_capacity - 1));
+					std::construct_at(new_data + i, std::move(*element));
+					std::destroy_at(element);
+				}
+
+				if (m_data)
+				{
+					std::allocator<T>{}.deallocate(m_data, m_capacity);
+				}
+
+				m_data = new_data;
+				m_capacity = new_capacity;
+				m_head = 0;
+			}
+
+			T* m_data{};
+			usize m_capacity{};
+			usize m_head{};
+			usize m_size{};
+		};
+
+		/// Returns the message ring of a message type, constructing it if necessary.
+		/// @tparam T Message type.
+		template <class T>
+		[[nodiscard]] message_ring<T>& get_message_ring()
+		{
+			const auto id = message_type_id<T>();
+			if (id >= m_message_rings.size())
+			{
+				m_message_rings.resize(id + 1);
+			}
+
+			auto& ring = m_message_rings[id];
+			if (!ring)
+			{
+				ring = std::make_unique<message_ring<T>>();
+			}
+
+			return static_cast<message_ring<T>&>(*ring);
+		}
+
+		std::vector<std::unique_ptr<message_ring_base>> m_message_rings;
+		std::vector<usize> m_sequence;
+		usize m_sequence_head{};
 	};
 }
@@ -0,0 +1,502 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <engine/geom/hyperoctree.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace engine::geom
+{
+	/// Linear hyperoctree, which stores node identifiers in a sorted contiguous array.
+	/// @tparam T Unsigned integral node identifier type.
+	/// @tparam N Number of dimensions.
+	/// @details Node identifiers are encoded as in hyperoctree, and sorted in depth-first preorder, so the descendants of each node immediately follow it. Lookups are binary searches, subtrees are contiguous ranges, and batches of nodes are inserted or erased with a radix sort and a single merge or compaction, which makes the linear hyperoctree suited to trees which are built in bulk and queried often.
+	/// @note As in hyperoctree, the root node is persistent, and nodes are always inserted and erased along with their siblings.
+	template <std::unsigned_integral T, usize N>
+	class linear_hyperoctree
+	{
+	private:
+		/// Hyperoctree with the same node identifier encoding.
+		using encoding = hyperoctree<T, N, hyperoctree_order::dfs_pre>;
+
+	public:
+		/// Node identifier type.
+		using node_type = T;
+
+		/// Constant iterator type.
+		using const_iterator = std::vector<node_type>::const_iterator;
+
+		/// Iterator type. Node identifiers cannot be modified through iterators.
+		using iterator = const_iterator;
+
+		/// Constant reverse iterator type.
+		using const_reverse_iterator = std::vector<node_type>::const_reverse_iterator;
+
+		/// Reverse iterator type. Node identifiers cannot be modified through iterators.
+		using reverse_iterator = const_reverse_iterator;
+
+		/// Number of dimensions.
+		static constexpr usize dimensions = N;
+
+		/// Node storage and traversal order.
+		static constexpr hyperoctree_order order = hyperoctree_order::dfs_pre;
+
+		/// Maximum node depth level.
+		static constexpr node_type max_depth = encoding::max_depth;
+
+		/// Number of bits in the node type.
+		static constexpr node_type node_bits = encoding::node_bits;
+
+		/// Number of bits required to encode the depth of a node.
+		static constexpr node_type depth_bits = encoding::depth_bits;
+
+		/// Number of bits required to encode the Morton location code of a node.
+		static constexpr node_type location_bits = encoding::location_bits;
+
+		/// Number of children per node.
+		static constexpr node_type children_per_node = encoding::children_per_node;
+
+		/// Number of siblings per node.
+		static constexpr node_type siblings_per_node = encoding::siblings_per_node;
+
+		/// Resolution in each dimension.
+		static constexpr node_type resolution = encoding::resolution;
+
+		/// Number of nodes in a full hyperoctree.
+		static constexpr usize max_node_count = encoding::max_node_count;
+
+		/// Node identifier of the persistent root node.
+		static constexpr node_type root = encoding::root;
+
+		/// @name Nodes
+		/// @{
+
+		/// @copydoc hyperoctree::depth()
+		[[nodiscard]] static inline constexpr node_type depth(node_type node) noexcept
+		{
+			return encoding::depth(node);
+		}
+
+		/// @copydoc hyperoctree::location()
+		[[nodiscard]] static inline constexpr node_type location(node_type node) noexcept
+		{
+			return encoding::location(node);
+		}
+
+		/// @copydoc hyperoctree::split()
+		[[nodiscard]] static inline constexpr std::array<node_type, 2> split(node_type node) noexcept
+		{
+			return encoding::split(node);
+		}
+
+		/// @copydoc hyperoctree::node()
+		[[nodiscard]] static inline constexpr node_type node(node_type depth, node_type location) noexcept
+		{
+			return encoding::node(depth, location);
+		}
+
+		/// @copydoc hyperoctree::ancestor()
+		[[nodiscard]] static inline constexpr node_type ancestor(node_type node, node_type depth) noexcept
+		{
+			return encoding::ancestor(node, depth);
+		}
+
+		/// @copydoc hyperoctree::parent()
+		[[nodiscard]] static inline constexpr node_type parent(node_type node) noexcept
+		{
+			return encoding::parent(node);
+		}
+
+		/// @copydoc hyperoctree::sibling()
+		[[nodiscard]] static inline constexpr node_type sibling(node_type node, node_type n) noexcept
+		{
+			return encoding::sibling(node, n);
+		}
+
+		/// @copydoc hyperoctree::child()
+		[[nodiscard]] static inline constexpr node_type child(node_type node, node_type n) noexcept
+		{
+			return encoding::child(node, n);
+		}
+
+		/// @copydoc hyperoctree::common_ancestor()
+		[[nodiscard]] static inline constexpr node_type common_ancestor(node_type a, node_type b) noexcept
+		{
+			return encoding::common_ancestor(a, b);
+		}
+
+		/// Returns the smallest node identifier which is greater than the identifiers of a node and all of its possible descendants.
+		/// @param node Node identifier.
+		/// @return End of the identifier range of the subtree of the node.
+		[[nodiscard]] static inline constexpr node_type subtree_end(node_type node) noexcept
+		{
+			const node_type shift = (node_bits - 1) - depth(node) * N;
+			return static_cast<node_type>(((node >> shift) + 1) << shift);
+		}
+
+		/// @}
+
+		/// Constructs a linear hyperoctree with a single root node.
+		linear_hyperoctree():
+			m_nodes({root})
+		{}
+
+		/// Constructs a linear hyperoctree which contains a set of nodes.
+		/// @param nodes Nodes to insert.
+		explicit linear_hyperoctree(std::span<const node_type> nodes):
+			linear_hyperoctree()
+		{
+			insert(nodes);
+		}
+
+		/// @name Iterators
+		/// @{
+
+		/// Returns an iterator to the first node, in depth-first preorder.
+		[[nodiscard]] inline const_iterator begin() const noexcept
+		{
+			return m_nodes.begin();
+		}
+
+		/// @copydoc begin()
+		[[nodiscard]] inline const_iterator cbegin() const noexcept
+		{
+			return m_nodes.cbegin();
+		}
+
+		/// Returns an iterator to the node following the last node, in depth-first preorder.
+		[[nodiscard]] inline const_iterator end() const noexcept
+		{
+			return m_nodes.end();
+		}
+
+		/// @copydoc end()
+		[[nodiscard]] inline const_iterator cend() const noexcept
+		{
+			return m_nodes.cend();
+		}
+
+		/// Returns a reverse iterator to the first node of the reversed hyperoctree.
+		[[nodiscard]] inline const_reverse_iterator rbegin() const noexcept
+		{
+			return m_nodes.rbegin();
+		}
+
+		/// @copydoc rbegin()
+		[[nodiscard]] inline const_reverse_iterator crbegin() const noexcept
+		{
+			return m_nodes.crbegin();
+		}
+
+		/// Returns a reverse iterator to the node following the last node of the reversed hyperoctree.
+		[[nodiscard]] inline const_reverse_iterator rend() const noexcept
+		{
+			return m_nodes.rend();
+		}
+
+		/// @copydoc rend()
+		[[nodiscard]] inline const_reverse_iterator crend() const noexcept
+		{
+			return m_nodes.crend();
+		}
+
+		/// @}
+
+		/// @name Capacity
+		/// @{
+
+		/// Checks if the hyperoctree has no nodes.
+		/// @return `true` if the hyperoctree is empty, `false` otherwise.
+		/// @note This function should always return `false`, as the root node is persistent.
+		[[nodiscard]] inline bool empty() const noexcept
+		{
+			return m_nodes.empty();
+		}
+
+		/// Checks if the hyperoctree is full.
+		/// @return `true` if the hyperoctree is full, `false` otherwise.
+		[[nodiscard]] inline bool full() const noexcept
+		{
+			return size() == max_size();
+		}
+
+		/// Returns the number of nodes in the hyperoctree.
+		[[nodiscard]] inline usize size() const noexcept
+		{
+			return m_nodes.size();
+		}
+
+		/// Returns the total number of nodes the hyperoctree is capable of containing.
+		[[nodiscard]] constexpr usize max_size() const noexcept
+		{
+			return max_node_count;
+		}
+
+		/// @}
+
+		/// @name Modifiers
+		/// @{
+
+		/// Erases all nodes except the root node, which is persistent.
+		inline void clear()
+		{
+			m_nodes.assign(1, root);
+		}
+
+		/// Inserts nodes and their siblings into the hyperoctree, inserting ancestors as necessary.
+		/// @param nodes Nodes to insert, in any order.
+		void insert(std::span<const node_type> nodes)
+		{
+			// Gather nodes which are not yet contained
+			m_frontier.clear();
+			for (const node_type node: nodes)
+			{
+				if (!contains(node))
+				{
+					m_frontier.emplace_back(node);
+				}
+			}
+
+			// Add sibling groups of new nodes and their ancestors, one level at a time, stopping at ancestors which are already contained
+			m_batch.clear();
+			while (!m_frontier.empty())
+			{
+				radix_sort(m_frontier, m_scratch);
+				m_frontier.erase(std::unique(m_frontier.begin(), m_frontier.end()), m_frontier.end());
+
+				usize parent_count = 0;
+				for (const node_type node: m_frontier)
+				{
+					const node_type first_sibling = child(parent(node), 0);
+					if (!m_batch.empty() && m_batch[m_batch.size() - children_per_node] == first_sibling)
+					{
+						continue;
+					}
+
+					for (node_type i = 0; i < children_per_node; ++i)
+					{
+						m_batch.emplace_back(sibling(first_sibling, i));
+					}
+
+					const node_type parent_node = parent(node);
+					if (!contains(parent_node))
+					{
+						m_frontier[parent_count++] = parent_node;
+					}
+				}
+				m_frontier.resize(parent_count);
+			}
+
+			if (m_batch.empty())
+			{
+				return;
+			}
+
+			// Merge new nodes into the sorted nodes
+			radix_sort(m_batch, m_scratch);
+			m_batch.erase(std::unique(m_batch.begin(), m_batch.end()), m_batch.end());
+			m_scratch.resize(m_nodes.size() + m_batch.size());
+			m_scratch.erase(std::set_union(m_nodes.begin(), m_nodes.end(), m_batch.begin(), m_batch.end(), m_scratch.begin()), m_scratch.end());
+			m_nodes.swap(m_scratch);
+		}
+
+		/// Inserts a node and its siblings into the hyperoctree, inserting ancestors as necessary.
+		/// @param node Node to insert.
+		/// @note The root node is persistent and does not need to be inserted.
+		inline void insert(node_type node)
+		{
+			if (!contains(node))
+			{
+				insert(std::span<const node_type>{&node, 1});
+			}
+		}
+
+		/// Erases nodes, along with their descendants, siblings, and descendants of siblings.
+		/// @param nodes Identifiers of the nodes to erase, in any order.
+		/// @note The root node is persistent and cannot be erased.
+		void erase(std::span<const node_type> nodes)
+		{
+			// Erasing a node erases the subtree of its parent, excluding the parent itself
+			m_batch.clear();
+			for (const node_type node: nodes)
+			{
+				if (node != root && contains(node))
+				{
+					m_batch.emplace_back(parent(node));
+				}
+			}
+
+			if (m_batch.empty())
+			{
+				return;
+			}
+
+			radix_sort(m_batch, m_scratch);
+			m_batch.erase(std::unique(m_batch.begin(), m_batch.end()), m_batch.end());
+
+			// Compact nodes, skipping erased ranges
+			auto output = m_nodes.begin();
+			auto input = m_nodes.begin();
+			node_type erased_end = 0;
+			for (const node_type parent_node: m_batch)
+			{
+				// Skip nodes whose ancestor's descendants were already erased
+				if (parent_node < erased_end)
+				{
+					continue;
+				}
+
+				const auto first = std::upper_bound(input, m_nodes.end(), parent_node);
+				output = std::copy(input, first, output);
+				erased_end = subtree_end(parent_node);
+				input = std::lower_bound(first, m_nodes.end(), erased_end);
+			}
+			output = std::copy(input, m_nodes.end(), output);
+			m_nodes.erase(output, m_nodes.end());
+		}
+
+		/// Erases a node, along with its descendants, siblings, and descendants of siblings.
+		/// @param node Identifier of the node to erase.
+		/// @note The root node is persistent and cannot be erased.
+		inline void erase(node_type node)
+		{
+			erase(std::span<const node_type>{&node, 1});
+		}
+
+		/// @}
+
+		/// @name Lookup
+		/// @{
+
+		/// Checks if a node is contained within the hyperoctree.
+		/// @param node Identifier of the node to check for.
+		/// @return `true` if the hyperoctree contains the node, `false` otherwise.
+		[[nodiscard]] inline bool contains(node_type node) const noexcept
+		{
+			return std::binary_search(m_nodes.begin(), m_nodes.end(), node);
+		}
+
+		/// Checks if a node has no children.
+		/// @param node Node identififer.
+		/// @return `true` if the node has no children, and `false` otherwise.
+		[[nodiscard]] inline bool is_leaf(node_type node) const noexcept
+		{
+			return !contains(child(node, 0));
+		}
+
+		/// Finds a node.
+		/// @param node Identifier of the node to find.
+		/// @return Iterator to the node, or end() if the node is not contained.
+		[[nodiscard]] const_iterator find(node_type node) const noexcept
+		{
+			const auto it = std::lower_bound(m_nodes.begin(), m_nodes.end(), node);
+			return (it != m_nodes.end() && *it == node) ? it : m_nodes.end();
+		}
+
+		/// Returns the number of nodes which precede a node in depth-first preorder.
+		/// @param node Node identifier, which need not be contained.
+		/// @return Number of contained nodes with smaller identifiers than @p node.
+		[[nodiscard]] inline usize rank(node_type node) const noexcept
+		{
+			return static_cast<usize>(std::lower_bound(m_nodes.begin(), m_nodes.end(), node) - m_nodes.begin());
+		}
+
+		/// Finds the deepest node which is either a node or one of its ancestors.
+		/// @param node Node identifier, typically of a location at the maximum depth.
+		/// @return Identifier of the deepest contained node which contains @p node. If @p node is not contained, this is a leaf node.
+		[[nodiscard]] inline node_type find_container(node_type node) const noexcept
+		{
+			// As siblings are always present, no contained node lies between the containing leaf and the node in depth-first preorder
+			return *(std::upper_bound(m_nodes.begin(), m_nodes.end(), node) - 1);
+		}
+
+		/// Returns a node and its descendants.
+		/// @param node Node identifier.
+		/// @return Contiguous range of the node and its descendants, in depth-first preorder, or an empty range if the node is not contained.
+		[[nodiscard]] std::span<const node_type> subtree(node_type node) const noexcept
+		{
+			const auto first = std::lower_bound(m_nodes.begin(), m_nodes.end(), node);
+			if (first == m_nodes.end() || *first != node)
+			{
+				return {};
+			}
+
+			return {first, std::lower_bound(first, m_nodes.end(), subtree_end(node))};
+		}
+
+		/// Returns all nodes, in depth-first preorder.
+		[[nodiscard]] inline std::span<const node_type> nodes() const noexcept
+		{
+			return m_nodes;
+		}
+
+		/// @}
+
+	private:
+		/// Sorts node identifiers with a least significant digit radix sort, skipping digits which all identifiers share.
+		/// @param[in,out] keys Node identifiers to sort.
+		/// @param scratch Scratch buffer.
+		static void radix_sort(std::vector<node_type>& keys, std::vector<node_type>& scratch)
+		{
+			if (keys.size() < 64)
+			{
+				std::sort(keys.begin(), keys.end());
+				return;
+			}
+
+			constexpr usize digit_count = sizeof(node_type);
+			std::array<std::array<usize, 256>, digit_count> histograms{};
+			for (const node_type key: keys)
+			{
+				for (usize d = 0; d < digit_count; ++d)
+				{
+					++histograms[d][(key >> (d * 8)) & 0xff];
+				}
+			}
+
+			scratch.resize(keys.size());
+			for (usize d = 0; d < digit_count; ++d)
+			{
+				auto& histogram = histograms[d];
+				if (std::ranges::find(histogram, keys.size()) != histogram.end())
+				{
+					continue;
+				}
+
+				usize offset = 0;
+				for (auto& count: histogram)
+				{
+					offset += std::exchange(count, offset);
+				}
+
+				for (const node_type key: keys)
+				{
+					scratch[histogram[(key >> (d * 8)) & 0xff]++] = key;
+				}
+				keys.swap(scratch);
+			}
+		}
+
+		std::vector<node_type> m_nodes;
+		std::vector<node_type> m_batch;
+		std::vector<node_type> m_frontier;
+		std::vector<node_type> m_scratch;
+	};
+
+	/// Linear octree, or 3-dimensional linear hyperoctree.
+	/// @tparam T Unsigned integral node identifier type.
+	template <std::unsigned_integral T>
+	using linear_octree = linear_hyperoctree<T, 3>;
+
+	/// Linear quadtree, or 2-dimensional linear hyperoctree.
+	/// @tparam T Unsigned integral node identifier type.
+	template <std::unsigned_integral T>
+	using linear_quadtree = linear_hyperoctree<T, 2>;
+}
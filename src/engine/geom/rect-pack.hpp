@@ -4,6 +4,7 @@
 #pragma once
 
 #include <engine/geom/primitives/rectangle.hpp>
+#include <engine/utility/sized-types.hpp>
 #include <memory>
 
 namespace engine::geom
@@ -60,6 +61,14 @@ namespace engine::geom
 			m_root_node.bounds.max = dimensions;
 		}
 
+		/// Enlarges the pack, preserving the positions of all previously inserted rects.
+		/// @param dimensions New dimensions of the root node. Must not be smaller than the current dimensions.
+		void grow(const vector_type& dimensions)
+		{
+			grow_axis(0, dimensions.x());
+			grow_axis(1, dimensions.y());
+		}
+
 		/// Inserts a rect.
 		/// @param dimensions Dimensions of the rect.
 		/// @return Pointer to the node in which the rect was inserted, or `nullptr` if the rect could not be inserted.
@@ -75,6 +84,34 @@ namespace engine::geom
 		}
 
 	private:
+		void grow_axis(usize axis, scalar_type size)
+		{
+			if (size <= m_root_node.bounds.max[axis])
+			{
+				return;
+			}
+
+			// Empty leaf root nodes can be enlarged in place
+			if (!m_root_node.occupied && !m_root_node.children[0])
+			{
+				m_root_node.bounds.max[axis] = size;
+				return;
+			}
+
+			// Move the old root node into the first child of a new root node, and the new space into the second
+			auto old_root_node = std::make_unique<node_type>(std::move(m_root_node));
+			auto new_space_node = std::make_unique<node_type>();
+			new_space_node->bounds = old_root_node->bounds;
+			new_space_node->bounds.min[axis] = old_root_node->bounds.max[axis];
+			new_space_node->bounds.max[axis] = size;
+
+			m_root_node = node_type{};
+			m_root_node.bounds = old_root_node->bounds;
+			m_root_node.bounds.max[axis] = size;
+			m_root_node.children[0] = std::move(old_root_node);
+			m_root_node.children[1] = std::move(new_space_node);
+		}
+
 		[[nodiscard]] node_type* insert(node_type& node, const vector_type& dimensions)
 		{
 			// If not a leaf node
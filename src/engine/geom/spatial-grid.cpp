@@ -0,0 +1,204 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <engine/geom/spatial-grid.hpp>
+#include <engine/geom/intersection.hpp>
+#include <bit>
+
+namespace engine::geom
+{
+	namespace
+	{
+		constexpr float inf = std::numeric_limits<float>::infinity();
+
+		/// Maximum ratio of dense cells to points.
+		constexpr u64 max_cells_per_point = 4;
+	}
+
+	spatial_grid::spatial_grid(float cell_size) noexcept:
+		m_cell_size(cell_size),
+		m_inverse_cell_size(1.0f / cell_size)
+	{
+		clear();
+	}
+
+	void spatial_grid::build(std::span<const math::fvec3> points)
+	{
+		if (points.empty())
+		{
+			clear();
+			return;
+		}
+
+		const usize point_count = points.size();
+
+		// Find the bounds of the points
+		m_bounds = {math::fvec3{inf, inf, inf}, math::fvec3{-inf, -inf, -inf}};
+		for (const auto& point: points)
+		{
+			m_bounds.extend(point);
+		}
+		m_min_cell = cell_of(m_bounds.min);
+		m_max_cell = cell_of(m_bounds.max);
+		m_grid_size = m_max_cell - m_min_cell + 1;
+
+		// Use dense cells if the bounds span few enough cells, otherwise allocate about two hashed buckets per point
+		const u64 dense_cell_count = static_cast<u64>(m_grid_size[0]) * static_cast<u64>(m_grid_size[1]) * static_cast<u64>(m_grid_size[2]);
+		m_dense = dense_cell_count <= static_cast<u64>(point_count) * max_cells_per_point + 64;
+		const usize bucket_count = m_dense ? static_cast<usize>(dense_cell_count) : std::bit_ceil(point_count * 2);
+		m_bucket_shift = 64 - static_cast<u32>(std::countr_zero(std::bit_ceil(point_count * 2)));
+		m_bucket_offsets.assign(bucket_count + 1, 0);
+
+		// Find the bucket of each point, and count the points in each bucket
+		m_buckets.resize(point_count);
+		m_unsorted_keys.resize(m_dense ? 0 : point_count);
+		for (usize i = 0; i < point_count; ++i)
+		{
+			const auto cell = cell_of(points[i]);
+			if (m_dense)
+			{
+				m_buckets[i] = static_cast<u32>(dense_bucket_of(cell));
+			}
+			else
+			{
+				m_unsorted_keys[i] = cell_key(cell);
+				m_buckets[i] = static_cast<u32>(bucket_of(m_unsorted_keys[i]));
+			}
+			++m_bucket_offsets[m_buckets[i] + 1];
+		}
+
+		// Convert bucket counts to offsets
+		for (usize i = 1; i <= bucket_count; ++i)
+		{
+			m_bucket_offsets[i] += m_bucket_offsets[i - 1];
+		}
+
+		// Scatter points into their buckets
+		m_points.resize(point_count);
+		m_indices.resize(point_count);
+		m_keys.resize(m_dense ? 0 : point_count);
+		m_bucket_cursors.assign(m_bucket_offsets.begin(), m_bucket_offsets.end() - 1);
+		for (usize i = 0; i < point_count; ++i)
+		{
+			const u32 j = m_bucket_cursors[m_buckets[i]]++;
+			m_points[j] = points[i];
+			m_indices[j] = static_cast<u32>(i);
+			if (!m_dense)
+			{
+				m_keys[j] = m_unsorted_keys[i];
+			}
+		}
+	}
+
+	void spatial_grid::clear() noexcept
+	{
+		m_dense = false;
+		m_bucket_shift = 63;
+		m_bucket_offsets.assign(3, 0);
+		m_points.clear();
+		m_indices.clear();
+		m_keys.clear();
+		m_bounds = {math::fvec3{inf, inf, inf}, math::fvec3{-inf, -inf, -inf}};
+		m_min_cell = {};
+		m_max_cell = {};
+		m_grid_size = {};
+	}
+
+	void spatial_grid::set_cell_size(float cell_size) noexcept
+	{
+		m_cell_size = cell_size;
+		m_inverse_cell_size = 1.0f / cell_size;
+		clear();
+	}
+
+	void spatial_grid::find_in_radius(const math::fvec3& center, float radius, std::vector<u32>& results) const
+	{
+		for_each_in_radius(center, radius, [&](u32 index, float)
+		{
+			results.emplace_back(index);
+		});
+	}
+
+	void spatial_grid::find_ray_cells(const geom::ray<float, 3>& ray, float radius, std::vector<cell_type>& cells) const
+	{
+		if (m_points.empty())
+		{
+			return;
+		}
+
+		// Clip the ray to the bounds of the points, padded by the radius
+		const box<float> bounds = {m_bounds.min - radius, m_bounds.max + radius};
+		const auto clip = intersection(ray, bounds);
+		if (!clip)
+		{
+			return;
+		}
+		const float t0 = std::max(std::get<0>(*clip), 0.0f);
+		const float t1 = std::get<1>(*clip);
+
+		// Points near the ray may lie in cells up to this many cells away from the cells which the ray passes through
+		const i32 reach = static_cast<i32>(std::ceil(radius * m_inverse_cell_size));
+
+		auto add_neighborhood = [&](const cell_type& cell)
+		{
+			for (i32 z = std::max(cell[2] - reach, m_min_cell[2]); z <= std::min(cell[2] + reach, m_max_cell[2]); ++z)
+			{
+				for (i32 y = std::max(cell[1] - reach, m_min_cell[1]); y <= std::min(cell[1] + reach, m_max_cell[1]); ++y)
+				{
+					for (i32 x = std::max(cell[0] - reach, m_min_cell[0]); x <= std::min(cell[0] + reach, m_max_cell[0]); ++x)
+					{
+						cells.push_back({x, y, z});
+					}
+				}
+			}
+		};
+
+		// Walk the cells which the clipped ray passes through
+		const auto start = ray.extrapolate(t0);
+		const auto last = cell_of(ray.extrapolate(t1));
+		auto cell = cell_of(start);
+		cell_type step;
+		math::fvec3 t_max;
+		math::fvec3 t_delta;
+		for (usize i = 0; i < 3; ++i)
+		{
+			if (ray.direction[i] > 0.0f)
+			{
+				step[i] = 1;
+				t_delta[i] = m_cell_size / ray.direction[i];
+				t_max[i] = t0 + (static_cast<float>(cell[i] + 1) * m_cell_size - start[i]) / ray.direction[i];
+			}
+			else if (ray.direction[i] < 0.0f)
+			{
+				step[i] = -1;
+				t_delta[i] = -m_cell_size / ray.direction[i];
+				t_max[i] = t0 + (static_cast<float>(cell[i]) * m_cell_size - start[i]) / ray.direction[i];
+			}
+			else
+			{
+				step[i] = 0;
+				t_delta[i] = inf;
+				t_max[i] = inf;
+			}
+		}
+
+		// Bound the walk by the number of cell boundaries between the first and last cells, in case of rounding
+		usize remaining = static_cast<usize>(std::abs(last[0] - cell[0]) + std::abs(last[1] - cell[1]) + std::abs(last[2] - cell[2]));
+		for (;;)
+		{
+			add_neighborhood(cell);
+			if (!remaining--)
+			{
+				break;
+			}
+
+			const usize axis = (t_max[0] < t_max[1]) ? ((t_max[0] < t_max[2]) ? 0 : 2) : ((t_max[1] < t_max[2]) ? 1 : 2);
+			cell[axis] += step[axis];
+			t_max[axis] += t_delta[axis];
+		}
+
+		// Neighborhoods of consecutive cells overlap
+		std::sort(cells.begin(), cells.end());
+		cells.erase(std::unique(cells.begin(), cells.end()), cells.end());
+	}
+}
@@ -0,0 +1,339 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <engine/geom/primitives/box.hpp>
+#include <engine/geom/primitives/ray.hpp>
+#include <engine/math/vector.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace engine::geom
+{
+	/// Hashed uniform grid of points, which is cheap enough to rebuild every tick and answers radius, nearest-neighbor and ray queries.
+	/// @details Points are bucketed by their grid cell with a counting sort, so that the points of each cell are contiguous. If the bounds of the points span few enough cells, buckets are dense cells in row-major order, so that each row of cells is contiguous. Otherwise, buckets are found by hashing cells, and each point stores the key of its cell, so that cells which share a bucket are told apart without measuring distances. Queries may run concurrently with each other, but not with build().
+	class spatial_grid
+	{
+	public:
+		/// Point found by a nearest-neighbor query.
+		struct neighbor
+		{
+			/// Index of the point.
+			u32 index;
+
+			/// Squared distance to the point.
+			float sqr_distance;
+		};
+
+		/// Constructs an empty spatial grid.
+		/// @param cell_size Edge length of the grid cells. Queries are fastest when the cell size is on the order of the typical query radius.
+		explicit spatial_grid(float cell_size = 1.0f) noexcept;
+
+		/// Rebuilds the grid from a set of points.
+		/// @param points Points to index. Query results refer to points by their index in this span.
+		void build(std::span<const math::fvec3> points);
+
+		/// Removes all points from the grid.
+		void clear() noexcept;
+
+		/// Sets the edge length of the grid cells. Removes all points from the grid.
+		/// @param cell_size Edge length of the grid cells.
+		void set_cell_size(float cell_size) noexcept;
+
+		/// Calls a function for each point within a radius of a center.
+		/// @param center Center of the query sphere.
+		/// @param radius Radius of the query sphere.
+		/// @param function Function called with the index and squared distance of each point.
+		template <class Function>
+		void for_each_in_radius(const math::fvec3& center, float radius, Function&& function) const
+		{
+			if (m_points.empty())
+			{
+				return;
+			}
+
+			const float sqr_radius = radius * radius;
+			const auto first = math::max(cell_of(center - radius), m_min_cell);
+			const auto last = math::min(cell_of(center + radius), m_max_cell);
+			for (i32 z = first[2]; z <= last[2]; ++z)
+			{
+				for (i32 y = first[1]; y <= last[1]; ++y)
+				{
+					visit_row(first[0], last[0], y, z, [&](usize i)
+					{
+						const float sqr_distance = math::sqr_distance(m_points[i], center);
+						if (sqr_distance <= sqr_radius)
+						{
+							function(m_indices[i], sqr_distance);
+						}
+					});
+				}
+			}
+		}
+
+		/// Finds the points within a radius of a center.
+		/// @param center Center of the query sphere.
+		/// @param radius Radius of the query sphere.
+		/// @param[out] results Vector to which the indices of the points are appended, in no particular order.
+		void find_in_radius(const math::fvec3& center, float radius, std::vector<u32>& results) const;
+
+		/// Finds the nearest points to a point which pass a filter.
+		/// @param point Query point.
+		/// @param[out] results Span to which the nearest points are written, nearest first. Its size is the maximum number of points to find.
+		/// @param filter Function which is called with the index of a point and returns `true` if the point may be found.
+		/// @param max_radius Maximum distance of found points.
+		/// @return Number of points found.
+		template <class Filter>
+		usize find_nearest(const math::fvec3& point, std::span<neighbor> results, Filter&& filter, float max_radius = std::numeric_limits<float>::infinity()) const
+		{
+			if (m_points.empty() || results.empty())
+			{
+				return 0;
+			}
+
+			// Keep the nearest points in a max-heap, with the farthest found point at the front
+			auto heap_compare = [](const neighbor& a, const neighbor& b){return a.sqr_distance < b.sqr_distance;};
+			usize count = 0;
+			float sqr_radius = max_radius * max_radius;
+
+			auto visit = [&](usize i)
+			{
+				const float sqr_distance = math::sqr_distance(m_points[i], point);
+				if (sqr_distance > sqr_radius || !filter(m_indices[i]))
+				{
+					return;
+				}
+
+				if (count < results.size())
+				{
+					results[count++] = {m_indices[i], sqr_distance};
+					std::push_heap(results.begin(), results.begin() + count, heap_compare);
+				}
+				else
+				{
+					std::pop_heap(results.begin(), results.end(), heap_compare);
+					results.back() = {m_indices[i], sqr_distance};
+					std::push_heap(results.begin(), results.end(), heap_compare);
+				}
+
+				// Once the results are full, only nearer points can be found
+				if (count == results.size())
+				{
+					sqr_radius = results.front().sqr_distance;
+				}
+			};
+
+			// Visit shells of cells around the cell of the point, nearest first
+			// Start at the first shell which reaches the bounds of the points
+			const auto center = cell_of(point);
+			i32 first_ring = 0;
+			for (usize i = 0; i < 3; ++i)
+			{
+				first_ring = std::max({first_ring, m_min_cell[i] - center[i], center[i] - m_max_cell[i]});
+			}
+
+			for (i32 ring = first_ring;; ++ring)
+			{
+				// Every unvisited point is farther than the inner surface of the shell
+				const float shell_distance = static_cast<float>(ring - 1) * m_cell_size;
+				if (ring && shell_distance * shell_distance > sqr_radius)
+				{
+					break;
+				}
+
+				// Stop once the shell lies beyond the bounds of the points
+				if (center[0] - ring < m_min_cell[0] && center[1] - ring < m_min_cell[1] && center[2] - ring < m_min_cell[2] &&
+					center[0] + ring > m_max_cell[0] && center[1] + ring > m_max_cell[1] && center[2] + ring > m_max_cell[2])
+				{
+					break;
+				}
+
+				for (i32 dz = -ring; dz <= ring; ++dz)
+				{
+					const i32 z = center[2] + dz;
+					if (z < m_min_cell[2] || z > m_max_cell[2])
+					{
+						continue;
+					}
+
+					for (i32 dy = -ring; dy <= ring; ++dy)
+					{
+						const i32 y = center[1] + dy;
+						if (y < m_min_cell[1] || y > m_max_cell[1])
+						{
+							continue;
+						}
+
+						// Within the shell, only the end cells of interior rows are on its surface
+						if (dz == -ring || dz == ring || dy == -ring || dy == ring)
+						{
+							visit_row(std::max(center[0] - ring, m_min_cell[0]), std::min(center[0] + ring, m_max_cell[0]), y, z, visit);
+						}
+						else
+						{
+							if (center[0] - ring >= m_min_cell[0])
+							{
+								visit_row(center[0] - ring, center[0] - ring, y, z, visit);
+							}
+							if (center[0] + ring <= m_max_cell[0])
+							{
+								visit_row(center[0] + ring, center[0] + ring, y, z, visit);
+							}
+						}
+					}
+				}
+			}
+
+			std::sort_heap(results.begin(), results.begin() + count, heap_compare);
+			return count;
+		}
+
+		/// Finds the nearest points to a point.
+		/// @param point Query point.
+		/// @param[out] results Span to which the nearest points are written, nearest first. Its size is the maximum number of points to find.
+		/// @param max_radius Maximum distance of found points.
+		/// @return Number of points found.
+		inline usize find_nearest(const math::fvec3& point, std::span<neighbor> results, float max_radius = std::numeric_limits<float>::infinity()) const
+		{
+			return find_nearest(point, results, [](u32){return true;}, max_radius);
+		}
+
+		/// Calls a function for each point which may lie within a distance of a ray. Each point is visited once, and points farther from the ray may also be visited.
+		/// @param ray Query ray.
+		/// @param radius Maximum distance from the ray.
+		/// @param function Function called with the index of each point.
+		template <class Function>
+		void for_each_near_ray(const geom::ray<float, 3>& ray, float radius, Function&& function) const
+		{
+			std::vector<cell_type> cells;
+			find_ray_cells(ray, radius, cells);
+			for (const auto& cell: cells)
+			{
+				visit_row(cell[0], cell[0], cell[1], cell[2], [&](usize i)
+				{
+					function(m_indices[i]);
+				});
+			}
+		}
+
+		/// Returns the bounds of the points, or an inverted box if the grid is empty.
+		[[nodiscard]] inline const box<float>& get_bounds() const noexcept
+		{
+			return m_bounds;
+		}
+
+		/// Returns the edge length of the grid cells.
+		[[nodiscard]] inline float get_cell_size() const noexcept
+		{
+			return m_cell_size;
+		}
+
+		/// Returns the number of points in the grid.
+		[[nodiscard]] inline usize size() const noexcept
+		{
+			return m_points.size();
+		}
+
+		/// Returns `true` if the grid has no points.
+		[[nodiscard]] inline bool empty() const noexcept
+		{
+			return m_points.empty();
+		}
+
+	private:
+		/// Integer coordinates of a grid cell.
+		using cell_type = math::vector<i32, 3>;
+
+		/// Returns the cell which contains a point.
+		[[nodiscard]] inline cell_type cell_of(const math::fvec3& point) const noexcept
+		{
+			// Clamp coordinates so that cells of distant points remain representable
+			constexpr float limit = static_cast<float>(i32{1} << 30);
+			return
+			{
+				static_cast<i32>(std::clamp(std::floor(point[0] * m_inverse_cell_size), -limit, limit)),
+				static_cast<i32>(std::clamp(std::floor(point[1] * m_inverse_cell_size), -limit, limit)),
+				static_cast<i32>(std::clamp(std::floor(point[2] * m_inverse_cell_size), -limit, limit))
+			};
+		}
+
+		/// Packs the coordinates of a cell into a key.
+		[[nodiscard]] static inline constexpr u64 cell_key(const cell_type& cell) noexcept
+		{
+			constexpr u64 mask = (u64{1} << 21) - 1;
+			constexpr i32 bias = i32{1} << 20;
+			return (static_cast<u64>(cell[0] + bias) & mask) | ((static_cast<u64>(cell[1] + bias) & mask) << 21) | ((static_cast<u64>(cell[2] + bias) & mask) << 42);
+		}
+
+		/// Returns the bucket of a cell key.
+		[[nodiscard]] inline usize bucket_of(u64 key) const noexcept
+		{
+			return static_cast<usize>((key * 0x9e3779b97f4a7c15) >> m_bucket_shift);
+		}
+
+		/// Returns the dense bucket of a cell within the bounds of the points.
+		[[nodiscard]] inline usize dense_bucket_of(const cell_type& cell) const noexcept
+		{
+			return (static_cast<usize>(cell[2] - m_min_cell[2]) * static_cast<usize>(m_grid_size[1]) + static_cast<usize>(cell[1] - m_min_cell[1])) * static_cast<usize>(m_grid_size[0]) + static_cast<usize>(cell[0] - m_min_cell[0]);
+		}
+
+		/// Calls a function with the sorted index of each point in a row of cells within the bounds of the points.
+		/// @param first_x First cell of the row on the x-axis.
+		/// @param last_x Last cell of the row on the x-axis.
+		/// @param y Cell of the row on the y-axis.
+		/// @param z Cell of the row on the z-axis.
+		/// @param function Function to call.
+		template <class Function>
+		inline void visit_row(i32 first_x, i32 last_x, i32 y, i32 z, Function&& function) const
+		{
+			if (m_dense)
+			{
+				// Rows of dense cells are contiguous
+				for (u32 i = m_bucket_offsets[dense_bucket_of({first_x, y, z})], end = m_bucket_offsets[dense_bucket_of({last_x, y, z}) + 1]; i < end; ++i)
+				{
+					function(i);
+				}
+			}
+			else
+			{
+				for (i32 x = first_x; x <= last_x; ++x)
+				{
+					const u64 key = cell_key({x, y, z});
+					const usize bucket = bucket_of(key);
+					for (u32 i = m_bucket_offsets[bucket], end = m_bucket_offsets[bucket + 1]; i < end; ++i)
+					{
+						if (m_keys[i] == key)
+						{
+							function(i);
+						}
+					}
+				}
+			}
+		}
+
+		/// Finds the distinct cells which contain points that may lie within a distance of a ray.
+		void find_ray_cells(const geom::ray<float, 3>& ray, float radius, std::vector<cell_type>& cells) const;
+
+		float m_cell_size;
+		float m_inverse_cell_size;
+		bool m_dense{false};
+		u32 m_bucket_shift{64};
+		std::vector<u32> m_bucket_offsets;
+		std::vector<math::fvec3> m_points;
+		std::vector<u32> m_indices;
+		std::vector<u64> m_keys;
+		std::vector<u64> m_unsorted_keys;
+		std::vector<u32> m_buckets;
+		std::vector<u32> m_bucket_cursors;
+		box<float> m_bounds;
+		cell_type m_min_cell{};
+		cell_type m_max_cell{};
+		cell_type m_grid_size{};
+	};
+}
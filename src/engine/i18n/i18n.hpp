@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <engine/i18n/packed-string-map.hpp>
 #include <engine/i18n/string-map.hpp>
 #include <engine/i18n/string-table.hpp>
 
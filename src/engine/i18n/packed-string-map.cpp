@@ -0,0 +1,298 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <engine/i18n/packed-string-map.hpp>
+#include <engine/resources/serializer.hpp>
+#include <engine/resources/deserializer.hpp>
+#include <engine/resources/deserialize-error.hpp>
+#include <engine/resources/resource-loader.hpp>
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <format>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace engine::i18n
+{
+	namespace
+	{
+		/// Packed string map identifier, "AKSM".
+		constexpr u32 packed_string_map_magic = 0x4d534b41;
+
+		/// Number of words in the header of a packed string map.
+		constexpr usize header_word_count = 4;
+
+		/// Number of words in each entry of a packed string map.
+		constexpr usize entry_word_count = 3;
+
+		/// Average number of keys per bucket.
+		constexpr usize keys_per_bucket = 4;
+	}
+
+	packed_string_map::packed_string_map(std::unique_ptr<std::byte[]> blob, usize size):
+		m_blob(std::move(blob)),
+		m_blob_size(size)
+	{
+		// Convert the index to the native byte order
+		if constexpr (std::endian::native == std::endian::big)
+		{
+			auto words = reinterpret_cast<u32*>(m_blob.get());
+			const usize word_count = m_blob_size / sizeof(u32);
+			for (usize i = 0; i < std::min(word_count, header_word_count); ++i)
+			{
+				words[i] = std::byteswap(words[i]);
+			}
+			if (word_count >= header_word_count)
+			{
+				const usize index_word_count = std::min<usize>(word_count, header_word_count + words[3] + static_cast<usize>(words[2]) * entry_word_count);
+				for (usize i = header_word_count; i < index_word_count; ++i)
+				{
+					words[i] = std::byteswap(words[i]);
+				}
+			}
+		}
+
+		parse();
+	}
+
+	packed_string_map::packed_string_map(const string_map& map)
+	{
+		const usize entry_count = map.size();
+		const usize bucket_count = entry_count ? (entry_count + keys_per_bucket - 1) / keys_per_bucket : 0;
+
+		// Distribute keys into buckets
+		std::vector<std::vector<hash::fnv32_t>> buckets(bucket_count);
+		for (const auto& [key, value]: map)
+		{
+			buckets[packed_string_map_hash(key, 0) % bucket_count].emplace_back(key);
+		}
+
+		// Place the largest buckets first, while most slots are free
+		std::vector<u32> bucket_order(bucket_count);
+		for (usize i = 0; i < bucket_count; ++i)
+		{
+			bucket_order[i] = static_cast<u32>(i);
+		}
+		std::stable_sort(bucket_order.begin(), bucket_order.end(), [&](u32 a, u32 b){return buckets[a].size() > buckets[b].size();});
+
+		// Find a displacement for each bucket which places all of its keys in distinct free slots
+		std::vector<u32> displacements(bucket_count, 0);
+		std::vector<const string_map::value_type*> slots(entry_count, nullptr);
+		std::vector<usize> bucket_slots;
+		for (const auto bucket_index: bucket_order)
+		{
+			const auto& bucket = buckets[bucket_index];
+			if (bucket.empty())
+			{
+				break;
+			}
+
+			for (u32 displacement = 1;; ++displacement)
+			{
+				if (!displacement)
+				{
+					throw std::invalid_argument("Failed to find a perfect hash for the string map.");
+				}
+
+				bucket_slots.clear();
+				for (const auto key: bucket)
+				{
+					const usize slot = packed_string_map_hash(key, displacement) % entry_count;
+					if (slots[slot] || std::find(bucket_slots.begin(), bucket_slots.end(), slot) != bucket_slots.end())
+					{
+						break;
+					}
+					bucket_slots.emplace_back(slot);
+				}
+
+				if (bucket_slots.size() == bucket.size())
+				{
+					for (usize i = 0; i < bucket.size(); ++i)
+					{
+						slots[bucket_slots[i]] = &*map.find(bucket[i]);
+					}
+					displacements[bucket_index] = displacement;
+					break;
+				}
+			}
+		}
+
+		// Measure string pool
+		usize pool_size = 0;
+		for (const auto& [key, value]: map)
+		{
+			pool_size += value.size() + 1;
+		}
+		if (pool_size > std::numeric_limits<u32>::max())
+		{
+			throw std::invalid_argument("String map exceeds the maximum size of a packed string map.");
+		}
+
+		// Allocate blob
+		const usize index_word_count = header_word_count + bucket_count + entry_count * entry_word_count;
+		m_blob_size = index_word_count * sizeof(u32) + pool_size;
+		m_blob = std::make_unique_for_overwrite<std::byte[]>(m_blob_size);
+
+		// Write index and string pool
+		auto words = reinterpret_cast<u32*>(m_blob.get());
+		auto pool = reinterpret_cast<char*>(m_blob.get()) + index_word_count * sizeof(u32);
+		words[0] = packed_string_map_magic;
+		words[1] = packed_string_map_version;
+		words[2] = static_cast<u32>(entry_count);
+		words[3] = static_cast<u32>(bucket_count);
+		std::copy(displacements.begin(), displacements.end(), words + header_word_count);
+
+		auto entry = words + header_word_count + bucket_count;
+		u32 offset = 0;
+		for (const auto slot: slots)
+		{
+			const auto& [key, value] = *slot;
+			entry[0] = static_cast<u32>(key);
+			entry[1] = offset;
+			entry[2] = static_cast<u32>(value.size());
+			entry += entry_word_count;
+
+			std::memcpy(pool + offset, value.data(), value.size());
+			offset += static_cast<u32>(value.size());
+			pool[offset++] = '\0';
+		}
+
+		parse();
+	}
+
+	std::optional<std::string_view> packed_string_map::find(hash::fnv32_t key) const noexcept
+	{
+		if (!m_entry_count)
+		{
+			return std::nullopt;
+		}
+
+		const u32 displacement = m_displacements[packed_string_map_hash(key, 0) % m_bucket_count];
+		const u32* entry = m_entries + (packed_string_map_hash(key, displacement) % m_entry_count) * entry_word_count;
+		if (entry[0] != static_cast<u32>(key))
+		{
+			return std::nullopt;
+		}
+
+		return std::string_view{m_pool + entry[1], entry[2]};
+	}
+
+	hash::fnv32_t packed_string_map::key_at(usize index) const noexcept
+	{
+		return static_cast<hash::fnv32_t>(m_entries[index * entry_word_count]);
+	}
+
+	std::string_view packed_string_map::value_at(usize index) const noexcept
+	{
+		const u32* entry = m_entries + index * entry_word_count;
+		return {m_pool + entry[1], entry[2]};
+	}
+
+	usize packed_string_map::index_size() const noexcept
+	{
+		return m_blob ? (header_word_count + m_bucket_count + static_cast<usize>(m_entry_count) * entry_word_count) * sizeof(u32) : 0;
+	}
+
+	void packed_string_map::parse()
+	{
+		if (m_blob_size < header_word_count * sizeof(u32))
+		{
+			throw std::invalid_argument("Packed string map truncated.");
+		}
+
+		const auto words = reinterpret_cast<const u32*>(m_blob.get());
+		if (words[0] != packed_string_map_magic)
+		{
+			throw std::invalid_argument("Invalid packed string map.");
+		}
+		if (words[1] != packed_string_map_version)
+		{
+			throw std::invalid_argument(std::format("Unsupported packed string map format (version {}).", words[1]));
+		}
+
+		m_entry_count = words[2];
+		m_bucket_count = words[3];
+		if (m_entry_count && !m_bucket_count)
+		{
+			throw std::invalid_argument("Invalid packed string map.");
+		}
+
+		const usize index_size = this->index_size();
+		if (m_blob_size < index_size)
+		{
+			throw std::invalid_argument("Packed string map truncated.");
+		}
+
+		m_displacements = words + header_word_count;
+		m_entries = m_displacements + m_bucket_count;
+		m_pool = reinterpret_cast<const char*>(m_blob.get()) + index_size;
+
+		// Check that every string and its terminator lie within the pool
+		const usize pool_size = m_blob_size - index_size;
+		for (usize i = 0; i < m_entry_count; ++i)
+		{
+			const u32* entry = m_entries + i * entry_word_count;
+			if (static_cast<usize>(entry[1]) + entry[2] >= pool_size || m_pool[entry[1] + entry[2]] != '\0')
+			{
+				throw std::invalid_argument("Packed string map truncated.");
+			}
+		}
+	}
+}
+
+namespace engine::resources
+{
+	/// Serializes a packed string map.
+	/// @param[in] map Packed string map to serialize.
+	/// @param[in,out] ctx Serialize context.
+	/// @throw serialize_error Write error.
+	template <>
+	void serializer<i18n::packed_string_map>::serialize(const i18n::packed_string_map& map, serialize_context& ctx)
+	{
+		// Default-constructed maps have no blob
+		if (map.blob().empty())
+		{
+			serialize(i18n::packed_string_map(i18n::string_map{}), ctx);
+			return;
+		}
+
+		const auto blob = map.blob();
+		const usize index_size = map.index_size();
+		ctx.write32<std::endian::little>(blob.data(), index_size / sizeof(u32));
+		ctx.write8(blob.data() + index_size, blob.size() - index_size);
+	}
+
+	/// Deserializes a packed string map.
+	/// @param[out] map Packed string map to deserialize.
+	/// @param[in,out] ctx Deserialize context.
+	/// @throw deserialize_error Read error.
+	template <>
+	void deserializer<i18n::packed_string_map>::deserialize(i18n::packed_string_map& map, deserialize_context& ctx)
+	{
+		// Read the whole blob at once
+		const usize size = ctx.size();
+		auto blob = std::make_unique_for_overwrite<std::byte[]>(size);
+		ctx.read8(blob.get(), size);
+
+		try
+		{
+			map = i18n::packed_string_map(std::move(blob), size);
+		}
+		catch (const std::invalid_argument& e)
+		{
+			throw deserialize_error(e.what());
+		}
+	}
+
+	template <>
+	std::unique_ptr<i18n::packed_string_map> resource_loader<i18n::packed_string_map>::load(resource_manager&, std::shared_ptr<deserialize_context> ctx)
+	{
+		auto resource = std::make_unique<i18n::packed_string_map>();
+
+		deserializer<i18n::packed_string_map>().deserialize(*resource, *ctx);
+
+		return resource;
+	}
+}
@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <engine/i18n/string-map.hpp>
+#include <engine/hash/fnv.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string_view>
+
+namespace engine::i18n
+{
+	/// Version of the packed string map format.
+	inline constexpr u32 packed_string_map_version = 1;
+
+	/// Read-only map of 32-bit keys to UTF-8 strings, stored in a single contiguous blob which is loaded with one read.
+	/// @details Keys are located with a minimal perfect hash, so each lookup hashes the key twice and compares it once. The blob consists of little-endian 32-bit words followed by a string pool:
+	///
+	/// | Field | Words |
+	/// | :---- | :---- |
+	/// | Magic number, "AKSM" | 1 |
+	/// | Format version | 1 |
+	/// | Entry count, `n` | 1 |
+	/// | Bucket count, `b` | 1 |
+	/// | Bucket displacements | `b` |
+	/// | Entries of key, string offset and string length | `3n` |
+	/// | UTF-8 string pool, with each string followed by a null terminator | |
+	///
+	/// An entry is found in slot `packed_string_map_hash(key, displacements[packed_string_map_hash(key, 0) % b]) % n`. Packed string maps can be built by `tools/strings-to-bin.py`.
+	class packed_string_map
+	{
+	public:
+		/// Constructs an empty packed string map.
+		packed_string_map() noexcept = default;
+
+		/// Constructs a packed string map from a blob.
+		/// @param blob Packed string map blob.
+		/// @param size Size of the blob, in bytes.
+		/// @exception std::invalid_argument Invalid or truncated blob.
+		packed_string_map(std::unique_ptr<std::byte[]> blob, usize size);
+
+		/// Constructs a packed string map from a string map.
+		/// @param map String map to pack.
+		/// @exception std::invalid_argument String pool exceeds 4 GiB.
+		explicit packed_string_map(const string_map& map);
+
+		/// Finds the string of a key.
+		/// @param key String key.
+		/// @return String of the key, or `std::nullopt` if the key was not found.
+		[[nodiscard]] std::optional<std::string_view> find(hash::fnv32_t key) const noexcept;
+
+		/// Checks if the map contains a key.
+		[[nodiscard]] inline bool contains(hash::fnv32_t key) const noexcept
+		{
+			return find(key).has_value();
+		}
+
+		/// Returns the key of an entry.
+		/// @param index Index of an entry, on `[0, size())`.
+		[[nodiscard]] hash::fnv32_t key_at(usize index) const noexcept;
+
+		/// Returns the string of an entry.
+		/// @param index Index of an entry, on `[0, size())`.
+		/// @return String, which is followed by a null terminator.
+		[[nodiscard]] std::string_view value_at(usize index) const noexcept;
+
+		/// Returns the number of entries in the map.
+		[[nodiscard]] inline constexpr usize size() const noexcept
+		{
+			return m_entry_count;
+		}
+
+		/// Returns `true` if the map has no entries.
+		[[nodiscard]] inline constexpr bool empty() const noexcept
+		{
+			return !m_entry_count;
+		}
+
+		/// Returns the blob of the map, in the native byte order.
+		[[nodiscard]] inline std::span<const std::byte> blob() const noexcept
+		{
+			return {m_blob.get(), m_blob_size};
+		}
+
+		/// Returns the size of the header, bucket displacements and entries of the blob, in bytes. These are stored as 32-bit words.
+		[[nodiscard]] usize index_size() const noexcept;
+
+	private:
+		/// Validates the blob and sets up views of its sections.
+		void parse();
+
+		std::unique_ptr<std::byte[]> m_blob;
+		usize m_blob_size{0};
+		const u32* m_displacements{nullptr};
+		const u32* m_entries{nullptr};
+		const char* m_pool{nullptr};
+		u32 m_entry_count{0};
+		u32 m_bucket_count{0};
+	};
+
+	/// Hash function of packed string maps.
+	/// @param key String key.
+	/// @param seed Bucket displacement, or `0` to find the bucket of a key.
+	/// @return Hash value.
+	[[nodiscard]] inline constexpr u32 packed_string_map_hash(hash::fnv32_t key, u32 seed) noexcept
+	{
+		// MurmurHash3 finalizer of the seeded key
+		u32 h = static_cast<u32>(key) ^ (seed * 0x9e3779b9u);
+		h ^= h >> 16;
+		h *= 0x85ebca6bu;
+		h ^= h >> 13;
+		h *= 0xc2b2ae35u;
+		h ^= h >> 16;
+		return h;
+	}
+}
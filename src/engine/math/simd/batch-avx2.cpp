@@ -0,0 +1,41 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// This translation unit is compiled with AVX2 and FMA code generation enabled, and must only be entered after checking get_supported_isa().
+
+#include <engine/math/simd/batch-kernels.hpp>
+
+static_assert(ENGINE_MATH_SIMD_AVX2, "batch-avx2.cpp must be compiled with AVX2 and FMA enabled.");
+
+namespace engine::math::simd::batch::avx2
+{
+	void transform_points(const math::fmat4* matrices, const math::fvec3* points, math::fvec3* results, usize count) noexcept
+	{
+		transform_points_kernel<8>(matrices, points, results, count);
+	}
+
+	void multiply_matrices(const math::fmat4* a, const math::fmat4* b, math::fmat4* results, usize count) noexcept
+	{
+		multiply_matrices_kernel<8>(a, b, results, count);
+	}
+
+	void multiply_quaternions(const math::fquat* a, const math::fquat* b, math::fquat* results, usize count) noexcept
+	{
+		multiply_quaternions_kernel<8>(a, b, results, count);
+	}
+
+	void rotate_vectors(const math::fquat* rotations, const math::fvec3* vectors, math::fvec3* results, usize count) noexcept
+	{
+		rotate_vectors_kernel<8>(rotations, vectors, results, count);
+	}
+
+	void normalize_vectors(const math::fvec3* vectors, math::fvec3* results, usize count) noexcept
+	{
+		normalize_vectors_kernel<8>(vectors, results, count);
+	}
+
+	void nlerp_quaternions(const math::fquat* a, const math::fquat* b, float t, math::fquat* results, usize count) noexcept
+	{
+		nlerp_quaternions_kernel<8>(a, b, t, results, count);
+	}
+}
@@ -0,0 +1,202 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <engine/math/simd/matrix-packet.hpp>
+#include <engine/math/simd/quaternion-packet.hpp>
+#include <engine/math/simd/vector-packet.hpp>
+#include <engine/utility/sized-types.hpp>
+
+// Batch kernels are compiled once per instruction set, in translation units with different code generation flags. Each instantiation is declared here in the namespace of its instruction set, and selected at runtime by the batch functions.
+#define ENGINE_MATH_SIMD_DECLARE_BATCH_KERNELS(isa_name) \
+	namespace engine::math::simd::batch::isa_name \
+	{ \
+		void transform_points(const math::fmat4* matrices, const math::fvec3* points, math::fvec3* results, usize count) noexcept; \
+		void multiply_matrices(const math::fmat4* a, const math::fmat4* b, math::fmat4* results, usize count) noexcept; \
+		void multiply_quaternions(const math::fquat* a, const math::fquat* b, math::fquat* results, usize count) noexcept; \
+		void rotate_vectors(const math::fquat* rotations, const math::fvec3* vectors, math::fvec3* results, usize count) noexcept; \
+		void normalize_vectors(const math::fvec3* vectors, math::fvec3* results, usize count) noexcept; \
+		void nlerp_quaternions(const math::fquat* a, const math::fquat* b, float t, math::fquat* results, usize count) noexcept; \
+	}
+
+ENGINE_MATH_SIMD_DECLARE_BATCH_KERNELS(sse2)
+ENGINE_MATH_SIMD_DECLARE_BATCH_KERNELS(avx2)
+
+#undef ENGINE_MATH_SIMD_DECLARE_BATCH_KERNELS
+
+namespace engine::math::simd::batch::ENGINE_MATH_SIMD_ISA
+{
+	/// Applies a packet function to full packets of elements, then to the remaining elements in a partial packet.
+	/// @tparam W Number of lanes.
+	/// @param count Number of elements.
+	/// @param full Function which processes `W` elements at an offset.
+	/// @param partial Function which processes fewer than `W` elements at an offset.
+	template <usize W, class Full, class Partial>
+	inline void for_each_packet(usize count, Full&& full, Partial&& partial) noexcept
+	{
+		usize i = 0;
+		for (; i + W <= count; i += W)
+		{
+			full(i);
+		}
+		if (i < count)
+		{
+			partial(i, count - i);
+		}
+	}
+
+	// Per-element matrices are processed column-wise, with one element in each group of four lanes. This avoids transposing each matrix into structure-of-arrays form, which costs more than it saves when every matrix is used only once.
+
+	template <usize W>
+	inline void transform_points_kernel(const math::fmat4* matrices, const math::fvec3* points, math::fvec3* results, usize count) noexcept
+	{
+		constexpr usize elements_per_packet = W / 4;
+
+		usize i = 0;
+		for (; i + elements_per_packet <= count; i += elements_per_packet)
+		{
+			const auto m = reinterpret_cast<const float*>(matrices + i);
+			const auto p = reinterpret_cast<const float*>(points + i);
+
+			auto r = load_packet_quads<W>(m + 12, 16);
+			r = fma(load_packet_quads<W>(m + 8, 16), make_packet_quads<W>(p + 2, 3), r);
+			r = fma(load_packet_quads<W>(m + 4, 16), make_packet_quads<W>(p + 1, 3), r);
+			r = fma(load_packet_quads<W>(m, 16), make_packet_quads<W>(p, 3), r);
+
+			alignas(32) float lanes[W];
+			store_packet(r, lanes);
+			for (usize j = 0; j < elements_per_packet; ++j)
+			{
+				results[i + j] = {lanes[j * 4], lanes[j * 4 + 1], lanes[j * 4 + 2]};
+			}
+		}
+
+		if constexpr (elements_per_packet > 1)
+		{
+			if (i < count)
+			{
+				transform_points_kernel<4>(matrices + i, points + i, results + i, count - i);
+			}
+		}
+	}
+
+	template <usize W>
+	inline void multiply_matrices_kernel(const math::fmat4* a, const math::fmat4* b, math::fmat4* results, usize count) noexcept
+	{
+		constexpr usize elements_per_packet = W / 4;
+
+		usize i = 0;
+		for (; i + elements_per_packet <= count; i += elements_per_packet)
+		{
+			const auto lhs = reinterpret_cast<const float*>(a + i);
+			const auto rhs = reinterpret_cast<const float*>(b + i);
+			const auto out = reinterpret_cast<float*>(results + i);
+
+			fpacket<W> columns[4];
+			for (usize k = 0; k < 4; ++k)
+			{
+				columns[k] = load_packet_quads<W>(lhs + k * 4, 16);
+			}
+
+			// Calculate all product columns before storing, in case the results alias the operands
+			fpacket<W> products[4];
+			for (usize j = 0; j < 4; ++j)
+			{
+				products[j] = columns[0] * make_packet_quads<W>(rhs + j * 4, 16);
+				for (usize k = 1; k < 4; ++k)
+				{
+					products[j] = fma(columns[k], make_packet_quads<W>(rhs + j * 4 + k, 16), products[j]);
+				}
+			}
+
+			for (usize j = 0; j < 4; ++j)
+			{
+				store_packet_quads(products[j], out + j * 4, 16);
+			}
+		}
+
+		if constexpr (elements_per_packet > 1)
+		{
+			if (i < count)
+			{
+				multiply_matrices_kernel<4>(a + i, b + i, results + i, count - i);
+			}
+		}
+	}
+
+	template <usize W>
+	inline void multiply_quaternions_kernel(const math::fquat* a, const math::fquat* b, math::fquat* results, usize count) noexcept
+	{
+		for_each_packet<W>
+		(
+			count,
+			[&](usize i)
+			{
+				store_quaternion_packet(load_quaternion_packet<W>(a + i) * load_quaternion_packet<W>(b + i), results + i);
+			},
+			[&](usize i, usize n)
+			{
+				store_quaternion_packet(load_quaternion_packet<W>(a + i, n) * load_quaternion_packet<W>(b + i, n), results + i, n);
+			}
+		);
+	}
+
+	template <usize W>
+	inline void rotate_vectors_kernel(const math::fquat* rotations, const math::fvec3* vectors, math::fvec3* results, usize count) noexcept
+	{
+		for_each_packet<W>
+		(
+			count,
+			[&](usize i)
+			{
+				store_vector_packet(load_quaternion_packet<W>(rotations + i) * load_vector_packet<W>(vectors + i), results + i);
+			},
+			[&](usize i, usize n)
+			{
+				store_vector_packet(load_quaternion_packet<W>(rotations + i, n) * load_vector_packet<W>(vectors + i, n), results + i, n);
+			}
+		);
+	}
+
+	template <usize W>
+	inline void normalize_vectors_kernel(const math::fvec3* vectors, math::fvec3* results, usize count) noexcept
+	{
+		for_each_packet<W>
+		(
+			count,
+			[&](usize i)
+			{
+				store_vector_packet(normalize(load_vector_packet<W>(vectors + i)), results + i);
+			},
+			[&](usize i, usize n)
+			{
+				// Normalize padding lanes of ones rather than zeros
+				math::fvec3 lanes[W];
+				for (usize j = 0; j < W; ++j)
+				{
+					lanes[j] = j < n ? vectors[i + j] : math::fvec3{1.0f, 1.0f, 1.0f};
+				}
+				store_vector_packet(normalize(load_vector_packet<W>(lanes)), results + i, n);
+			}
+		);
+	}
+
+	template <usize W>
+	inline void nlerp_quaternions_kernel(const math::fquat* a, const math::fquat* b, float t, math::fquat* results, usize count) noexcept
+	{
+		const auto tp = make_packet<W>(t);
+		for_each_packet<W>
+		(
+			count,
+			[&](usize i)
+			{
+				store_quaternion_packet(nlerp(load_quaternion_packet<W>(a + i), load_quaternion_packet<W>(b + i), tp), results + i);
+			},
+			[&](usize i, usize n)
+			{
+				store_quaternion_packet(nlerp(load_quaternion_packet<W>(a + i, n), load_quaternion_packet<W>(b + i, n), tp), results + i, n);
+			}
+		);
+	}
+}
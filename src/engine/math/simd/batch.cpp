@@ -0,0 +1,127 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <engine/math/simd/batch.hpp>
+#include <engine/math/simd/batch-kernels.hpp>
+#include <engine/math/simd/isa.hpp>
+#include <engine/debug/contract.hpp>
+
+namespace engine::math::simd::batch::sse2
+{
+	void transform_points(const math::fmat4* matrices, const math::fvec3* points, math::fvec3* results, usize count) noexcept
+	{
+		transform_points_kernel<4>(matrices, points, results, count);
+	}
+
+	void multiply_matrices(const math::fmat4* a, const math::fmat4* b, math::fmat4* results, usize count) noexcept
+	{
+		multiply_matrices_kernel<4>(a, b, results, count);
+	}
+
+	void multiply_quaternions(const math::fquat* a, const math::fquat* b, math::fquat* results, usize count) noexcept
+	{
+		multiply_quaternions_kernel<4>(a, b, results, count);
+	}
+
+	void rotate_vectors(const math::fquat* rotations, const math::fvec3* vectors, math::fvec3* results, usize count) noexcept
+	{
+		rotate_vectors_kernel<4>(rotations, vectors, results, count);
+	}
+
+	void normalize_vectors(const math::fvec3* vectors, math::fvec3* results, usize count) noexcept
+	{
+		normalize_vectors_kernel<4>(vectors, results, count);
+	}
+
+	void nlerp_quaternions(const math::fquat* a, const math::fquat* b, float t, math::fquat* results, usize count) noexcept
+	{
+		nlerp_quaternions_kernel<4>(a, b, t, results, count);
+	}
+}
+
+namespace engine::math::simd::batch
+{
+	void transform_points(std::span<const math::fmat4> matrices, std::span<const math::fvec3> points, std::span<math::fvec3> results) noexcept
+	{
+		debug::precondition(matrices.size() == points.size() && points.size() == results.size());
+
+		if (get_isa() == isa::avx2)
+		{
+			avx2::transform_points(matrices.data(), points.data(), results.data(), results.size());
+		}
+		else
+		{
+			sse2::transform_points(matrices.data(), points.data(), results.data(), results.size());
+		}
+	}
+
+	void multiply_matrices(std::span<const math::fmat4> a, std::span<const math::fmat4> b, std::span<math::fmat4> results) noexcept
+	{
+		debug::precondition(a.size() == b.size() && b.size() == results.size());
+
+		if (get_isa() == isa::avx2)
+		{
+			avx2::multiply_matrices(a.data(), b.data(), results.data(), results.size());
+		}
+		else
+		{
+			sse2::multiply_matrices(a.data(), b.data(), results.data(), results.size());
+		}
+	}
+
+	void multiply_quaternions(std::span<const math::fquat> a, std::span<const math::fquat> b, std::span<math::fquat> results) noexcept
+	{
+		debug::precondition(a.size() == b.size() && b.size() == results.size());
+
+		if (get_isa() == isa::avx2)
+		{
+			avx2::multiply_quaternions(a.data(), b.data(), results.data(), results.size());
+		}
+		else
+		{
+			sse2::multiply_quaternions(a.data(), b.data(), results.data(), results.size());
+		}
+	}
+
+	void rotate_vectors(std::span<const math::fquat> rotations, std::span<const math::fvec3> vectors, std::span<math::fvec3> results) noexcept
+	{
+		debug::precondition(rotations.size() == vectors.size() && vectors.size() == results.size());
+
+		if (get_isa() == isa::avx2)
+		{
+			avx2::rotate_vectors(rotations.data(), vectors.data(), results.data(), results.size());
+		}
+		else
+		{
+			sse2::rotate_vectors(rotations.data(), vectors.data(), results.data(), results.size());
+		}
+	}
+
+	void normalize_vectors(std::span<const math::fvec3> vectors, std::span<math::fvec3> results) noexcept
+	{
+		debug::precondition(vectors.size() == results.size());
+
+		if (get_isa() == isa::avx2)
+		{
+			avx2::normalize_vectors(vectors.data(), results.data(), results.size());
+		}
+		else
+		{
+			sse2::normalize_vectors(vectors.data(), results.data(), results.size());
+		}
+	}
+
+	void nlerp_quaternions(std::span<const math::fquat> a, std::span<const math::fquat> b, float t, std::span<math::fquat> results) noexcept
+	{
+		debug::precondition(a.size() == b.size() && b.size() == results.size());
+
+		if (get_isa() == isa::avx2)
+		{
+			avx2::nlerp_quaternions(a.data(), b.data(), t, results.data(), results.size());
+		}
+		else
+		{
+			sse2::nlerp_quaternions(a.data(), b.data(), t, results.data(), results.size());
+		}
+	}
+}
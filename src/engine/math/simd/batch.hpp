@@ -0,0 +1,55 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <engine/math/matrix.hpp>
+#include <engine/math/quaternion.hpp>
+#include <engine/math/vector.hpp>
+#include <span>
+
+/// Batch math functions, which process arrays of math types in SIMD packets using the instruction set selected with set_isa().
+namespace engine::math::simd::batch
+{
+	/// Transforms points by affine matrices.
+	/// @param matrices Affine transformation matrices.
+	/// @param points Points to transform, one per matrix.
+	/// @param[out] results Transformed points. May alias @p points.
+	/// @warning All spans must be the same size.
+	void transform_points(std::span<const math::fmat4> matrices, std::span<const math::fvec3> points, std::span<math::fvec3> results) noexcept;
+
+	/// Multiplies matrices.
+	/// @param a Matrices on the left-hand side.
+	/// @param b Matrices on the right-hand side.
+	/// @param[out] results Products of the matrices. May alias @p a or @p b.
+	/// @warning All spans must be the same size.
+	void multiply_matrices(std::span<const math::fmat4> a, std::span<const math::fmat4> b, std::span<math::fmat4> results) noexcept;
+
+	/// Multiplies quaternions.
+	/// @param a Quaternions on the left-hand side.
+	/// @param b Quaternions on the right-hand side.
+	/// @param[out] results Products of the quaternions. May alias @p a or @p b.
+	/// @warning All spans must be the same size.
+	void multiply_quaternions(std::span<const math::fquat> a, std::span<const math::fquat> b, std::span<math::fquat> results) noexcept;
+
+	/// Rotates vectors by unit quaternions.
+	/// @param rotations Unit quaternions.
+	/// @param vectors Vectors to rotate, one per quaternion.
+	/// @param[out] results Rotated vectors. May alias @p vectors.
+	/// @warning All spans must be the same size.
+	void rotate_vectors(std::span<const math::fquat> rotations, std::span<const math::fvec3> vectors, std::span<math::fvec3> results) noexcept;
+
+	/// Normalizes vectors.
+	/// @param vectors Vectors to normalize.
+	/// @param[out] results Normalized vectors. May alias @p vectors.
+	/// @warning All spans must be the same size.
+	void normalize_vectors(std::span<const math::fvec3> vectors, std::span<math::fvec3> results) noexcept;
+
+	/// Performs normalized linear interpolation between quaternions.
+	/// @param a First quaternions.
+	/// @param b Second quaternions.
+	/// @param t Interpolation factor.
+	/// @param[out] results Interpolated unit quaternions. May alias @p a or @p b.
+	/// @warning All spans must be the same size.
+	void nlerp_quaternions(std::span<const math::fquat> a, std::span<const math::fquat> b, float t, std::span<math::fquat> results) noexcept;
+}
@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <engine/math/simd/isa.hpp>
+#include <atomic>
+#include <stdexcept>
+
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#endif
+
+namespace engine::math::simd
+{
+	namespace
+	{
+		/// Detects whether the processor and operating system support AVX2 and FMA3.
+		[[nodiscard]] bool detect_avx2() noexcept
+		{
+			#if defined(_MSC_VER)
+				int info[4];
+				__cpuid(info, 0);
+				if (info[0] < 7)
+				{
+					return false;
+				}
+
+				// Check FMA3, OSXSAVE, and AVX support
+				__cpuid(info, 1);
+				constexpr int fma_bit = 1 << 12;
+				constexpr int osxsave_bit = 1 << 27;
+				constexpr int avx_bit = 1 << 28;
+				if ((info[2] & (fma_bit | osxsave_bit | avx_bit)) != (fma_bit | osxsave_bit | avx_bit))
+				{
+					return false;
+				}
+
+				// Check that the operating system saves YMM registers
+				if ((_xgetbv(0) & 0b110) != 0b110)
+				{
+					return false;
+				}
+
+				// Check AVX2 support
+				__cpuidex(info, 7, 0);
+				constexpr int avx2_bit = 1 << 5;
+				return (info[1] & avx2_bit) != 0;
+			#else
+				// GCC and Clang also check operating system support for YMM registers
+				__builtin_cpu_init();
+				return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+			#endif
+		}
+
+		[[nodiscard]] std::atomic<isa>& selected_isa() noexcept
+		{
+			static std::atomic<isa> value{get_supported_isa()};
+			return value;
+		}
+	}
+
+	isa get_supported_isa() noexcept
+	{
+		static const isa supported_isa = detect_avx2() ? isa::avx2 : isa::sse2;
+		return supported_isa;
+	}
+
+	isa get_isa() noexcept
+	{
+		return selected_isa().load(std::memory_order_relaxed);
+	}
+
+	void set_isa(isa value)
+	{
+		if (value == isa::avx2 && get_supported_isa() != isa::avx2)
+		{
+			throw std::invalid_argument("SIMD instruction set not supported by the processor.");
+		}
+
+		selected_isa().store(value, std::memory_order_relaxed);
+	}
+}
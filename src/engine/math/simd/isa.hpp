@@ -0,0 +1,45 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <immintrin.h>
+
+/// `1` if the current translation unit is compiled with AVX2 and FMA instructions enabled, `0` otherwise.
+#if defined(__AVX2__) && (defined(__FMA__) || defined(_MSC_VER))
+	#define ENGINE_MATH_SIMD_AVX2 1
+#else
+	#define ENGINE_MATH_SIMD_AVX2 0
+#endif
+
+/// Name of the namespace which holds code compiled for the instruction set of the current translation unit.
+/// @details SIMD packet types and functions are declared in an inline namespace with this name, so that translation units compiled for different instruction sets can use the same packet types without violating the one definition rule.
+#if ENGINE_MATH_SIMD_AVX2
+	#define ENGINE_MATH_SIMD_ISA avx2
+#else
+	#define ENGINE_MATH_SIMD_ISA sse2
+#endif
+
+namespace engine::math::simd
+{
+	/// Instruction sets for which SIMD code paths are compiled.
+	enum class isa
+	{
+		/// SSE2, supported by all x86-64 processors.
+		sse2,
+
+		/// AVX2 and FMA3.
+		avx2
+	};
+
+	/// Returns the most capable instruction set supported by the processor and operating system.
+	[[nodiscard]] isa get_supported_isa() noexcept;
+
+	/// Returns the instruction set of the code paths selected by SIMD batch functions.
+	[[nodiscard]] isa get_isa() noexcept;
+
+	/// Selects the instruction set of the code paths used by SIMD batch functions. By default, the most capable supported instruction set is selected.
+	/// @param value Instruction set to select.
+	/// @exception std::invalid_argument Instruction set not supported by the processor.
+	void set_isa(isa value);
+}
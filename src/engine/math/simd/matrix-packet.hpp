@@ -0,0 +1,187 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <engine/math/simd/vector-packet.hpp>
+#include <engine/math/matrix.hpp>
+#include <engine/utility/sized-types.hpp>
+
+namespace engine::math::simd::inline types::inline ENGINE_MATH_SIMD_ISA
+{
+	/// Structure-of-arrays packet of `W` *n* by *m* column-major matrices.
+	/// @tparam W Number of lanes.
+	/// @tparam N Number of columns.
+	/// @tparam M Number of rows.
+	template <usize W, usize N, usize M>
+	struct matrix_packet
+	{
+		/// Column vector packet type.
+		using column_type = vector_packet<W, M>;
+
+		/// Number of lanes.
+		static inline constexpr usize width = W;
+
+		/// Number of columns.
+		static inline constexpr usize column_count = N;
+
+		/// Number of rows.
+		static inline constexpr usize row_count = M;
+
+		/// Vector packets of each column, across all lanes.
+		column_type columns[N];
+	};
+
+	/// Packet of eight 3x3 matrices.
+	using fmat3x8 = matrix_packet<8, 3, 3>;
+
+	/// Packet of eight 4x4 matrices.
+	using fmat4x8 = matrix_packet<8, 4, 4>;
+
+	/// @name Matrix packet loading and storing
+	/// @{
+
+	/// Loads `W` consecutive matrices into a matrix packet.
+	/// @param matrices Pointer to `W` matrices.
+	/// @return Matrix packet of the loaded matrices.
+	template <usize W, usize N, usize M>
+	[[nodiscard]] inline matrix_packet<W, N, M> load_matrix_packet(const math::matrix<float, N, M>* matrices) noexcept
+	{
+		const auto values = reinterpret_cast<const float*>(matrices);
+
+		matrix_packet<W, N, M> p;
+		for (usize i = 0; i < N; ++i)
+		{
+			if constexpr (M == 4)
+			{
+				load_transposed(values + i * M, N * M, p.columns[i].elements);
+			}
+			else
+			{
+				for (usize j = 0; j < M; ++j)
+				{
+					p.columns[i].elements[j] = load_packet<W>(values + i * M + j, N * M);
+				}
+			}
+		}
+		return p;
+	}
+
+	/// Loads up to `W` consecutive matrices into a matrix packet. Lanes past @p count are set to the identity matrix.
+	/// @param matrices Pointer to @p count matrices.
+	/// @param count Number of matrices to load, no greater than `W`.
+	/// @return Matrix packet of the loaded matrices.
+	template <usize W, usize N, usize M>
+	[[nodiscard]] inline matrix_packet<W, N, M> load_matrix_packet(const math::matrix<float, N, M>* matrices, usize count) noexcept
+	{
+		math::matrix<float, N, M> lanes[W];
+		for (usize i = 0; i < W; ++i)
+		{
+			lanes[i] = i < count ? matrices[i] : math::matrix<float, N, M>::identity();
+		}
+		return load_matrix_packet<W>(lanes);
+	}
+
+	/// Stores a matrix packet to `W` consecutive matrices.
+	/// @param p Matrix packet to store.
+	/// @param[out] matrices Pointer to `W` matrices.
+	template <usize W, usize N, usize M>
+	inline void store_matrix_packet(const matrix_packet<W, N, M>& p, math::matrix<float, N, M>* matrices) noexcept
+	{
+		const auto values = reinterpret_cast<float*>(matrices);
+		for (usize i = 0; i < N; ++i)
+		{
+			if constexpr (M == 4)
+			{
+				store_transposed(p.columns[i].elements, values + i * M, N * M);
+			}
+			else
+			{
+				for (usize j = 0; j < M; ++j)
+				{
+					store_packet(p.columns[i].elements[j], values + i * M + j, N * M);
+				}
+			}
+		}
+	}
+
+	/// Stores the first @p count lanes of a matrix packet to consecutive matrices.
+	/// @param p Matrix packet to store.
+	/// @param[out] matrices Pointer to @p count matrices.
+	/// @param count Number of matrices to store, no greater than `W`.
+	template <usize W, usize N, usize M>
+	inline void store_matrix_packet(const matrix_packet<W, N, M>& p, math::matrix<float, N, M>* matrices, usize count) noexcept
+	{
+		math::matrix<float, N, M> lanes[W];
+		store_matrix_packet(p, lanes);
+		for (usize i = 0; i < count; ++i)
+		{
+			matrices[i] = lanes[i];
+		}
+	}
+
+	/// @}
+
+	/// @name Matrix packet functions
+	/// @{
+
+	/// Multiplies the matrices in a matrix packet by the column vectors in a vector packet.
+	template <usize W, usize N, usize M>
+	[[nodiscard]] inline vector_packet<W, M> mul(const matrix_packet<W, N, M>& a, const vector_packet<W, N>& b) noexcept
+	{
+		vector_packet<W, M> result;
+		for (usize j = 0; j < M; ++j)
+		{
+			result.elements[j] = a.columns[0].elements[j] * b.elements[0];
+		}
+		for (usize i = 1; i < N; ++i)
+		{
+			for (usize j = 0; j < M; ++j)
+			{
+				result.elements[j] = fma(a.columns[i].elements[j], b.elements[i], result.elements[j]);
+			}
+		}
+		return result;
+	}
+
+	/// Multiplies the matrices in two matrix packets.
+	template <usize W, usize N, usize M, usize P>
+	[[nodiscard]] inline matrix_packet<W, P, M> mul(const matrix_packet<W, N, M>& a, const matrix_packet<W, P, N>& b) noexcept
+	{
+		matrix_packet<W, P, M> result;
+		for (usize i = 0; i < P; ++i)
+		{
+			result.columns[i] = mul(a, b.columns[i]);
+		}
+		return result;
+	}
+
+	/// Transforms the 3-dimensional points in a vector packet by the 4x4 affine matrices in a matrix packet.
+	template <usize W>
+	[[nodiscard]] inline vector_packet<W, 3> transform_point(const matrix_packet<W, 4, 4>& a, const vector_packet<W, 3>& b) noexcept
+	{
+		vector_packet<W, 3> result;
+		for (usize j = 0; j < 3; ++j)
+		{
+			result.elements[j] = fma(a.columns[0].elements[j], b.elements[0], fma(a.columns[1].elements[j], b.elements[1], fma(a.columns[2].elements[j], b.elements[2], a.columns[3].elements[j])));
+		}
+		return result;
+	}
+
+	/// Transposes the matrices in a matrix packet.
+	template <usize W, usize N, usize M>
+	[[nodiscard]] inline matrix_packet<W, M, N> transpose(const matrix_packet<W, N, M>& a) noexcept
+	{
+		matrix_packet<W, M, N> result;
+		for (usize i = 0; i < N; ++i)
+		{
+			for (usize j = 0; j < M; ++j)
+			{
+				result.columns[j].elements[i] = a.columns[i].elements[j];
+			}
+		}
+		return result;
+	}
+
+	/// @}
+}
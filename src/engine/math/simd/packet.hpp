@@ -0,0 +1,851 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <engine/math/simd/isa.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <immintrin.h>
+
+namespace engine::math::simd::inline types::inline ENGINE_MATH_SIMD_ISA
+{
+	/// Packet of single-precision floating-point lanes, with one SIMD lane per element of a structure-of-arrays.
+	/// @tparam W Number of lanes.
+	template <usize W>
+	struct fpacket;
+
+	/// Packet of four single-precision floating-point lanes.
+	template <>
+	struct fpacket<4>
+	{
+		/// Number of lanes.
+		static inline constexpr usize width = 4;
+
+		/// @private
+		__m128 m_data;
+	};
+
+	/// Packet of eight single-precision floating-point lanes.
+	/// @details Eight-lane packets are held in an AVX register in translation units compiled for AVX2, or in a pair of SSE registers otherwise.
+	template <>
+	struct fpacket<8>
+	{
+		/// Number of lanes.
+		static inline constexpr usize width = 8;
+
+		#if ENGINE_MATH_SIMD_AVX2
+			/// @private
+			__m256 m_data;
+		#else
+			/// @private
+			fpacket<4> m_halves[2];
+		#endif
+	};
+
+	/// Four-lane packet.
+	using fpacket4 = fpacket<4>;
+
+	/// Eight-lane packet.
+	using fpacket8 = fpacket<8>;
+
+	/// @name Packet construction
+	/// @{
+
+	/// Broadcasts a value to all lanes of a packet.
+	/// @tparam W Number of lanes.
+	/// @param value Value to broadcast.
+	/// @return Packet with all lanes set to @p value.
+	template <usize W>
+	[[nodiscard]] inline fpacket<W> make_packet(float value) noexcept
+	{
+		if constexpr (W == 4)
+		{
+			return {_mm_set1_ps(value)};
+		}
+		else
+		{
+			#if ENGINE_MATH_SIMD_AVX2
+				return {_mm256_set1_ps(value)};
+			#else
+				return {{make_packet<4>(value), make_packet<4>(value)}};
+			#endif
+		}
+	}
+
+	/// Loads consecutive values into the lanes of a packet.
+	/// @tparam W Number of lanes.
+	/// @param values Pointer to `W` values. Need not be aligned.
+	/// @return Packet of the loaded values.
+	template <usize W>
+	[[nodiscard]] inline fpacket<W> load_packet(const float* values) noexcept
+	{
+		if constexpr (W == 4)
+		{
+			return {_mm_loadu_ps(values)};
+		}
+		else
+		{
+			#if ENGINE_MATH_SIMD_AVX2
+				return {_mm256_loadu_ps(values)};
+			#else
+				return {{load_packet<4>(values), load_packet<4>(values + 4)}};
+			#endif
+		}
+	}
+
+	/// Loads strided values into the lanes of a packet.
+	/// @tparam W Number of lanes.
+	/// @param values Pointer to the first value.
+	/// @param stride Number of floats between consecutive values.
+	/// @return Packet of the loaded values.
+	template <usize W>
+	[[nodiscard]] inline fpacket<W> load_packet(const float* values, usize stride) noexcept
+	{
+		if constexpr (W == 4)
+		{
+			return {_mm_setr_ps(values[0], values[stride], values[stride * 2], values[stride * 3])};
+		}
+		else
+		{
+			#if ENGINE_MATH_SIMD_AVX2
+				return {_mm256_setr_ps(values[0], values[stride], values[stride * 2], values[stride * 3], values[stride * 4], values[stride * 5], values[stride * 6], values[stride * 7])};
+			#else
+				return {{load_packet<4>(values, stride), load_packet<4>(values + stride * 4, stride)}};
+			#endif
+		}
+	}
+
+	/// Loads four consecutive values from each of `W / 4` strided locations into consecutive groups of four lanes.
+	/// @tparam W Number of lanes.
+	/// @param values Pointer to the first value.
+	/// @param stride Number of floats between consecutive groups of values.
+	/// @return Packet of the loaded values.
+	template <usize W>
+	[[nodiscard]] inline fpacket<W> load_packet_quads(const float* values, usize stride) noexcept
+	{
+		if constexpr (W == 4)
+		{
+			return load_packet<4>(values);
+		}
+		else
+		{
+			#if ENGINE_MATH_SIMD_AVX2
+				return {_mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(values)), _mm_loadu_ps(values + stride), 1)};
+			#else
+				return {{load_packet<4>(values), load_packet<4>(values + stride)}};
+			#endif
+		}
+	}
+
+	/// Broadcasts each of `W / 4` strided values to a consecutive group of four lanes.
+	/// @tparam W Number of lanes.
+	/// @param values Pointer to the first value.
+	/// @param stride Number of floats between consecutive values.
+	/// @return Packet of the broadcast values.
+	template <usize W>
+	[[nodiscard]] inline fpacket<W> make_packet_quads(const float* values, usize stride) noexcept
+	{
+		if constexpr (W == 4)
+		{
+			return make_packet<4>(*values);
+		}
+		else
+		{
+			#if ENGINE_MATH_SIMD_AVX2
+				return {_mm256_insertf128_ps(_mm256_castps128_ps256(_mm_set1_ps(*values)), _mm_set1_ps(values[stride]), 1)};
+			#else
+				return {{make_packet<4>(*values), make_packet<4>(values[stride])}};
+			#endif
+		}
+	}
+
+	/// @}
+
+	/// @name Packet storage
+	/// @{
+
+	/// Stores the lanes of a packet to consecutive values.
+	/// @param p Packet to store.
+	/// @param[out] values Pointer to `W` values. Need not be aligned.
+	inline void store_packet(const fpacket<4>& p, float* values) noexcept
+	{
+		_mm_storeu_ps(values, p.m_data);
+	}
+
+	/// @copydoc store_packet(const fpacket<4>&, float*)
+	inline void store_packet(const fpacket<8>& p, float* values) noexcept
+	{
+		#if ENGINE_MATH_SIMD_AVX2
+			_mm256_storeu_ps(values, p.m_data);
+		#else
+			store_packet(p.m_halves[0], values);
+			store_packet(p.m_halves[1], values + 4);
+		#endif
+	}
+
+	/// Stores consecutive groups of four lanes of a packet to `W / 4` strided locations.
+	/// @param p Packet to store.
+	/// @param[out] values Pointer to the first value.
+	/// @param stride Number of floats between consecutive groups of values.
+	inline void store_packet_quads(const fpacket<4>& p, float* values, usize) noexcept
+	{
+		store_packet(p, values);
+	}
+
+	/// @copydoc store_packet_quads(const fpacket<4>&, float*, usize)
+	inline void store_packet_quads(const fpacket<8>& p, float* values, usize stride) noexcept
+	{
+		#if ENGINE_MATH_SIMD_AVX2
+			_mm_storeu_ps(values, _mm256_castps256_ps128(p.m_data));
+			_mm_storeu_ps(values + stride, _mm256_extractf128_ps(p.m_data, 1));
+		#else
+			store_packet(p.m_halves[0], values);
+			store_packet(p.m_halves[1], values + stride);
+		#endif
+	}
+
+	/// Stores the lanes of a packet to strided values.
+	/// @param p Packet to store.
+	/// @param[out] values Pointer to the first value.
+	/// @param stride Number of floats between consecutive values.
+	template <usize W>
+	inline void store_packet(const fpacket<W>& p, float* values, usize stride) noexcept
+	{
+		alignas(32) float lanes[W];
+		store_packet(p, lanes);
+		for (usize i = 0; i < W; ++i)
+		{
+			values[i * stride] = lanes[i];
+		}
+	}
+
+	/// @}
+
+	/// @name Transposed loading and storing
+	/// @{
+
+	/// Loads four consecutive values from each of `W` strided structures, transposing them into four packets.
+	/// @param values Pointer to the first value of the first structure.
+	/// @param stride Number of floats between consecutive structures.
+	/// @param[out] packets Packets of the first, second, third, and fourth values of each structure.
+	inline void load_transposed(const float* values, usize stride, fpacket<4> (&packets)[4]) noexcept
+	{
+		__m128 r0 = _mm_loadu_ps(values);
+		__m128 r1 = _mm_loadu_ps(values + stride);
+		__m128 r2 = _mm_loadu_ps(values + stride * 2);
+		__m128 r3 = _mm_loadu_ps(values + stride * 3);
+		_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+		packets[0] = {r0};
+		packets[1] = {r1};
+		packets[2] = {r2};
+		packets[3] = {r3};
+	}
+
+	/// @copydoc load_transposed(const float*, usize, fpacket<4> (&)[4])
+	inline void load_transposed(const float* values, usize stride, fpacket<8> (&packets)[4]) noexcept
+	{
+		#if ENGINE_MATH_SIMD_AVX2
+			// Pair structure i with structure i + 4 in the low and high 128-bit lanes, then transpose within each lane
+			__m256 r[4];
+			for (usize i = 0; i < 4; ++i)
+			{
+				r[i] = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(values + stride * i)), _mm_loadu_ps(values + stride * (i + 4)), 1);
+			}
+			const __m256 t0 = _mm256_unpacklo_ps(r[0], r[1]);
+			const __m256 t1 = _mm256_unpacklo_ps(r[2], r[3]);
+			const __m256 t2 = _mm256_unpackhi_ps(r[0], r[1]);
+			const __m256 t3 = _mm256_unpackhi_ps(r[2], r[3]);
+			packets[0] = {_mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0))};
+			packets[1] = {_mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2))};
+			packets[2] = {_mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0))};
+			packets[3] = {_mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2))};
+		#else
+			fpacket<4> lo[4];
+			fpacket<4> hi[4];
+			load_transposed(values, stride, lo);
+			load_transposed(values + stride * 4, stride, hi);
+			for (usize i = 0; i < 4; ++i)
+			{
+				packets[i] = {{lo[i], hi[i]}};
+			}
+		#endif
+	}
+
+	/// Transposes four packets and stores them to four consecutive values in each of `W` strided structures.
+	/// @param packets Packets of the first, second, third, and fourth values of each structure.
+	/// @param[out] values Pointer to the first value of the first structure.
+	/// @param stride Number of floats between consecutive structures.
+	inline void store_transposed(const fpacket<4> (&packets)[4], float* values, usize stride) noexcept
+	{
+		__m128 r0 = packets[0].m_data;
+		__m128 r1 = packets[1].m_data;
+		__m128 r2 = packets[2].m_data;
+		__m128 r3 = packets[3].m_data;
+		_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+		_mm_storeu_ps(values, r0);
+		_mm_storeu_ps(values + stride, r1);
+		_mm_storeu_ps(values + stride * 2, r2);
+		_mm_storeu_ps(values + stride * 3, r3);
+	}
+
+	/// @copydoc store_transposed(const fpacket<4> (&)[4], float*, usize)
+	inline void store_transposed(const fpacket<8> (&packets)[4], float* values, usize stride) noexcept
+	{
+		#if ENGINE_MATH_SIMD_AVX2
+			const __m256 t0 = _mm256_unpacklo_ps(packets[0].m_data, packets[1].m_data);
+			const __m256 t1 = _mm256_unpacklo_ps(packets[2].m_data, packets[3].m_data);
+			const __m256 t2 = _mm256_unpackhi_ps(packets[0].m_data, packets[1].m_data);
+			const __m256 t3 = _mm256_unpackhi_ps(packets[2].m_data, packets[3].m_data);
+			const __m256 r[4] =
+			{
+				_mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0)),
+				_mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2)),
+				_mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0)),
+				_mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2))
+			};
+			for (usize i = 0; i < 4; ++i)
+			{
+				_mm_storeu_ps(values + stride * i, _mm256_castps256_ps128(r[i]));
+				_mm_storeu_ps(values + stride * (i + 4), _mm256_extractf128_ps(r[i], 1));
+			}
+		#else
+			const fpacket<4> lo[4] = {packets[0].m_halves[0], packets[1].m_halves[0], packets[2].m_halves[0], packets[3].m_halves[0]};
+			const fpacket<4> hi[4] = {packets[0].m_halves[1], packets[1].m_halves[1], packets[2].m_halves[1], packets[3].m_halves[1]};
+			store_transposed(lo, values, stride);
+			store_transposed(hi, values + stride * 4, stride);
+		#endif
+	}
+
+	/// Loads `W` tightly-packed three-value structures, transposing them into three packets.
+	/// @param values Pointer to `W * 3` values.
+	/// @param[out] packets Packets of the first, second, and third values of each structure.
+	inline void load_transposed(const float* values, fpacket<4> (&packets)[3]) noexcept
+	{
+		// a = x0 y0 z0 x1, b = y1 z1 x2 y2, c = z2 x3 y3 z3
+		const __m128 a = _mm_loadu_ps(values);
+		const __m128 b = _mm_loadu_ps(values + 4);
+		const __m128 c = _mm_loadu_ps(values + 8);
+
+		const __m128 t0 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2));
+		const __m128 t1 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1));
+		const __m128 t2 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3));
+		const __m128 t3 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2));
+
+		packets[0] = {_mm_shuffle_ps(a, t0, _MM_SHUFFLE(2, 0, 3, 0))};
+		packets[1] = {_mm_shuffle_ps(t1, t2, _MM_SHUFFLE(2, 0, 2, 0))};
+		packets[2] = {_mm_shuffle_ps(t3, c, _MM_SHUFFLE(3, 0, 2, 0))};
+	}
+
+	/// @copydoc load_transposed(const float*, fpacket<4> (&)[3])
+	inline void load_transposed(const float* values, fpacket<8> (&packets)[3]) noexcept
+	{
+		fpacket<4> lo[3];
+		fpacket<4> hi[3];
+		load_transposed(values, lo);
+		load_transposed(values + 12, hi);
+		for (usize i = 0; i < 3; ++i)
+		{
+			#if ENGINE_MATH_SIMD_AVX2
+				packets[i] = {_mm256_set_m128(hi[i].m_data, lo[i].m_data)};
+			#else
+				packets[i] = {{lo[i], hi[i]}};
+			#endif
+		}
+	}
+
+	/// Transposes three packets and stores them to `W` tightly-packed three-value structures.
+	/// @param packets Packets of the first, second, and third values of each structure.
+	/// @param[out] values Pointer to `W * 3` values.
+	inline void store_transposed(const fpacket<4> (&packets)[3], float* values) noexcept
+	{
+		const __m128 xy_lo = _mm_unpacklo_ps(packets[0].m_data, packets[1].m_data);
+		const __m128 xy_hi = _mm_unpackhi_ps(packets[0].m_data, packets[1].m_data);
+		const __m128 z = packets[2].m_data;
+
+		const __m128 t0 = _mm_shuffle_ps(z, xy_lo, _MM_SHUFFLE(2, 2, 0, 0));
+		const __m128 t1 = _mm_shuffle_ps(xy_lo, z, _MM_SHUFFLE(1, 1, 3, 3));
+		const __m128 t2 = _mm_shuffle_ps(z, xy_hi, _MM_SHUFFLE(2, 2, 2, 2));
+		const __m128 t3 = _mm_shuffle_ps(xy_hi, z, _MM_SHUFFLE(3, 3, 3, 3));
+
+		_mm_storeu_ps(values, _mm_shuffle_ps(xy_lo, t0, _MM_SHUFFLE(2, 0, 1, 0)));
+		_mm_storeu_ps(values + 4, _mm_shuffle_ps(t1, xy_hi, _MM_SHUFFLE(1, 0, 2, 0)));
+		_mm_storeu_ps(values + 8, _mm_shuffle_ps(t2, t3, _MM_SHUFFLE(2, 0, 2, 0)));
+	}
+
+	/// @copydoc store_transposed(const fpacket<4> (&)[3], float*)
+	inline void store_transposed(const fpacket<8> (&packets)[3], float* values) noexcept
+	{
+		#if ENGINE_MATH_SIMD_AVX2
+			const fpacket<4> lo[3] = {{_mm256_castps256_ps128(packets[0].m_data)}, {_mm256_castps256_ps128(packets[1].m_data)}, {_mm256_castps256_ps128(packets[2].m_data)}};
+			const fpacket<4> hi[3] = {{_mm256_extractf128_ps(packets[0].m_data, 1)}, {_mm256_extractf128_ps(packets[1].m_data, 1)}, {_mm256_extractf128_ps(packets[2].m_data, 1)}};
+		#else
+			const fpacket<4> lo[3] = {packets[0].m_halves[0], packets[1].m_halves[0], packets[2].m_halves[0]};
+			const fpacket<4> hi[3] = {packets[0].m_halves[1], packets[1].m_halves[1], packets[2].m_halves[1]};
+		#endif
+		store_transposed(lo, values);
+		store_transposed(hi, values + 12);
+	}
+
+	/// @}
+
+	/// @name Packet arithmetic
+	/// @{
+
+	// Defines a lane-wise binary operation for both packet widths
+	#if ENGINE_MATH_SIMD_AVX2
+		#define ENGINE_MATH_SIMD_PACKET_BINARY_OP(name, sse_op, avx_op) \
+			[[nodiscard]] inline fpacket<4> name(const fpacket<4>& a, const fpacket<4>& b) noexcept {return {sse_op(a.m_data, b.m_data)};} \
+			[[nodiscard]] inline fpacket<8> name(const fpacket<8>& a, const fpacket<8>& b) noexcept {return {avx_op(a.m_data, b.m_data)};}
+	#else
+		#define ENGINE_MATH_SIMD_PACKET_BINARY_OP(name, sse_op, avx_op) \
+			[[nodiscard]] inline fpacket<4> name(const fpacket<4>& a, const fpacket<4>& b) noexcept {return {sse_op(a.m_data, b.m_data)};} \
+			[[nodiscard]] inline fpacket<8> name(const fpacket<8>& a, const fpacket<8>& b) noexcept {return {{name(a.m_halves[0], b.m_halves[0]), name(a.m_halves[1], b.m_halves[1])}};}
+	#endif
+
+	/// Adds two packets.
+	ENGINE_MATH_SIMD_PACKET_BINARY_OP(operator+, _mm_add_ps, _mm256_add_ps)
+
+	/// Subtracts a packet from another packet.
+	ENGINE_MATH_SIMD_PACKET_BINARY_OP(operator-, _mm_sub_ps, _mm256_sub_ps)
+
+	/// Multiplies two packets.
+	ENGINE_MATH_SIMD_PACKET_BINARY_OP(operator*, _mm_mul_ps, _mm256_mul_ps)
+
+	/// Divides a packet by another packet.
+	ENGINE_MATH_SIMD_PACKET_BINARY_OP(operator/, _mm_div_ps, _mm256_div_ps)
+
+	/// Returns the lane-wise minimum of two packets.
+	ENGINE_MATH_SIMD_PACKET_BINARY_OP(min, _mm_min_ps, _mm256_min_ps)
+
+	/// Returns the lane-wise maximum of two packets.
+	ENGINE_MATH_SIMD_PACKET_BINARY_OP(max, _mm_max_ps, _mm256_max_ps)
+
+	#undef ENGINE_MATH_SIMD_PACKET_BINARY_OP
+
+	/// Returns a mask of the lanes in which a packet is less than another packet.
+	[[nodiscard]] inline fpacket<4> less_than(const fpacket<4>& a, const fpacket<4>& b) noexcept
+	{
+		return {_mm_cmplt_ps(a.m_data, b.m_data)};
+	}
+
+	/// @copydoc less_than(const fpacket<4>&, const fpacket<4>&)
+	[[nodiscard]] inline fpacket<8> less_than(const fpacket<8>& a, const fpacket<8>& b) noexcept
+	{
+		#if ENGINE_MATH_SIMD_AVX2
+			return {_mm256_cmp_ps(a.m_data, b.m_data, _CMP_LT_OQ)};
+		#else
+			return {{less_than(a.m_halves[0], b.m_halves[0]), less_than(a.m_halves[1], b.m_halves[1])}};
+		#endif
+	}
+
+	/// Returns a mask of the lanes in which a packet is greater than another packet.
+	template <usize W>
+	[[nodiscard]] inline fpacket<W> greater_than(const fpacket<W>& a, const fpacket<W>& b) noexcept
+	{
+		return less_than(b, a);
+	}
+
+	/// Returns `true` if any lane of a mask packet is set.
+	[[nodiscard]] inline bool any(const fpacket<4>& mask) noexcept
+	{
+		return _mm_movemask_ps(mask.m_data) != 0;
+	}
+
+	/// @copydoc any(const fpacket<4>&)
+	[[nodiscard]] inline bool any(const fpacket<8>& mask) noexcept
+	{
+		#if ENGINE_MATH_SIMD_AVX2
+			return _mm256_movemask_ps(mask.m_data) != 0;
+		#else
+			return any(mask.m_halves[0]) || any(mask.m_halves[1]);
+		#endif
+	}
+
+	/// Negates a packet.
+	template <usize W>
+	[[nodiscard]] inline fpacket<W> operator-(const fpacket<W>& p) noexcept
+	{
+		return make_packet<W>(0.0f) - p;
+	}
+
+	/// Multiplies two packets and adds a third, with a fused multiply-add instruction when available.
+	/// @param a First factor.
+	/// @param b Second factor.
+	/// @param c Addend.
+	/// @return `a * b + c`
+	[[nodiscard]] inline fpacket<4> fma(const fpacket<4>& a, const fpacket<4>& b, const fpacket<4>& c) noexcept
+	{
+		#if ENGINE_MATH_SIMD_AVX2
+			return {_mm_fmadd_ps(a.m_data, b.m_data, c.m_data)};
+		#else
+			return a * b + c;
+		#endif
+	}
+
+	/// @copydoc fma(const fpacket<4>&, const fpacket<4>&, const fpacket<4>&)
+	[[nodiscard]] inline fpacket<8> fma(const fpacket<8>& a, const fpacket<8>& b, const fpacket<8>& c) noexcept
+	{
+		#if ENGINE_MATH_SIMD_AVX2
+			return {_mm256_fmadd_ps(a.m_data, b.m_data, c.m_data)};
+		#else
+			return {{fma(a.m_halves[0], b.m_halves[0], c.m_halves[0]), fma(a.m_halves[1], b.m_halves[1], c.m_halves[1])}};
+		#endif
+	}
+
+	/// Returns the lane-wise square root of a packet.
+	[[nodiscard]] inline fpacket<4> sqrt(const fpacket<4>& p) noexcept
+	{
+		return {_mm_sqrt_ps(p.m_data)};
+	}
+
+	/// @copydoc sqrt(const fpacket<4>&)
+	[[nodiscard]] inline fpacket<8> sqrt(const fpacket<8>& p) noexcept
+	{
+		#if ENGINE_MATH_SIMD_AVX2
+			return {_mm256_sqrt_ps(p.m_data)};
+		#else
+			return {{sqrt(p.m_halves[0]), sqrt(p.m_halves[1])}};
+		#endif
+	}
+
+	/// Selects lanes from one of two packets according to a mask.
+	/// @param mask Mask packet, such as the result of less_than().
+	/// @param a Packet from which lanes are selected where the mask is set.
+	/// @param b Packet from which lanes are selected where the mask is clear.
+	/// @return Packet of selected lanes.
+	[[nodiscard]] inline fpacket<4> select(const fpacket<4>& mask, const fpacket<4>& a, const fpacket<4>& b) noexcept
+	{
+		return {_mm_or_ps(_mm_and_ps(mask.m_data, a.m_data), _mm_andnot_ps(mask.m_data, b.m_data))};
+	}
+
+	/// @copydoc select(const fpacket<4>&, const fpacket<4>&, const fpacket<4>&)
+	[[nodiscard]] inline fpacket<8> select(const fpacket<8>& mask, const fpacket<8>& a, const fpacket<8>& b) noexcept
+	{
+		#if ENGINE_MATH_SIMD_AVX2
+			return {_mm256_blendv_ps(b.m_data, a.m_data, mask.m_data)};
+		#else
+			return {{select(mask.m_halves[0], a.m_halves[0], b.m_halves[0]), select(mask.m_halves[1], a.m_halves[1], b.m_halves[1])}};
+		#endif
+	}
+
+	/// Returns the lane-wise absolute value of a packet.
+	template <usize W>
+	[[nodiscard]] inline fpacket<W> abs(const fpacket<W>& p) noexcept
+	{
+		return max(p, -p);
+	}
+
+	/// Returns the lane-wise reciprocal square root of a packet, at full precision.
+	template <usize W>
+	[[nodiscard]] inline fpacket<W> rcp_sqrt(const fpacket<W>& p) noexcept
+	{
+		return make_packet<W>(1.0f) / sqrt(p);
+	}
+
+	/// Rounds each lane of a packet toward zero.
+	/// @warning Lanes must be on `(-2^31, 2^31)`.
+	[[nodiscard]] inline fpacket<4> trunc(const fpacket<4>& p) noexcept
+	{
+		return {_mm_cvtepi32_ps(_mm_cvttps_epi32(p.m_data))};
+	}
+
+	/// @copydoc trunc(const fpacket<4>&)
+	[[nodiscard]] inline fpacket<8> trunc(const fpacket<8>& p) noexcept
+	{
+		#if ENGINE_MATH_SIMD_AVX2
+			return {_mm256_round_ps(p.m_data, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC)};
+		#else
+			return {{trunc(p.m_halves[0]), trunc(p.m_halves[1])}};
+		#endif
+	}
+
+	/// Rounds each lane of a packet toward negative infinity.
+	/// @warning Lanes must be on `(-2^31, 2^31)`.
+	[[nodiscard]] inline fpacket<4> floor(const fpacket<4>& p) noexcept
+	{
+		#if ENGINE_MATH_SIMD_AVX2
+			return {_mm_floor_ps(p.m_data)};
+		#else
+			const auto t = trunc(p);
+			return t - select(greater_than(t, p), make_packet<4>(1.0f), make_packet<4>(0.0f));
+		#endif
+	}
+
+	/// @copydoc floor(const fpacket<4>&)
+	[[nodiscard]] inline fpacket<8> floor(const fpacket<8>& p) noexcept
+	{
+		#if ENGINE_MATH_SIMD_AVX2
+			return {_mm256_floor_ps(p.m_data)};
+		#else
+			return {{floor(p.m_halves[0]), floor(p.m_halves[1])}};
+		#endif
+	}
+
+	/// Returns `true` if all lanes of two packets are equal.
+	[[nodiscard]] inline bool all_equal(const fpacket<4>& a, const fpacket<4>& b) noexcept
+	{
+		return _mm_movemask_ps(_mm_cmpeq_ps(a.m_data, b.m_data)) == 0b1111;
+	}
+
+	/// @copydoc all_equal(const fpacket<4>&, const fpacket<4>&)
+	[[nodiscard]] inline bool all_equal(const fpacket<8>& a, const fpacket<8>& b) noexcept
+	{
+		#if ENGINE_MATH_SIMD_AVX2
+			return _mm256_movemask_ps(_mm256_cmp_ps(a.m_data, b.m_data, _CMP_EQ_OQ)) == 0b11111111;
+		#else
+			return all_equal(a.m_halves[0], b.m_halves[0]) && all_equal(a.m_halves[1], b.m_halves[1]);
+		#endif
+	}
+
+	/// Returns the value of the first lane of a packet.
+	[[nodiscard]] inline float first_lane(const fpacket<4>& p) noexcept
+	{
+		return _mm_cvtss_f32(p.m_data);
+	}
+
+	/// @copydoc first_lane(const fpacket<4>&)
+	[[nodiscard]] inline float first_lane(const fpacket<8>& p) noexcept
+	{
+		#if ENGINE_MATH_SIMD_AVX2
+			return _mm256_cvtss_f32(p.m_data);
+		#else
+			return first_lane(p.m_halves[0]);
+		#endif
+	}
+
+	/// @}
+
+	/// Packet of unsigned 32-bit integer lanes, with wrapping arithmetic.
+	/// @tparam W Number of lanes.
+	template <usize W>
+	struct upacket;
+
+	/// Packet of four unsigned 32-bit integer lanes.
+	template <>
+	struct upacket<4>
+	{
+		/// Number of lanes.
+		static inline constexpr usize width = 4;
+
+		/// @private
+		__m128i m_data;
+	};
+
+	/// Packet of eight unsigned 32-bit integer lanes.
+	template <>
+	struct upacket<8>
+	{
+		/// Number of lanes.
+		static inline constexpr usize width = 8;
+
+		#if ENGINE_MATH_SIMD_AVX2
+			/// @private
+			__m256i m_data;
+		#else
+			/// @private
+			upacket<4> m_halves[2];
+		#endif
+	};
+
+	/// @name Integer packet functions
+	/// @{
+
+	/// Broadcasts a value to all lanes of an integer packet.
+	template <usize W>
+	[[nodiscard]] inline upacket<W> make_upacket(u32 value) noexcept
+	{
+		if constexpr (W == 4)
+		{
+			return {_mm_set1_epi32(static_cast<int>(value))};
+		}
+		else
+		{
+			#if ENGINE_MATH_SIMD_AVX2
+				return {_mm256_set1_epi32(static_cast<int>(value))};
+			#else
+				return {{make_upacket<4>(value), make_upacket<4>(value)}};
+			#endif
+		}
+	}
+
+	/// Stores the lanes of an integer packet to consecutive values.
+	inline void store_packet(const upacket<4>& p, u32* values) noexcept
+	{
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(values), p.m_data);
+	}
+
+	/// @copydoc store_packet(const upacket<4>&, u32*)
+	inline void store_packet(const upacket<8>& p, u32* values) noexcept
+	{
+		#if ENGINE_MATH_SIMD_AVX2
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(values), p.m_data);
+		#else
+			store_packet(p.m_halves[0], values);
+			store_packet(p.m_halves[1], values + 4);
+		#endif
+	}
+
+	// Defines a lane-wise binary integer operation for both packet widths
+	#if ENGINE_MATH_SIMD_AVX2
+		#define ENGINE_MATH_SIMD_UPACKET_BINARY_OP(name, sse_op, avx_op) \
+			[[nodiscard]] inline upacket<4> name(const upacket<4>& a, const upacket<4>& b) noexcept {return {sse_op(a.m_data, b.m_data)};} \
+			[[nodiscard]] inline upacket<8> name(const upacket<8>& a, const upacket<8>& b) noexcept {return {avx_op(a.m_data, b.m_data)};}
+	#else
+		#define ENGINE_MATH_SIMD_UPACKET_BINARY_OP(name, sse_op, avx_op) \
+			[[nodiscard]] inline upacket<4> name(const upacket<4>& a, const upacket<4>& b) noexcept {return {sse_op(a.m_data, b.m_data)};} \
+			[[nodiscard]] inline upacket<8> name(const upacket<8>& a, const upacket<8>& b) noexcept {return {{name(a.m_halves[0], b.m_halves[0]), name(a.m_halves[1], b.m_halves[1])}};}
+	#endif
+
+	/// Adds two integer packets.
+	ENGINE_MATH_SIMD_UPACKET_BINARY_OP(operator+, _mm_add_epi32, _mm256_add_epi32)
+
+	/// Subtracts an integer packet from another integer packet.
+	ENGINE_MATH_SIMD_UPACKET_BINARY_OP(operator-, _mm_sub_epi32, _mm256_sub_epi32)
+
+	/// Returns the bitwise AND of two integer packets.
+	ENGINE_MATH_SIMD_UPACKET_BINARY_OP(operator&, _mm_and_si128, _mm256_and_si256)
+
+	/// Returns the bitwise XOR of two integer packets.
+	ENGINE_MATH_SIMD_UPACKET_BINARY_OP(operator^, _mm_xor_si128, _mm256_xor_si256)
+
+	#undef ENGINE_MATH_SIMD_UPACKET_BINARY_OP
+
+	/// Multiplies two integer packets, keeping the low 32 bits of each product.
+	[[nodiscard]] inline upacket<4> operator*(const upacket<4>& a, const upacket<4>& b) noexcept
+	{
+		#if ENGINE_MATH_SIMD_AVX2
+			return {_mm_mullo_epi32(a.m_data, b.m_data)};
+		#else
+			// SSE2 only multiplies the even lanes into 64-bit products
+			const __m128i even = _mm_mul_epu32(a.m_data, b.m_data);
+			const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a.m_data, 32), _mm_srli_epi64(b.m_data, 32));
+			return {_mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)))};
+		#endif
+	}
+
+	/// @copydoc operator*(const upacket<4>&, const upacket<4>&)
+	[[nodiscard]] inline upacket<8> operator*(const upacket<8>& a, const upacket<8>& b) noexcept
+	{
+		#if ENGINE_MATH_SIMD_AVX2
+			return {_mm256_mullo_epi32(a.m_data, b.m_data)};
+		#else
+			return {{a.m_halves[0] * b.m_halves[0], a.m_halves[1] * b.m_halves[1]}};
+		#endif
+	}
+
+	/// Multiplies two integer packets, keeping the high 32 bits of each product.
+	[[nodiscard]] inline upacket<4> mul_hi(const upacket<4>& a, const upacket<4>& b) noexcept
+	{
+		const __m128i even = _mm_mul_epu32(a.m_data, b.m_data);
+		const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a.m_data, 32), _mm_srli_epi64(b.m_data, 32));
+		return {_mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 3, 1)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 3, 1)))};
+	}
+
+	/// @copydoc mul_hi(const upacket<4>&, const upacket<4>&)
+	[[nodiscard]] inline upacket<8> mul_hi(const upacket<8>& a, const upacket<8>& b) noexcept
+	{
+		#if ENGINE_MATH_SIMD_AVX2
+			const __m256i even = _mm256_mul_epu32(a.m_data, b.m_data);
+			const __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(a.m_data, 32), _mm256_srli_epi64(b.m_data, 32));
+			return {_mm256_unpacklo_epi32(_mm256_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 3, 1)), _mm256_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 3, 1)))};
+		#else
+			return {{mul_hi(a.m_halves[0], b.m_halves[0]), mul_hi(a.m_halves[1], b.m_halves[1])}};
+		#endif
+	}
+
+	/// Shifts each lane of an integer packet right, shifting in zeros.
+	/// @param p Integer packet.
+	/// @param count Number of bits by which to shift.
+	[[nodiscard]] inline upacket<4> operator>>(const upacket<4>& p, int count) noexcept
+	{
+		return {_mm_srli_epi32(p.m_data, count)};
+	}
+
+	/// @copydoc operator>>(const upacket<4>&, int)
+	[[nodiscard]] inline upacket<8> operator>>(const upacket<8>& p, int count) noexcept
+	{
+		#if ENGINE_MATH_SIMD_AVX2
+			return {_mm256_srli_epi32(p.m_data, count)};
+		#else
+			return {{p.m_halves[0] >> count, p.m_halves[1] >> count}};
+		#endif
+	}
+
+	/// Returns a mask of the lanes in which two integer packets are equal.
+	[[nodiscard]] inline fpacket<4> equal(const upacket<4>& a, const upacket<4>& b) noexcept
+	{
+		return {_mm_castsi128_ps(_mm_cmpeq_epi32(a.m_data, b.m_data))};
+	}
+
+	/// @copydoc equal(const upacket<4>&, const upacket<4>&)
+	[[nodiscard]] inline fpacket<8> equal(const upacket<8>& a, const upacket<8>& b) noexcept
+	{
+		#if ENGINE_MATH_SIMD_AVX2
+			return {_mm256_castsi256_ps(_mm256_cmpeq_epi32(a.m_data, b.m_data))};
+		#else
+			return {{equal(a.m_halves[0], b.m_halves[0]), equal(a.m_halves[1], b.m_halves[1])}};
+		#endif
+	}
+
+	/// Selects lanes from one of two integer packets according to a mask.
+	/// @param mask Mask packet, such as the result of less_than().
+	/// @param a Integer packet from which lanes are selected where the mask is set.
+	/// @param b Integer packet from which lanes are selected where the mask is clear.
+	/// @return Integer packet of selected lanes.
+	[[nodiscard]] inline upacket<4> select(const fpacket<4>& mask, const upacket<4>& a, const upacket<4>& b) noexcept
+	{
+		const __m128i m = _mm_castps_si128(mask.m_data);
+		return {_mm_or_si128(_mm_and_si128(m, a.m_data), _mm_andnot_si128(m, b.m_data))};
+	}
+
+	/// @copydoc select(const fpacket<4>&, const upacket<4>&, const upacket<4>&)
+	[[nodiscard]] inline upacket<8> select(const fpacket<8>& mask, const upacket<8>& a, const upacket<8>& b) noexcept
+	{
+		#if ENGINE_MATH_SIMD_AVX2
+			return {_mm256_blendv_epi8(b.m_data, a.m_data, _mm256_castps_si256(mask.m_data))};
+		#else
+			return {{select(mask.m_halves[0], a.m_halves[0], b.m_halves[0]), select(mask.m_halves[1], a.m_halves[1], b.m_halves[1])}};
+		#endif
+	}
+
+	/// Converts each lane of a packet to an unsigned integer, truncating toward zero. Negative values wrap, as with a `static_cast` through a 64-bit integer.
+	/// @warning Lanes must be on `(-2^31, 2^31)`.
+	[[nodiscard]] inline upacket<4> to_upacket(const fpacket<4>& p) noexcept
+	{
+		return {_mm_cvttps_epi32(p.m_data)};
+	}
+
+	/// @copydoc to_upacket(const fpacket<4>&)
+	[[nodiscard]] inline upacket<8> to_upacket(const fpacket<8>& p) noexcept
+	{
+		#if ENGINE_MATH_SIMD_AVX2
+			return {_mm256_cvttps_epi32(p.m_data)};
+		#else
+			return {{to_upacket(p.m_halves[0]), to_upacket(p.m_halves[1])}};
+		#endif
+	}
+
+	/// Converts each lane of an integer packet to the nearest floating-point value, as with a `static_cast` from an unsigned integer.
+	template <usize W>
+	[[nodiscard]] inline fpacket<W> to_fpacket(const upacket<W>& p) noexcept
+	{
+		// Convert the high and low halves separately, which are exact, then round once when adding them
+		const auto hi = p >> 16;
+		const auto lo = p & make_upacket<W>(0xffff);
+
+		if constexpr (W == 4)
+		{
+			return fma(fpacket<4>{_mm_cvtepi32_ps(hi.m_data)}, make_packet<4>(65536.0f), fpacket<4>{_mm_cvtepi32_ps(lo.m_data)});
+		}
+		else
+		{
+			#if ENGINE_MATH_SIMD_AVX2
+				return fma(fpacket<8>{_mm256_cvtepi32_ps(hi.m_data)}, make_packet<8>(65536.0f), fpacket<8>{_mm256_cvtepi32_ps(lo.m_data)});
+			#else
+				return {{to_fpacket(p.m_halves[0]), to_fpacket(p.m_halves[1])}};
+			#endif
+		}
+	}
+
+	/// @}
+}
@@ -0,0 +1,145 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <engine/math/simd/vector-packet.hpp>
+#include <engine/math/quaternion.hpp>
+#include <engine/utility/sized-types.hpp>
+
+namespace engine::math::simd::inline types::inline ENGINE_MATH_SIMD_ISA
+{
+	/// Structure-of-arrays packet of `W` quaternions.
+	/// @tparam W Number of lanes.
+	template <usize W>
+	struct quaternion_packet
+	{
+		/// Packet type.
+		using packet_type = fpacket<W>;
+
+		/// Number of lanes.
+		static inline constexpr usize width = W;
+
+		/// Packet of quaternion real parts.
+		packet_type r;
+
+		/// Vector packet of quaternion imaginary parts.
+		vector_packet<W, 3> i;
+	};
+
+	/// Packet of four quaternions.
+	using fquatx4 = quaternion_packet<4>;
+
+	/// Packet of eight quaternions.
+	using fquatx8 = quaternion_packet<8>;
+
+	/// @name Quaternion packet loading and storing
+	/// @{
+
+	/// Loads `W` consecutive quaternions into a quaternion packet.
+	/// @param quaternions Pointer to `W` quaternions.
+	/// @return Quaternion packet of the loaded quaternions.
+	template <usize W>
+	[[nodiscard]] inline quaternion_packet<W> load_quaternion_packet(const math::quaternion<float>* quaternions) noexcept
+	{
+		const auto v = load_vector_packet<W>(reinterpret_cast<const math::fvec4*>(quaternions));
+		return {v.elements[0], {{v.elements[1], v.elements[2], v.elements[3]}}};
+	}
+
+	/// Loads up to `W` consecutive quaternions into a quaternion packet. Lanes past @p count are set to the identity quaternion.
+	/// @param quaternions Pointer to @p count quaternions.
+	/// @param count Number of quaternions to load, no greater than `W`.
+	/// @return Quaternion packet of the loaded quaternions.
+	template <usize W>
+	[[nodiscard]] inline quaternion_packet<W> load_quaternion_packet(const math::quaternion<float>* quaternions, usize count) noexcept
+	{
+		math::quaternion<float> lanes[W];
+		for (usize i = 0; i < W; ++i)
+		{
+			lanes[i] = i < count ? quaternions[i] : math::identity<math::quaternion<float>>;
+		}
+		return load_quaternion_packet<W>(lanes);
+	}
+
+	/// Stores a quaternion packet to `W` consecutive quaternions.
+	/// @param q Quaternion packet to store.
+	/// @param[out] quaternions Pointer to `W` quaternions.
+	template <usize W>
+	inline void store_quaternion_packet(const quaternion_packet<W>& q, math::quaternion<float>* quaternions) noexcept
+	{
+		store_vector_packet(vector_packet<W, 4>{{q.r, q.i.x(), q.i.y(), q.i.z()}}, reinterpret_cast<math::fvec4*>(quaternions));
+	}
+
+	/// Stores the first @p count lanes of a quaternion packet to consecutive quaternions.
+	/// @param q Quaternion packet to store.
+	/// @param[out] quaternions Pointer to @p count quaternions.
+	/// @param count Number of quaternions to store, no greater than `W`.
+	template <usize W>
+	inline void store_quaternion_packet(const quaternion_packet<W>& q, math::quaternion<float>* quaternions, usize count) noexcept
+	{
+		store_vector_packet(vector_packet<W, 4>{{q.r, q.i.x(), q.i.y(), q.i.z()}}, reinterpret_cast<math::fvec4*>(quaternions), count);
+	}
+
+	/// @}
+
+	/// @name Quaternion packet functions
+	/// @{
+
+	/// Multiplies the quaternions in two quaternion packets.
+	template <usize W>
+	[[nodiscard]] inline quaternion_packet<W> operator*(const quaternion_packet<W>& lhs, const quaternion_packet<W>& rhs) noexcept
+	{
+		return
+		{
+			lhs.r * rhs.r - dot(lhs.i, rhs.i),
+			lhs.i * rhs.r + rhs.i * lhs.r + cross(lhs.i, rhs.i)
+		};
+	}
+
+	/// Rotates the vectors in a vector packet by the unit quaternions in a quaternion packet.
+	/// @warning Quaternions must be unit quaternions.
+	template <usize W>
+	[[nodiscard]] inline vector_packet<W, 3> operator*(const quaternion_packet<W>& lhs, const vector_packet<W, 3>& rhs) noexcept
+	{
+		const auto t = cross(lhs.i, rhs) * make_packet<W>(2.0f);
+		return rhs + lhs.r * t + cross(lhs.i, t);
+	}
+
+	/// Calculates the conjugates of the quaternions in a quaternion packet.
+	template <usize W>
+	[[nodiscard]] inline quaternion_packet<W> conjugate(const quaternion_packet<W>& q) noexcept
+	{
+		return {q.r, -q.i};
+	}
+
+	/// Calculates the dot products of the quaternions in two quaternion packets.
+	template <usize W>
+	[[nodiscard]] inline fpacket<W> dot(const quaternion_packet<W>& a, const quaternion_packet<W>& b) noexcept
+	{
+		return fma(a.r, b.r, dot(a.i, b.i));
+	}
+
+	/// Normalizes the quaternions in a quaternion packet.
+	template <usize W>
+	[[nodiscard]] inline quaternion_packet<W> normalize(const quaternion_packet<W>& q) noexcept
+	{
+		const auto s = rcp_sqrt(dot(q, q));
+		return {q.r * s, q.i * s};
+	}
+
+	/// Performs normalized linear interpolation between the quaternions in two quaternion packets.
+	/// @param a First quaternion packet.
+	/// @param b Second quaternion packet.
+	/// @param t Packet of interpolation factors.
+	template <usize W>
+	[[nodiscard]] inline quaternion_packet<W> nlerp(const quaternion_packet<W>& a, const quaternion_packet<W>& b, const fpacket<W>& t) noexcept
+	{
+		// Interpolate along the shortest path
+		const auto s = select(less_than(dot(a, b), make_packet<W>(0.0f)), -t, t);
+		const auto u = make_packet<W>(1.0f) - t;
+
+		return normalize(quaternion_packet<W>{fma(b.r, s, a.r * u), b.i * s + a.i * u});
+	}
+
+	/// @}
+}
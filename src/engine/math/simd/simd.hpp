@@ -4,6 +4,12 @@
 #pragma once
 
 #include <engine/math/simd/vector.hpp>
+#include <engine/math/simd/isa.hpp>
+#include <engine/math/simd/packet.hpp>
+#include <engine/math/simd/vector-packet.hpp>
+#include <engine/math/simd/quaternion-packet.hpp>
+#include <engine/math/simd/matrix-packet.hpp>
+#include <engine/math/simd/batch.hpp>
 
 /// SIMD math.
 namespace engine::math::simd {}
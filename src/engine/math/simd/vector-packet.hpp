@@ -0,0 +1,318 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <engine/math/simd/packet.hpp>
+#include <engine/math/vector.hpp>
+#include <engine/utility/sized-types.hpp>
+
+namespace engine::math::simd::inline types::inline ENGINE_MATH_SIMD_ISA
+{
+	/// Structure-of-arrays packet of `W` *n*-dimensional vectors.
+	/// @tparam W Number of lanes.
+	/// @tparam N Number of elements.
+	template <usize W, usize N>
+	struct vector_packet
+	{
+		/// Packet type.
+		using packet_type = fpacket<W>;
+
+		/// Number of lanes.
+		static inline constexpr usize width = W;
+
+		/// Number of elements.
+		static inline constexpr usize size = N;
+
+		/// Packets of each element, across all lanes.
+		packet_type elements[N];
+
+		/// @name Element access
+		/// @{
+
+		/// Returns a reference to the packet of the first element.
+		[[nodiscard]] inline constexpr packet_type& x() noexcept
+		{
+			return elements[0];
+		}
+		[[nodiscard]] inline constexpr const packet_type& x() const noexcept
+		{
+			return elements[0];
+		}
+
+		/// Returns a reference to the packet of the second element.
+		[[nodiscard]] inline constexpr packet_type& y() noexcept requires (N > 1)
+		{
+			return elements[1];
+		}
+		[[nodiscard]] inline constexpr const packet_type& y() const noexcept requires (N > 1)
+		{
+			return elements[1];
+		}
+
+		/// Returns a reference to the packet of the third element.
+		[[nodiscard]] inline constexpr packet_type& z() noexcept requires (N > 2)
+		{
+			return elements[2];
+		}
+		[[nodiscard]] inline constexpr const packet_type& z() const noexcept requires (N > 2)
+		{
+			return elements[2];
+		}
+
+		/// Returns a reference to the packet of the fourth element.
+		[[nodiscard]] inline constexpr packet_type& w() noexcept requires (N > 3)
+		{
+			return elements[3];
+		}
+		[[nodiscard]] inline constexpr const packet_type& w() const noexcept requires (N > 3)
+		{
+			return elements[3];
+		}
+
+		/// @}
+	};
+
+	/// Packet of four 3-dimensional vectors.
+	using fvec3x4 = vector_packet<4, 3>;
+
+	/// Packet of eight 3-dimensional vectors.
+	using fvec3x8 = vector_packet<8, 3>;
+
+	/// Packet of four 4-dimensional vectors.
+	using fvec4x4 = vector_packet<4, 4>;
+
+	/// Packet of eight 4-dimensional vectors.
+	using fvec4x8 = vector_packet<8, 4>;
+
+	/// @name Vector packet loading and storing
+	/// @{
+
+	/// Loads `W` consecutive array-of-structures vectors into a vector packet.
+	/// @param vectors Pointer to `W` vectors.
+	/// @return Vector packet of the loaded vectors.
+	template <usize W, usize N>
+	[[nodiscard]] inline vector_packet<W, N> load_vector_packet(const math::vector<float, N>* vectors) noexcept
+	{
+		const auto values = reinterpret_cast<const float*>(vectors);
+
+		vector_packet<W, N> p;
+		if constexpr (N == 3)
+		{
+			load_transposed(values, p.elements);
+		}
+		else if constexpr (N == 4)
+		{
+			load_transposed(values, N, p.elements);
+		}
+		else
+		{
+			for (usize i = 0; i < N; ++i)
+			{
+				p.elements[i] = load_packet<W>(values + i, N);
+			}
+		}
+		return p;
+	}
+
+	/// Loads up to `W` consecutive array-of-structures vectors into a vector packet. Lanes past @p count are set to zero.
+	/// @param vectors Pointer to @p count vectors.
+	/// @param count Number of vectors to load, no greater than `W`.
+	/// @return Vector packet of the loaded vectors.
+	template <usize W, usize N>
+	[[nodiscard]] inline vector_packet<W, N> load_vector_packet(const math::vector<float, N>* vectors, usize count) noexcept
+	{
+		math::vector<float, N> lanes[W] = {};
+		for (usize i = 0; i < count; ++i)
+		{
+			lanes[i] = vectors[i];
+		}
+		return load_vector_packet<W>(lanes);
+	}
+
+	/// Stores a vector packet to `W` consecutive array-of-structures vectors.
+	/// @param p Vector packet to store.
+	/// @param[out] vectors Pointer to `W` vectors.
+	template <usize W, usize N>
+	inline void store_vector_packet(const vector_packet<W, N>& p, math::vector<float, N>* vectors) noexcept
+	{
+		const auto values = reinterpret_cast<float*>(vectors);
+		if constexpr (N == 3)
+		{
+			store_transposed(p.elements, values);
+		}
+		else if constexpr (N == 4)
+		{
+			store_transposed(p.elements, values, N);
+		}
+		else
+		{
+			for (usize i = 0; i < N; ++i)
+			{
+				store_packet(p.elements[i], values + i, N);
+			}
+		}
+	}
+
+	/// Stores the first @p count lanes of a vector packet to consecutive array-of-structures vectors.
+	/// @param p Vector packet to store.
+	/// @param[out] vectors Pointer to @p count vectors.
+	/// @param count Number of vectors to store, no greater than `W`.
+	template <usize W, usize N>
+	inline void store_vector_packet(const vector_packet<W, N>& p, math::vector<float, N>* vectors, usize count) noexcept
+	{
+		math::vector<float, N> lanes[W];
+		store_vector_packet(p, lanes);
+		for (usize i = 0; i < count; ++i)
+		{
+			vectors[i] = lanes[i];
+		}
+	}
+
+	/// @}
+
+	/// @name Vector packet arithmetic
+	/// @{
+
+	/// Adds two vector packets.
+	template <usize W, usize N>
+	[[nodiscard]] inline vector_packet<W, N> operator+(const vector_packet<W, N>& a, const vector_packet<W, N>& b) noexcept
+	{
+		vector_packet<W, N> result;
+		for (usize i = 0; i < N; ++i)
+		{
+			result.elements[i] = a.elements[i] + b.elements[i];
+		}
+		return result;
+	}
+
+	/// Subtracts a vector packet from another vector packet.
+	template <usize W, usize N>
+	[[nodiscard]] inline vector_packet<W, N> operator-(const vector_packet<W, N>& a, const vector_packet<W, N>& b) noexcept
+	{
+		vector_packet<W, N> result;
+		for (usize i = 0; i < N; ++i)
+		{
+			result.elements[i] = a.elements[i] - b.elements[i];
+		}
+		return result;
+	}
+
+	/// Negates a vector packet.
+	template <usize W, usize N>
+	[[nodiscard]] inline vector_packet<W, N> operator-(const vector_packet<W, N>& v) noexcept
+	{
+		vector_packet<W, N> result;
+		for (usize i = 0; i < N; ++i)
+		{
+			result.elements[i] = -v.elements[i];
+		}
+		return result;
+	}
+
+	/// Multiplies two vector packets element-wise.
+	template <usize W, usize N>
+	[[nodiscard]] inline vector_packet<W, N> operator*(const vector_packet<W, N>& a, const vector_packet<W, N>& b) noexcept
+	{
+		vector_packet<W, N> result;
+		for (usize i = 0; i < N; ++i)
+		{
+			result.elements[i] = a.elements[i] * b.elements[i];
+		}
+		return result;
+	}
+
+	/// Multiplies each vector of a vector packet by the scalar in the corresponding lane of a packet.
+	template <usize W, usize N>
+	[[nodiscard]] inline vector_packet<W, N> operator*(const vector_packet<W, N>& v, const fpacket<W>& s) noexcept
+	{
+		vector_packet<W, N> result;
+		for (usize i = 0; i < N; ++i)
+		{
+			result.elements[i] = v.elements[i] * s;
+		}
+		return result;
+	}
+
+	/// @copydoc operator*(const vector_packet<W, N>&, const fpacket<W>&)
+	template <usize W, usize N>
+	[[nodiscard]] inline vector_packet<W, N> operator*(const fpacket<W>& s, const vector_packet<W, N>& v) noexcept
+	{
+		return v * s;
+	}
+
+	/// Divides each vector of a vector packet by the scalar in the corresponding lane of a packet.
+	template <usize W, usize N>
+	[[nodiscard]] inline vector_packet<W, N> operator/(const vector_packet<W, N>& v, const fpacket<W>& s) noexcept
+	{
+		return v * (make_packet<W>(1.0f) / s);
+	}
+
+	/// @}
+
+	/// @name Vector packet functions
+	/// @{
+
+	/// Calculates the dot products of the vectors in two vector packets.
+	/// @return Packet of dot products.
+	template <usize W, usize N>
+	[[nodiscard]] inline fpacket<W> dot(const vector_packet<W, N>& a, const vector_packet<W, N>& b) noexcept
+	{
+		auto result = a.elements[0] * b.elements[0];
+		for (usize i = 1; i < N; ++i)
+		{
+			result = fma(a.elements[i], b.elements[i], result);
+		}
+		return result;
+	}
+
+	/// Calculates the cross products of the vectors in two 3-dimensional vector packets.
+	template <usize W>
+	[[nodiscard]] inline vector_packet<W, 3> cross(const vector_packet<W, 3>& a, const vector_packet<W, 3>& b) noexcept
+	{
+		return
+		{{
+			fma(a.y(), b.z(), -(a.z() * b.y())),
+			fma(a.z(), b.x(), -(a.x() * b.z())),
+			fma(a.x(), b.y(), -(a.y() * b.x()))
+		}};
+	}
+
+	/// Calculates the squared lengths of the vectors in a vector packet.
+	template <usize W, usize N>
+	[[nodiscard]] inline fpacket<W> sqr_length(const vector_packet<W, N>& v) noexcept
+	{
+		return dot(v, v);
+	}
+
+	/// Calculates the lengths of the vectors in a vector packet.
+	template <usize W, usize N>
+	[[nodiscard]] inline fpacket<W> length(const vector_packet<W, N>& v) noexcept
+	{
+		return sqrt(sqr_length(v));
+	}
+
+	/// Normalizes the vectors in a vector packet.
+	template <usize W, usize N>
+	[[nodiscard]] inline vector_packet<W, N> normalize(const vector_packet<W, N>& v) noexcept
+	{
+		return v * rcp_sqrt(sqr_length(v));
+	}
+
+	/// Linearly interpolates between the vectors in two vector packets.
+	/// @param a First vector packet.
+	/// @param b Second vector packet.
+	/// @param t Packet of interpolation factors.
+	template <usize W, usize N>
+	[[nodiscard]] inline vector_packet<W, N> lerp(const vector_packet<W, N>& a, const vector_packet<W, N>& b, const fpacket<W>& t) noexcept
+	{
+		vector_packet<W, N> result;
+		for (usize i = 0; i < N; ++i)
+		{
+			result.elements[i] = fma(b.elements[i] - a.elements[i], t, a.elements[i]);
+		}
+		return result;
+	}
+
+	/// @}
+}
@@ -0,0 +1,16 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// This translation unit is compiled with AVX2 and FMA code generation enabled, and must only be entered after checking math::simd::get_supported_isa().
+
+#include <engine/noise/batch-kernels.hpp>
+
+static_assert(ENGINE_MATH_SIMD_AVX2, "batch-avx2.cpp must be compiled with AVX2 and FMA enabled.");
+
+namespace engine::noise::batch::avx2
+{
+	ENGINE_NOISE_DEFINE_BATCH_KERNELS(8, 2)
+	ENGINE_NOISE_DEFINE_BATCH_KERNELS(8, 3)
+}
+
+#undef ENGINE_NOISE_DEFINE_BATCH_KERNELS
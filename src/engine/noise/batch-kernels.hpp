@@ -0,0 +1,784 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <engine/math/simd/vector-packet.hpp>
+#include <engine/math/vector.hpp>
+#include <engine/hash/pcg.hpp>
+#include <engine/noise/simplex.hpp>
+#include <engine/noise/voronoi.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <algorithm>
+#include <limits>
+
+namespace engine::noise::batch
+{
+	/// Simplex noise constants, which are calculated once by the dispatching translation unit.
+	struct simplex_parameters
+	{
+		/// Skewing factor.
+		float skew;
+
+		/// Unskewing factor.
+		float unskew;
+
+		/// Normalization factor.
+		float normalization;
+	};
+
+	/// Voronoi search kernel offsets, in structure-of-arrays form.
+	template <usize N>
+	struct voronoi_kernel_table
+	{
+		alignas(32) float offsets[N][voronoi_kernel_size<N>];
+	};
+
+	/// Voronoi search kernel offsets, in structure-of-arrays form.
+	template <usize N>
+	inline constexpr auto voronoi_kernel_offsets = []()
+	{
+		voronoi_kernel_table<N> table{};
+		for (usize i = 0; i < voronoi_kernel_size<N>; ++i)
+		{
+			for (usize j = 0; j < N; ++j)
+			{
+				table.offsets[j][i] = voronoi_kernel<float, N>[i].elements[j];
+			}
+		}
+		return table;
+	}();
+}
+
+// Batch kernels are compiled once per instruction set, in translation units with different code generation flags. Each instantiation is declared here in the namespace of its instruction set, and selected at runtime by the batch functions.
+#define ENGINE_NOISE_DECLARE_BATCH_KERNELS(isa_name, N) \
+	namespace engine::noise::batch::isa_name \
+	{ \
+		void simplex(const math::fvec##N* positions, usize count, const simplex_parameters& parameters, float* values) noexcept; \
+		void simplex_grid(const math::fvec##N& origin, const math::fvec##N& spacing, const math::uvec##N& size, const simplex_parameters& parameters, float* values) noexcept; \
+		void fbm(const math::fvec##N* positions, usize count, usize octaves, float lacunarity, float gain, const simplex_parameters& parameters, float* values) noexcept; \
+		void fbm_grid(const math::fvec##N& origin, const math::fvec##N& spacing, const math::uvec##N& size, usize octaves, float lacunarity, float gain, const simplex_parameters& parameters, float* values) noexcept; \
+		void voronoi_f1(const math::fvec##N* positions, usize count, float hash_scale, const math::fvec##N& tiling, float* sqr_distances, math::fvec##N* displacements, u32* ids) noexcept; \
+		void voronoi_f1_grid(const math::fvec##N& origin, const math::fvec##N& spacing, const math::uvec##N& size, float hash_scale, const math::fvec##N& tiling, float* sqr_distances, math::fvec##N* displacements, u32* ids) noexcept; \
+	}
+
+ENGINE_NOISE_DECLARE_BATCH_KERNELS(sse2, 2)
+ENGINE_NOISE_DECLARE_BATCH_KERNELS(sse2, 3)
+ENGINE_NOISE_DECLARE_BATCH_KERNELS(avx2, 2)
+ENGINE_NOISE_DECLARE_BATCH_KERNELS(avx2, 3)
+
+#undef ENGINE_NOISE_DECLARE_BATCH_KERNELS
+
+// Defines the kernels declared above for one instruction set, with a packet width of `W`
+#define ENGINE_NOISE_DEFINE_BATCH_KERNELS(W, N) \
+	void simplex(const math::fvec##N* positions, usize count, const simplex_parameters& parameters, float* values) noexcept \
+	{ \
+		simplex_kernel<W>(positions, count, parameters, values); \
+	} \
+	void simplex_grid(const math::fvec##N& origin, const math::fvec##N& spacing, const math::uvec##N& size, const simplex_parameters& parameters, float* values) noexcept \
+	{ \
+		simplex_grid_kernel<W>(origin, spacing, size, parameters, values); \
+	} \
+	void fbm(const math::fvec##N* positions, usize count, usize octaves, float lacunarity, float gain, const simplex_parameters& parameters, float* values) noexcept \
+	{ \
+		fbm_kernel<W>(positions, count, octaves, lacunarity, gain, parameters, values); \
+	} \
+	void fbm_grid(const math::fvec##N& origin, const math::fvec##N& spacing, const math::uvec##N& size, usize octaves, float lacunarity, float gain, const simplex_parameters& parameters, float* values) noexcept \
+	{ \
+		fbm_grid_kernel<W>(origin, spacing, size, octaves, lacunarity, gain, parameters, values); \
+	} \
+	void voronoi_f1(const math::fvec##N* positions, usize count, float hash_scale, const math::fvec##N& tiling, float* sqr_distances, math::fvec##N* displacements, u32* ids) noexcept \
+	{ \
+		voronoi_f1_kernel<W>(positions, count, hash_scale, tiling, sqr_distances, displacements, ids); \
+	} \
+	void voronoi_f1_grid(const math::fvec##N& origin, const math::fvec##N& spacing, const math::uvec##N& size, float hash_scale, const math::fvec##N& tiling, float* sqr_distances, math::fvec##N* displacements, u32* ids) noexcept \
+	{ \
+		voronoi_f1_grid_kernel<W>(origin, spacing, size, hash_scale, tiling, sqr_distances, displacements, ids); \
+	}
+
+namespace engine::noise::batch::ENGINE_MATH_SIMD_ISA
+{
+	using namespace math::simd;
+
+	// Kernels only call packet functions and read constant tables, so that no scalar library code is emitted with the code generation flags of another instruction set.
+
+	/// Stores the first lanes of a packet.
+	template <usize W>
+	inline void store_lanes(const fpacket<W>& p, float* values, usize count) noexcept
+	{
+		if (count == W)
+		{
+			store_packet(p, values);
+		}
+		else
+		{
+			alignas(32) float lanes[W];
+			store_packet(p, lanes);
+			for (usize i = 0; i < count; ++i)
+			{
+				values[i] = lanes[i];
+			}
+		}
+	}
+
+	/// @copydoc store_lanes(const fpacket<W>&, float*, usize)
+	template <usize W>
+	inline void store_lanes(const upacket<W>& p, u32* values, usize count) noexcept
+	{
+		if (count == W)
+		{
+			store_packet(p, values);
+		}
+		else
+		{
+			alignas(32) u32 lanes[W];
+			store_packet(p, lanes);
+			for (usize i = 0; i < count; ++i)
+			{
+				values[i] = lanes[i];
+			}
+		}
+	}
+
+	/// Returns a packet of lane indices, `{0, 1, ..., W - 1}`.
+	template <usize W>
+	[[nodiscard]] inline fpacket<W> lane_indices() noexcept
+	{
+		alignas(32) static constexpr float indices[8] = {0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f};
+		return load_packet<W>(indices);
+	}
+
+	/// Returns `true` if all lanes of a vector packet are equal.
+	template <usize W, usize N>
+	[[nodiscard]] inline bool is_uniform(const vector_packet<W, N>& p) noexcept
+	{
+		for (usize i = 0; i < N; ++i)
+		{
+			if (!all_equal(p.elements[i], make_packet<W>(first_lane(p.elements[i]))))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/// Returns the square length of each vector in a vector packet, summed in the same order as math::sqr_length().
+	template <usize W, usize N>
+	[[nodiscard]] inline fpacket<W> sqr_length_exact(const vector_packet<W, N>& p) noexcept
+	{
+		auto result = p.elements[0] * p.elements[0];
+		for (usize i = 1; i < N; ++i)
+		{
+			result = result + p.elements[i] * p.elements[i];
+		}
+		return result;
+	}
+
+	/// Hashes integer vector packets in place, matching hash::pcg().
+	template <usize W, usize N>
+	inline void pcg(upacket<W> (&x)[N]) noexcept
+	{
+		static_assert(N == 2 || N == 3);
+
+		const auto multiplier = make_upacket<W>(hash::pcg_multiplier<u32>);
+		const auto increment = make_upacket<W>(hash::pcg_increment<u32>);
+
+		for (usize i = 0; i < N; ++i)
+		{
+			x[i] = x[i] * multiplier + increment;
+		}
+
+		if constexpr (N == 2)
+		{
+			for (int round = 0; round < 2; ++round)
+			{
+				x[0] = x[0] + x[1] * multiplier;
+				x[1] = x[1] + x[0] * multiplier;
+				x[0] = x[0] ^ (x[0] >> 16);
+				x[1] = x[1] ^ (x[1] >> 16);
+			}
+		}
+		else
+		{
+			x[0] = x[0] + x[1] * x[2];
+			x[1] = x[1] + x[2] * x[0];
+			x[2] = x[2] + x[0] * x[1];
+			x[0] = x[0] ^ (x[0] >> 16);
+			x[1] = x[1] ^ (x[1] >> 16);
+			x[2] = x[2] ^ (x[2] >> 16);
+			x[0] = x[0] + x[1] * x[2];
+			x[1] = x[1] + x[2] * x[0];
+			x[2] = x[2] + x[0] * x[1];
+		}
+	}
+
+	/// Hashes a position packet, matching hash::pcg().
+	template <usize W, usize N>
+	inline void hash_packet(const vector_packet<W, N>& position, upacket<W> (&hash)[N]) noexcept
+	{
+		for (usize i = 0; i < N; ++i)
+		{
+			hash[i] = to_upacket(position.elements[i]);
+		}
+		pcg(hash);
+	}
+
+	/// Calls a function for each packet of a set of positions.
+	/// @param positions Positions.
+	/// @param count Number of positions.
+	/// @param function Function which is passed a position packet, the index of its first position, and the number of valid lanes.
+	template <usize W, usize N, class Function>
+	inline void for_each_position_packet(const math::vector<float, N>* positions, usize count, Function&& function) noexcept
+	{
+		usize i = 0;
+		for (; i + W <= count; i += W)
+		{
+			function(load_vector_packet<W>(positions + i), i, W);
+		}
+		if (i < count)
+		{
+			function(load_vector_packet<W>(positions + i, count - i), i, count - i);
+		}
+	}
+
+	/// Calls a function for each packet of grid positions. Packets run along the x-axis and never span more than one row.
+	/// @param origin Position of the first grid sample.
+	/// @param spacing Distance between adjacent grid samples on each axis.
+	/// @param size Number of grid samples on each axis.
+	/// @param function Function which is passed a position packet, the index of its first position, and the number of valid lanes.
+	template <usize W, usize N, class Function>
+	inline void for_each_grid_packet(const math::vector<float, N>& origin, const math::vector<float, N>& spacing, const math::vector<u32, N>& size, Function&& function) noexcept
+	{
+		const usize row_size = size.elements[0];
+		usize row_count = 1;
+		for (usize i = 1; i < N; ++i)
+		{
+			row_count *= size.elements[i];
+		}
+
+		const auto lanes = lane_indices<W>();
+		const auto origin_x = make_packet<W>(origin.elements[0]);
+		const auto spacing_x = make_packet<W>(spacing.elements[0]);
+
+		vector_packet<W, N> position;
+		for (usize row = 0; row < row_count; ++row)
+		{
+			// Position of the row on the y- and z-axes
+			usize coordinate = row;
+			for (usize i = 1; i < N; ++i)
+			{
+				const usize index = coordinate % size.elements[i];
+				coordinate /= size.elements[i];
+				position.elements[i] = make_packet<W>(origin.elements[i] + static_cast<float>(index) * spacing.elements[i]);
+			}
+
+			const usize offset = row * row_size;
+			for (usize x = 0; x < row_size; x += W)
+			{
+				position.elements[0] = origin_x + (make_packet<W>(static_cast<float>(x)) + lanes) * spacing_x;
+				function(position, offset + x, std::min<usize>(W, row_size - x));
+			}
+		}
+	}
+
+	/// Cached gradient indices of the corners of the most recent hypercube cell in which all lanes of a simplex noise packet were found.
+	template <usize N>
+	struct simplex_cache
+	{
+		/// Origin vertex of the cached cell.
+		float origin[N];
+
+		/// Gradient index of each corner of the cached cell, indexed by a bit per axis.
+		u32 gradient_indices[usize{1} << N];
+
+		/// `true` if the cache has been filled.
+		bool valid{false};
+	};
+
+	/// Returns the index of the simplex edge gradient for a hash value.
+	template <usize N, usize W>
+	[[nodiscard]] inline upacket<W> simplex_gradient_index(const upacket<W>& hash) noexcept
+	{
+		if constexpr (N == 2)
+		{
+			return hash & make_upacket<W>(3);
+		}
+		else
+		{
+			// `hash % 12`, with the quotient calculated by multiplying by a fixed-point reciprocal
+			static_assert(simplex_edge_count<N> == 12);
+			const auto quotient = mul_hi(hash, make_upacket<W>(0xaaaaaaab)) >> 3;
+			return hash - quotient * make_upacket<W>(12);
+		}
+	}
+
+	/// Returns the dot product of displacement vectors and simplex edge gradients.
+	template <usize W, usize N>
+	[[nodiscard]] inline fpacket<W> simplex_gradient_dot(const upacket<W>& gradient_index, const vector_packet<W, N>& d) noexcept
+	{
+		// Edge gradients have a zero component on one axis, and components of -1 or 1 on the others
+		const auto zero = make_upacket<W>(0);
+		const auto one = make_packet<W>(1.0f);
+		const auto negative_one = make_packet<W>(-1.0f);
+
+		if constexpr (N == 2)
+		{
+			const auto zero_axis = gradient_index >> 1;
+			const auto sign = select(equal(gradient_index & make_upacket<W>(1), zero), negative_one, one);
+			return select(equal(zero_axis, zero), d.elements[1], d.elements[0]) * sign;
+		}
+		else
+		{
+			const auto zero_axis = gradient_index >> 2;
+			const auto sign0 = select(equal(gradient_index & make_upacket<W>(1), zero), negative_one, one);
+			const auto sign1 = select(equal(gradient_index & make_upacket<W>(2), zero), negative_one, one);
+			const auto u = select(equal(zero_axis, zero), d.elements[1], d.elements[0]);
+			const auto v = select(equal(zero_axis, make_upacket<W>(2)), d.elements[1], d.elements[2]);
+			return u * sign0 + v * sign1;
+		}
+	}
+
+	/// Fills a simplex noise cache with the gradient indices of the corners of a hypercube cell.
+	template <usize W, usize N>
+	inline void fill_simplex_cache(simplex_cache<N>& cache, const vector_packet<W, N>& origin) noexcept
+	{
+		constexpr usize corner_count = usize{1} << N;
+		constexpr usize padded_corner_count = (corner_count + W - 1) / W * W;
+
+		for (usize i = 0; i < N; ++i)
+		{
+			cache.origin[i] = first_lane(origin.elements[i]);
+		}
+
+		// Hash corners across lanes
+		alignas(32) float corners[N][padded_corner_count];
+		for (usize i = 0; i < padded_corner_count; ++i)
+		{
+			for (usize j = 0; j < N; ++j)
+			{
+				corners[j][i] = cache.origin[j] + static_cast<float>((i >> j) & 1);
+			}
+		}
+
+		for (usize i = 0; i < padded_corner_count; i += W)
+		{
+			vector_packet<W, N> corner;
+			for (usize j = 0; j < N; ++j)
+			{
+				corner.elements[j] = load_packet<W>(corners[j] + i);
+			}
+
+			upacket<W> hash[N];
+			hash_packet(corner, hash);
+			store_lanes(simplex_gradient_index<N>(hash[0]), cache.gradient_indices + i, std::min(W, corner_count - i));
+		}
+
+		cache.valid = true;
+	}
+
+	/// Evaluates simplex noise for a packet of positions.
+	/// @param position Position packet.
+	/// @param parameters Simplex noise constants.
+	/// @param cache Corner cache, which is used when all lanes fall in the same hypercube cell.
+	/// @return Noise values.
+	template <usize W, usize N>
+	[[nodiscard]] fpacket<W> simplex_packet(const vector_packet<W, N>& position, const simplex_parameters& parameters, simplex_cache<N>& cache) noexcept
+	{
+		const auto zero = make_packet<W>(0.0f);
+		const auto one = make_packet<W>(1.0f);
+
+		// Skew input position to get the origin vertex of the unit hypercube cell to which it belongs
+		auto skew = position.elements[0];
+		for (usize i = 1; i < N; ++i)
+		{
+			skew = skew + position.elements[i];
+		}
+		skew = skew * make_packet<W>(parameters.skew);
+
+		vector_packet<W, N> origin;
+		auto unskew = zero;
+		for (usize i = 0; i < N; ++i)
+		{
+			origin.elements[i] = floor(position.elements[i] + skew);
+			unskew = i ? unskew + origin.elements[i] : origin.elements[i];
+		}
+		unskew = unskew * make_packet<W>(parameters.unskew);
+
+		// Displacement vector from origin vertex position to input position
+		vector_packet<W, N> dx;
+		for (usize i = 0; i < N; ++i)
+		{
+			dx.elements[i] = (position.elements[i] - origin.elements[i]) + unskew;
+		}
+
+		// Rank of each axis in the traversal order, by descending displacement with ties broken by axis index
+		fpacket<W> ranks[N];
+		for (usize i = 0; i < N; ++i)
+		{
+			ranks[i] = zero;
+			for (usize j = 0; j < N; ++j)
+			{
+				if (j < i)
+				{
+					ranks[i] = ranks[i] + select(greater_than(dx.elements[i], dx.elements[j]), zero, one);
+				}
+				else if (j > i)
+				{
+					ranks[i] = ranks[i] + select(greater_than(dx.elements[j], dx.elements[i]), one, zero);
+				}
+			}
+		}
+
+		// Reuse corner gradients if all lanes fall in the same cell
+		bool uniform = is_uniform(origin);
+		if (uniform)
+		{
+			bool hit = cache.valid;
+			for (usize i = 0; hit && i < N; ++i)
+			{
+				hit = cache.origin[i] == first_lane(origin.elements[i]);
+			}
+			if (!hit)
+			{
+				fill_simplex_cache(cache, origin);
+			}
+		}
+
+		auto n = zero;
+		for (usize k = 0; k <= N; ++k)
+		{
+			// Offset of the current vertex from the origin vertex, which steps along the `k` highest-ranked axes
+			const auto rank_threshold = make_packet<W>(static_cast<float>(k) - 0.5f);
+			fpacket<W> masks[N];
+			vector_packet<W, N> offset;
+			vector_packet<W, N> d;
+			for (usize i = 0; i < N; ++i)
+			{
+				masks[i] = less_than(ranks[i], rank_threshold);
+				offset.elements[i] = k == 0 ? zero : k == N ? one : select(masks[i], one, zero);
+				d.elements[i] = (dx.elements[i] - offset.elements[i]) + make_packet<W>(parameters.unskew * static_cast<float>(k));
+			}
+
+			// Calculate falloff
+			auto t = make_packet<W>(0.5f) - sqr_length_exact(d);
+			t = t * t * t;
+
+			upacket<W> gradient_index;
+			if (uniform)
+			{
+				if (k == 0)
+				{
+					gradient_index = make_upacket<W>(cache.gradient_indices[0]);
+				}
+				else if (k == N)
+				{
+					gradient_index = make_upacket<W>(cache.gradient_indices[(usize{1} << N) - 1]);
+				}
+				else
+				{
+					// Select corners by one axis at a time, halving the candidates each step
+					upacket<W> candidates[usize{1} << N];
+					for (usize i = 0; i < (usize{1} << N); ++i)
+					{
+						candidates[i] = make_upacket<W>(cache.gradient_indices[i]);
+					}
+					for (usize i = 0; i < N; ++i)
+					{
+						for (usize j = 0; j < (usize{1} << (N - i - 1)); ++j)
+						{
+							candidates[j] = select(masks[i], candidates[j * 2 + 1], candidates[j * 2]);
+						}
+					}
+					gradient_index = candidates[0];
+				}
+			}
+			else
+			{
+				vector_packet<W, N> vertex;
+				for (usize i = 0; i < N; ++i)
+				{
+					vertex.elements[i] = origin.elements[i] + offset.elements[i];
+				}
+
+				upacket<W> hash[N];
+				hash_packet(vertex, hash);
+				gradient_index = simplex_gradient_index<N>(hash[0]);
+			}
+
+			n = n + select(greater_than(t, zero), simplex_gradient_dot(gradient_index, d) * t, zero);
+		}
+
+		return n * make_packet<W>(parameters.normalization);
+	}
+
+	/// Cached cell centers of the most recent kernel in which all lanes of a Voronoi packet were found.
+	template <usize N>
+	struct voronoi_cache
+	{
+		/// Integer part of the cached kernel position.
+		float position[N];
+
+		/// Cell center offsets from the integer part of the position, in structure-of-arrays form.
+		alignas(32) float centers[N][voronoi_kernel_size<N>];
+
+		/// Cell hash values.
+		alignas(32) u32 ids[voronoi_kernel_size<N>];
+
+		/// `true` if the cache has been filled.
+		bool valid{false};
+	};
+
+	/// Voronoi F1 results for a packet of positions.
+	template <usize W, usize N>
+	struct voronoi_f1_result
+	{
+		/// Square distances to the F1 cell centers.
+		fpacket<W> sqr_distance;
+
+		/// Displacement vectors to the F1 cell centers.
+		vector_packet<W, N> displacement;
+
+		/// F1 cell hash values.
+		upacket<W> id;
+	};
+
+	/// Calculates the centers and hash values of Voronoi cells.
+	/// @param position_i Integer parts of the positions.
+	/// @param kernel_index Index of the first kernel offset, which increases by one with each lane if @p per_lane is `true`.
+	/// @param hash_scale Factor which scales hash values onto `[0, randomness]`.
+	/// @param tiling Distance at which the Voronoi pattern repeats.
+	/// @param[out] center Cell center offsets from @p position_i.
+	/// @param[out] id Cell hash values.
+	template <bool PerLane, usize W, usize N>
+	inline void voronoi_cells(const vector_packet<W, N>& position_i, usize kernel_index, float hash_scale, const math::vector<float, N>& tiling, vector_packet<W, N>& center, upacket<W>& id) noexcept
+	{
+		vector_packet<W, N> offset_i;
+		vector_packet<W, N> hash_position;
+		for (usize i = 0; i < N; ++i)
+		{
+			const float* offsets = voronoi_kernel_offsets<N>.offsets[i];
+			offset_i.elements[i] = PerLane ? load_packet<W>(offsets + kernel_index) : make_packet<W>(offsets[kernel_index]);
+			hash_position.elements[i] = position_i.elements[i] + offset_i.elements[i];
+
+			// Tile where specified
+			if (tiling.elements[i])
+			{
+				const auto t = make_packet<W>(tiling.elements[i]);
+				auto& p = hash_position.elements[i];
+				p = p - t * trunc(p / t);
+				p = select(less_than(p, make_packet<W>(0.0f)), p + t, p);
+			}
+		}
+
+		upacket<W> hash[N];
+		hash_packet(hash_position, hash);
+
+		const auto scale = make_packet<W>(hash_scale);
+		for (usize i = 0; i < N; ++i)
+		{
+			center.elements[i] = offset_i.elements[i] + to_fpacket(hash[i]) * scale;
+		}
+		id = hash[0];
+	}
+
+	/// Finds the Voronoi cells (F1) containing a packet of positions.
+	/// @param position Position packet.
+	/// @param hash_scale Factor which scales hash values onto `[0, randomness]`.
+	/// @param tiling Distance at which the Voronoi pattern repeats.
+	/// @param cache Cell cache, which is used when all lanes share the same search kernel.
+	template <usize W, usize N>
+	[[nodiscard]] voronoi_f1_result<W, N> voronoi_f1_packet(const vector_packet<W, N>& position, float hash_scale, const math::vector<float, N>& tiling, voronoi_cache<N>& cache) noexcept
+	{
+		constexpr usize kernel_size = voronoi_kernel_size<N>;
+
+		// Get integer and fractional parts
+		vector_packet<W, N> position_i;
+		vector_packet<W, N> position_f;
+		for (usize i = 0; i < N; ++i)
+		{
+			position_i.elements[i] = floor(position.elements[i] - make_packet<W>(1.5f));
+			position_f.elements[i] = position.elements[i] - position_i.elements[i];
+		}
+
+		voronoi_f1_result<W, N> result;
+		result.sqr_distance = make_packet<W>(std::numeric_limits<float>::infinity());
+		result.displacement = {};
+		result.id = make_upacket<W>(0);
+
+		auto update = [&](const vector_packet<W, N>& center, const upacket<W>& id)
+		{
+			vector_packet<W, N> displacement;
+			for (usize i = 0; i < N; ++i)
+			{
+				displacement.elements[i] = center.elements[i] - position_f.elements[i];
+			}
+
+			const auto sqr_distance = sqr_length_exact(displacement);
+			const auto mask = less_than(sqr_distance, result.sqr_distance);
+			result.sqr_distance = select(mask, sqr_distance, result.sqr_distance);
+			for (usize i = 0; i < N; ++i)
+			{
+				result.displacement.elements[i] = select(mask, displacement.elements[i], result.displacement.elements[i]);
+			}
+			result.id = select(mask, id, result.id);
+		};
+
+		vector_packet<W, N> center;
+		upacket<W> id;
+
+		if (is_uniform(position_i))
+		{
+			// Hash the kernel cells once, across lanes, then reuse them while the kernel is unchanged
+			bool hit = cache.valid;
+			for (usize i = 0; hit && i < N; ++i)
+			{
+				hit = cache.position[i] == first_lane(position_i.elements[i]);
+			}
+			if (!hit)
+			{
+				for (usize i = 0; i < N; ++i)
+				{
+					cache.position[i] = first_lane(position_i.elements[i]);
+				}
+				for (usize k = 0; k < kernel_size; k += W)
+				{
+					voronoi_cells<true>(position_i, k, hash_scale, tiling, center, id);
+					for (usize i = 0; i < N; ++i)
+					{
+						store_packet(center.elements[i], cache.centers[i] + k);
+					}
+					store_packet(id, cache.ids + k);
+				}
+				cache.valid = true;
+			}
+
+			for (usize k = 0; k < kernel_size; ++k)
+			{
+				for (usize i = 0; i < N; ++i)
+				{
+					center.elements[i] = make_packet<W>(cache.centers[i][k]);
+				}
+				update(center, make_upacket<W>(cache.ids[k]));
+			}
+		}
+		else
+		{
+			for (usize k = 0; k < kernel_size; ++k)
+			{
+				voronoi_cells<false>(position_i, k, hash_scale, tiling, center, id);
+				update(center, id);
+			}
+		}
+
+		return result;
+	}
+
+	template <usize W, usize N>
+	inline void simplex_kernel(const math::vector<float, N>* positions, usize count, const simplex_parameters& parameters, float* values) noexcept
+	{
+		simplex_cache<N> cache;
+		for_each_position_packet<W>(positions, count, [&](const vector_packet<W, N>& position, usize i, usize n)
+		{
+			store_lanes(simplex_packet(position, parameters, cache), values + i, n);
+		});
+	}
+
+	template <usize W, usize N>
+	inline void simplex_grid_kernel(const math::vector<float, N>& origin, const math::vector<float, N>& spacing, const math::vector<u32, N>& size, const simplex_parameters& parameters, float* values) noexcept
+	{
+		simplex_cache<N> cache;
+		for_each_grid_packet<W>(origin, spacing, size, [&](const vector_packet<W, N>& position, usize i, usize n)
+		{
+			store_lanes(simplex_packet(position, parameters, cache), values + i, n);
+		});
+	}
+
+	/// Number of fBm octaves which keep their own simplex noise cache. Higher octaves share the last cache.
+	inline constexpr usize fbm_cached_octave_count = 12;
+
+	/// Evaluates fBm of simplex noise for a packet of positions.
+	template <usize W, usize N>
+	[[nodiscard]] fpacket<W> fbm_packet(vector_packet<W, N> position, usize octaves, float lacunarity, float gain, const simplex_parameters& parameters, simplex_cache<N> (&caches)[fbm_cached_octave_count]) noexcept
+	{
+		auto value = make_packet<W>(0.0f);
+		float amplitude = 1.0f;
+		const auto frequency_scale = make_packet<W>(lacunarity);
+
+		for (usize i = 0; i < octaves; ++i)
+		{
+			value = value + simplex_packet(position, parameters, caches[std::min(i, fbm_cached_octave_count - 1)]) * make_packet<W>(amplitude);
+			for (usize j = 0; j < N; ++j)
+			{
+				position.elements[j] = position.elements[j] * frequency_scale;
+			}
+			amplitude *= gain;
+		}
+
+		return value;
+	}
+
+	template <usize W, usize N>
+	inline void fbm_kernel(const math::vector<float, N>* positions, usize count, usize octaves, float lacunarity, float gain, const simplex_parameters& parameters, float* values) noexcept
+	{
+		simplex_cache<N> caches[fbm_cached_octave_count];
+		for_each_position_packet<W>(positions, count, [&](const vector_packet<W, N>& position, usize i, usize n)
+		{
+			store_lanes(fbm_packet(position, octaves, lacunarity, gain, parameters, caches), values + i, n);
+		});
+	}
+
+	template <usize W, usize N>
+	inline void fbm_grid_kernel(const math::vector<float, N>& origin, const math::vector<float, N>& spacing, const math::vector<u32, N>& size, usize octaves, float lacunarity, float gain, const simplex_parameters& parameters, float* values) noexcept
+	{
+		simplex_cache<N> caches[fbm_cached_octave_count];
+		for_each_grid_packet<W>(origin, spacing, size, [&](const vector_packet<W, N>& position, usize i, usize n)
+		{
+			store_lanes(fbm_packet(position, octaves, lacunarity, gain, parameters, caches), values + i, n);
+		});
+	}
+
+	/// Stores the selected outputs of a Voronoi F1 packet.
+	template <usize W, usize N>
+	inline void store_voronoi_f1_result(const voronoi_f1_result<W, N>& result, usize i, usize n, float* sqr_distances, math::vector<float, N>* displacements, u32* ids) noexcept
+	{
+		if (sqr_distances)
+		{
+			store_lanes(result.sqr_distance, sqr_distances + i, n);
+		}
+		if (displacements)
+		{
+			if (n == W)
+			{
+				store_vector_packet(result.displacement, displacements + i);
+			}
+			else
+			{
+				store_vector_packet(result.displacement, displacements + i, n);
+			}
+		}
+		if (ids)
+		{
+			store_lanes(result.id, ids + i, n);
+		}
+	}
+
+	template <usize W, usize N>
+	inline void voronoi_f1_kernel(const math::vector<float, N>* positions, usize count, float hash_scale, const math::vector<float, N>& tiling, float* sqr_distances, math::vector<float, N>* displacements, u32* ids) noexcept
+	{
+		voronoi_cache<N> cache;
+		for_each_position_packet<W>(positions, count, [&](const vector_packet<W, N>& position, usize i, usize n)
+		{
+			store_voronoi_f1_result(voronoi_f1_packet(position, hash_scale, tiling, cache), i, n, sqr_distances, displacements, ids);
+		});
+	}
+
+	template <usize W, usize N>
+	inline void voronoi_f1_grid_kernel(const math::vector<float, N>& origin, const math::vector<float, N>& spacing, const math::vector<u32, N>& size, float hash_scale, const math::vector<float, N>& tiling, float* sqr_distances, math::vector<float, N>* displacements, u32* ids) noexcept
+	{
+		voronoi_cache<N> cache;
+		for_each_grid_packet<W>(origin, spacing, size, [&](const vector_packet<W, N>& position, usize i, usize n)
+		{
+			store_voronoi_f1_result(voronoi_f1_packet(position, hash_scale, tiling, cache), i, n, sqr_distances, displacements, ids);
+		});
+	}
+}
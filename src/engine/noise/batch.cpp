@@ -0,0 +1,225 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <engine/noise/batch.hpp>
+#include <engine/noise/batch-kernels.hpp>
+#include <engine/math/simd/isa.hpp>
+#include <engine/debug/contract.hpp>
+#include <limits>
+
+namespace engine::noise::batch::sse2
+{
+	ENGINE_NOISE_DEFINE_BATCH_KERNELS(4, 2)
+	ENGINE_NOISE_DEFINE_BATCH_KERNELS(4, 3)
+}
+
+#undef ENGINE_NOISE_DEFINE_BATCH_KERNELS
+
+namespace engine::noise::batch
+{
+	namespace
+	{
+		/// Returns the simplex noise constants, calculated as in noise::simplex().
+		template <usize N>
+		[[nodiscard]] const simplex_parameters& get_simplex_parameters()
+		{
+			static const simplex_parameters parameters = []()
+			{
+				const float f = (math::sqrt(static_cast<float>(N + 1)) - 1.0f) / static_cast<float>(N);
+				const float g = f / (1.0f + f * static_cast<float>(N));
+
+				float falloff = 0.5f - static_cast<float>(N) / (4.0f * static_cast<float>(N + 1));
+				falloff = falloff * falloff * falloff;
+
+				const float corner_normalization = 1.0f / ((static_cast<float>(N) / math::sqrt(static_cast<float>(N + 1))) * falloff);
+				const float edge_normalization = corner_normalization * (math::sqrt(static_cast<float>(N)) / math::length(simplex_edges<float, N>[0]));
+
+				return simplex_parameters{f, g, edge_normalization};
+			}();
+
+			return parameters;
+		}
+
+		/// Returns the factor which scales hash values onto `[0, randomness]`, calculated as in noise::voronoi_f1().
+		[[nodiscard]] inline float get_voronoi_hash_scale(float randomness) noexcept
+		{
+			return (1.0f / static_cast<float>(std::numeric_limits<u32>::max())) * randomness;
+		}
+
+		/// Returns the number of samples in a grid.
+		template <usize N>
+		[[nodiscard]] usize grid_sample_count(const math::vector<u32, N>& size) noexcept
+		{
+			usize count = 1;
+			for (usize i = 0; i < N; ++i)
+			{
+				count *= size[i];
+			}
+			return count;
+		}
+
+		/// Returns a pointer to the elements of an optional output, or `nullptr` if it is empty.
+		template <class T>
+		[[nodiscard]] T* optional_output(std::span<T> output, usize count) noexcept
+		{
+			debug::precondition(output.empty() || output.size() == count);
+			return output.empty() ? nullptr : output.data();
+		}
+
+		template <usize N>
+		void dispatch_simplex(std::span<const math::vector<float, N>> positions, std::span<float> values) noexcept
+		{
+			debug::precondition(positions.size() == values.size());
+
+			if (math::simd::get_isa() == math::simd::isa::avx2)
+			{
+				avx2::simplex(positions.data(), positions.size(), get_simplex_parameters<N>(), values.data());
+			}
+			else
+			{
+				sse2::simplex(positions.data(), positions.size(), get_simplex_parameters<N>(), values.data());
+			}
+		}
+
+		template <usize N>
+		void dispatch_simplex_grid(const math::vector<float, N>& origin, const math::vector<float, N>& spacing, const math::vector<u32, N>& size, std::span<float> values) noexcept
+		{
+			debug::precondition(values.size() == grid_sample_count(size));
+
+			if (math::simd::get_isa() == math::simd::isa::avx2)
+			{
+				avx2::simplex_grid(origin, spacing, size, get_simplex_parameters<N>(), values.data());
+			}
+			else
+			{
+				sse2::simplex_grid(origin, spacing, size, get_simplex_parameters<N>(), values.data());
+			}
+		}
+
+		template <usize N>
+		void dispatch_fbm(std::span<const math::vector<float, N>> positions, usize octaves, float lacunarity, float gain, std::span<float> values) noexcept
+		{
+			debug::precondition(positions.size() == values.size());
+
+			if (math::simd::get_isa() == math::simd::isa::avx2)
+			{
+				avx2::fbm(positions.data(), positions.size(), octaves, lacunarity, gain, get_simplex_parameters<N>(), values.data());
+			}
+			else
+			{
+				sse2::fbm(positions.data(), positions.size(), octaves, lacunarity, gain, get_simplex_parameters<N>(), values.data());
+			}
+		}
+
+		template <usize N>
+		void dispatch_fbm_grid(const math::vector<float, N>& origin, const math::vector<float, N>& spacing, const math::vector<u32, N>& size, usize octaves, float lacunarity, float gain, std::span<float> values) noexcept
+		{
+			debug::precondition(values.size() == grid_sample_count(size));
+
+			if (math::simd::get_isa() == math::simd::isa::avx2)
+			{
+				avx2::fbm_grid(origin, spacing, size, octaves, lacunarity, gain, get_simplex_parameters<N>(), values.data());
+			}
+			else
+			{
+				sse2::fbm_grid(origin, spacing, size, octaves, lacunarity, gain, get_simplex_parameters<N>(), values.data());
+			}
+		}
+
+		template <usize N>
+		void dispatch_voronoi_f1(std::span<const math::vector<float, N>> positions, float randomness, const math::vector<float, N>& tiling, std::span<float> sqr_distances, std::span<math::vector<float, N>> displacements, std::span<u32> ids) noexcept
+		{
+			const auto count = positions.size();
+			const auto sqr_distances_data = optional_output(sqr_distances, count);
+			const auto displacements_data = optional_output(displacements, count);
+			const auto ids_data = optional_output(ids, count);
+
+			if (math::simd::get_isa() == math::simd::isa::avx2)
+			{
+				avx2::voronoi_f1(positions.data(), count, get_voronoi_hash_scale(randomness), tiling, sqr_distances_data, displacements_data, ids_data);
+			}
+			else
+			{
+				sse2::voronoi_f1(positions.data(), count, get_voronoi_hash_scale(randomness), tiling, sqr_distances_data, displacements_data, ids_data);
+			}
+		}
+
+		template <usize N>
+		void dispatch_voronoi_f1_grid(const math::vector<float, N>& origin, const math::vector<float, N>& spacing, const math::vector<u32, N>& size, float randomness, const math::vector<float, N>& tiling, std::span<float> sqr_distances, std::span<math::vector<float, N>> displacements, std::span<u32> ids) noexcept
+		{
+			const auto count = grid_sample_count(size);
+			const auto sqr_distances_data = optional_output(sqr_distances, count);
+			const auto displacements_data = optional_output(displacements, count);
+			const auto ids_data = optional_output(ids, count);
+
+			if (math::simd::get_isa() == math::simd::isa::avx2)
+			{
+				avx2::voronoi_f1_grid(origin, spacing, size, get_voronoi_hash_scale(randomness), tiling, sqr_distances_data, displacements_data, ids_data);
+			}
+			else
+			{
+				sse2::voronoi_f1_grid(origin, spacing, size, get_voronoi_hash_scale(randomness), tiling, sqr_distances_data, displacements_data, ids_data);
+			}
+		}
+	}
+
+	void simplex(std::span<const math::fvec2> positions, std::span<float> values) noexcept
+	{
+		dispatch_simplex(positions, values);
+	}
+
+	void simplex(std::span<const math::fvec3> positions, std::span<float> values) noexcept
+	{
+		dispatch_simplex(positions, values);
+	}
+
+	void simplex_grid(const math::fvec2& origin, const math::fvec2& spacing, const math::uvec2& size, std::span<float> values) noexcept
+	{
+		dispatch_simplex_grid(origin, spacing, size, values);
+	}
+
+	void simplex_grid(const math::fvec3& origin, const math::fvec3& spacing, const math::uvec3& size, std::span<float> values) noexcept
+	{
+		dispatch_simplex_grid(origin, spacing, size, values);
+	}
+
+	void fbm(std::span<const math::fvec2> positions, usize octaves, float lacunarity, float gain, std::span<float> values) noexcept
+	{
+		dispatch_fbm(positions, octaves, lacunarity, gain, values);
+	}
+
+	void fbm(std::span<const math::fvec3> positions, usize octaves, float lacunarity, float gain, std::span<float> values) noexcept
+	{
+		dispatch_fbm(positions, octaves, lacunarity, gain, values);
+	}
+
+	void fbm_grid(const math::fvec2& origin, const math::fvec2& spacing, const math::uvec2& size, usize octaves, float lacunarity, float gain, std::span<float> values) noexcept
+	{
+		dispatch_fbm_grid(origin, spacing, size, octaves, lacunarity, gain, values);
+	}
+
+	void fbm_grid(const math::fvec3& origin, const math::fvec3& spacing, const math::uvec3& size, usize octaves, float lacunarity, float gain, std::span<float> values) noexcept
+	{
+		dispatch_fbm_grid(origin, spacing, size, octaves, lacunarity, gain, values);
+	}
+
+	void voronoi_f1(std::span<const math::fvec2> positions, float randomness, const math::fvec2& tiling, std::span<float> sqr_distances, std::span<math::fvec2> displacements, std::span<u32> ids) noexcept
+	{
+		dispatch_voronoi_f1(positions, randomness, tiling, sqr_distances, displacements, ids);
+	}
+
+	void voronoi_f1(std::span<const math::fvec3> positions, float randomness, const math::fvec3& tiling, std::span<float> sqr_distances, std::span<math::fvec3> displacements, std::span<u32> ids) noexcept
+	{
+		dispatch_voronoi_f1(positions, randomness, tiling, sqr_distances, displacements, ids);
+	}
+
+	void voronoi_f1_grid(const math::fvec2& origin, const math::fvec2& spacing, const math::uvec2& size, float randomness, const math::fvec2& tiling, std::span<float> sqr_distances, std::span<math::fvec2> displacements, std::span<u32> ids) noexcept
+	{
+		dispatch_voronoi_f1_grid(origin, spacing, size, randomness, tiling, sqr_distances, displacements, ids);
+	}
+
+	void voronoi_f1_grid(const math::fvec3& origin, const math::fvec3& spacing, const math::uvec3& size, float randomness, const math::fvec3& tiling, std::span<float> sqr_distances, std::span<math::fvec3> displacements, std::span<u32> ids) noexcept
+	{
+		dispatch_voronoi_f1_grid(origin, spacing, size, randomness, tiling, sqr_distances, displacements, ids);
+	}
+}
@@ -0,0 +1,130 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <engine/math/vector.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <span>
+
+/// Batch noise functions, which evaluate single-precision noise at many positions at once in SIMD packets, using the instruction set selected with math::simd::set_isa().
+/// @details Batch functions match their scalar counterparts with the default hash::pcg hash function, to within floating-point rounding.
+namespace engine::noise::batch
+{
+	/// @name Simplex noise
+	/// @{
+
+	/// Evaluates 2D simplex noise at a set of positions.
+	/// @param positions Input positions.
+	/// @param[out] values Noise values, on `[-1, 1]`.
+	/// @warning @p values must be the same size as @p positions.
+	/// @see noise::simplex()
+	void simplex(std::span<const math::fvec2> positions, std::span<float> values) noexcept;
+
+	/// Evaluates 3D simplex noise at a set of positions.
+	/// @copydetails simplex(std::span<const math::fvec2>, std::span<float>)
+	void simplex(std::span<const math::fvec3> positions, std::span<float> values) noexcept;
+
+	/// Evaluates 2D simplex noise on a grid of positions.
+	/// @param origin Position of the first grid sample.
+	/// @param spacing Distance between adjacent grid samples on each axis.
+	/// @param size Number of grid samples on each axis.
+	/// @param[out] values Noise values, on `[-1, 1]`, in row-major order with the x-axis varying fastest.
+	/// @warning @p values must have `size.x() * size.y()` elements.
+	void simplex_grid(const math::fvec2& origin, const math::fvec2& spacing, const math::uvec2& size, std::span<float> values) noexcept;
+
+	/// Evaluates 3D simplex noise on a grid of positions.
+	/// @param origin Position of the first grid sample.
+	/// @param spacing Distance between adjacent grid samples on each axis.
+	/// @param size Number of grid samples on each axis.
+	/// @param[out] values Noise values, on `[-1, 1]`, with the x-axis varying fastest, then the y-axis.
+	/// @warning @p values must have `size.x() * size.y() * size.z()` elements.
+	void simplex_grid(const math::fvec3& origin, const math::fvec3& spacing, const math::uvec3& size, std::span<float> values) noexcept;
+
+	/// @}
+
+	/// @name Fractional Brownian motion
+	/// @{
+
+	/// Evaluates 2D fractional Brownian motion of simplex noise at a set of positions.
+	/// @param positions Input positions.
+	/// @param octaves Number of octaves.
+	/// @param lacunarity Frequency multiplier.
+	/// @param gain Amplitude multiplier.
+	/// @param[out] values fBm values.
+	/// @warning @p values must be the same size as @p positions.
+	/// @see noise::fbm()
+	void fbm(std::span<const math::fvec2> positions, usize octaves, float lacunarity, float gain, std::span<float> values) noexcept;
+
+	/// Evaluates 3D fractional Brownian motion of simplex noise at a set of positions.
+	/// @copydetails fbm(std::span<const math::fvec2>, usize, float, float, std::span<float>)
+	void fbm(std::span<const math::fvec3> positions, usize octaves, float lacunarity, float gain, std::span<float> values) noexcept;
+
+	/// Evaluates 2D fractional Brownian motion of simplex noise on a grid of positions.
+	/// @param origin Position of the first grid sample.
+	/// @param spacing Distance between adjacent grid samples on each axis.
+	/// @param size Number of grid samples on each axis.
+	/// @param octaves Number of octaves.
+	/// @param lacunarity Frequency multiplier.
+	/// @param gain Amplitude multiplier.
+	/// @param[out] values fBm values, in row-major order with the x-axis varying fastest.
+	/// @warning @p values must have `size.x() * size.y()` elements.
+	void fbm_grid(const math::fvec2& origin, const math::fvec2& spacing, const math::uvec2& size, usize octaves, float lacunarity, float gain, std::span<float> values) noexcept;
+
+	/// Evaluates 3D fractional Brownian motion of simplex noise on a grid of positions.
+	/// @param origin Position of the first grid sample.
+	/// @param spacing Distance between adjacent grid samples on each axis.
+	/// @param size Number of grid samples on each axis.
+	/// @param octaves Number of octaves.
+	/// @param lacunarity Frequency multiplier.
+	/// @param gain Amplitude multiplier.
+	/// @param[out] values fBm values, with the x-axis varying fastest, then the y-axis.
+	/// @warning @p values must have `size.x() * size.y() * size.z()` elements.
+	void fbm_grid(const math::fvec3& origin, const math::fvec3& spacing, const math::uvec3& size, usize octaves, float lacunarity, float gain, std::span<float> values) noexcept;
+
+	/// @}
+
+	/// @name Voronoi noise
+	/// @{
+
+	/// Finds the 2D Voronoi cells (F1) containing a set of positions.
+	/// @param positions Input positions.
+	/// @param randomness Degree of randomness, on `[0, 1]`.
+	/// @param tiling Distance at which the Voronoi pattern should repeat. A value of `0` indicates no repetition.
+	/// @param[out] sqr_distances Square Euclidean distances from each position to its F1 cell center. May be empty.
+	/// @param[out] displacements Displacement vectors from each position to its F1 cell center. May be empty.
+	/// @param[out] ids Hash values indicating the ID of each F1 cell. May be empty.
+	/// @warning Non-empty outputs must be the same size as @p positions.
+	/// @see noise::voronoi_f1()
+	void voronoi_f1(std::span<const math::fvec2> positions, float randomness, const math::fvec2& tiling, std::span<float> sqr_distances, std::span<math::fvec2> displacements, std::span<u32> ids) noexcept;
+
+	/// Finds the 3D Voronoi cells (F1) containing a set of positions.
+	/// @copydetails voronoi_f1(std::span<const math::fvec2>, float, const math::fvec2&, std::span<float>, std::span<math::fvec2>, std::span<u32>)
+	void voronoi_f1(std::span<const math::fvec3> positions, float randomness, const math::fvec3& tiling, std::span<float> sqr_distances, std::span<math::fvec3> displacements, std::span<u32> ids) noexcept;
+
+	/// Finds the 2D Voronoi cells (F1) containing a grid of positions.
+	/// @param origin Position of the first grid sample.
+	/// @param spacing Distance between adjacent grid samples on each axis.
+	/// @param size Number of grid samples on each axis.
+	/// @param randomness Degree of randomness, on `[0, 1]`.
+	/// @param tiling Distance at which the Voronoi pattern should repeat. A value of `0` indicates no repetition.
+	/// @param[out] sqr_distances Square Euclidean distances from each position to its F1 cell center, in row-major order with the x-axis varying fastest. May be empty.
+	/// @param[out] displacements Displacement vectors from each position to its F1 cell center. May be empty.
+	/// @param[out] ids Hash values indicating the ID of each F1 cell. May be empty.
+	/// @warning Non-empty outputs must have `size.x() * size.y()` elements.
+	void voronoi_f1_grid(const math::fvec2& origin, const math::fvec2& spacing, const math::uvec2& size, float randomness, const math::fvec2& tiling, std::span<float> sqr_distances, std::span<math::fvec2> displacements, std::span<u32> ids) noexcept;
+
+	/// Finds the 3D Voronoi cells (F1) containing a grid of positions.
+	/// @param origin Position of the first grid sample.
+	/// @param spacing Distance between adjacent grid samples on each axis.
+	/// @param size Number of grid samples on each axis.
+	/// @param randomness Degree of randomness, on `[0, 1]`.
+	/// @param tiling Distance at which the Voronoi pattern should repeat. A value of `0` indicates no repetition.
+	/// @param[out] sqr_distances Square Euclidean distances from each position to its F1 cell center, with the x-axis varying fastest, then the y-axis. May be empty.
+	/// @param[out] displacements Displacement vectors from each position to its F1 cell center. May be empty.
+	/// @param[out] ids Hash values indicating the ID of each F1 cell. May be empty.
+	/// @warning Non-empty outputs must have `size.x() * size.y() * size.z()` elements.
+	void voronoi_f1_grid(const math::fvec3& origin, const math::fvec3& spacing, const math::uvec3& size, float randomness, const math::fvec3& tiling, std::span<float> sqr_distances, std::span<math::fvec3> displacements, std::span<u32> ids) noexcept;
+
+	/// @}
+}
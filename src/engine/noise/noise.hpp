@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <engine/noise/batch.hpp>
 #include <engine/noise/fbm.hpp>
 #include <engine/noise/simplex.hpp>
 #include <engine/noise/voronoi.hpp>
@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <engine/physics/gas/transmittance-lut.hpp>
+#include <engine/physics/gas/atmosphere.hpp>
+#include <engine/math/functions.hpp>
+#include <engine/debug/contract.hpp>
+#include <algorithm>
+
+namespace engine::physics::gas
+{
+	namespace
+	{
+		/// Calculates the distance from a point within an atmosphere to its upper limit along a ray.
+		/// @param radius Distance from the center of the planet to the origin of the ray.
+		/// @param cos_view_zenith Cosine of the angle between the ray direction and the local zenith direction.
+		/// @param top_radius Radius of the upper limit of the atmosphere.
+		/// @return Distance to the upper limit of the atmosphere.
+		[[nodiscard]] double distance_to_top(double radius, double cos_view_zenith, double top_radius) noexcept
+		{
+			const double discriminant = radius * radius * (cos_view_zenith * cos_view_zenith - 1.0) + top_radius * top_radius;
+			return std::max(0.0, -radius * cos_view_zenith + math::sqrt(std::max(0.0, discriminant)));
+		}
+	}
+
+	void transmittance_lut::build(const profile& profile, const math::vec2<usize>& resolution, usize sample_count)
+	{
+		debug::precondition(resolution.x() >= 2 && resolution.y() >= 2);
+
+		m_profile = profile;
+		m_resolution = resolution;
+		m_top_radius = profile.planet_radius + profile.upper_limit;
+		m_horizon_distance = math::sqrt(std::max(0.0, m_top_radius * m_top_radius - profile.planet_radius * profile.planet_radius));
+		m_entries.resize(resolution.x() * resolution.y());
+
+		const double bottom_radius = profile.planet_radius;
+
+		for (usize y = 0; y < resolution.y(); ++y)
+		{
+			// Map texel row to height, via the distance to the horizon
+			const double rho = m_horizon_distance * static_cast<double>(y) / static_cast<double>(resolution.y() - 1);
+			const double radius = math::sqrt(rho * rho + bottom_radius * bottom_radius);
+
+			// Distances to the upper limit of the atmosphere, at zenith and at the horizon
+			const double min_distance = m_top_radius - radius;
+			const double max_distance = rho + m_horizon_distance;
+
+			for (usize x = 0; x < resolution.x(); ++x)
+			{
+				// Map texel column to view zenith angle, via the distance to the upper limit of the atmosphere
+				const double distance = min_distance + (max_distance - min_distance) * static_cast<double>(x) / static_cast<double>(resolution.x() - 1);
+				const double cos_view_zenith = distance == 0.0 ? 1.0 : std::clamp((m_horizon_distance * m_horizon_distance - rho * rho - distance * distance) / (2.0 * radius * distance), -1.0, 1.0);
+
+				m_entries[y * resolution.x() + x] = integrate(profile, radius, cos_view_zenith, sample_count);
+			}
+		}
+	}
+
+	std::optional<math::dvec3> transmittance_lut::lookup(double radius, double cos_view_zenith) const noexcept
+	{
+		const double bottom_radius = m_profile.planet_radius;
+		radius = std::clamp(radius, bottom_radius, m_top_radius);
+
+		// Reject rays which intersect the planet
+		if (cos_view_zenith < 0.0 && radius * radius * (cos_view_zenith * cos_view_zenith - 1.0) + bottom_radius * bottom_radius >= 0.0)
+		{
+			return std::nullopt;
+		}
+
+		// Map height and view zenith angle to texture coordinates
+		const double rho = math::sqrt(std::max(0.0, radius * radius - bottom_radius * bottom_radius));
+		const double distance = distance_to_top(radius, cos_view_zenith, m_top_radius);
+		const double min_distance = m_top_radius - radius;
+		const double max_distance = rho + m_horizon_distance;
+		const double u = max_distance > min_distance ? (distance - min_distance) / (max_distance - min_distance) : 0.0;
+		const double v = m_horizon_distance > 0.0 ? rho / m_horizon_distance : 0.0;
+
+		// Bilinearly interpolate table entries
+		const double fx = std::clamp(u, 0.0, 1.0) * static_cast<double>(m_resolution.x() - 1);
+		const double fy = std::clamp(v, 0.0, 1.0) * static_cast<double>(m_resolution.y() - 1);
+		const usize x0 = std::min(static_cast<usize>(fx), m_resolution.x() - 2);
+		const usize y0 = std::min(static_cast<usize>(fy), m_resolution.y() - 2);
+		const double tx = fx - static_cast<double>(x0);
+		const double ty = fy - static_cast<double>(y0);
+
+		const math::dvec3* row0 = m_entries.data() + y0 * m_resolution.x() + x0;
+		const math::dvec3* row1 = row0 + m_resolution.x();
+
+		return math::lerp(math::lerp(row0[0], row0[1], tx), math::lerp(row1[0], row1[1], tx), ty);
+	}
+
+	math::dvec3 transmittance_lut::integrate(const profile& profile, double radius, double cos_view_zenith, usize sample_count) noexcept
+	{
+		math::dvec3 densities{};
+
+		const double sample_end_distance = distance_to_top(radius, cos_view_zenith, profile.planet_radius + profile.upper_limit);
+		if (sample_end_distance <= 0.0 || !sample_count)
+		{
+			return densities;
+		}
+
+		// Precalculate terms re-used in sample height calculation
+		const double sqr_radius = radius * radius;
+		const double two_radius_cos_view_zenith = 2.0 * radius * cos_view_zenith;
+
+		// Integrate atmospheric particle densities using the midpoint rule
+		const double sample_length = sample_end_distance / static_cast<double>(sample_count);
+		for (usize i = 0; i < sample_count; ++i)
+		{
+			// Calculate sample elevation
+			const double sample_distance = (static_cast<double>(i) + 0.5) * sample_length;
+			const double sample_height = math::sqrt(sample_distance * sample_distance + sqr_radius + two_radius_cos_view_zenith * sample_distance);
+			const double sample_elevation = sample_height - profile.planet_radius;
+
+			// Sum atmospheric particle densities at sample elevation
+			densities.x() += atmosphere::density::exponential(1.0, sample_elevation, profile.rayleigh_scale_height);
+			densities.y() += atmosphere::density::exponential(1.0, sample_elevation, profile.mie_scale_height);
+			densities.z() += atmosphere::density::triangular(1.0, sample_elevation, profile.ozone_lower_limit, profile.ozone_upper_limit, profile.ozone_mode);
+		}
+
+		return densities * sample_length;
+	}
+}
@@ -0,0 +1,96 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <engine/math/vector.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <optional>
+#include <vector>
+
+namespace engine::physics::gas
+{
+	/// Lookup table of atmospheric column densities, from which the transmittance along rays from points within an atmosphere can be calculated without ray marching.
+	/// @details The table stores the column densities of Rayleigh particles, Mie particles, and ozone, integrated along rays from a point within the atmosphere to its upper limit, parameterized by the height and view zenith angle of the point. The table uses the parameterization of Bruneton (2017), which concentrates resolution near the horizon, as do the transmittance LUTs of the sky pass.
+	///
+	/// As the table stores column densities rather than transmittance, it only depends on the density profile of the atmosphere, and need not be rebuilt when the scattering or absorption coefficients change.
+	///
+	/// @see Bruneton, E. (2017). A Qualitative and Quantitative Evaluation of 8 Clear Sky Models. IEEE Transactions on Visualization and Computer Graphics, 23(12), 2641–2655.
+	class transmittance_lut
+	{
+	public:
+		/// Density profile of an atmosphere.
+		struct profile
+		{
+			/// Radius of the planet, in meters.
+			double planet_radius{};
+
+			/// Elevation of the upper limit of the atmosphere, in meters.
+			double upper_limit{};
+
+			/// Scale height of the exponential distribution of Rayleigh particles, in meters.
+			double rayleigh_scale_height{};
+
+			/// Scale height of the exponential distribution of Mie particles, in meters.
+			double mie_scale_height{};
+
+			/// Elevation of the lower limit of the triangular distribution of ozone particles, in meters.
+			double ozone_lower_limit{};
+
+			/// Elevation of the upper limit of the triangular distribution of ozone particles, in meters.
+			double ozone_upper_limit{};
+
+			/// Elevation of the mode of the triangular distribution of ozone particles, in meters.
+			double ozone_mode{};
+		};
+
+		/// Default table resolution, in view zenith angle and height.
+		static inline constexpr math::vec2<usize> default_resolution{256, 64};
+
+		/// Default number of integration samples per table entry.
+		static inline constexpr usize default_sample_count = 40;
+
+		/// Builds the table.
+		/// @param profile Density profile of the atmosphere.
+		/// @param resolution Table resolution, in view zenith angle and height. Each dimension must be at least `2`.
+		/// @param sample_count Number of integration samples per table entry.
+		void build(const profile& profile, const math::vec2<usize>& resolution = default_resolution, usize sample_count = default_sample_count);
+
+		/// Looks up the column densities along a ray.
+		/// @param radius Distance from the center of the planet to the origin of the ray, in meters. Clamped to the atmosphere.
+		/// @param cos_view_zenith Cosine of the angle between the ray direction and the local zenith direction.
+		/// @return Column densities of Rayleigh particles, Mie particles, and ozone, relative to their sea level densities, or `std::nullopt` if the ray intersects the planet.
+		[[nodiscard]] std::optional<math::dvec3> lookup(double radius, double cos_view_zenith) const noexcept;
+
+		/// Integrates the column densities along a ray by ray marching.
+		/// @param profile Density profile of the atmosphere.
+		/// @param radius Distance from the center of the planet to the origin of the ray, in meters.
+		/// @param cos_view_zenith Cosine of the angle between the ray direction and the local zenith direction.
+		/// @param sample_count Number of integration samples.
+		/// @return Column densities of Rayleigh particles, Mie particles, and ozone, relative to their sea level densities.
+		[[nodiscard]] static math::dvec3 integrate(const profile& profile, double radius, double cos_view_zenith, usize sample_count) noexcept;
+
+		/// Returns `true` if the table has not been built, `false` otherwise.
+		[[nodiscard]] inline bool empty() const noexcept
+		{
+			return m_entries.empty();
+		}
+
+		/// Returns the density profile from which the table was built.
+		[[nodiscard]] inline const profile& get_profile() const noexcept
+		{
+			return m_profile;
+		}
+
+	private:
+		profile m_profile;
+		math::vec2<usize> m_resolution{};
+		std::vector<math::dvec3> m_entries;
+
+		/// Radius of the upper limit of the atmosphere.
+		double m_top_radius{};
+
+		/// Distance to the horizon from a point on the upper limit of the atmosphere.
+		double m_horizon_distance{};
+	};
+}
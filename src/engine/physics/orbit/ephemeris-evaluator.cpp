@@ -0,0 +1,234 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <engine/physics/orbit/ephemeris-evaluator.hpp>
+#include <engine/debug/contract.hpp>
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <emmintrin.h>
+
+namespace engine::physics::orbit
+{
+	namespace
+	{
+		/// Number of double-precision lanes per SIMD register.
+		constexpr usize lane_width = 2;
+
+		/// Number of lane groups evaluated together, limited by the number of SIMD registers available to hold recurrence state.
+		template <bool Velocity>
+		constexpr usize interleave = Velocity ? 2 : 4;
+	}
+
+	ephemeris_evaluator::ephemeris_evaluator(std::shared_ptr<const paged_ephemeris> ephemeris, std::vector<usize> items):
+		m_ephemeris(std::move(ephemeris)),
+		m_items(std::move(items))
+	{
+		debug::precondition(m_ephemeris != nullptr);
+
+		// One lane per component per item, padded to a multiple of the SIMD width
+		m_lane_count = (m_items.size() * 3 + lane_width - 1) / lane_width * lane_width;
+
+		for (const auto item: m_items)
+		{
+			m_coefficient_count = std::max(m_coefficient_count, m_ephemeris->layout(item).coefficient_count);
+		}
+		debug::precondition(m_items.empty() || m_coefficient_count >= 2);
+
+		// Padding lanes keep zero coefficients and evaluate to zero
+		m_coefficients.resize(m_lane_count * m_coefficient_count);
+		m_lane_start.resize(m_lane_count);
+		m_lane_scale.resize(m_lane_count);
+		m_lane_coefficient_count.resize(m_lane_count);
+		m_lane_position.resize(m_lane_count);
+		m_lane_velocity.resize(m_lane_count);
+		m_segment.resize(m_coefficient_count * 3);
+	}
+
+	void ephemeris_evaluator::evaluate(double t, std::span<math::dvec3> positions, std::span<math::dvec3> velocities)
+	{
+		sample({&t, 1}, positions, velocities);
+	}
+
+	void ephemeris_evaluator::sample(std::span<const double> times, std::span<math::dvec3> positions, std::span<math::dvec3> velocities)
+	{
+		debug::precondition(positions.size() >= times.size() * m_items.size());
+		debug::precondition(velocities.empty() || velocities.size() >= times.size() * m_items.size());
+
+		if (m_items.empty())
+		{
+			return;
+		}
+
+		for (usize i = 0; i < times.size(); ++i)
+		{
+			const double t = times[i];
+			if (!(t >= m_block_start && t < m_block_end))
+			{
+				build_block(t);
+			}
+
+			const usize offset = i * m_items.size();
+			if (velocities.empty())
+			{
+				evaluate_block<false>(t, positions.data() + offset, nullptr);
+			}
+			else
+			{
+				evaluate_block<true>(t, positions.data() + offset, velocities.data() + offset);
+			}
+		}
+	}
+
+	void ephemeris_evaluator::build_block(double t)
+	{
+		m_block_start = -std::numeric_limits<double>::infinity();
+		m_block_end = std::numeric_limits<double>::infinity();
+
+		const auto n = m_coefficient_count;
+
+		for (usize i = 0; i < m_items.size(); ++i)
+		{
+			const auto segment = m_ephemeris->copy_segment(m_items[i], t, m_segment);
+			const auto segment_end = segment.start + segment.duration;
+
+			// Narrow the block interval to the segment, unless the segment has been clamped to the start or end of the ephemeris
+			if (segment.start > m_ephemeris->start_time())
+			{
+				m_block_start = std::max(m_block_start, segment.start);
+			}
+			if (segment_end < m_ephemeris->end_time())
+			{
+				m_block_end = std::min(m_block_end, segment_end);
+			}
+
+			for (usize component = 0; component < 3; ++component)
+			{
+				const usize lane = i * 3 + component;
+				const usize group = lane / lane_width;
+				const usize group_lane = lane % lane_width;
+
+				m_lane_start[lane] = segment.start;
+				m_lane_scale[lane] = 2.0 / segment.duration;
+				m_lane_coefficient_count[lane] = segment.coefficient_count;
+
+				// Transpose coefficients, zero-padding series shorter than the longest series
+				double* destination = m_coefficients.data() + group * n * lane_width + group_lane;
+				const double* source = m_segment.data() + component * segment.coefficient_count;
+				for (usize k = 0; k < n; ++k)
+				{
+					destination[k * lane_width] = k < segment.coefficient_count ? source[k] : 0.0;
+				}
+			}
+		}
+
+		++m_block_build_count;
+	}
+
+	template <bool Velocity, usize Groups>
+	void ephemeris_evaluator::evaluate_lanes(double t, usize lane)
+	{
+		const auto n = m_coefficient_count;
+		const double* c = m_coefficients.data() + lane * n;
+		const __m128d one = _mm_set1_pd(1.0);
+		const __m128d time = _mm_set1_pd(t);
+
+		// Skip trailing coefficients which are zero in every lane of the groups
+		usize group_n = 0;
+		for (usize i = 0; i < Groups * lane_width; ++i)
+		{
+			group_n = std::max(group_n, m_lane_coefficient_count[lane + i]);
+		}
+
+		__m128d scale[Groups];
+		__m128d x2[Groups];
+		__m128d t1[Groups];
+		__m128d t2[Groups];
+		__m128d y[Groups];
+		__m128d d1[Groups];
+		__m128d d2[Groups];
+		__m128d dy[Groups];
+
+		for (usize g = 0; g < Groups; ++g)
+		{
+			const double* cg = c + g * n * lane_width;
+
+			// Map time to the Chebyshev domain of each lane
+			scale[g] = _mm_loadu_pd(m_lane_scale.data() + lane + g * lane_width);
+			const __m128d x = _mm_sub_pd(_mm_mul_pd(_mm_sub_pd(time, _mm_loadu_pd(m_lane_start.data() + lane + g * lane_width)), scale[g]), one);
+			x2[g] = _mm_add_pd(x, x);
+
+			// T0 = 1, T1 = x
+			t2[g] = one;
+			t1[g] = x;
+			y[g] = _mm_add_pd(_mm_loadu_pd(cg), _mm_mul_pd(_mm_loadu_pd(cg + lane_width), x));
+
+			// T0' = 0, T1' = 1
+			d2[g] = _mm_setzero_pd();
+			d1[g] = one;
+			dy[g] = _mm_loadu_pd(cg + lane_width);
+		}
+
+		for (usize k = 2; k < group_n; ++k)
+		{
+			for (usize g = 0; g < Groups; ++g)
+			{
+				const __m128d ck = _mm_loadu_pd(c + (g * n + k) * lane_width);
+
+				// Tk = 2x * Tk-1 - Tk-2
+				const __m128d t0 = _mm_sub_pd(_mm_mul_pd(x2[g], t1[g]), t2[g]);
+				y[g] = _mm_add_pd(y[g], _mm_mul_pd(ck, t0));
+
+				if constexpr (Velocity)
+				{
+					// Tk' = 2 * Tk-1 + 2x * Tk-1' - Tk-2'
+					const __m128d d0 = _mm_sub_pd(_mm_add_pd(_mm_add_pd(t1[g], t1[g]), _mm_mul_pd(x2[g], d1[g])), d2[g]);
+					dy[g] = _mm_add_pd(dy[g], _mm_mul_pd(ck, d0));
+					d2[g] = d1[g];
+					d1[g] = d0;
+				}
+
+				t2[g] = t1[g];
+				t1[g] = t0;
+			}
+		}
+
+		for (usize g = 0; g < Groups; ++g)
+		{
+			_mm_storeu_pd(m_lane_position.data() + lane + g * lane_width, y[g]);
+
+			if constexpr (Velocity)
+			{
+				// Chain rule: dy/dt = dy/dx * dx/dt
+				_mm_storeu_pd(m_lane_velocity.data() + lane + g * lane_width, _mm_mul_pd(dy[g], scale[g]));
+			}
+		}
+	}
+
+	template <bool Velocity>
+	void ephemeris_evaluator::evaluate_block(double t, math::dvec3* positions, math::dvec3* velocities)
+	{
+		// Evaluate interleaved lane groups, as the Chebyshev recurrence of a single group is latency-bound
+		usize lane = 0;
+		for (; lane + lane_width * interleave<Velocity> <= m_lane_count; lane += lane_width * interleave<Velocity>)
+		{
+			evaluate_lanes<Velocity, interleave<Velocity>>(t, lane);
+		}
+		for (; lane < m_lane_count; lane += lane_width)
+		{
+			evaluate_lanes<Velocity, 1>(t, lane);
+		}
+
+		for (usize i = 0; i < m_items.size(); ++i)
+		{
+			const double* p = m_lane_position.data() + i * 3;
+			positions[i] = {p[0], p[1], p[2]};
+
+			if constexpr (Velocity)
+			{
+				const double* v = m_lane_velocity.data() + i * 3;
+				velocities[i] = {v[0], v[1], v[2]};
+			}
+		}
+	}
+}
@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <engine/physics/orbit/paged-ephemeris.hpp>
+#include <engine/math/vector.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace engine::physics::orbit
+{
+	/// Evaluates the positions and velocities of multiple ephemeris items in a single SIMD pass.
+	/// @details The Chebyshev coefficients of every component of every evaluated item are transposed into a structure-of-arrays block, in which each SIMD lane holds one component of one item. The block remains valid until the evaluation time leaves the subintervals from which it was built, so consecutive evaluations at nearby times, such as per-frame updates or dense sampling of a time range, only perform the Chebyshev recurrences.
+	/// @note An evaluator is not thread-safe, as evaluation may rebuild its coefficient block. Use one evaluator per thread.
+	class ephemeris_evaluator
+	{
+	public:
+		/// Constructs an evaluator.
+		/// @param ephemeris Ephemeris to evaluate.
+		/// @param items Indices of the ephemeris items to evaluate.
+		/// @exception std::out_of_range Invalid item index.
+		ephemeris_evaluator(std::shared_ptr<const paged_ephemeris> ephemeris, std::vector<usize> items);
+
+		/// Constructs an empty evaluator.
+		ephemeris_evaluator() noexcept = default;
+
+		/// Calculates the Cartesian positions, and optionally velocities, of the evaluated items at a given time.
+		/// @param t Time.
+		/// @param[out] positions Positions of the evaluated items, in the order in which they were given.
+		/// @param[out] velocities Velocities of the evaluated items, in units of position per unit time. If empty, velocities will not be calculated.
+		void evaluate(double t, std::span<math::dvec3> positions, std::span<math::dvec3> velocities = {});
+
+		/// Calculates the Cartesian positions, and optionally velocities, of the evaluated items at multiple times.
+		/// @param times Times at which to evaluate the items. Sorted times minimize the number of coefficient block rebuilds.
+		/// @param[out] positions Positions of the evaluated items, with the positions of each time stored contiguously. Must hold `times.size() * item_count()` elements.
+		/// @param[out] velocities Velocities of the evaluated items, stored in the same order as @p positions. If empty, velocities will not be calculated.
+		void sample(std::span<const double> times, std::span<math::dvec3> positions, std::span<math::dvec3> velocities = {});
+
+		/// Returns the indices of the evaluated items.
+		[[nodiscard]] inline const std::vector<usize>& items() const noexcept
+		{
+			return m_items;
+		}
+
+		/// Returns the number of evaluated items.
+		[[nodiscard]] inline usize item_count() const noexcept
+		{
+			return m_items.size();
+		}
+
+		/// Returns the number of times the coefficient block has been rebuilt.
+		[[nodiscard]] inline usize block_build_count() const noexcept
+		{
+			return m_block_build_count;
+		}
+
+	private:
+		/// Rebuilds the coefficient block from the subintervals covering a given time.
+		/// @param t Time.
+		void build_block(double t);
+
+		/// Evaluates the coefficient block at a given time.
+		/// @tparam Velocity `true` if velocities should be calculated, `false` otherwise.
+		/// @param t Time.
+		/// @param[out] positions Positions of the evaluated items.
+		/// @param[out] velocities Velocities of the evaluated items.
+		template <bool Velocity>
+		void evaluate_block(double t, math::dvec3* positions, math::dvec3* velocities);
+
+		/// Evaluates consecutive groups of lanes of the coefficient block at a given time.
+		/// @tparam Velocity `true` if derivatives should be calculated, `false` otherwise.
+		/// @tparam Groups Number of SIMD-width lane groups to evaluate.
+		/// @param t Time.
+		/// @param lane Index of the first lane to evaluate.
+		template <bool Velocity, usize Groups>
+		void evaluate_lanes(double t, usize lane);
+
+		std::shared_ptr<const paged_ephemeris> m_ephemeris;
+		std::vector<usize> m_items;
+
+		/// Number of lanes in the coefficient block, padded to a multiple of the SIMD width.
+		usize m_lane_count{};
+
+		/// Maximum number of Chebyshev coefficients per component.
+		usize m_coefficient_count{};
+
+		/// Coefficients, interleaved in groups of SIMD-width lanes: `[lane group][coefficient][lane]`.
+		std::vector<double> m_coefficients;
+
+		/// Start time of each lane's subinterval.
+		std::vector<double> m_lane_start;
+
+		/// Reciprocal of half the duration of each lane's subinterval, which maps time to the Chebyshev domain.
+		std::vector<double> m_lane_scale;
+
+		/// Number of Chebyshev coefficients of each lane.
+		std::vector<usize> m_lane_coefficient_count;
+
+		/// Evaluated lane values and derivatives.
+		std::vector<double> m_lane_position;
+		std::vector<double> m_lane_velocity;
+
+		/// Scratch space for copying segment coefficients.
+		std::vector<double> m_segment;
+
+		/// Time interval `[m_block_start, m_block_end)` over which the coefficient block is valid.
+		double m_block_start{1.0};
+		double m_block_end{0.0};
+
+		usize m_block_build_count{};
+	};
+}
@@ -2,12 +2,18 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include <engine/physics/orbit/ephemeris.hpp>
+#include <engine/physics/orbit/paged-ephemeris.hpp>
 #include <engine/resources/deserializer.hpp>
+#include <engine/resources/deserialize-error.hpp>
 #include <engine/resources/resource-loader.hpp>
+#include <engine/utility/mapped-file.hpp>
 #include <engine/utility/sized-types.hpp>
 #include <engine/math/functions.hpp>
+#include <engine/debug/log.hpp>
 #include <bit>
+#include <cstring>
 #include <functional>
+#include <span>
 
 namespace engine::resources
 {
@@ -116,34 +122,54 @@ namespace engine::resources
 		1  // TT-TDB: t (seconds)
 	};
 
-	/// Deserializes an ephemeris.
-	/// @param[out] value Ephemeris to deserialize.
-	/// @param[in,out] ctx Deserialize context.
-	/// @throw deserialize_error Read error.
-	template <>
-	void deserializer<physics::orbit::ephemeris<double>>::deserialize(physics::orbit::ephemeris<double>& value, deserialize_context& ctx)
+	/// Parsed JPL DE file header.
+	struct jpl_de_header
 	{
-		auto& ephemeris = value;
+		/// `true` if the file endianness does not match the host endianness, `false` otherwise.
+		bool swap_endian{};
 
-		ephemeris.trajectories.clear();
+		/// Start time, end time, and record duration, in days. Start and end times are relative to the J2000 epoch.
+		f64 time[3]{};
 
-		// Read file into buffer
-		std::vector<std::byte> file_buffer(ctx.size());
-		ctx.read8(file_buffer.data(), file_buffer.size());
+		/// Coefficient table, containing the 1-based offset of the first coefficient, number of coefficients per component, and number of subintervals, of each item.
+		i32 coeff_table[jpl_de_max_item_count][3]{};
+
+		/// Number of coefficients per record.
+		usize record_coeff_count{};
+
+		/// Number of records.
+		usize record_count{};
+	};
+
+	/// Parses a JPL DE file header.
+	/// @param data File data, beginning with at least the header.
+	/// @return Parsed header.
+	/// @throw deserialize_error Header truncated.
+	[[nodiscard]] static jpl_de_header parse_jpl_de_header(std::span<const std::byte> data)
+	{
+		jpl_de_header header;
+
+		const auto read = [&](void* destination, usize offset, usize size)
+		{
+			if (offset + size > data.size())
+			{
+				throw deserialize_error("JPL DE header truncated.");
+			}
+			std::memcpy(destination, data.data() + offset, size);
+		};
 
 		// Read DE version number
 		i32 denum = 0;
-		std::memcpy(&denum, &file_buffer.at(jpl_de_offset_denum), sizeof(i32));
+		read(&denum, jpl_de_offset_denum, sizeof(i32));
 
 		// Check if file endianness does not match host endianness
-		const bool swap_endian = (denum & jpl_de_denum_endian_mask);
+		header.swap_endian = (denum & jpl_de_denum_endian_mask);
 
 		// Read ephemeris time
-		f64 ephemeris_time[3]{};
-		std::memcpy(&ephemeris_time, &file_buffer.at(jpl_de_offset_time), 3 * sizeof(f64));
-		if (swap_endian)
+		read(&header.time, jpl_de_offset_time, 3 * sizeof(f64));
+		if (header.swap_endian)
 		{
-			for (f64& t: ephemeris_time)
+			for (f64& t: header.time)
 			{
 				t = std::bit_cast<f64>(std::byteswap(std::bit_cast<u64>(t)));
 			}
@@ -151,30 +177,30 @@ namespace engine::resources
 
 		// Make time relative to J2000 epoch
 		const double epoch = 2451545.0;
-		ephemeris_time[0] -= epoch;
-		ephemeris_time[1] -= epoch;
+		header.time[0] -= epoch;
+		header.time[1] -= epoch;
 
 		// Read number of constants
 		i32 constant_count = 0;
-		std::memcpy(&constant_count, &file_buffer.at(jpl_de_offset_time + sizeof(f64) * 3), sizeof(i32));
-		if (swap_endian)
+		read(&constant_count, jpl_de_offset_time + sizeof(f64) * 3, sizeof(i32));
+		if (header.swap_endian)
 		{
 			constant_count = std::byteswap(constant_count);
 		}
 
 		// Read first coefficient table
-		i32 coeff_table[jpl_de_max_item_count][3]{};
-		std::memcpy(&coeff_table, &file_buffer.at(jpl_de_offset_table1), sizeof(i32) * 3 * jpl_de_table1_count);
+		auto& coeff_table = header.coeff_table;
+		read(&coeff_table, jpl_de_offset_table1, sizeof(i32) * 3 * jpl_de_table1_count);
 
 		// Read second coefficient table
-		std::memcpy(&coeff_table[jpl_de_table1_count][0], &file_buffer.at(jpl_de_offset_table2), sizeof(i32) * 3 * jpl_de_table2_count);
+		read(&coeff_table[jpl_de_table1_count][0], jpl_de_offset_table2, sizeof(i32) * 3 * jpl_de_table2_count);
 
 		// Read third coefficient table, skipping any extra constant names
 		const usize coeff_table3_offset = jpl_de_offset_table3 + (constant_count > jpl_de_constant_limit ? (constant_count - jpl_de_constant_limit) * jpl_de_constant_length : 0);
-		std::memcpy(&coeff_table[jpl_de_table1_count + jpl_de_table2_count][0], &file_buffer.at(coeff_table3_offset), sizeof(i32) * 3 * jpl_de_table3_count);
+		read(&coeff_table[jpl_de_table1_count + jpl_de_table2_count][0], coeff_table3_offset, sizeof(i32) * 3 * jpl_de_table3_count);
 
 		// Swap coefficient table endianness, if necessary
-		if (swap_endian)
+		if (header.swap_endian)
 		{
 			for (usize i = 0; i < jpl_de_max_item_count; ++i)
 			{
@@ -192,10 +218,37 @@ namespace engine::resources
 			i32 coeff_count = coeff_table[i][0] + coeff_table[i][1] * coeff_table[i][2] * static_cast<i32>(jpl_de_component_count[i]) - 1;
 			record_coeff_count = math::max(record_coeff_count, coeff_count);
 		}
+		header.record_coeff_count = static_cast<usize>(record_coeff_count);
+
+		// Calculate record count
+		header.record_count = static_cast<usize>((header.time[1] - header.time[0]) / header.time[2]);
+
+		return header;
+	}
+
+	/// Deserializes an ephemeris.
+	/// @param[out] value Ephemeris to deserialize.
+	/// @param[in,out] ctx Deserialize context.
+	/// @throw deserialize_error Read error.
+	template <>
+	void deserializer<physics::orbit::ephemeris<double>>::deserialize(physics::orbit::ephemeris<double>& value, deserialize_context& ctx)
+	{
+		auto& ephemeris = value;
+
+		ephemeris.trajectories.clear();
+
+		// Read file into buffer
+		std::vector<std::byte> file_buffer(ctx.size());
+		ctx.read8(file_buffer.data(), file_buffer.size());
+
+		// Parse header
+		const auto header = parse_jpl_de_header(file_buffer);
+		const auto& ephemeris_time = header.time;
+		const auto& coeff_table = header.coeff_table;
 
 		// Calculate record size and record count
-		usize record_size = record_coeff_count * sizeof(double);
-		usize record_count = static_cast<usize>((ephemeris_time[1] - ephemeris_time[0]) / ephemeris_time[2]);
+		usize record_size = header.record_coeff_count * sizeof(double);
+		usize record_count = header.record_count;
 
 		// Calculate coefficient strides
 		usize strides[11];
@@ -230,7 +283,7 @@ namespace engine::resources
 		}
 
 		// Swap coefficient endianness, if necessary
-		if (swap_endian)
+		if (header.swap_endian)
 		{
 			for (usize i = 0; i < 11; ++i)
 			{
@@ -252,4 +305,90 @@ namespace engine::resources
 
 		return resource;
 	}
+
+	template <>
+	std::unique_ptr<physics::orbit::paged_ephemeris> resource_loader<physics::orbit::paged_ephemeris>::load(resource_manager&, std::shared_ptr<deserialize_context> ctx)
+	{
+		// Read header, which may extend beyond the fixed-size fields if the constant limit has been exceeded
+		std::vector<std::byte> header_buffer(jpl_de_offset_table3);
+		ctx->read8(header_buffer.data(), header_buffer.size());
+		i32 constant_count = 0;
+		std::memcpy(&constant_count, &header_buffer.at(jpl_de_offset_time + sizeof(f64) * 3), sizeof(i32));
+		i32 denum = 0;
+		std::memcpy(&denum, &header_buffer.at(jpl_de_offset_denum), sizeof(i32));
+		if (denum & jpl_de_denum_endian_mask)
+		{
+			constant_count = std::byteswap(constant_count);
+		}
+		const usize extra_constant_size = constant_count > jpl_de_constant_limit ? (constant_count - jpl_de_constant_limit) * jpl_de_constant_length : 0;
+		header_buffer.resize(jpl_de_offset_table3 + extra_constant_size + sizeof(i32) * 3 * jpl_de_table3_count);
+		ctx->read8(header_buffer.data() + jpl_de_offset_table3, header_buffer.size() - jpl_de_offset_table3);
+
+		const auto header = parse_jpl_de_header(header_buffer);
+		const usize record_size = header.record_coeff_count * sizeof(f64);
+
+		// Describe layout of items 0-10
+		std::vector<physics::orbit::paged_ephemeris::item_layout> items(11);
+		for (usize i = 0; i < items.size(); ++i)
+		{
+			items[i].offset = static_cast<usize>(header.coeff_table[i][0] - 1);
+			items[i].coefficient_count = static_cast<usize>(header.coeff_table[i][1]);
+			items[i].subinterval_count = static_cast<usize>(header.coeff_table[i][2]);
+		}
+
+		// Records follow the two header records
+		const auto record_offset = [record_size](usize record)
+		{
+			return (record + 2) * record_size;
+		};
+
+		physics::orbit::paged_ephemeris::record_reader reader;
+
+		// Memory-map the file if it exists in the native filesystem
+		if (const auto native_path = ctx->native_path(); !native_path.empty())
+		{
+			try
+			{
+				auto file = std::make_shared<mapped_file>(native_path);
+				if (record_offset(header.record_count) > file->size())
+				{
+					throw deserialize_error("JPL DE file truncated.");
+				}
+
+				reader = [file = std::move(file), record_offset](usize record, std::span<std::byte> buffer)
+				{
+					std::memcpy(buffer.data(), file->data().data() + record_offset(record), buffer.size_bytes());
+				};
+			}
+			catch (const std::filesystem::filesystem_error& e)
+			{
+				log_warning("Failed to map ephemeris file \"{}\": {}", native_path.string(), e.what());
+			}
+		}
+
+		// Otherwise, such as when the file is contained within an archive, read records through the deserialize context
+		if (!reader)
+		{
+			reader = [ctx, record_offset](usize record, std::span<std::byte> buffer)
+			{
+				ctx->seek(record_offset(record));
+				if (ctx->read8(buffer.data(), buffer.size_bytes()) != buffer.size_bytes())
+				{
+					throw deserialize_error("JPL DE file truncated.");
+				}
+			};
+		}
+
+		return std::make_unique<physics::orbit::paged_ephemeris>
+		(
+			header.time[0],
+			header.time[1],
+			header.time[2],
+			header.record_count,
+			header.record_coeff_count,
+			std::move(items),
+			header.swap_endian,
+			std::move(reader)
+		);
+	}
 }
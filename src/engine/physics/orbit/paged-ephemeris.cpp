@@ -0,0 +1,139 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <engine/physics/orbit/paged-ephemeris.hpp>
+#include <engine/math/polynomial.hpp>
+#include <engine/debug/contract.hpp>
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+#include <utility>
+
+namespace engine::physics::orbit
+{
+	paged_ephemeris::paged_ephemeris(double t0, double t1, double record_duration, usize record_count, usize record_size, std::vector<item_layout> items, bool swap_endian, record_reader reader, usize cache_capacity):
+		m_t0(t0),
+		m_t1(t1),
+		m_record_duration(record_duration),
+		m_record_count(record_count),
+		m_record_size(record_size),
+		m_items(std::move(items)),
+		m_swap_endian(swap_endian),
+		m_reader(std::move(reader)),
+		m_cache(std::max<usize>(cache_capacity, 1))
+	{
+		debug::precondition(m_record_count > 0);
+		debug::precondition(m_record_duration > 0.0);
+
+		for (auto& entry: m_cache)
+		{
+			entry.record = m_record_count;
+		}
+	}
+
+	math::dvec3 paged_ephemeris::position(usize item, double t) const
+	{
+		const auto& layout = m_items.at(item);
+		const auto n = layout.coefficient_count;
+
+		usize record;
+		usize subinterval;
+		const auto segment = locate(layout, t, record, subinterval);
+
+		// Map time to the subinterval's Chebyshev domain
+		const double x = (t - segment.start) / segment.duration * 2.0 - 1.0;
+
+		std::lock_guard lock(m_mutex);
+
+		const double* ax = fetch(record) + layout.offset + subinterval * n * 3;
+		const double* ay = ax + n;
+		const double* az = ay + n;
+
+		return
+		{
+			math::chebyshev(ax, ay, x),
+			math::chebyshev(ay, az, x),
+			math::chebyshev(az, az + n, x)
+		};
+	}
+
+	auto paged_ephemeris::copy_segment(usize item, double t, std::span<double> coefficients) const -> segment
+	{
+		const auto& layout = m_items.at(item);
+		const auto n = layout.coefficient_count;
+
+		debug::precondition(coefficients.size() >= n * 3);
+
+		usize record;
+		usize subinterval;
+		const auto segment = locate(layout, t, record, subinterval);
+
+		std::lock_guard lock(m_mutex);
+
+		const double* a = fetch(record) + layout.offset + subinterval * n * 3;
+		std::copy_n(a, n * 3, coefficients.begin());
+
+		return segment;
+	}
+
+	auto paged_ephemeris::locate(const item_layout& layout, double t, usize& record, usize& subinterval) const noexcept -> segment
+	{
+		// Find record containing time t
+		t -= m_t0;
+		record = std::min(static_cast<usize>(std::max(t, 0.0) / m_record_duration), m_record_count - 1);
+		t -= static_cast<double>(record) * m_record_duration;
+
+		// Find subinterval containing time t
+		const double subinterval_duration = m_record_duration / static_cast<double>(layout.subinterval_count);
+		subinterval = std::min(static_cast<usize>(std::max(t, 0.0) / subinterval_duration), layout.subinterval_count - 1);
+
+		return
+		{
+			m_t0 + static_cast<double>(record) * m_record_duration + static_cast<double>(subinterval) * subinterval_duration,
+			subinterval_duration,
+			layout.coefficient_count
+		};
+	}
+
+	const double* paged_ephemeris::fetch(usize record) const
+	{
+		++m_cache_clock;
+
+		// Find cached record, or the least recently used entry to replace
+		cache_entry* lru_entry = &m_cache.front();
+		for (auto& entry: m_cache)
+		{
+			if (entry.record == record)
+			{
+				entry.last_use = m_cache_clock;
+				return entry.coefficients.data();
+			}
+
+			if (entry.last_use < lru_entry->last_use)
+			{
+				lru_entry = &entry;
+			}
+		}
+
+		// Read record into least recently used entry
+		auto& entry = *lru_entry;
+		entry.record = m_record_count;
+		entry.coefficients.resize(m_record_size);
+		m_reader(record, std::as_writable_bytes(std::span{entry.coefficients}));
+
+		// Decode record
+		if (m_swap_endian)
+		{
+			for (double& a: entry.coefficients)
+			{
+				a = std::bit_cast<double>(std::byteswap(std::bit_cast<u64>(a)));
+			}
+		}
+
+		entry.record = record;
+		entry.last_use = m_cache_clock;
+		++m_decoded_record_count;
+
+		return entry.coefficients.data();
+	}
+}
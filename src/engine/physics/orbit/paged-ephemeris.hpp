@@ -0,0 +1,162 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <engine/math/vector.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <span>
+#include <vector>
+
+namespace engine::physics::orbit
+{
+	/// Ephemeris which reads and decodes its Chebyshev coefficient records on demand.
+	/// @details Unlike ephemeris, which decodes every record of every item at load time, a paged ephemeris only decodes the records covering the times at which it is queried, and retains the most recently used records in a small LRU cache. This allows long-span ephemerides, such as JPL DE440 and DE441, to be used without loading the entire file into memory.
+	class paged_ephemeris
+	{
+	public:
+		/// Layout of the coefficients of an ephemeris item within a record.
+		struct item_layout
+		{
+			/// Offset to the first coefficient of the item, in coefficients from the start of the record.
+			usize offset{};
+
+			/// Number of Chebyshev coefficients per component.
+			usize coefficient_count{};
+
+			/// Number of subintervals into which each record is divided for this item.
+			usize subinterval_count{};
+		};
+
+		/// Chebyshev series of an ephemeris item over a single subinterval of a record.
+		struct segment
+		{
+			/// Start time of the subinterval.
+			double start{};
+
+			/// Duration of the subinterval.
+			double duration{};
+
+			/// Number of Chebyshev coefficients per component.
+			usize coefficient_count{};
+		};
+
+		/// Function which reads the raw coefficients of a record.
+		/// @param record Index of the record to read.
+		/// @param buffer Destination of the record's raw coefficients.
+		using record_reader = std::function<void(usize record, std::span<std::byte> buffer)>;
+
+		/// Default number of decoded records retained by the cache.
+		static inline constexpr usize default_cache_capacity = 4;
+
+		/// Constructs a paged ephemeris.
+		/// @param t0 Start time of the ephemeris.
+		/// @param t1 End time of the ephemeris.
+		/// @param record_duration Duration of each record.
+		/// @param record_count Number of records.
+		/// @param record_size Number of coefficients per record.
+		/// @param items Coefficient layout of each item.
+		/// @param swap_endian `true` if the byte order of the coefficients should be reversed after reading, `false` otherwise.
+		/// @param reader Function which reads raw records.
+		/// @param cache_capacity Maximum number of decoded records to retain.
+		paged_ephemeris(double t0, double t1, double record_duration, usize record_count, usize record_size, std::vector<item_layout> items, bool swap_endian, record_reader reader, usize cache_capacity = default_cache_capacity);
+
+		/// Calculates the Cartesian position of an ephemeris item at a given time.
+		/// @param item Index of the ephemeris item.
+		/// @param t Time, on `[t0, t1)`. Times outside of this interval are evaluated with the nearest record.
+		/// @return Position of the item at time @p t.
+		/// @exception std::out_of_range Invalid item index.
+		[[nodiscard]] math::dvec3 position(usize item, double t) const;
+
+		/// Copies the Chebyshev coefficients of the subinterval of an ephemeris item which covers a given time.
+		/// @param item Index of the ephemeris item.
+		/// @param t Time, on `[t0, t1)`. Times outside of this interval select the nearest subinterval.
+		/// @param[out] coefficients Destination of the coefficients of the x, y, and z components, in that order. Must hold at least three times the item's coefficient count.
+		/// @return Segment describing the copied coefficients.
+		/// @exception std::out_of_range Invalid item index.
+		segment copy_segment(usize item, double t, std::span<double> coefficients) const;
+
+		/// Returns the coefficient layout of an ephemeris item.
+		/// @param item Index of the ephemeris item.
+		/// @exception std::out_of_range Invalid item index.
+		[[nodiscard]] inline const item_layout& layout(usize item) const
+		{
+			return m_items.at(item);
+		}
+
+		/// Returns the number of ephemeris items.
+		[[nodiscard]] inline usize item_count() const noexcept
+		{
+			return m_items.size();
+		}
+
+		/// Returns the start time of the ephemeris.
+		[[nodiscard]] inline double start_time() const noexcept
+		{
+			return m_t0;
+		}
+
+		/// Returns the end time of the ephemeris.
+		[[nodiscard]] inline double end_time() const noexcept
+		{
+			return m_t1;
+		}
+
+		/// Returns the number of records in the ephemeris.
+		[[nodiscard]] inline usize record_count() const noexcept
+		{
+			return m_record_count;
+		}
+
+		/// Returns the number of records which have been decoded since construction, including records which have since been evicted from the cache.
+		[[nodiscard]] inline usize decoded_record_count() const noexcept
+		{
+			return m_decoded_record_count;
+		}
+
+	private:
+		/// Decoded record cache entry.
+		struct cache_entry
+		{
+			/// Index of the cached record, or `record_count` if the entry is unused.
+			usize record{};
+
+			/// Value of the cache clock when the entry was last used.
+			u64 last_use{};
+
+			/// Decoded coefficients of the record.
+			std::vector<double> coefficients;
+		};
+
+		/// Finds the record and subinterval of an ephemeris item which cover a given time.
+		/// @param layout Coefficient layout of the ephemeris item.
+		/// @param t Time.
+		/// @param[out] record Index of the record.
+		/// @param[out] subinterval Index of the subinterval within the record.
+		/// @return Segment describing the subinterval.
+		[[nodiscard]] segment locate(const item_layout& layout, double t, usize& record, usize& subinterval) const noexcept;
+
+		/// Returns the decoded coefficients of a record, reading and decoding the record if it is not cached.
+		/// @param record Index of the record.
+		/// @return Pointer to the decoded coefficients of the record.
+		/// @warning The returned pointer is only valid while `m_mutex` is held.
+		[[nodiscard]] const double* fetch(usize record) const;
+
+		double m_t0{};
+		double m_t1{};
+		double m_record_duration{};
+		usize m_record_count{};
+		usize m_record_size{};
+		std::vector<item_layout> m_items;
+		bool m_swap_endian{};
+		record_reader m_reader;
+
+		mutable std::mutex m_mutex;
+		mutable std::vector<cache_entry> m_cache;
+		mutable u64 m_cache_clock{};
+		mutable usize m_decoded_record_count{};
+	};
+}
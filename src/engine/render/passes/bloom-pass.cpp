@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include <engine/render/passes/bloom-pass.hpp>
+#include <engine/debug/profiler.hpp>
 #include <engine/render/vertex-attribute-location.hpp>
 #include <engine/render/context.hpp>
 #include <engine/gl/pipeline.hpp>
@@ -57,6 +58,8 @@ namespace engine::render
 
 	void bloom_pass::render(render::context&)
 	{
+		debug::profile_scope profile("bloom_pass::render");
+
 		// Execute command buffer
 		for (const auto& command: m_command_buffer)
 		{
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include <engine/render/passes/clear-pass.hpp>
+#include <engine/debug/profiler.hpp>
 #include <engine/gl/pipeline.hpp>
 
 namespace engine::render
@@ -12,6 +13,8 @@ namespace engine::render
 
 	void clear_pass::render(render::context&)
 	{
+		debug::profile_scope profile("clear_pass::render");
+
 		if (m_clear_mask)
 		{
 			m_pipeline->bind_framebuffer(m_framebuffer);
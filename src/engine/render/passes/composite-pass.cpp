@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include <engine/render/passes/composite-pass.hpp>
+#include <engine/debug/profiler.hpp>
 #include <engine/gl/pipeline.hpp>
 #include <engine/gl/framebuffer.hpp>
 #include <engine/gl/shader-program.hpp>
@@ -39,6 +40,8 @@ namespace engine::render
 
 	void composite_pass::render(render::context& ctx)
 	{
+		debug::profile_scope profile("composite_pass::render");
+
 		// Update resolution
 		const auto& viewport_dimensions = (m_framebuffer) ? m_framebuffer->dimensions() : m_pipeline->get_default_framebuffer_dimensions();
 		m_resolution = {static_cast<float>(viewport_dimensions[0]), static_cast<float>(viewport_dimensions[1])};
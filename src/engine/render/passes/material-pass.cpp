@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include <execution>
+#include <engine/debug/profiler.hpp>
 #include <engine/render/passes/material-pass.hpp>
 #include <engine/config.hpp>
 #include <engine/gl/framebuffer.hpp>
@@ -113,6 +114,8 @@ namespace engine::render
 
 	void material_pass::render(render::context& ctx)
 	{
+		debug::profile_scope profile("material_pass::render");
+
 		m_pipeline->bind_framebuffer(m_framebuffer);
 		clear();
 	
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include <engine/render/passes/sky-pass.hpp>
+#include <engine/debug/profiler.hpp>
 #include <engine/gl/framebuffer.hpp>
 #include <engine/gl/shader-program.hpp>
 #include <engine/gl/shader-variable.hpp>
@@ -129,6 +130,8 @@ namespace engine::render
 
 	void sky_pass::render(render::context& ctx)
 	{
+		debug::profile_scope profile("sky_pass::render");
+
 		if (!(m_layer_mask & ctx.camera->get_layer_mask()))
 		{
 			return;
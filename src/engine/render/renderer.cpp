@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include <engine/render/renderer.hpp>
+#include <engine/debug/profiler.hpp>
 #include <engine/render/stages/light-probe-stage.hpp>
 #include <engine/render/stages/cascaded-shadow-map-stage.hpp>
 #include <engine/render/stages/culling-stage.hpp>
@@ -22,6 +23,8 @@ namespace engine::render
 
 	void renderer::render(float t, float dt, float alpha, scene::collection& collection)
 	{
+		debug::profile_scope profile("renderer::render");
+		
 		// Init render context
 		m_ctx.collection = &collection;
 		m_ctx.t = t;
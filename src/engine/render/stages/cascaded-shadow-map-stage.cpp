@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include <execution>
+#include <engine/debug/profiler.hpp>
 #include <engine/render/stages/cascaded-shadow-map-stage.hpp>
 #include <engine/render/context.hpp>
 #include <engine/render/material.hpp>
@@ -66,6 +67,8 @@ namespace engine::render
 
 	void cascaded_shadow_map_stage::execute(render::context& ctx)
 	{
+		debug::profile_scope profile("cascaded_shadow_map_stage::execute");
+
 		// For each light
 		const auto& lights = ctx.collection->get_objects(scene::light::object_type_id);
 		for (scene::object_base* object: lights)
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include <engine/render/stages/culling-stage.hpp>
+#include <engine/debug/profiler.hpp>
 #include <engine/render/context.hpp>
 #include <engine/scene/camera.hpp>
 #include <engine/scene/collection.hpp>
@@ -10,6 +11,8 @@ namespace engine::render
 {
 	void culling_stage::execute(render::context& ctx)
 	{
+		debug::profile_scope profile("culling_stage::execute");
+
 		// Get all objects in the collection
 		const auto& objects = ctx.collection->get_objects();
 	
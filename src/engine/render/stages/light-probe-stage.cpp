@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include <engine/render/stages/light-probe-stage.hpp>
+#include <engine/debug/profiler.hpp>
 #include <engine/render/vertex-attribute-location.hpp>
 #include <engine/scene/light-probe.hpp>
 #include <engine/scene/collection.hpp>
@@ -134,6 +135,8 @@ namespace engine::render
 
 	void light_probe_stage::execute(render::context& ctx)
 	{
+		debug::profile_scope profile("light_probe_stage::execute");
+
 		const auto& light_probes = ctx.collection->get_objects(scene::light_probe::object_type_id);
 		if (light_probes.empty())
 		{
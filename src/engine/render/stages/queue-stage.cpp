@@ -2,12 +2,15 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include <engine/render/stages/queue-stage.hpp>
+#include <engine/debug/profiler.hpp>
 #include <engine/scene/object.hpp>
 
 namespace engine::render
 {
 	void queue_stage::execute(render::context& ctx)
 	{
+		debug::profile_scope profile("queue_stage::execute");
+
 		// For each visible object in the render context
 		for (const auto& object: ctx.objects)
 		{
@@ -20,6 +20,9 @@ namespace engine::resources
 		/// Returns the path associated with this deserialize context.
 		[[nodiscard]] virtual const std::filesystem::path& path() const noexcept = 0;
 
+		/// Returns the path to the file in the native filesystem, or an empty path if the file cannot be accessed directly through the native filesystem, such as when it is contained within an archive.
+		[[nodiscard]] virtual std::filesystem::path native_path() const = 0;
+
 		/// Returns `true` if an error occured during a read operation or initialization, `false` otherwise.
 		[[nodiscard]] virtual bool error() const noexcept = 0;
 
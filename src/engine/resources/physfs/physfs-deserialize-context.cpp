@@ -5,6 +5,7 @@
 #include <engine/resources/physfs/physfs-deserialize-context.hpp>
 #include <engine/resources/deserialize-error.hpp>
 #include <engine/utility/sized-types.hpp>
+#include <system_error>
 
 namespace engine::resources
 {
@@ -77,6 +78,23 @@ namespace engine::resources
 		return m_path;
 	}
 
+	std::filesystem::path physfs_deserialize_context::native_path() const
+	{
+		// Get the directory or archive in which the file was found
+		if (const char* real_dir = PHYSFS_getRealDir(m_path.string().c_str()))
+		{
+			// Files within archives have no native path
+			std::filesystem::path path = std::filesystem::path(real_dir) / m_path.relative_path();
+			std::error_code ec;
+			if (std::filesystem::is_regular_file(path, ec))
+			{
+				return path;
+			}
+		}
+
+		return {};
+	}
+
 	bool physfs_deserialize_context::error() const noexcept
 	{
 		return m_error;
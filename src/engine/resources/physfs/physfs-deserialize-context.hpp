@@ -37,6 +37,7 @@ namespace engine::resources
 		[[nodiscard]] bool is_open() const noexcept;
 
 		[[nodiscard]] const std::filesystem::path& path() const noexcept override;
+		[[nodiscard]] std::filesystem::path native_path() const override;
 		[[nodiscard]] bool error() const noexcept override;
 		[[nodiscard]] bool eof() const noexcept override;
 		[[nodiscard]] usize size() const noexcept override;
@@ -9,6 +9,7 @@
 #include <engine/resources/serializer.hpp>
 #include <engine/resources/resource-loader.hpp>
 #include <engine/debug/log.hpp>
+#include <engine/debug/profiler.hpp>
 #include <filesystem>
 #include <memory>
 #include <stdexcept>
@@ -92,6 +93,8 @@ namespace engine::resources
 			return std::static_pointer_cast<T>(resource);
 		}
 
+		debug::profile_scope profile("resource_manager::load");
+
 		const auto path_string = path.string();
 
 		try
@@ -11,6 +11,8 @@
 #include <engine/render/context.hpp>
 #include <engine/gl/vertex-input-attribute.hpp>
 #include <engine/utility/sized-types.hpp>
+#include <algorithm>
+#include <span>
 
 namespace engine::scene
 {
@@ -39,11 +41,8 @@ namespace engine::scene
 			}
 		};
 
-		// Floating-point elements per text vertex
-		static const usize floats_per_text_vertex = 2 + 2 + 4;
-
 		// Text vertex byte stride.
-		static const usize text_vertex_stride = floats_per_text_vertex * sizeof(float);
+		constexpr usize text_vertex_stride = type::floats_per_text_vertex * sizeof(float);
 	}
 
 	text::text()
@@ -52,7 +51,7 @@ namespace engine::scene
 		m_vertex_array = std::make_unique<gl::vertex_array>(text_vertex_attributes);
 
 		// Construct empty vertex buffer
-		m_vertex_buffer = std::make_unique<gl::vertex_buffer>(gl::buffer_usage::static_draw);
+		m_vertex_buffer = std::make_unique<gl::vertex_buffer>(gl::buffer_usage::dynamic_draw);
 
 		// Init render operation
 		m_render_op.primitive_topology = gl::primitive_topology::triangle_list;
@@ -64,6 +63,9 @@ namespace engine::scene
 		m_render_op.vertex_count = 0;
 		m_render_op.first_instance = 0;
 		m_render_op.instance_count = 1;
+
+		// Init text color
+		m_layout.set_color({1.0f, 0.0f, 1.0f, 1.0f});
 	}
 
 	void text::render(render::context& ctx) const
@@ -78,7 +80,8 @@ namespace engine::scene
 
 	void text::refresh()
 	{
-		update_content();
+		m_layout.relayout();
+		update_vertex_buffer();
 	}
 
 	void text::set_material(std::shared_ptr<render::material> material)
@@ -99,7 +102,8 @@ namespace engine::scene
 				(
 					[&](const auto&)
 					{
-						update_uvs();
+						m_layout.update_texture_coordinates();
+						update_vertex_buffer();
 					}
 				);
 			}
@@ -108,7 +112,8 @@ namespace engine::scene
 				m_font_texture_resized_subscription.reset();
 			}
 
-			update_content();
+			m_layout.set_font(m_font.get());
+			update_vertex_buffer();
 		}
 	}
 
@@ -117,24 +122,20 @@ namespace engine::scene
 		if (m_direction != direction)
 		{
 			m_direction = direction;
-			update_content();
+			refresh();
 		}
 	}
 
 	void text::set_content(std::string_view content)
 	{
-		if (m_content_u8 != content)
-		{
-			m_content_u8 = content;
-			m_content_u32 = type::to_utf32(m_content_u8);
-			update_content();
-		}
+		m_layout.set_content(content);
+		update_vertex_buffer();
 	}
 
 	void text::set_color(const math::fvec4& color)
 	{
-		m_color = color;
-		update_colors();
+		m_layout.set_color(color);
+		update_vertex_buffer();
 	}
 
 	void text::transformed()
@@ -146,246 +147,44 @@ namespace engine::scene
 			m_world_bounds.extend(get_transform() * m_local_bounds.corner(i));
 		}
 
-		m_render_op.transform = get_transform().matrix();
-	}
-
-	void text::update_uvs()
-	{
-		if (!m_font || m_content_u32.empty() || m_vertex_data.size() < m_content_u32.length() * 6 * 8)
-		{
-			return;
-		}
-
-		// Determine scale factor for texture coordinates
-		const auto& texture_dimensions = m_font->get_texture()->get_image_view()->get_image()->get_dimensions();
-		const auto uv_scale = math::fvec2
-		{
-			1.0f / static_cast<float>(texture_dimensions[0]),
-			1.0f / static_cast<float>(texture_dimensions[1])
-		};
-
-		// Update texture coordinates
-		float* v = m_vertex_data.data() + 2;
-		for (auto code : m_content_u32)
-		{
-			if (!is_visible(code))
-			{
-				continue;
-			}
-
-			// Get glyph from glyph cache
-			const auto glyph = m_font->get_cached_glyph(code);
-
-			if (glyph)
-			{
-				// Glyph found, update glyph UVs
-				math::fvec2 uvs[6];
-				uvs[0] = {static_cast<float>(glyph->bitmap_position[0]), static_cast<float>(glyph->bitmap_position[1])};
-				uvs[1] = {uvs[0].x(), uvs[0].y() + glyph->bitmap_dimensions[1]};
-				uvs[2] = {uvs[0].x() + glyph->bitmap_dimensions[0], uvs[1].y()};
-				uvs[3] = {uvs[2].x(), uvs[0].y()};
-				uvs[4] = uvs[0];
-				uvs[5] = uvs[2];
-
-				for (int i = 0; i < 6; ++i)
-				{
-					*(v++) = uvs[i].x() * uv_scale[0];
-					*(v++) = uvs[i].y() * uv_scale[1];
-					v += 6;
-				}
-			}
-			else
-			{
-				// Glyph not yet cached, skip it
-				v += 8 * 6;
-			}
-		}
-
-		update_vertex_buffer();
+		// Offset vertices by the layout origin
+		const auto origin = m_layout.get_origin();
+		m_render_op.transform = get_transform().matrix() * math::translate(math::fvec3{origin.x(), origin.y(), 0.0f});
 	}
 
-	void text::update_colors()
-	{
-		if (m_content_u32.empty() || m_vertex_data.size() < m_content_u32.length() * 6 * 8)
-		{
-			return;
-		}
-
-		float* v = m_vertex_data.data() + 4;
-		for (auto code : m_content_u32)
-		{
-			if (!is_visible(code))
-			{
-				continue;
-			}
-
-			for (int i = 0; i < 6; ++i)
-			{
-				*(v++) = m_color[0];
-				*(v++) = m_color[1];
-				*(v++) = m_color[2];
-				*(v++) = m_color[3];
-				v += 4;
-			}
-		}
-
-		update_vertex_buffer();
-	}
-
-	void text::update_content()
+	void text::update_vertex_buffer()
 	{
-		// If no valid font or no text, clear vertex count
-		if (!m_font || m_content_u32.empty())
-		{
-			m_render_op.vertex_count = 0;
-			m_local_bounds = {{0, 0, 0}, {0, 0, 0}};
-			transformed();
-			return;
-		}
-
-		// Cache glyphs
-		m_font->cache_glyphs(m_content_u32);
+		const auto& modified_ranges = m_layout.get_modified_ranges();
+		const auto vertex_count = m_layout.get_vertex_count();
 
-		// Determine maximum required size of vertex buffer, in bytes
-		const auto max_vertex_count = m_content_u32.length() * 6;
-		const auto max_vertex_buffer_size = max_vertex_count * text_vertex_stride;
-
-		// Reserve vertex data
-		if (m_vertex_data.size() < max_vertex_buffer_size / sizeof(float))
+		if (m_vertex_buffer->size() < vertex_count * text_vertex_stride)
 		{
-			m_vertex_data.resize(max_vertex_buffer_size / sizeof(float));
+			// Grow VBO to the capacity of the layout vertex data
+			m_vertex_buffer->resize(std::as_bytes(std::span{m_layout.get_vertices()}));
 		}
-
-		// Get font metrics and texture
-		const auto& font_metrics = m_font->get_metrics();
-
-		// Determine scale factor for texture coordinates
-		const auto& texture_dimensions = m_font->get_texture()->get_image_view()->get_image()->get_dimensions();
-		const auto uv_scale = math::fvec2
-		{
-			1.0f / static_cast<float>(texture_dimensions[0]),
-			1.0f / static_cast<float>(texture_dimensions[1])
-		};
-
-		// Init pen position
-		math::fvec2 pen_position = {0.0f, 0.0f};
-
-		// Reset local-space bounds
-		m_local_bounds.min = {std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(), 0.0f};
-		m_local_bounds.max = {-std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), 0.0f};
-
-		// Generate vertex data
-		m_render_op.vertex_count = 0;
-		char32_t previous_code = 0;
-		float* v = m_vertex_data.data();
-		for (char32_t code : m_content_u32)
+		else
 		{
-			// Get glyph from character code
-			const auto& glyph = *m_font->get_cached_glyph(code);
-
-			// Apply kerning
-			if (previous_code)
-			{
-				pen_position.x() += m_font->get_kerning(previous_code, code)[0];
-			}
-
-			// Calculate vertex positions
-			math::fvec2 positions[6];
-			positions[0] = {pen_position[0] + glyph.horizontal_bearings[0], pen_position[1] + glyph.horizontal_bearings[1]};
-			positions[1] = {positions[0].x(), positions[0].y() - glyph.bitmap_dimensions[1]};
-			positions[2] = {positions[0].x() + glyph.bitmap_dimensions[0], positions[1].y()};
-			positions[3] = {positions[2].x(), positions[0].y()};
-			positions[4] = positions[0];
-			positions[5] = positions[2];
-
-			// Calculate vertex UVs
-			math::fvec2 uvs[6];
-			uvs[0] = {static_cast<float>(glyph.bitmap_position[0]), static_cast<float>(glyph.bitmap_position[1])};
-			uvs[1] = {uvs[0].x(), uvs[0].y() + glyph.bitmap_dimensions[1]};
-			uvs[2] = {uvs[0].x() + glyph.bitmap_dimensions[0], uvs[1].y()};
-			uvs[3] = {uvs[2].x(), uvs[0].y()};
-			uvs[4] = uvs[0];
-			uvs[5] = uvs[2];
-
-			for (int i = 0; i < 6; ++i)
-			{
-				// Round positions
-				positions[i].x() = math::round(positions[i].x());
-				positions[i].y() = math::round(positions[i].y());
-
-				// Normalize UVs
-				uvs[i] *= uv_scale;
-			}
-
-			// Advance pen position
-			pen_position.x() += glyph.horizontal_advance;
-
-			// Handle newlines
-			if (code == U'\n')
-			{
-				pen_position.x() = 0.0f;
-				pen_position.y() -= font_metrics.linespace;
-			}
-
-			// Update previous UTF-32 character code
-			previous_code = code;
-
-			if (is_visible(code))
+			// Upload modified vertices only
+			const auto vertex_data = std::as_bytes(std::span{m_layout.get_vertices()});
+			for (const auto& [first, last]: modified_ranges)
 			{
-				// Add vertex to vertex data buffer
-				for (int i = 0; i < 6; ++i)
+				const auto end = std::min(last, vertex_count);
+				if (first < end)
 				{
-					*(v++) = positions[i].x();
-					*(v++) = positions[i].y();
-					*(v++) = uvs[i].x();
-					*(v++) = uvs[i].y();
-					*(v++) = m_color[0];
-					*(v++) = m_color[1];
-					*(v++) = m_color[2];
-					*(v++) = m_color[3];
-				}
-
-				m_render_op.vertex_count += 6;
-
-				// Update local-space bounds
-				for (int i = 0; i < 4; ++i)
-				{
-					const math::fvec2& position = positions[i];
-					for (int j = 0; j < 2; ++j)
-					{
-						m_local_bounds.min[j] = math::min(m_local_bounds.min[j], position[j]);
-						m_local_bounds.max[j] = math::max(m_local_bounds.max[j], position[j]);
-					}
+					m_vertex_buffer->write(first * text_vertex_stride, vertex_data.subspan(first * text_vertex_stride, (end - first) * text_vertex_stride));
 				}
 			}
 		}
+		m_layout.clear_modified_ranges();
 
-		// Upload vertex data to VBO, growing VBO size if necessary
-		if (m_vertex_buffer->size() < m_render_op.vertex_count * text_vertex_stride)
-		{
-			m_vertex_buffer->resize(m_render_op.vertex_count * text_vertex_stride, {reinterpret_cast<const std::byte*>(m_vertex_data.data()), m_render_op.vertex_count * text_vertex_stride});
-		}
-		else
-		{
-			update_vertex_buffer();
-		}
+		m_render_op.vertex_count = static_cast<u32>(vertex_count);
+
+		// Update local-space bounds
+		const auto& bounds = m_layout.get_bounds();
+		m_local_bounds.min = {bounds.min.x(), bounds.min.y(), 0.0f};
+		m_local_bounds.max = {bounds.max.x(), bounds.max.y(), 0.0f};
 
 		// Update world-space bounds
 		transformed();
 	}
-
-	void text::update_vertex_buffer()
-	{
-		m_vertex_buffer->write({reinterpret_cast<const std::byte*>(m_vertex_data.data()), m_render_op.vertex_count * text_vertex_stride});
-	}
-
-	bool text::is_visible(char32_t code) const
-	{
-		if (code == ' ' || code == '\t' || code == '\n' || code == '\r')
-		{
-			return false;
-		}
-
-		return true;
-	}
 }
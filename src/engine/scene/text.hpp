@@ -10,6 +10,7 @@
 #include <engine/event/subscription.hpp>
 #include <engine/type/font.hpp>
 #include <engine/type/text-direction.hpp>
+#include <engine/type/text-layout.hpp>
 #include <engine/gl/vertex-array.hpp>
 #include <engine/gl/vertex-buffer.hpp>
 #include <memory>
@@ -73,13 +74,13 @@ namespace engine::scene
 		/// Returns the text content.
 		[[nodiscard]] inline const auto& get_content() const noexcept
 		{
-			return m_content_u8;
+			return m_layout.get_content();
 		}
 
 		/// Returns the text color.
 		[[nodiscard]] inline const auto& get_color() const noexcept
 		{
-			return m_color;
+			return m_layout.get_color();
 		}
 
 		/// Returns the bounds of the text.
@@ -95,31 +96,18 @@ namespace engine::scene
 		}
 
 	private:
-		/// Updates UV coordinates of each characters.
-		void update_uvs();
-
-		/// Updates the colors of each character.
-		void update_colors();
-
-		void update_content();
-
-		/// Uploads character veretex data to the vertex buffer.
+		/// Uploads modified vertices of the text layout to the vertex buffer.
 		void update_vertex_buffer();
 
 		void transformed() override;
 
-		bool is_visible(char32_t code) const;
-
 		mutable render::operation m_render_op;
 		aabb_type m_local_bounds{{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
 		aabb_type m_world_bounds{{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
 		std::shared_ptr<type::font> m_font;
 		std::shared_ptr<event::subscription> m_font_texture_resized_subscription;
 		type::text_direction m_direction{type::text_direction::ltr};
-		std::string m_content_u8;
-		std::u32string m_content_u32;
-		math::fvec4 m_color{1.0f, 0.0f, 1.0f, 1.0f};
-		std::vector<float> m_vertex_data;
+		type::text_layout m_layout;
 		std::unique_ptr<gl::vertex_array> m_vertex_array;
 		std::unique_ptr<gl::vertex_buffer> m_vertex_buffer;
 	};
@@ -0,0 +1,135 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <engine/type/font-cache.hpp>
+#include <engine/resources/serializer.hpp>
+#include <engine/resources/deserializer.hpp>
+#include <engine/resources/deserialize-error.hpp>
+#include <engine/resources/resource-loader.hpp>
+#include <bit>
+#include <format>
+#include <iterator>
+#include <memory>
+
+namespace engine::resources
+{
+	namespace
+	{
+		/// Font cache file identifier, "AKFC".
+		constexpr u32 font_cache_magic = 0x43464b41;
+	}
+
+	/// Serializes a font cache.
+	/// @param[in] cache Font cache to serialize.
+	/// @param[in,out] ctx Serialize context.
+	/// @throw serialize_error Write error.
+	template <>
+	void serializer<type::font_cache>::serialize(const type::font_cache& cache, serialize_context& ctx)
+	{
+		const u32 header[] =
+		{
+			font_cache_magic,
+			type::font_cache_version,
+			cache.texture_dimensions[0],
+			cache.texture_dimensions[1],
+			static_cast<u32>(cache.glyphs.size())
+		};
+		ctx.write32<std::endian::little>(reinterpret_cast<const std::byte*>(header), std::size(header));
+		ctx.write64<std::endian::little>(reinterpret_cast<const std::byte*>(&cache.key), 1);
+
+		for (const auto& [code, g]: cache.glyphs)
+		{
+			const float metrics[] =
+			{
+				g.dimensions[0],
+				g.dimensions[1],
+				g.horizontal_bearings[0],
+				g.horizontal_bearings[1],
+				g.horizontal_advance,
+				g.vertical_bearings[0],
+				g.vertical_bearings[1],
+				g.vertical_advance
+			};
+
+			const u32 bitmap_header[] =
+			{
+				static_cast<u32>(code),
+				g.bitmap_dimensions[0],
+				g.bitmap_dimensions[1],
+				std::bit_cast<u32>(g.bitmap_bearings[0]),
+				std::bit_cast<u32>(g.bitmap_bearings[1])
+			};
+
+			ctx.write32<std::endian::little>(reinterpret_cast<const std::byte*>(metrics), std::size(metrics));
+			ctx.write32<std::endian::little>(reinterpret_cast<const std::byte*>(bitmap_header), std::size(bitmap_header));
+			ctx.write8(g.bitmap_data.get(), g.bitmap_dimensions[0] * g.bitmap_dimensions[1]);
+		}
+	}
+
+	/// Deserializes a font cache.
+	/// @param[out] cache Font cache to deserialize.
+	/// @param[in,out] ctx Deserialize context.
+	/// @throw deserialize_error Read error.
+	template <>
+	void deserializer<type::font_cache>::deserialize(type::font_cache& cache, deserialize_context& ctx)
+	{
+		u32 header[5];
+		ctx.read32<std::endian::little>(reinterpret_cast<std::byte*>(header), std::size(header));
+		if (header[0] != font_cache_magic)
+		{
+			throw deserialize_error("Invalid font cache file.");
+		}
+		if (header[1] != type::font_cache_version)
+		{
+			throw deserialize_error(std::format("Unsupported font cache format (version {}).", header[1]));
+		}
+
+		cache.texture_dimensions = {header[2], header[3]};
+		ctx.read64<std::endian::little>(reinterpret_cast<std::byte*>(&cache.key), 1);
+
+		// Each glyph has at least 13 words of metrics and bitmap header
+		if (header[4] > (ctx.size() - ctx.tell()) / (13 * sizeof(u32)))
+		{
+			throw deserialize_error("Font cache file truncated.");
+		}
+
+		cache.glyphs.clear();
+		cache.glyphs.resize(header[4]);
+		for (auto& [code, g]: cache.glyphs)
+		{
+			float metrics[8];
+			u32 bitmap_header[5];
+			ctx.read32<std::endian::little>(reinterpret_cast<std::byte*>(metrics), std::size(metrics));
+			ctx.read32<std::endian::little>(reinterpret_cast<std::byte*>(bitmap_header), std::size(bitmap_header));
+
+			g.dimensions = {metrics[0], metrics[1]};
+			g.horizontal_bearings = {metrics[2], metrics[3]};
+			g.horizontal_advance = metrics[4];
+			g.vertical_bearings = {metrics[5], metrics[6]};
+			g.vertical_advance = metrics[7];
+
+			code = static_cast<char32_t>(bitmap_header[0]);
+			g.bitmap_dimensions = {bitmap_header[1], bitmap_header[2]};
+			g.bitmap_bearings = {std::bit_cast<i32>(bitmap_header[3]), std::bit_cast<i32>(bitmap_header[4])};
+
+			const usize bitmap_size = static_cast<usize>(g.bitmap_dimensions[0]) * g.bitmap_dimensions[1];
+			if (bitmap_size > ctx.size() - ctx.tell())
+			{
+				throw deserialize_error("Font cache file truncated.");
+			}
+
+			g.bitmap_data = std::make_unique<std::byte[]>(bitmap_size);
+			ctx.read8(g.bitmap_data.get(), bitmap_size);
+		}
+	}
+
+	template <>
+	std::unique_ptr<type::font_cache> resource_loader<type::font_cache>::load(resource_manager&, std::shared_ptr<deserialize_context> ctx)
+	{
+		auto resource = std::make_unique<type::font_cache>();
+
+		deserializer<type::font_cache>().deserialize(*resource, *ctx);
+
+		return resource;
+	}
+}
@@ -0,0 +1,31 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <engine/type/glyph.hpp>
+#include <engine/math/vector.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <utility>
+#include <vector>
+
+namespace engine::type
+{
+	/// Version of the font cache format. Incrementing the version invalidates all existing font caches.
+	inline constexpr u32 font_cache_version = 1;
+
+	/// Rasterized glyphs of a font, which can be saved to disk and imported into a font to skip glyph rasterization.
+	/// @see font::export_cache()
+	/// @see font::import_cache()
+	struct font_cache
+	{
+		/// Key identifying the typeface, size, and rendering settings of the font.
+		u64 key{};
+
+		/// Dimensions of the font texture.
+		math::uvec2 texture_dimensions{};
+
+		/// Cached glyphs, paired with their UTF-32 character codes.
+		std::vector<std::pair<char32_t, glyph>> glyphs;
+	};
+}
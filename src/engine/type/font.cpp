@@ -9,8 +9,14 @@
 #include <engine/gl/texture.hpp>
 #include <engine/geom/rect-pack.hpp>
 #include <engine/utility/sized-types.hpp>
+#include <engine/hash/fnv.hpp>
+#include <algorithm>
 #include <bit>
+#include <cstring>
+#include <format>
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 namespace engine::type
 {
@@ -21,6 +27,29 @@ namespace engine::type
 		{
 			return u32{1} << std::bit_width(n);
 		}
+
+		/// Returns a deep copy of a glyph.
+		[[nodiscard]] glyph copy_glyph(const glyph& g)
+		{
+			glyph copy;
+			copy.dimensions = g.dimensions;
+			copy.horizontal_bearings = g.horizontal_bearings;
+			copy.horizontal_advance = g.horizontal_advance;
+			copy.vertical_bearings = g.vertical_bearings;
+			copy.vertical_advance = g.vertical_advance;
+			copy.bitmap_position = g.bitmap_position;
+			copy.bitmap_dimensions = g.bitmap_dimensions;
+			copy.bitmap_bearings = g.bitmap_bearings;
+
+			const usize bitmap_size = static_cast<usize>(g.bitmap_dimensions[0]) * g.bitmap_dimensions[1];
+			copy.bitmap_data = std::make_unique<std::byte[]>(bitmap_size);
+			if (bitmap_size)
+			{
+				std::memcpy(copy.bitmap_data.get(), g.bitmap_data.get(), bitmap_size);
+			}
+
+			return copy;
+		}
 	}
 
 	font::font(std::shared_ptr<typeface> face, float size, bool sdf):
@@ -61,6 +90,18 @@ namespace engine::type
 		// Init glyph pack
 		const auto& texture_dimensions = m_texture->get_image_view()->get_image()->get_dimensions();
 		m_glyph_pack.resize({texture_dimensions[0], texture_dimensions[1]});
+	
+		// Generate cache key
+		const auto cache_key_string = std::format
+		(
+			"{}\n{}\n{}\n{}\n{}",
+			m_typeface->get_family_name(),
+			m_typeface->get_style_name(),
+			m_size,
+			m_sdf,
+			font_cache_version
+		);
+		m_cache_key = static_cast<u64>(hash::fnv1a64<char>(cache_key_string));
 	}
 
 	usize font::cache_glyph(char32_t code)
@@ -70,11 +111,20 @@ namespace engine::type
 
 	usize font::cache_glyphs(char32_t first, char32_t last)
 	{
-		std::vector<glyph*> cached_glyphs;
-		bool repack = false;
+		std::u32string text;
+		for (auto code = first; code <= last && code >= first; ++code)
+		{
+			text.push_back(code);
+		}
 	
-		// Load glyphs
-		for (auto code = first; code <= last; ++code)
+		return cache_glyphs(text);
+	}
+
+	usize font::cache_glyphs(std::u32string_view text)
+	{
+		// Find unique uncached glyphs, reserving glyph map entries for them
+		std::vector<char32_t> codes;
+		for (auto code: text)
 		{
 			// Check if typeface contains glyph for the given character code
 			if (!m_typeface->has_glyph(code))
@@ -84,125 +134,47 @@ namespace engine::type
 			}
 		
 			// Ignore glyph if already cached
-			if (auto it = m_glyph_map.find(code); it != m_glyph_map.end())
-			{
-				continue;
-			}
-		
-			// Load glyph from typeface and insert into glyph map
-			auto result = m_glyph_map.emplace(code, m_typeface->get_glyph(code, m_size, m_sdf));
-			if (result.second)
+			if (m_glyph_map.try_emplace(code).second)
 			{
-				// Append pointer to glyph to vector of newly-cached glyphs
-				auto g = cached_glyphs.emplace_back(&result.first->second);
-			
-				// Attempt to pack glyph
-				if (!repack)
-				{
-					if (auto node = m_glyph_pack.insert({g->bitmap_dimensions[0], g->bitmap_dimensions[1]}))
-					{
-						// Update texture coordinates of glyph
-						g->bitmap_position[0] = node->bounds.min.x();
-						g->bitmap_position[1] = node->bounds.min.y();
-					}
-					else
-					{
-						const auto& texture_dimensions = m_texture->get_image_view()->get_image()->get_dimensions();
-						log_trace
-						(
-							"Failed to pack glyph for U+{:X} into {}x{} texture",
-							static_cast<u32>(code),
-							texture_dimensions[0],
-							texture_dimensions[1]
-						);
-					
-						// Glyph pack failed, repack later
-						repack = true;
-					}
-				}
+				codes.emplace_back(code);
 			}
 		}
 	
-		if (!repack)
+		if (codes.empty())
 		{
-			// Write glyph bitmaps to font texture
-			write_bitmaps(cached_glyphs);
+			return 0;
 		}
-		else
+	
+		// Load glyphs from typeface
+		std::vector<glyph> glyphs(codes.size());
+		try
 		{
-			// Resize texture and repack all glyphs
-			repack_glyphs();
+			m_typeface->get_glyphs(codes, m_size, m_sdf, glyphs);
 		}
-	
-		return cached_glyphs.size();
-	}
-
-	usize font::cache_glyphs(std::u32string_view text)
-	{
-		std::vector<glyph*> cached_glyphs;
-		bool repack = false;
-	
-		// Load glyphs
-		for (auto code: text)
+		catch (...)
 		{
-			// Check if typeface contains glyph for the given character code
-			if (!m_typeface->has_glyph(code))
-			{
-				// Glyph not found, use missing glyph (character code 0)
-				code = 0;
-			}
-		
-			// Ignore glyph if already cached
-			if (auto it = m_glyph_map.find(code); it != m_glyph_map.end())
+			for (auto code: codes)
 			{
-				continue;
+				m_glyph_map.erase(code);
 			}
 		
-			// Load glyph from typeface and insert into glyph map
-			auto result = m_glyph_map.emplace(code, m_typeface->get_glyph(code, m_size, m_sdf));
-			if (result.second)
-			{
-				// Append pointer to glyph to vector of newly-cached glyphs
-				auto g = cached_glyphs.emplace_back(&result.first->second);
-			
-				// Attempt to pack glyph
-				if (!repack)
-				{
-					if (auto node = m_glyph_pack.insert({g->bitmap_dimensions[0], g->bitmap_dimensions[1]}))
-					{
-						// Update texture coordinates of glyph
-						g->bitmap_position[0] = node->bounds.min.x();
-						g->bitmap_position[1] = node->bounds.min.y();
-					}
-					else
-					{
-						const auto& texture_dimensions = m_texture->get_image_view()->get_image()->get_dimensions();
-						log_trace
-						(
-							"Failed to pack glyph for U+{:X} into {}x{} texture",
-							static_cast<u32>(code),
-							texture_dimensions[0],
-							texture_dimensions[1]
-						);
-					
-						// Glyph pack failed, repack later
-						repack = true;
-					}
-				}
-			}
+			throw;
 		}
 	
-		if (!repack)
-		{
-			// Write glyph bitmaps to font texture
-			write_bitmaps(cached_glyphs);
-		}
-		else
+		m_rasterized_glyph_count += codes.size();
+	
+		// Move glyphs into glyph map
+		std::vector<glyph*> cached_glyphs(codes.size());
+		for (usize i = 0; i < codes.size(); ++i)
 		{
-			// Resize texture and repack all glyphs
-			repack_glyphs();
+			auto& g = m_glyph_map[codes[i]];
+			g = std::move(glyphs[i]);
+			cached_glyphs[i] = &g;
 		}
 	
+		// Pack glyphs and write them to the font texture
+		pack_glyphs(cached_glyphs);
+	
 		return cached_glyphs.size();
 	}
 
@@ -236,6 +208,123 @@ namespace engine::type
 		return m_typeface->get_kerning(m_size, first, second);
 	}
 
+	math::uvec2 font::get_texture_dimensions() const
+	{
+		const auto& dimensions = m_texture->get_image_view()->get_image()->get_dimensions();
+		return {dimensions[0], dimensions[1]};
+	}
+
+	font_cache font::export_cache() const
+	{
+		font_cache cache;
+		cache.key = m_cache_key;
+	
+		const auto& texture_dimensions = m_texture->get_image_view()->get_image()->get_dimensions();
+		cache.texture_dimensions = {texture_dimensions[0], texture_dimensions[1]};
+	
+		cache.glyphs.reserve(m_glyph_map.size());
+		for (const auto& [code, g]: m_glyph_map)
+		{
+			cache.glyphs.emplace_back(code, copy_glyph(g));
+		}
+	
+		return cache;
+	}
+
+	usize font::import_cache(const font_cache& cache)
+	{
+		if (cache.key != m_cache_key)
+		{
+			throw std::invalid_argument("Font cache key mismatch.");
+		}
+	
+		// Enlarge font texture once, up front, to the size of the texture from which the cache was exported
+		const auto& texture_dimensions = m_texture->get_image_view()->get_image()->get_dimensions();
+		const usize cache_texture_area = static_cast<usize>(cache.texture_dimensions[0]) * cache.texture_dimensions[1];
+		if (cache_texture_area > static_cast<usize>(texture_dimensions[0]) * texture_dimensions[1])
+		{
+			grow_texture(cache_texture_area);
+		}
+	
+		// Copy uncached glyphs into glyph map
+		std::vector<glyph*> imported_glyphs;
+		imported_glyphs.reserve(cache.glyphs.size());
+		for (const auto& [code, cached_glyph]: cache.glyphs)
+		{
+			if (auto [it, inserted] = m_glyph_map.try_emplace(code); inserted)
+			{
+				it->second = copy_glyph(cached_glyph);
+				imported_glyphs.emplace_back(&it->second);
+			}
+		}
+	
+		// Pack glyphs and write them to the font texture
+		pack_glyphs(imported_glyphs);
+	
+		return imported_glyphs.size();
+	}
+
+	void font::pack_glyphs(std::span<glyph*> glyphs)
+	{
+		if (glyphs.empty())
+		{
+			return;
+		}
+	
+		// Pack tallest glyphs first
+		std::sort
+		(
+			glyphs.begin(),
+			glyphs.end(),
+			[](const glyph* a, const glyph* b)
+			{
+				return a->bitmap_dimensions[1] > b->bitmap_dimensions[1];
+			}
+		);
+	
+		// Enlarge font texture up front if the glyphs can't possibly fit
+		usize glyph_area = 0;
+		for (auto g: glyphs)
+		{
+			glyph_area += static_cast<usize>(g->bitmap_dimensions[0]) * g->bitmap_dimensions[1];
+		}
+		m_packed_area += glyph_area;
+	
+		const auto& texture_dimensions = m_texture->get_image_view()->get_image()->get_dimensions();
+		if (m_packed_area > static_cast<usize>(texture_dimensions[0]) * texture_dimensions[1])
+		{
+			grow_texture(m_packed_area);
+		}
+	
+		// Pack glyphs, enlarging the font texture when full
+		for (auto g: glyphs)
+		{
+			for (;;)
+			{
+				if (auto node = m_glyph_pack.insert({g->bitmap_dimensions[0], g->bitmap_dimensions[1]}))
+				{
+					// Update texture coordinates of glyph
+					g->bitmap_position[0] = node->bounds.min.x();
+					g->bitmap_position[1] = node->bounds.min.y();
+					break;
+				}
+			
+				const auto& dimensions = m_texture->get_image_view()->get_image()->get_dimensions();
+				log_trace
+				(
+					"Failed to pack glyph into {}x{} texture",
+					dimensions[0],
+					dimensions[1]
+				);
+			
+				grow_texture(static_cast<usize>(dimensions[0]) * dimensions[1] + 1);
+			}
+		}
+	
+		// Write glyph bitmaps to font texture
+		write_bitmaps(glyphs);
+	}
+
 	void font::write_bitmaps(std::span<glyph*> glyphs)
 	{
 		for (auto g: glyphs)
@@ -255,19 +344,15 @@ namespace engine::type
 		}
 	}
 
-	void font::repack_glyphs()
+	void font::grow_texture(usize min_area)
 	{
 		// Get font texture dimensions
 		const auto old_texture_dimensions = m_texture->get_image_view()->get_image()->get_dimensions();
 	
-		// Init new dimensions of font texture
+		// Determine new dimensions of font texture
 		auto new_texture_dimensions = old_texture_dimensions;
-	
-		// Pack glyphs
-		bool packed = false;
 		do
 		{
-			// Determine new dimensions of font texture
 			if (new_texture_dimensions[0] > new_texture_dimensions[1])
 			{
 				new_texture_dimensions[1] = next_power_of_two(new_texture_dimensions[1]);
@@ -276,54 +361,8 @@ namespace engine::type
 			{
 				new_texture_dimensions[0] = next_power_of_two(new_texture_dimensions[0]);
 			}
-		
-			log_trace
-			(
-				"Repacking {} glyphs into {}x{} texture...",
-				m_glyph_map.size(),
-				new_texture_dimensions[0],
-				new_texture_dimensions[1]
-			);
-		
-			// Resize glyph pack
-			m_glyph_pack.resize({new_texture_dimensions[0], new_texture_dimensions[1]});
-		
-			// Attempt to pack glyphs
-			packed = true;
-			for (auto it = m_glyph_map.begin(); it != m_glyph_map.end(); ++it)
-			{
-				// Pack glyph
-				if (auto pack_node = m_glyph_pack.insert({it->second.bitmap_dimensions[0], it->second.bitmap_dimensions[1]}))
-				{
-					// Update texture coordinates of glyph
-					it->second.bitmap_position[0] = pack_node->bounds.min.x();
-					it->second.bitmap_position[1] = pack_node->bounds.min.y();
-				}
-				else
-				{
-					log_trace
-					(
-						"Failed to pack glyph for U+{:X} into {}x{} texture",
-						static_cast<u32>(it->first),
-						new_texture_dimensions[0],
-						new_texture_dimensions[1]
-					);
-				
-					// Glyph pack failed
-					packed = false;
-					break;
-				}
-			}
 		}
-		while (!packed);
-	
-		log_trace
-		(
-			"Packed {} glyphs into {}x{} texture",
-			m_glyph_map.size(),
-			new_texture_dimensions[0],
-			new_texture_dimensions[1]
-		);
+		while (static_cast<usize>(new_texture_dimensions[0]) * new_texture_dimensions[1] < min_area);
 	
 		log_trace
 		(
@@ -334,56 +373,41 @@ namespace engine::type
 			new_texture_dimensions[1]
 		);
 	
-		// Resize font texture image
-		m_texture->set_image_view
-		(
-			std::make_shared<gl::image_view_2d>
-			(
-				std::make_shared<gl::image_2d>
-				(
-					gl::format::r8_unorm,
-					new_texture_dimensions[0],
-					new_texture_dimensions[1]
-				)
-			)
-		);
+		// Enlarge glyph pack, keeping previously packed glyphs in place
+		m_glyph_pack.grow({new_texture_dimensions[0], new_texture_dimensions[1]});
 	
-		log_trace
+		// Copy previously written glyph bitmaps into the enlarged font texture image
+		auto new_image = std::make_shared<gl::image_2d>
 		(
-			"Resized font texture from {}x{} to {}x{}",
-			old_texture_dimensions[0],
-			old_texture_dimensions[1],
+			gl::format::r8_unorm,
 			new_texture_dimensions[0],
 			new_texture_dimensions[1]
 		);
-	
-		log_trace
+		m_texture->get_image_view()->get_image()->copy
 		(
-			"Writing {} glyphs to font texture...",
-			m_glyph_map.size()
+			0,
+			0,
+			0,
+			0,
+			*new_image,
+			0,
+			0,
+			0,
+			0,
+			old_texture_dimensions[0],
+			old_texture_dimensions[1],
+			1
 		);
 	
-		// Write glyph bitmaps to font texture image
-		for (auto it = m_glyph_map.begin(); it != m_glyph_map.end(); ++it)
-		{
-			m_texture->get_image_view()->get_image()->write
-			(
-				0,
-				it->second.bitmap_position[0],
-				it->second.bitmap_position[1],
-				0,
-				it->second.bitmap_dimensions[0],
-				it->second.bitmap_dimensions[1],
-				1,
-				m_texture->get_image_view()->get_image()->get_format(),
-				{it->second.bitmap_data.get(), it->second.bitmap_dimensions[0] * it->second.bitmap_dimensions[1]}
-			);
-		}
+		m_texture->set_image_view(std::make_shared<gl::image_view_2d>(std::move(new_image)));
 	
 		log_trace
 		(
-			"Wrote {} glyphs to font texture",
-			m_glyph_map.size()
+			"Resized font texture from {}x{} to {}x{}",
+			old_texture_dimensions[0],
+			old_texture_dimensions[1],
+			new_texture_dimensions[0],
+			new_texture_dimensions[1]
 		);
 	
 		// Generate font texture resized event
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <engine/type/glyph.hpp>
+#include <engine/type/font-cache.hpp>
 #include <engine/event/publisher.hpp>
 #include <engine/math/vector.hpp>
 #include <engine/geom/rect-pack.hpp>
@@ -92,6 +93,7 @@ namespace engine::type
 		/// Caches all glyphs required to render a string of text.
 		/// @param text UTF-32 text.
 		/// @return Number of newly-cached glyphs.
+		/// @note Glyphs are rasterized concurrently if supported by the typeface. When the font texture is full it is enlarged, and only newly-cached glyphs are written to it.
 		/// @warning Font texture view and texture image may be reconstructed.
 		/// @warning Texture coordinates of pre-cached glyphs may be modified.
 		usize cache_glyphs(std::u32string_view text);
@@ -115,6 +117,35 @@ namespace engine::type
 		/// @return Kerning offset, in pixels.
 		[[nodiscard]] math::fvec2 get_kerning(char32_t first, char32_t second) const;
 	
+		/// Returns the number of glyphs rasterized by the typeface since the font was constructed, excluding imported glyphs.
+		[[nodiscard]] inline constexpr usize get_rasterized_glyph_count() const noexcept
+		{
+			return m_rasterized_glyph_count;
+		}
+	
+		/// @}
+	
+		/// @name Cache
+		/// @{
+	
+		/// Exports all cached glyphs.
+		/// @return Font cache containing copies of all cached glyphs.
+		[[nodiscard]] font_cache export_cache() const;
+	
+		/// Imports glyphs from a font cache, skipping rasterization.
+		/// @param cache Font cache exported from a font with the same cache key.
+		/// @return Number of newly-cached glyphs.
+		/// @exception std::invalid_argument Font cache key mismatch.
+		/// @warning Font texture view and texture image may be reconstructed.
+		/// @warning Texture coordinates of pre-cached glyphs may be modified.
+		usize import_cache(const font_cache& cache);
+	
+		/// Returns a key which identifies the typeface, size, and rendering settings of the font, and the font cache format version.
+		[[nodiscard]] inline constexpr u64 get_cache_key() const noexcept
+		{
+			return m_cache_key;
+		}
+	
 		/// @}
 	
 		/// Returns the typeface to which the font belongs.
@@ -135,6 +166,9 @@ namespace engine::type
 			return m_texture;
 		}
 	
+		/// Returns the dimensions of the font texture, in pixels.
+		[[nodiscard]] math::uvec2 get_texture_dimensions() const;
+
 		/// Returns the channel through which font texture resized events are published.
 		[[nodiscard]] inline auto& get_texture_resized_channel() noexcept
 		{
@@ -142,12 +176,17 @@ namespace engine::type
 		}
 	
 	private:
+		/// Packs glyph bitmaps into the font texture, enlarging the texture as necessary, then writes them to the texture.
+		/// @param glyphs Newly-cached glyphs.
+		void pack_glyphs(std::span<glyph*> glyphs);
+	
 		/// Writes glyph bitmaps to the font texture.
 		/// @param glyphs Glyphs for which bitmaps should be written.
 		void write_bitmaps(std::span<glyph*> glyphs);
 	
-		/// Resizes the font texture size and repacks glyph bitmaps.
-		void repack_glyphs();
+		/// Enlarges the font texture, preserving the positions and bitmaps of cached glyphs.
+		/// @param min_area Minimum area of the enlarged texture, in pixels.
+		void grow_texture(usize min_area);
 	
 		std::shared_ptr<typeface> m_typeface;
 		float m_size{};
@@ -156,6 +195,9 @@ namespace engine::type
 		std::shared_ptr<gl::texture_2d> m_texture;
 		std::unordered_map<char32_t, glyph> m_glyph_map;
 		geom::rect_pack<u32> m_glyph_pack;
+		usize m_packed_area{};
+		usize m_rasterized_glyph_count{};
+		u64 m_cache_key{};
 		event::publisher<font_texture_resized_event> m_texture_resized_publisher;
 	};
 }
@@ -10,17 +10,98 @@
 #include <engine/debug/log.hpp>
 #include <engine/utility/sized-types.hpp>
 #include <engine/math/functions.hpp>
+#include <algorithm>
+#include <exception>
 #include <format>
 #include <memory>
 #include <stdexcept>
+#include <thread>
 #include <utility>
 
 namespace engine::type
 {
-	ft_typeface::ft_typeface(FT_Library ft_library, FT_Face ft_face, std::unique_ptr<std::byte[]> file_buffer):
+	namespace
+	{
+		/// Minimum number of glyphs rasterized by each glyph rasterization thread.
+		constexpr usize min_glyphs_per_thread = 32;
+
+		/// Maximum number of glyph rasterization threads, including the calling thread.
+		constexpr usize max_thread_count = 8;
+
+		/// Sets the pixel size of a FreeType face, if changed.
+		/// @param ft_face FreeType face.
+		/// @param[in,out] face_size Current pixel size of the face.
+		/// @param size New pixel size of the face.
+		void set_pixel_size(FT_Face ft_face, float& face_size, float size)
+		{
+			if (face_size != size)
+			{
+				if (const FT_Error error = FT_Set_Pixel_Sizes(ft_face, 0, static_cast<FT_UInt>(math::round(size))))
+				{
+					throw std::runtime_error(std::format("FreeType failed to set face size (error code \"{}\")", error));
+				}
+			
+				face_size = size;
+			}
+		}
+
+		/// Loads and renders a glyph from a FreeType face.
+		/// @param ft_face FreeType face, sized to the font size.
+		/// @param code UTF-32 character code of the glyph.
+		/// @param sdf `true` to render a signed distance field (SDF) glyph bitmap, `false` otherwise.
+		/// @return Loaded glyph.
+		[[nodiscard]] glyph load_glyph(FT_Face ft_face, char32_t code, bool sdf)
+		{
+			// Get index of glyph from character code
+			const FT_UInt glyph_index = FT_Get_Char_Index(ft_face, static_cast<FT_ULong>(code));
+		
+			// Determine glyph load flags
+			FT_Int32 ft_load_flags = FT_LOAD_RENDER;
+			if (sdf)
+			{
+				ft_load_flags |= FT_LOAD_TARGET_(FT_RENDER_MODE_SDF);
+			}
+			else
+			{
+				ft_load_flags |= FT_LOAD_TARGET_NORMAL;
+			}
+		
+			// Load glyph and render bitmap
+			if (const FT_Error error = FT_Load_Glyph(ft_face, glyph_index, ft_load_flags))
+			{
+				throw std::runtime_error(std::format("FreeType failed to load glyph (error code \"{}\")", error));
+			}
+		
+			// Allocate glyph
+			glyph g;
+		
+			// Calculate glyph metrics, in pixels
+			g.dimensions[0] = ft_face->glyph->metrics.width / 64.0f;
+			g.dimensions[1] = ft_face->glyph->metrics.height / 64.0f;
+			g.horizontal_bearings[0] = ft_face->glyph->metrics.horiBearingX / 64.0f;
+			g.horizontal_bearings[1] = ft_face->glyph->metrics.horiBearingY / 64.0f;
+			g.horizontal_advance = ft_face->glyph->metrics.horiAdvance / 64.0f;
+			g.vertical_bearings[0] = ft_face->glyph->metrics.vertBearingX / 64.0f;
+			g.vertical_bearings[1] = ft_face->glyph->metrics.vertBearingY / 64.0f;
+			g.vertical_advance = ft_face->glyph->metrics.vertAdvance / 64.0f;
+			g.bitmap_dimensions[0] = static_cast<u32>(ft_face->glyph->bitmap.width);
+			g.bitmap_dimensions[1] = static_cast<u32>(ft_face->glyph->bitmap.rows);
+			g.bitmap_bearings[0] = static_cast<i32>(ft_face->glyph->bitmap_left);
+			g.bitmap_bearings[1] = static_cast<i32>(ft_face->glyph->bitmap_top);
+		
+			// Allocate and copy glyph bitmap
+			g.bitmap_data = std::make_unique<std::byte[]>(g.bitmap_dimensions[0] * g.bitmap_dimensions[1]);
+			std::memcpy(g.bitmap_data.get(), ft_face->glyph->bitmap.buffer, g.bitmap_dimensions[0] * g.bitmap_dimensions[1]);
+		
+			return g;
+		}
+	}
+
+	ft_typeface::ft_typeface(FT_Library ft_library, FT_Face ft_face, std::unique_ptr<std::byte[]> file_buffer, usize file_size):
 		m_ft_library(ft_library),
 		m_ft_face(ft_face),
-		m_file_buffer{std::move(file_buffer)}
+		m_file_buffer{std::move(file_buffer)},
+		m_file_size(file_size)
 	{
 		m_family_name = m_ft_face->family_name;
 		m_style_name = m_ft_face->style_name;
@@ -45,6 +126,12 @@ namespace engine::type
 
 	ft_typeface::~ft_typeface()
 	{
+		for (auto& worker: m_worker_faces)
+		{
+			FT_Done_Face(worker.ft_face);
+			FT_Done_FreeType(worker.ft_library);
+		}
+	
 		FT_Done_Face(m_ft_face);
 		FT_Done_FreeType(m_ft_library);
 	}
@@ -78,48 +165,94 @@ namespace engine::type
 		// Set font size
 		set_face_pixel_size(size);
 	
-		// Get index of glyph from character code
-		const FT_UInt glyph_index = FT_Get_Char_Index(m_ft_face, static_cast<FT_ULong>(code));
+		return load_glyph(m_ft_face, code, sdf);
+	}
+
+	void ft_typeface::get_glyphs(std::span<const char32_t> codes, float size, bool sdf, std::span<glyph> glyphs) const
+	{
+		// Determine number of rasterization threads
+		const usize thread_count = std::min
+		({
+			max_thread_count,
+			static_cast<usize>(std::max(std::thread::hardware_concurrency(), 1u)),
+			std::max(codes.size() / min_glyphs_per_thread, usize{1})
+		});
+	
+		// Set font size
+		set_face_pixel_size(size);
+	
+		if (thread_count == 1)
+		{
+			for (usize i = 0; i < codes.size(); ++i)
+			{
+				glyphs[i] = load_glyph(m_ft_face, codes[i], sdf);
+			}
+		
+			return;
+		}
 	
-		// Determine glyph load flags
-		FT_Int32 ft_load_flags = FT_LOAD_RENDER;
-		if (sdf)
+		// FreeType faces can't be shared between threads, so open one face per worker thread from the shared file buffer
+		while (m_worker_faces.size() < thread_count - 1)
 		{
-			ft_load_flags |= FT_LOAD_TARGET_(FT_RENDER_MODE_SDF);
+			worker_face worker;
+			if (const FT_Error error = FT_Init_FreeType(&worker.ft_library))
+			{
+				throw std::runtime_error(std::format("Failed to init FreeType library (error code \"{}\")", error));
+			}
+		
+			if (const FT_Error error = FT_New_Memory_Face(worker.ft_library, reinterpret_cast<const FT_Byte*>(m_file_buffer.get()), static_cast<FT_Long>(m_file_size), 0, &worker.ft_face))
+			{
+				FT_Done_FreeType(worker.ft_library);
+				throw std::runtime_error(std::format("Failed to load FreeType face (error code \"{}\")", error));
+			}
+		
+			m_worker_faces.emplace_back(worker);
 		}
-		else
+	
+		// Rasterize a contiguous range of glyphs on each thread
+		std::vector<std::exception_ptr> exceptions(thread_count);
+		auto thread_worker = [&](usize thread_index, FT_Face ft_face, float& face_size)
+		{
+			const usize begin = codes.size() * thread_index / thread_count;
+			const usize end = codes.size() * (thread_index + 1) / thread_count;
+		
+			try
+			{
+				set_pixel_size(ft_face, face_size, size);
+				for (usize i = begin; i < end; ++i)
+				{
+					glyphs[i] = load_glyph(ft_face, codes[i], sdf);
+				}
+			}
+			catch (...)
+			{
+				exceptions[thread_index] = std::current_exception();
+			}
+		};
+	
+		std::vector<std::thread> threads;
+		threads.reserve(thread_count - 1);
+		for (usize i = 1; i < thread_count; ++i)
 		{
-			ft_load_flags |= FT_LOAD_TARGET_NORMAL;
+			auto& worker = m_worker_faces[i - 1];
+			threads.emplace_back(thread_worker, i, worker.ft_face, std::ref(worker.face_size));
 		}
 	
-		// Load glyph and render bitmap
-		if (const FT_Error error = FT_Load_Glyph(m_ft_face, glyph_index, ft_load_flags))
+		thread_worker(0, m_ft_face, m_face_size);
+	
+		for (auto& thread: threads)
 		{
-			throw std::runtime_error(std::format("FreeType failed to load glyph (error code \"{}\")", error));
+			thread.join();
 		}
 	
-		// Allocate glyph
-		glyph g;
-	
-		// Calculate glyph metrics, in pixels
-		g.dimensions[0] = m_ft_face->glyph->metrics.width / 64.0f;
-		g.dimensions[1] = m_ft_face->glyph->metrics.height / 64.0f;
-		g.horizontal_bearings[0] = m_ft_face->glyph->metrics.horiBearingX / 64.0f;
-		g.horizontal_bearings[1] = m_ft_face->glyph->metrics.horiBearingY / 64.0f;
-		g.horizontal_advance = m_ft_face->glyph->metrics.horiAdvance / 64.0f;
-		g.vertical_bearings[0] = m_ft_face->glyph->metrics.vertBearingX / 64.0f;
-		g.vertical_bearings[1] = m_ft_face->glyph->metrics.vertBearingY / 64.0f;
-		g.vertical_advance = m_ft_face->glyph->metrics.vertAdvance / 64.0f;
-		g.bitmap_dimensions[0] = static_cast<u32>(m_ft_face->glyph->bitmap.width);
-		g.bitmap_dimensions[1] = static_cast<u32>(m_ft_face->glyph->bitmap.rows);
-		g.bitmap_bearings[0] = static_cast<i32>(m_ft_face->glyph->bitmap_left);
-		g.bitmap_bearings[1] = static_cast<i32>(m_ft_face->glyph->bitmap_top);
-	
-		// Allocate and copy glyph bitmap
-		g.bitmap_data = std::make_unique<std::byte[]>(g.bitmap_dimensions[0] * g.bitmap_dimensions[1]);
-		std::memcpy(g.bitmap_data.get(), m_ft_face->glyph->bitmap.buffer, g.bitmap_dimensions[0] * g.bitmap_dimensions[1]);
-	
-		return g;
+		// Rethrow the first exception raised by a thread, if any
+		for (const auto& exception: exceptions)
+		{
+			if (exception)
+			{
+				std::rethrow_exception(exception);
+			}
+		}
 	}
 
 	math::fvec2 ft_typeface::get_kerning(float size, char32_t first, char32_t second) const
@@ -153,15 +286,7 @@ namespace engine::type
 
 	void ft_typeface::set_face_pixel_size(float size) const
 	{
-		if (m_face_size != size)
-		{
-			if (const FT_Error error = FT_Set_Pixel_Sizes(m_ft_face, 0, static_cast<FT_UInt>(math::round(size))))
-			{
-				throw std::runtime_error(std::format("FreeType failed to set face size (error code \"{}\")", error));
-			}
-		
-			m_face_size = size;
-		}
+		set_pixel_size(m_ft_face, m_face_size, size);
 	}
 }
 
@@ -189,6 +314,6 @@ namespace engine::resources
 			throw deserialize_error(std::format("Failed to load FreeType face (error code \"{}\")", error));
 		}
 
-		return std::make_unique<type::ft_typeface>(ft_library, ft_face, std::move(file_buffer));
+		return std::make_unique<type::ft_typeface>(ft_library, ft_face, std::move(file_buffer), ctx->size());
 	}
 }
@@ -7,8 +7,10 @@
 #include <freetype/freetype.h>
 #include <engine/type/typeface.hpp>
 #include <engine/math/vector.hpp>
+#include <engine/utility/sized-types.hpp>
 #include <cstddef>
 #include <memory>
+#include <span>
 #include <vector>
 
 namespace engine::type
@@ -22,7 +24,8 @@ namespace engine::type
 		/// @param ft_library Pointer to a FreeType library instance.
 		/// @param ft_face Pointer to the FreeType object instance.
 		/// @param file_buffer File buffer containing FreeType face data.
-		ft_typeface(FT_Library ft_library, FT_Face ft_face, std::unique_ptr<std::byte[]> file_buffer);
+		/// @param file_size Size of the file buffer, in bytes.
+		ft_typeface(FT_Library ft_library, FT_Face ft_face, std::unique_ptr<std::byte[]> file_buffer, usize file_size);
 	
 		/// Destructs a FreeType typeface.
 		~ft_typeface() override;
@@ -30,14 +33,29 @@ namespace engine::type
 		[[nodiscard]] font_metrics get_font_metrics(float size) const override;
 		[[nodiscard]] bool has_glyph(char32_t code) const override;
 		[[nodiscard]] glyph get_glyph(char32_t code, float size, bool sdf) const override;
+	
+		/// @copydoc typeface::get_glyphs
+		/// @details Large groups of glyphs are rasterized concurrently by worker threads, each of which renders through its own FreeType library and face instances.
+		void get_glyphs(std::span<const char32_t> codes, float size, bool sdf, std::span<glyph> glyphs) const override;
+	
 		[[nodiscard]] math::fvec2 get_kerning(float size, char32_t first, char32_t second) const override;
 	
 	private:
+		/// FreeType library and face used by a glyph rasterization worker thread.
+		struct worker_face
+		{
+			FT_Library ft_library{};
+			FT_Face ft_face{};
+			float face_size{-1.0f};
+		};
+	
 		void set_face_pixel_size(float height) const;
 	
 		FT_Library m_ft_library;
 		FT_Face m_ft_face;
 		std::unique_ptr<std::byte[]> m_file_buffer;
+		usize m_file_size{};
 		mutable float m_face_size{-1.0f};
+		mutable std::vector<worker_face> m_worker_faces;
 	};
 }
@@ -0,0 +1,676 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <engine/type/font.hpp>
+#include <engine/type/unicode.hpp>
+#include <engine/geom/primitives/rectangle.hpp>
+#include <engine/math/functions.hpp>
+#include <engine/math/vector.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace engine::type
+{
+	/// Number of floating-point elements per text vertex: two position, two texture coordinate, and four color elements.
+	inline constexpr usize floats_per_text_vertex = 2 + 2 + 4;
+
+	/// Number of vertices per visible character.
+	inline constexpr usize vertices_per_text_character = 6;
+
+	/// Returns `true` if a character produces geometry when rendered, `false` otherwise.
+	/// @param code UTF-32 character code.
+	[[nodiscard]] inline constexpr bool is_visible_character(char32_t code) noexcept
+	{
+		return code != U' ' && code != U'\t' && code != U'\n' && code != U'\r';
+	}
+
+	/// Character of a shaped line of text.
+	struct shaped_glyph
+	{
+		/// UTF-32 character code.
+		char32_t code{};
+
+		/// Position of the upper-left corner of the glyph quad, relative to the line origin, in integer pixels.
+		math::fvec2 position{};
+
+		/// Dimensions of the glyph quad, in integer pixels.
+		math::fvec2 dimensions{};
+
+		/// Position of the glyph bitmap within the font texture, in integer pixels.
+		math::fvec2 texel_position{};
+
+		/// Horizontal pen position after advancing past the glyph.
+		float pen_position{};
+	};
+
+	/// Text layout which generates triangle list vertices for a string of text, and updates them incrementally as the text changes.
+	/// @details Text is shaped one line at a time. Shaped lines are cached by content, and lines which share a prefix with the line they replace only reshape the characters following the prefix. Each line occupies its own range of vertices, so modifying a line leaves the vertices of all other lines untouched. Lines are positioned relative to a moving origin, so lines scrolled off the top of the text do not require the remaining lines to be moved.
+	/// @tparam Font Font type. Must provide `get_metrics()`, `cache_glyphs(std::u32string_view)`, `get_cached_glyph(char32_t)`, `get_kerning(char32_t, char32_t)`, and `get_texture_dimensions()`.
+	template <class Font>
+	class basic_text_layout
+	{
+	public:
+		/// Font type.
+		using font_type = Font;
+
+		/// Half-open range of vertex indices.
+		using vertex_range = std::pair<usize, usize>;
+
+		/// Maximum number of modified vertex ranges, before they are merged into one.
+		static constexpr usize max_modified_ranges = 64;
+
+		/// Maximum number of shaped lines in the shaping cache, before it is cleared.
+		static constexpr usize max_shaping_cache_size = 1024;
+
+		/// Sets the font with which the text is laid out, and lays out the text again.
+		/// @param font Pointer to a font, or `nullptr`.
+		void set_font(font_type* font)
+		{
+			m_font = font;
+			relayout();
+		}
+
+		/// Sets the text color and opacity.
+		/// @param color Text color and opacity.
+		void set_color(const math::fvec4& color)
+		{
+			if (m_color == color)
+			{
+				return;
+			}
+
+			m_color = color;
+
+			for (const auto& l: m_lines)
+			{
+				float* v = m_vertices.data() + l.first_vertex * floats_per_text_vertex + 4;
+				for (usize i = 0; i < l.run->vertex_count; ++i)
+				{
+					std::memcpy(v, m_color.data(), 4 * sizeof(float));
+					v += floats_per_text_vertex;
+				}
+			}
+
+			mark_modified(0, m_vertex_count);
+		}
+
+		/// Sets the text content.
+		/// @param content UTF-8 string of text.
+		void set_content(std::string_view content)
+		{
+			if (m_content == content)
+			{
+				return;
+			}
+
+			m_content = content;
+
+			if (m_font)
+			{
+				update_lines();
+			}
+		}
+
+		/// Discards all shaped lines and lays out the entire text again.
+		void relayout()
+		{
+			m_lines.clear();
+			m_free_slots.clear();
+			m_free_vertex_count = 0;
+			m_vertex_count = 0;
+			m_first_line_number = 0;
+			m_shaping_cache.clear();
+			m_kerning_cache.clear();
+			m_modified_ranges.clear();
+
+			if (m_font)
+			{
+				m_line_advance = math::round(m_font->get_metrics().linespace);
+				m_texture_dimensions = m_font->get_texture_dimensions();
+				update_lines();
+			}
+			else
+			{
+				m_bounds = {{0.0f, 0.0f}, {0.0f, 0.0f}};
+			}
+		}
+
+		/// Updates the texture coordinates of all vertices if the font texture has been resized.
+		void update_texture_coordinates()
+		{
+			if (!m_font || m_font->get_texture_dimensions() == m_texture_dimensions)
+			{
+				return;
+			}
+
+			m_texture_dimensions = m_font->get_texture_dimensions();
+
+			// Glyph bitmaps keep their positions when the font texture grows, so only texture coordinate normalization changes
+			for (usize i = 0; i < m_lines.size(); ++i)
+			{
+				write_line(m_lines[i], m_first_line_number + i);
+			}
+		}
+
+		/// Clears the list of modified vertex ranges.
+		inline void clear_modified_ranges() noexcept
+		{
+			m_modified_ranges.clear();
+		}
+
+		/// Returns the font with which the text is laid out.
+		[[nodiscard]] inline constexpr font_type* get_font() const noexcept
+		{
+			return m_font;
+		}
+
+		/// Returns the text color and opacity.
+		[[nodiscard]] inline constexpr const math::fvec4& get_color() const noexcept
+		{
+			return m_color;
+		}
+
+		/// Returns the text content.
+		[[nodiscard]] inline constexpr const std::string& get_content() const noexcept
+		{
+			return m_content;
+		}
+
+		/// Returns the vertex data. The vertex data may be larger than the number of vertices.
+		/// @details Vertex positions are relative to the layout origin. Unused vertices are degenerate.
+		[[nodiscard]] inline constexpr const std::vector<float>& get_vertices() const noexcept
+		{
+			return m_vertices;
+		}
+
+		/// Returns the number of vertices to be rendered.
+		[[nodiscard]] inline constexpr usize get_vertex_count() const noexcept
+		{
+			return m_vertex_count;
+		}
+
+		/// Returns the ranges of vertices which have been modified since the modified ranges were last cleared.
+		[[nodiscard]] inline constexpr const std::vector<vertex_range>& get_modified_ranges() const noexcept
+		{
+			return m_modified_ranges;
+		}
+
+		/// Returns the translation which must be added to vertex positions to place the baseline of the first line at the origin.
+		[[nodiscard]] inline math::fvec2 get_origin() const noexcept
+		{
+			return {0.0f, static_cast<float>(m_first_line_number) * m_line_advance};
+		}
+
+		/// Returns the bounds of the text, with the baseline of the first line at the origin.
+		[[nodiscard]] inline constexpr const geom::rectangle<float>& get_bounds() const noexcept
+		{
+			return m_bounds;
+		}
+
+		/// Returns the number of lines of text.
+		[[nodiscard]] inline constexpr usize get_line_count() const noexcept
+		{
+			return m_lines.size();
+		}
+
+	private:
+		/// Shaped line of text.
+		struct glyph_run
+		{
+			/// Shaped characters.
+			std::vector<shaped_glyph> glyphs;
+
+			/// Number of vertices of the visible characters.
+			usize vertex_count{0};
+
+			/// Bounds of the visible characters, relative to the line origin.
+			geom::rectangle<float> bounds{{0.0f, 0.0f}, {0.0f, 0.0f}};
+		};
+
+		/// Line of text, and the range of vertices it occupies.
+		struct line
+		{
+			std::string text;
+			std::shared_ptr<const glyph_run> run;
+			usize first_vertex{0};
+			usize vertex_capacity{0};
+		};
+
+		/// Vertex capacities are rounded up to a multiple of this value, so lines can grow in place.
+		static constexpr usize vertex_granularity = 8 * vertices_per_text_character;
+
+		/// Line numbers are rebased once the first line number exceeds this value, to preserve the precision of vertex positions.
+		static constexpr usize max_first_line_number = 4096;
+
+		void update_lines()
+		{
+			// Split content into lines
+			std::vector<std::string_view> new_lines;
+			for (usize begin = 0;;)
+			{
+				const auto end = m_content.find('\n', begin);
+				new_lines.emplace_back(std::string_view{m_content}.substr(begin, end - begin));
+				if (end == std::string::npos)
+				{
+					break;
+				}
+				begin = end + 1;
+			}
+
+			// Detect lines scrolled off the top of the text: most of the remaining lines must match the first new lines, lines which follow are diffed below
+			usize scrolled_line_count = 0;
+			if (!m_lines.empty() && m_lines.front().text != new_lines.front())
+			{
+				for (usize k = 1; k < m_lines.size(); ++k)
+				{
+					if (m_lines[k].text == new_lines.front())
+					{
+						const auto overlap = std::min(m_lines.size() - k, new_lines.size());
+						usize i = 1;
+						while (i < overlap && m_lines[k + i].text == new_lines[i])
+						{
+							++i;
+						}
+
+						if (2 * i >= overlap)
+						{
+							scrolled_line_count = k;
+						}
+
+						break;
+					}
+				}
+			}
+
+			// Determine the range of lines to be replaced, excluding common leading and trailing lines
+			const auto old_line_count = m_lines.size() - scrolled_line_count;
+			usize prefix = 0;
+			while (prefix < std::min(old_line_count, new_lines.size()) && m_lines[scrolled_line_count + prefix].text == new_lines[prefix])
+			{
+				++prefix;
+			}
+			usize suffix = 0;
+			while (suffix < std::min(old_line_count, new_lines.size()) - prefix && m_lines[m_lines.size() - 1 - suffix].text == new_lines[new_lines.size() - 1 - suffix])
+			{
+				++suffix;
+			}
+			const auto old_middle_count = old_line_count - prefix - suffix;
+			const auto new_middle_count = new_lines.size() - prefix - suffix;
+
+			// Cache the glyphs of all lines to be shaped at once
+			std::u32string uncached_text;
+			for (usize i = prefix; i < prefix + new_middle_count; ++i)
+			{
+				if (!m_shaping_cache.contains(std::string{new_lines[i]}))
+				{
+					uncached_text += to_utf32(new_lines[i]);
+				}
+			}
+			if (!uncached_text.empty())
+			{
+				m_font->cache_glyphs(uncached_text);
+				update_texture_coordinates();
+			}
+
+			// Remove lines scrolled off the top of the text
+			for (usize i = 0; i < scrolled_line_count; ++i)
+			{
+				free_vertices(m_lines[i]);
+			}
+			m_lines.erase(m_lines.begin(), m_lines.begin() + scrolled_line_count);
+			m_first_line_number += scrolled_line_count;
+
+			// Replace middle lines, reshaping each new line from the old line in its place
+			for (usize i = new_middle_count; i < old_middle_count; ++i)
+			{
+				free_vertices(m_lines[prefix + i]);
+			}
+			if (old_middle_count > new_middle_count)
+			{
+				m_lines.erase(m_lines.begin() + (prefix + new_middle_count), m_lines.begin() + (prefix + old_middle_count));
+			}
+			else if (new_middle_count > old_middle_count)
+			{
+				m_lines.insert(m_lines.begin() + (prefix + old_middle_count), new_middle_count - old_middle_count, line{});
+			}
+			for (usize i = prefix; i < prefix + new_middle_count; ++i)
+			{
+				auto& l = m_lines[i];
+				l.run = shape(new_lines[i], (i - prefix < old_middle_count) ? l.run.get() : nullptr);
+				l.text = new_lines[i];
+				place_line(l, m_first_line_number + i);
+			}
+
+			// Move trailing lines if the number of preceding lines changed
+			if (new_middle_count != old_middle_count)
+			{
+				for (usize i = prefix + new_middle_count; i < m_lines.size(); ++i)
+				{
+					write_line(m_lines[i], m_first_line_number + i);
+				}
+			}
+
+			// Rebase line numbers, or compact vertices, if necessary
+			if (m_first_line_number > max_first_line_number || (m_free_vertex_count > vertex_granularity * 16 && m_free_vertex_count > m_vertex_count / 2))
+			{
+				compact();
+			}
+
+			update_bounds();
+		}
+
+		[[nodiscard]] std::shared_ptr<const glyph_run> shape(std::string_view text, const glyph_run* previous_run)
+		{
+			auto key = std::string{text};
+			if (auto it = m_shaping_cache.find(key); it != m_shaping_cache.end())
+			{
+				return it->second;
+			}
+
+			const auto text_u32 = to_utf32(text);
+			auto run = std::make_shared<glyph_run>();
+			run->glyphs.reserve(text_u32.size());
+
+			// Reuse the shaped characters of the common prefix of the previous run
+			usize reused_count = 0;
+			if (previous_run)
+			{
+				const auto& previous_glyphs = previous_run->glyphs;
+				while (reused_count < std::min(previous_glyphs.size(), text_u32.size()) && previous_glyphs[reused_count].code == text_u32[reused_count])
+				{
+					run->glyphs.emplace_back(previous_glyphs[reused_count]);
+					++reused_count;
+				}
+			}
+
+			// Shape remaining characters
+			float pen_position = reused_count ? run->glyphs.back().pen_position : 0.0f;
+			char32_t previous_code = reused_count ? text_u32[reused_count - 1] : 0;
+			for (usize i = reused_count; i < text_u32.size(); ++i)
+			{
+				const char32_t code = text_u32[i];
+				auto& g = run->glyphs.emplace_back();
+				g.code = code;
+
+				// Apply kerning
+				if (previous_code)
+				{
+					pen_position += get_kerning(previous_code, code);
+				}
+				previous_code = code;
+
+				if (const auto glyph = m_font->get_cached_glyph(code))
+				{
+					g.position = {math::round(pen_position + glyph->horizontal_bearings[0]), math::round(glyph->horizontal_bearings[1])};
+					g.dimensions = {static_cast<float>(glyph->bitmap_dimensions[0]), static_cast<float>(glyph->bitmap_dimensions[1])};
+					g.texel_position = {static_cast<float>(glyph->bitmap_position[0]), static_cast<float>(glyph->bitmap_position[1])};
+					pen_position += glyph->horizontal_advance;
+				}
+
+				g.pen_position = pen_position;
+			}
+
+			// Count vertices and calculate bounds
+			run->bounds = {{std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity()}, {-std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity()}};
+			for (const auto& g: run->glyphs)
+			{
+				if (is_visible_character(g.code))
+				{
+					run->vertex_count += vertices_per_text_character;
+					run->bounds.extend(g.position);
+					run->bounds.extend(math::fvec2{g.position.x() + g.dimensions.x(), g.position.y() - g.dimensions.y()});
+				}
+			}
+
+			if (m_shaping_cache.size() >= max_shaping_cache_size)
+			{
+				m_shaping_cache.clear();
+			}
+			m_shaping_cache.emplace(std::move(key), run);
+
+			return run;
+		}
+
+		[[nodiscard]] float get_kerning(char32_t first, char32_t second)
+		{
+			const u64 key = (static_cast<u64>(first) << 32) | static_cast<u64>(second);
+			auto it = m_kerning_cache.find(key);
+			if (it == m_kerning_cache.end())
+			{
+				it = m_kerning_cache.emplace(key, m_font->get_kerning(first, second)[0]).first;
+			}
+			return it->second;
+		}
+
+		/// Writes a reshaped line in place if it fits in its vertex range, otherwise moves it to a new vertex range.
+		void place_line(line& l, usize line_number)
+		{
+			if (l.run->vertex_count > l.vertex_capacity)
+			{
+				free_vertices(l);
+				allocate_vertices(l);
+			}
+
+			write_line(l, line_number);
+		}
+
+		void write_line(const line& l, usize line_number)
+		{
+			if (!l.vertex_capacity)
+			{
+				return;
+			}
+
+			const float line_y = -static_cast<float>(line_number) * m_line_advance;
+			const math::fvec2 uv_scale =
+			{
+				1.0f / static_cast<float>(m_texture_dimensions[0]),
+				1.0f / static_cast<float>(m_texture_dimensions[1])
+			};
+
+			float* v = m_vertices.data() + l.first_vertex * floats_per_text_vertex;
+			for (const auto& g: l.run->glyphs)
+			{
+				if (!is_visible_character(g.code))
+				{
+					continue;
+				}
+
+				// Calculate vertex positions
+				math::fvec2 positions[6];
+				positions[0] = {g.position.x(), line_y + g.position.y()};
+				positions[1] = {positions[0].x(), positions[0].y() - g.dimensions.y()};
+				positions[2] = {positions[0].x() + g.dimensions.x(), positions[1].y()};
+				positions[3] = {positions[2].x(), positions[0].y()};
+				positions[4] = positions[0];
+				positions[5] = positions[2];
+
+				// Calculate vertex UVs
+				math::fvec2 uvs[6];
+				uvs[0] = g.texel_position;
+				uvs[1] = {uvs[0].x(), uvs[0].y() + g.dimensions.y()};
+				uvs[2] = {uvs[0].x() + g.dimensions.x(), uvs[1].y()};
+				uvs[3] = {uvs[2].x(), uvs[0].y()};
+				uvs[4] = uvs[0];
+				uvs[5] = uvs[2];
+
+				for (int i = 0; i < 6; ++i)
+				{
+					*(v++) = positions[i].x();
+					*(v++) = positions[i].y();
+					*(v++) = uvs[i].x() * uv_scale.x();
+					*(v++) = uvs[i].y() * uv_scale.y();
+					*(v++) = m_color[0];
+					*(v++) = m_color[1];
+					*(v++) = m_color[2];
+					*(v++) = m_color[3];
+				}
+			}
+
+			// Make unused vertices of the range degenerate
+			std::fill(v, m_vertices.data() + (l.first_vertex + l.vertex_capacity) * floats_per_text_vertex, 0.0f);
+
+			mark_modified(l.first_vertex, l.vertex_capacity);
+		}
+
+		void allocate_vertices(line& l)
+		{
+			const auto capacity = (l.run->vertex_count + vertex_granularity - 1) / vertex_granularity * vertex_granularity;
+			l.vertex_capacity = capacity;
+			if (!capacity)
+			{
+				return;
+			}
+
+			// Reuse first free range which fits
+			for (auto it = m_free_slots.begin(); it != m_free_slots.end(); ++it)
+			{
+				if (it->second >= capacity)
+				{
+					l.first_vertex = it->first;
+					it->first += capacity;
+					it->second -= capacity;
+					if (!it->second)
+					{
+						m_free_slots.erase(it);
+					}
+					m_free_vertex_count -= capacity;
+					return;
+				}
+			}
+
+			// Append range, growing vertex data geometrically
+			l.first_vertex = m_vertex_count;
+			m_vertex_count += capacity;
+			if (m_vertices.size() < m_vertex_count * floats_per_text_vertex)
+			{
+				m_vertices.resize(std::max(m_vertex_count * floats_per_text_vertex, m_vertices.size() * 2));
+			}
+		}
+
+		void free_vertices(line& l)
+		{
+			if (!l.vertex_capacity)
+			{
+				return;
+			}
+
+			std::fill_n(m_vertices.data() + l.first_vertex * floats_per_text_vertex, l.vertex_capacity * floats_per_text_vertex, 0.0f);
+			mark_modified(l.first_vertex, l.vertex_capacity);
+
+			m_free_slots.emplace_back(l.first_vertex, l.vertex_capacity);
+			m_free_vertex_count += l.vertex_capacity;
+			l.vertex_capacity = 0;
+
+			// Release free ranges at the end of the vertex data
+			for (bool released = true; released;)
+			{
+				released = false;
+				for (auto it = m_free_slots.begin(); it != m_free_slots.end(); ++it)
+				{
+					if (it->first + it->second == m_vertex_count)
+					{
+						m_vertex_count = it->first;
+						m_free_vertex_count -= it->second;
+						m_free_slots.erase(it);
+						released = true;
+						break;
+					}
+				}
+			}
+		}
+
+		/// Packs all lines into contiguous vertex ranges and rebases line numbers.
+		void compact()
+		{
+			m_free_slots.clear();
+			m_free_vertex_count = 0;
+			m_vertex_count = 0;
+			m_first_line_number = 0;
+
+			for (usize i = 0; i < m_lines.size(); ++i)
+			{
+				allocate_vertices(m_lines[i]);
+				write_line(m_lines[i], i);
+			}
+		}
+
+		void update_bounds()
+		{
+			m_bounds = {{std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity()}, {-std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity()}};
+			for (usize i = 0; i < m_lines.size(); ++i)
+			{
+				const auto& run = *m_lines[i].run;
+				if (run.vertex_count)
+				{
+					const math::fvec2 offset = {0.0f, -static_cast<float>(i) * m_line_advance};
+					m_bounds.extend(run.bounds.min + offset);
+					m_bounds.extend(run.bounds.max + offset);
+				}
+			}
+
+			if (m_bounds.min.x() > m_bounds.max.x())
+			{
+				m_bounds = {{0.0f, 0.0f}, {0.0f, 0.0f}};
+			}
+		}
+
+		void mark_modified(usize first, usize count)
+		{
+			if (!count)
+			{
+				return;
+			}
+
+			if (!m_modified_ranges.empty() && m_modified_ranges.back().second == first)
+			{
+				m_modified_ranges.back().second += count;
+			}
+			else
+			{
+				m_modified_ranges.emplace_back(first, first + count);
+			}
+
+			// Merge modified ranges if there are too many to upload individually
+			if (m_modified_ranges.size() > max_modified_ranges)
+			{
+				vertex_range merged = m_modified_ranges.front();
+				for (const auto& range: m_modified_ranges)
+				{
+					merged.first = std::min(merged.first, range.first);
+					merged.second = std::max(merged.second, range.second);
+				}
+				m_modified_ranges.assign(1, merged);
+			}
+		}
+
+		font_type* m_font{nullptr};
+		math::fvec4 m_color{1.0f, 1.0f, 1.0f, 1.0f};
+		std::string m_content;
+		std::vector<line> m_lines;
+		usize m_first_line_number{0};
+		float m_line_advance{0.0f};
+		math::uvec2 m_texture_dimensions{1, 1};
+		std::vector<float> m_vertices;
+		usize m_vertex_count{0};
+		std::vector<std::pair<usize, usize>> m_free_slots;
+		usize m_free_vertex_count{0};
+		std::vector<vertex_range> m_modified_ranges;
+		geom::rectangle<float> m_bounds{{0.0f, 0.0f}, {0.0f, 0.0f}};
+		std::unordered_map<std::string, std::shared_ptr<const glyph_run>> m_shaping_cache;
+		std::unordered_map<u64, float> m_kerning_cache;
+	};
+
+	/// Text layout of a font.
+	using text_layout = basic_text_layout<font>;
+}
@@ -6,6 +6,8 @@
 #include <engine/type/font.hpp>
 #include <engine/type/glyph.hpp>
 #include <engine/math/vector.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <span>
 #include <string>
 
 namespace engine::type
@@ -53,6 +55,20 @@ namespace engine::type
 		/// @return Loaded glyph.
 		[[nodiscard]] virtual glyph get_glyph(char32_t code, float size, bool sdf = false) const = 0;
 	
+		/// Loads a group of glyphs.
+		/// @param codes UTF-32 character codes of the glyphs.
+		/// @param size Font size, in pixels.
+		/// @param sdf `true` to render signed distance field (SDF) glyph bitmaps, `false` otherwise.
+		/// @param[out] glyphs Loaded glyphs, one per character code.
+		/// @note Implementations may load glyphs concurrently.
+		virtual void get_glyphs(std::span<const char32_t> codes, float size, bool sdf, std::span<glyph> glyphs) const
+		{
+			for (usize i = 0; i < codes.size(); ++i)
+			{
+				glyphs[i] = get_glyph(codes[i], size, sdf);
+			}
+		}
+	
 		/// @}
 	
 		/// @name Kerning
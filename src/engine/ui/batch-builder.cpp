@@ -0,0 +1,206 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <engine/ui/batch-builder.hpp>
+#include <engine/debug/contract.hpp>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace engine::ui
+{
+	void batch_builder::insert(batch_item& item)
+	{
+		if (m_slot_indices.try_emplace(&item, m_slots.size()).second)
+		{
+			m_slots.emplace_back().item = &item;
+			m_layout_dirty = true;
+		}
+	}
+
+	void batch_builder::erase(batch_item& item)
+	{
+		auto it = m_slot_indices.find(&item);
+		if (it == m_slot_indices.end())
+		{
+			return;
+		}
+
+		// Swap slot with the last slot, then pop it
+		const auto index = it->second;
+		m_slot_indices.erase(it);
+		if (index != m_slots.size() - 1)
+		{
+			m_slots[index] = m_slots.back();
+			m_slot_indices[m_slots[index].item] = index;
+		}
+		m_slots.pop_back();
+
+		m_layout_dirty = true;
+	}
+
+	void batch_builder::invalidate(batch_item& item)
+	{
+		if (m_layout_dirty)
+		{
+			return;
+		}
+
+		auto it = m_slot_indices.find(&item);
+		if (it != m_slot_indices.end() && !m_slots[it->second].dirty)
+		{
+			m_slots[it->second].dirty = true;
+			m_dirty_slots.emplace_back(it->second);
+		}
+	}
+
+	auto batch_builder::build() -> const std::vector<vertex_range>&
+	{
+		m_modified_ranges.clear();
+
+		if (!m_layout_dirty)
+		{
+			for (const auto index: m_dirty_slots)
+			{
+				auto& s = m_slots[index];
+				const auto& item = *s.item;
+
+				// Rebuild entire stream if the item can't be rewritten in place
+				if (item.vertex_count != s.vertex_count || item.depth != s.depth || item.material.get() != s.material || item.visible != s.visible)
+				{
+					m_layout_dirty = true;
+					break;
+				}
+
+				s.dirty = false;
+				if (s.visible && s.vertex_count)
+				{
+					write(s);
+					m_modified_ranges.emplace_back(s.first_vertex, s.first_vertex + s.vertex_count);
+				}
+			}
+
+			if (!m_layout_dirty)
+			{
+				m_dirty_slots.clear();
+
+				// Merge modified ranges if there are too many to upload individually
+				if (m_modified_ranges.size() > max_modified_ranges)
+				{
+					vertex_range merged{std::numeric_limits<usize>::max(), 0};
+					for (const auto& range: m_modified_ranges)
+					{
+						merged.first = std::min(merged.first, range.first);
+						merged.second = std::max(merged.second, range.second);
+					}
+					m_modified_ranges.assign(1, merged);
+				}
+
+				return m_modified_ranges;
+			}
+
+			m_modified_ranges.clear();
+		}
+
+		rebuild();
+
+		if (m_vertex_count)
+		{
+			m_modified_ranges.emplace_back(0, m_vertex_count);
+		}
+
+		return m_modified_ranges;
+	}
+
+	void batch_builder::rebuild()
+	{
+		m_dirty_slots.clear();
+		m_layout_dirty = false;
+
+		// Sort items by depth, then by material
+		for (auto& s: m_slots)
+		{
+			s.dirty = false;
+			s.depth = s.item->depth;
+			s.material = s.item->material.get();
+			s.visible = s.item->visible;
+			s.vertex_count = s.item->vertex_count;
+		}
+		std::sort
+		(
+			m_slots.begin(),
+			m_slots.end(),
+			[](const auto& a, const auto& b)
+			{
+				if (a.depth != b.depth)
+				{
+					return a.depth < b.depth;
+				}
+				return std::less<const render::material*>{}(a.material, b.material);
+			}
+		);
+
+		// Assign vertices to items and merge adjacent items into ranges
+		m_ranges.clear();
+		m_vertex_count = 0;
+		for (usize i = 0; i < m_slots.size(); ++i)
+		{
+			auto& s = m_slots[i];
+			m_slot_indices[s.item] = i;
+
+			if (!s.visible || !s.vertex_count)
+			{
+				continue;
+			}
+
+			s.first_vertex = m_vertex_count;
+			m_vertex_count += s.vertex_count;
+
+			if (m_ranges.empty() || m_ranges.back().material.get() != s.material || m_ranges.back().depth != s.depth)
+			{
+				m_ranges.emplace_back(s.item->material, s.depth, s.first_vertex, 0);
+			}
+			m_ranges.back().vertex_count += s.vertex_count;
+		}
+
+		// Grow vertex data geometrically, to avoid reallocating it each time an item is added
+		const auto vertex_data_size = m_vertex_count * floats_per_batch_vertex;
+		if (m_vertices.size() < vertex_data_size)
+		{
+			m_vertices.resize(std::max(vertex_data_size, m_vertices.size() * 2));
+		}
+
+		// Write vertex data
+		m_bounds = {{std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity()}, {-std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity()}};
+		for (const auto& s: m_slots)
+		{
+			if (s.visible && s.vertex_count)
+			{
+				write(s);
+			}
+		}
+		if (!m_vertex_count)
+		{
+			m_bounds = {{0.0f, 0.0f}, {0.0f, 0.0f}};
+		}
+	}
+
+	void batch_builder::write(const slot& s)
+	{
+		const auto& item = *s.item;
+		debug::precondition(item.vertices.size() >= item.vertex_count * floats_per_batch_vertex);
+
+		const float* src = item.vertices.data();
+		float* dst = m_vertices.data() + s.first_vertex * floats_per_batch_vertex;
+		for (usize i = 0; i < s.vertex_count; ++i)
+		{
+			dst[0] = src[0] + item.translation.x();
+			dst[1] = src[1] + item.translation.y();
+			std::memcpy(dst + 2, src + 2, (floats_per_batch_vertex - 2) * sizeof(float));
+			m_bounds.extend(math::fvec2{dst[0], dst[1]});
+
+			src += floats_per_batch_vertex;
+			dst += floats_per_batch_vertex;
+		}
+	}
+}
@@ -0,0 +1,140 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <engine/render/material.hpp>
+#include <engine/geom/primitives/rectangle.hpp>
+#include <engine/math/vector.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace engine::ui
+{
+	/// Number of floating-point elements per batch vertex: two position, two texture coordinate, and four color elements.
+	inline constexpr usize floats_per_batch_vertex = 2 + 2 + 4;
+
+	/// Geometry of a UI element, rendered as part of a batch.
+	struct batch_item
+	{
+		/// Triangle list vertex data, with two position, two texture coordinate, and four color elements per vertex. Positions are relative to the item translation.
+		std::vector<float> vertices;
+
+		/// Number of vertices in the vertex data.
+		usize vertex_count{0};
+
+		/// Translation of the item.
+		math::fvec2 translation{};
+
+		/// Depth of the item.
+		float depth{0.0f};
+
+		/// Material with which the item is rendered.
+		std::shared_ptr<render::material> material;
+
+		/// `true` if the item should be rendered, `false` otherwise.
+		bool visible{true};
+	};
+
+	/// Range of batched vertices which share a material and depth, and can be rendered with a single draw call.
+	struct batch_range
+	{
+		/// Material with which the range is rendered.
+		std::shared_ptr<render::material> material;
+
+		/// Depth of the range.
+		float depth{0.0f};
+
+		/// Index of the first vertex in the range.
+		usize first_vertex{0};
+
+		/// Number of vertices in the range.
+		usize vertex_count{0};
+	};
+
+	/// Concatenates the geometry of batch items into a single vertex stream, sorted into as few ranges as possible.
+	/// @details Items are grouped by depth and material. Only the geometry of invalidated items is rewritten, unless an invalidated item changes its vertex count, depth, material, or visibility, in which case the entire stream is rebuilt.
+	class batch_builder
+	{
+	public:
+		/// Half-open range of vertex indices.
+		using vertex_range = std::pair<usize, usize>;
+
+		/// Maximum number of modified vertex ranges reported by build(), before they are merged into one.
+		static constexpr usize max_modified_ranges = 64;
+
+		/// Inserts an item into the batch.
+		/// @param item Item to insert. The item must outlive its membership in the batch.
+		void insert(batch_item& item);
+
+		/// Removes an item from the batch.
+		/// @param item Item to remove.
+		void erase(batch_item& item);
+
+		/// Notifies the batch that an item has been modified.
+		/// @param item Modified item.
+		void invalidate(batch_item& item);
+
+		/// Rebuilds the geometry of all invalidated items.
+		/// @return Ranges of vertices which were modified. If many items were modified, their ranges are merged into one.
+		const std::vector<vertex_range>& build();
+
+		/// Returns the batched vertex data. The vertex data may be larger than the number of batched vertices.
+		[[nodiscard]] inline constexpr const auto& get_vertices() const noexcept
+		{
+			return m_vertices;
+		}
+
+		/// Returns the number of batched vertices.
+		[[nodiscard]] inline constexpr usize get_vertex_count() const noexcept
+		{
+			return m_vertex_count;
+		}
+
+		/// Returns the ranges of batched vertices.
+		[[nodiscard]] inline constexpr const auto& get_ranges() const noexcept
+		{
+			return m_ranges;
+		}
+
+		/// Returns the bounds of the batched vertex positions.
+		[[nodiscard]] inline constexpr const auto& get_bounds() const noexcept
+		{
+			return m_bounds;
+		}
+
+		/// Returns the number of items in the batch.
+		[[nodiscard]] inline usize size() const noexcept
+		{
+			return m_slots.size();
+		}
+
+	private:
+		struct slot
+		{
+			batch_item* item{nullptr};
+			usize first_vertex{0};
+			usize vertex_count{0};
+			float depth{0.0f};
+			const render::material* material{nullptr};
+			bool visible{false};
+			bool dirty{false};
+		};
+
+		void rebuild();
+		void write(const slot& s);
+
+		std::vector<slot> m_slots;
+		std::unordered_map<const batch_item*, usize> m_slot_indices;
+		std::vector<usize> m_dirty_slots;
+		std::vector<vertex_range> m_modified_ranges;
+		bool m_layout_dirty{false};
+		std::vector<float> m_vertices;
+		usize m_vertex_count{0};
+		std::vector<batch_range> m_ranges;
+		geom::rectangle<float> m_bounds{{0.0f, 0.0f}, {0.0f, 0.0f}};
+	};
+}
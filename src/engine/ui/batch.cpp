@@ -0,0 +1,156 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <engine/ui/batch.hpp>
+#include <engine/scene/camera.hpp>
+#include <engine/render/vertex-attribute-location.hpp>
+#include <engine/render/context.hpp>
+#include <engine/gl/vertex-input-attribute.hpp>
+#include <engine/math/matrix.hpp>
+#include <algorithm>
+#include <span>
+
+namespace engine::ui
+{
+	namespace
+	{
+		// Batch vertex attributes.
+		constexpr gl::vertex_input_attribute batch_vertex_attributes[3] =
+		{
+			{
+				render::vertex_attribute_location::position,
+				0,
+				gl::format::r32g32_sfloat,
+				0
+			},
+			{
+				render::vertex_attribute_location::uv,
+				0,
+				gl::format::r32g32_sfloat,
+				2 * sizeof(float)
+			},
+			{
+				render::vertex_attribute_location::color,
+				0,
+				gl::format::r32g32b32a32_sfloat,
+				4 * sizeof(float)
+			}
+		};
+
+		// Batch vertex byte stride.
+		constexpr usize batch_vertex_stride = floats_per_batch_vertex * sizeof(float);
+
+		// Appends modified vertex ranges to the pending ranges of a vertex buffer, merging them if there are too many.
+		void append_ranges(std::vector<batch_builder::vertex_range>& pending_ranges, const std::vector<batch_builder::vertex_range>& modified_ranges)
+		{
+			pending_ranges.insert(pending_ranges.end(), modified_ranges.begin(), modified_ranges.end());
+
+			if (pending_ranges.size() > batch_builder::max_modified_ranges)
+			{
+				batch_builder::vertex_range merged = pending_ranges.front();
+				for (const auto& range: pending_ranges)
+				{
+					merged.first = std::min(merged.first, range.first);
+					merged.second = std::max(merged.second, range.second);
+				}
+				pending_ranges.assign(1, merged);
+			}
+		}
+	}
+
+	batch::batch()
+	{
+		// Construct vertex array
+		m_vertex_array = std::make_unique<gl::vertex_array>(batch_vertex_attributes);
+
+		// Construct empty vertex buffers
+		m_vertex_buffers[0] = std::make_unique<gl::vertex_buffer>(gl::buffer_usage::dynamic_draw, 0);
+		m_vertex_buffers[1] = std::make_unique<gl::vertex_buffer>(gl::buffer_usage::dynamic_draw, 0);
+	}
+
+	void batch::render(render::context& ctx) const
+	{
+		update();
+
+		// If the current vertex buffer is out of date, bring the other vertex buffer up to date and swap to it
+		if (!m_pending_ranges[m_buffer_index].empty())
+		{
+			m_buffer_index ^= 1;
+
+			const auto vertex_data = std::as_bytes(std::span{m_builder.get_vertices()});
+			auto& vertex_buffer = *m_vertex_buffers[m_buffer_index];
+			auto& pending_ranges = m_pending_ranges[m_buffer_index];
+
+			if (vertex_buffer.size() < m_builder.get_vertex_count() * batch_vertex_stride)
+			{
+				// Grow vertex buffer to the capacity of the vertex data
+				vertex_buffer.resize(vertex_data);
+			}
+			else
+			{
+				// Upload modified vertices only
+				for (const auto& [first, last]: pending_ranges)
+				{
+					vertex_buffer.write(first * batch_vertex_stride, vertex_data.subspan(first * batch_vertex_stride, (last - first) * batch_vertex_stride));
+				}
+			}
+
+			pending_ranges.clear();
+		}
+
+		const auto layer_mask = get_layer_mask();
+		const auto& near_plane = ctx.camera->get_view_frustum().near();
+		const auto& ranges = m_builder.get_ranges();
+		for (usize i = 0; i < m_operations.size(); ++i)
+		{
+			auto& operation = m_operations[i];
+			operation.vertex_buffer = m_vertex_buffers[m_buffer_index].get();
+			operation.depth = near_plane.distance(math::fvec3{0.0f, 0.0f, ranges[i].depth});
+			operation.layer_mask = layer_mask;
+			ctx.operations.push_back(&operation);
+		}
+	}
+
+	const batch::aabb_type& batch::get_bounds() const noexcept
+	{
+		update();
+		return m_bounds;
+	}
+
+	void batch::update() const
+	{
+		const auto& modified_ranges = m_builder.build();
+		append_ranges(m_pending_ranges[0], modified_ranges);
+		append_ranges(m_pending_ranges[1], modified_ranges);
+
+		const auto& ranges = m_builder.get_ranges();
+		if (modified_ranges.empty() && ranges.size() == m_operations.size())
+		{
+			return;
+		}
+
+		// Rebuild render operations
+		m_operations.resize(ranges.size());
+		for (usize i = 0; i < ranges.size(); ++i)
+		{
+			const auto& range = ranges[i];
+			auto& operation = m_operations[i];
+
+			operation.primitive_topology = gl::primitive_topology::triangle_list;
+			operation.vertex_array = m_vertex_array.get();
+			operation.vertex_offset = 0;
+			operation.vertex_stride = batch_vertex_stride;
+			operation.first_vertex = static_cast<u32>(range.first_vertex);
+			operation.vertex_count = static_cast<u32>(range.vertex_count);
+			operation.first_instance = 0;
+			operation.instance_count = 1;
+			operation.material = range.material;
+			operation.transform = math::translate(math::fvec3{0.0f, 0.0f, range.depth});
+		}
+
+		// Update bounds
+		const auto& bounds = m_builder.get_bounds();
+		m_bounds.min = {bounds.min.x(), bounds.min.y(), ranges.empty() ? 0.0f : ranges.front().depth};
+		m_bounds.max = {bounds.max.x(), bounds.max.y(), ranges.empty() ? 0.0f : ranges.back().depth};
+	}
+}
@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <engine/ui/batch-builder.hpp>
+#include <engine/scene/object.hpp>
+#include <engine/render/operation.hpp>
+#include <engine/gl/vertex-array.hpp>
+#include <engine/gl/vertex-buffer.hpp>
+#include <memory>
+#include <vector>
+
+namespace engine::ui
+{
+	/// Scene object which renders the geometry of UI elements with a shared vertex buffer and one render operation per batch range.
+	/// @details Geometry is rebuilt lazily when the bounds of the batch are queried, so that all modifications made to items during a frame are coalesced. Vertex data is uploaded to one of two vertex buffers in alternation, so that a buffer is not written while the GPU may still be reading it.
+	class batch: public scene::object<batch>
+	{
+	public:
+		/// Constructs a batch.
+		batch();
+
+		/// Destructs a batch.
+		~batch() override = default;
+
+		void render(render::context& ctx) const override;
+
+		/// @copydoc batch_builder::insert()
+		inline void insert(batch_item& item)
+		{
+			m_builder.insert(item);
+		}
+
+		/// @copydoc batch_builder::erase()
+		inline void erase(batch_item& item)
+		{
+			m_builder.erase(item);
+		}
+
+		/// @copydoc batch_builder::invalidate()
+		inline void invalidate(batch_item& item)
+		{
+			m_builder.invalidate(item);
+		}
+
+		[[nodiscard]] const aabb_type& get_bounds() const noexcept override;
+
+	private:
+		void update() const;
+
+		mutable batch_builder m_builder;
+		mutable std::vector<batch_builder::vertex_range> m_pending_ranges[2];
+		mutable usize m_buffer_index{0};
+		mutable aabb_type m_bounds{{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
+		mutable std::vector<render::operation> m_operations;
+		std::unique_ptr<gl::vertex_array> m_vertex_array;
+		std::unique_ptr<gl::vertex_buffer> m_vertex_buffers[2];
+	};
+}
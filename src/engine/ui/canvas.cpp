@@ -6,32 +6,47 @@
 
 namespace engine::ui
 {
+	canvas::canvas()
+	{
+		m_scene.add_object(m_batch);
+	}
+
+	canvas::~canvas()
+	{
+		// Remove children while the canvas can still be notified, so that descendants are removed from the batch before it is destroyed
+		remove_children();
+	}
+
 	void canvas::descendant_added(element& descendant)
 	{
-		// Add descendant to the scene
+		// Add descendant to the scene and batch
 		descendant.add_to_scene(m_scene);
+		descendant.add_to_batch(m_batch);
 
-		// Add all sub-descendants to the scene
+		// Add all sub-descendants to the scene and batch
 		descendant.visit_descendants
 		(
 			[&](element& e)
 			{
 				e.add_to_scene(m_scene);
+				e.add_to_batch(m_batch);
 			}
 		);
 	}
 
 	void canvas::descendant_removed(element& descendant)
 	{
-		// Remove descendant from the scene
+		// Remove descendant from the scene and batch
 		descendant.remove_from_scene(m_scene);
+		descendant.remove_from_batch(m_batch);
 
-		// Remove all sub-descendants from the scene
+		// Remove all sub-descendants from the scene and batch
 		descendant.visit_descendants
 		(
 			[&](element& e)
 			{
 				e.remove_from_scene(m_scene);
+				e.remove_from_batch(m_batch);
 			}
 		);
 	}
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <engine/ui/element.hpp>
+#include <engine/ui/batch.hpp>
 #include <engine/scene/collection.hpp>
 
 namespace engine::ui
@@ -12,8 +13,11 @@ namespace engine::ui
 	class canvas: public element
 	{
 	public:
+		/// Constructs a canvas.
+		canvas();
+
 		/// Destructs a canvas.
-		~canvas() override = default;
+		~canvas() override;
 
 		[[nodiscard]] inline constexpr element_type get_type() const noexcept override
 		{
@@ -32,10 +36,17 @@ namespace engine::ui
 			return m_scene;
 		}
 
+		/// Returns the batch which renders the geometry of the canvas's descendants.
+		[[nodiscard]] inline const auto& get_batch() const noexcept
+		{
+			return m_batch;
+		}
+
 	private:
 		void descendant_added(element& descendant) override;
 		void descendant_removed(element& descendant) override;
 
+		batch m_batch;
 		scene::collection m_scene;
 	};
 }
@@ -380,6 +380,14 @@ namespace engine::ui
 	{
 	}
 
+	void element::add_to_batch(batch&)
+	{
+	}
+
+	void element::remove_from_batch(batch&)
+	{
+	}
+
 	bool element::handle_mouse_moved(const input::mouse_moved_event& event)
 	{
 		if (!m_handle_input)
@@ -14,6 +14,8 @@
 
 namespace engine::ui
 {
+	class batch;
+
 	enum class element_type
 	{
 		/// Unknown element type.
@@ -421,6 +423,8 @@ namespace engine::ui
 
 		virtual void add_to_scene(scene::collection& scene);
 		virtual void remove_from_scene(scene::collection& scene);
+		virtual void add_to_batch(batch& batch);
+		virtual void remove_from_batch(batch& batch);
 
 		virtual bool handle_mouse_moved(const input::mouse_moved_event& event);
 		virtual bool handle_mouse_button_pressed(const input::mouse_button_pressed_event& event);
@@ -2,50 +2,88 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include <engine/ui/image.hpp>
-#include <engine/scene/billboard.hpp>
+#include <engine/ui/batch.hpp>
 
 namespace engine::ui
 {
 	image::image()
 	{
-		m_billboard = std::make_unique<scene::billboard>();
+		// Init quad vertices with white vertex colors
+		m_batch_item.vertex_count = 6;
+		m_batch_item.vertices.assign(m_batch_item.vertex_count * floats_per_batch_vertex, 1.0f);
+		m_batch_item.depth = static_cast<float>(get_depth());
+	}
+
+	image::~image()
+	{
+		if (m_batch)
+		{
+			m_batch->erase(m_batch_item);
+		}
 	}
 
 	void image::set_material(std::shared_ptr<render::material> material)
 	{
-		m_billboard->set_material(std::move(material));
+		m_batch_item.material = std::move(material);
+		invalidate_batch_item();
 	}
 
 	void image::bounds_recalculated()
 	{
 		const auto& bounds = get_bounds();
-		const auto center = bounds.center();
 		const auto size = bounds.size();
 
-		auto transform = m_billboard->get_transform();
-		transform.translation.x() = center.x();
-		transform.translation.y() = center.y();
-		transform.translation.z() = static_cast<float>(get_depth());
-		transform.scale.x() = size.x() * 0.5f;
-		transform.scale.y() = size.y() * 0.5f;
+		// Quad positions and UVs, as two triangles
+		const math::fvec2 corners[6] =
+		{
+			{0.0f, 1.0f},
+			{0.0f, 0.0f},
+			{1.0f, 0.0f},
+			{1.0f, 1.0f},
+			{0.0f, 1.0f},
+			{1.0f, 0.0f}
+		};
+
+		float* v = m_batch_item.vertices.data();
+		for (const auto& corner: corners)
+		{
+			v[0] = corner.x() * size.x();
+			v[1] = corner.y() * size.y();
+			v[2] = corner.x();
+			v[3] = corner.y();
+			v += floats_per_batch_vertex;
+		}
 
-		m_billboard->set_transform(transform);
+		m_batch_item.translation = bounds.min;
+		invalidate_batch_item();
 	}
 
-	void image::add_to_scene(scene::collection& scene)
+	void image::add_to_batch(batch& batch)
 	{
-		scene.add_object(*m_billboard);
+		m_batch = &batch;
+		m_batch->insert(m_batch_item);
 	}
 
-	void image::remove_from_scene(scene::collection& scene)
+	void image::remove_from_batch(batch& batch)
 	{
-		scene.remove_object(*m_billboard);
+		batch.erase(m_batch_item);
+		if (m_batch == &batch)
+		{
+			m_batch = nullptr;
+		}
 	}
 
 	void image::depth_changed()
 	{
-		auto translation = m_billboard->get_translation();
-		translation.z() = static_cast<float>(get_depth());
-		m_billboard->set_translation(translation);
+		m_batch_item.depth = static_cast<float>(get_depth());
+		invalidate_batch_item();
+	}
+
+	void image::invalidate_batch_item()
+	{
+		if (m_batch)
+		{
+			m_batch->invalidate(m_batch_item);
+		}
 	}
 }
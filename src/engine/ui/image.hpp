@@ -4,7 +4,8 @@
 #pragma once
 
 #include <engine/ui/element.hpp>
-#include <engine/scene/billboard.hpp>
+#include <engine/ui/batch-builder.hpp>
+#include <engine/render/material.hpp>
 #include <memory>
 
 namespace engine::ui
@@ -17,7 +18,7 @@ namespace engine::ui
 		image();
 
 		/// Destructs an image.
-		~image() override = default;
+		~image() override;
 
 		[[nodiscard]] inline constexpr element_type get_type() const noexcept override
 		{
@@ -28,17 +29,18 @@ namespace engine::ui
 		/// @param material Image material.
 		void set_material(std::shared_ptr<render::material> material);
 
-		// TODO: set_color() and set_opacity() methods can be added by implementing set_color() in scene::billboard.
-		// The billboard can set the vertex colors rather than a shader uniform.
+		// TODO: set_color() and set_opacity() methods can be added by writing the color to the vertex colors of the batch item.
 
 	protected:
 		void bounds_recalculated() override;
 
 	private:
-		void add_to_scene(scene::collection& scene) override;
-		void remove_from_scene(scene::collection& scene) override;
+		void add_to_batch(batch& batch) override;
+		void remove_from_batch(batch& batch) override;
 		void depth_changed() override;
+		void invalidate_batch_item();
 
-		std::unique_ptr<scene::billboard> m_billboard;
+		batch_item m_batch_item;
+		batch* m_batch{nullptr};
 	};
 }
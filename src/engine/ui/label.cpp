@@ -2,36 +2,69 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include <engine/ui/label.hpp>
-#include <engine/scene/text.hpp>
+#include <engine/ui/batch.hpp>
 #include <engine/math/functions.hpp>
 
 namespace engine::ui
 {
 	label::label()
 	{
-		m_text_object = std::make_unique<scene::text>();
+		m_layout.set_color(m_color);
 	}
 
-	void label::set_text(std::string_view text)
+	label::~label()
 	{
-		m_text_object->set_content(std::move(text));
-		recalculate_min_size();
+		if (m_batch)
+		{
+			m_batch->erase(m_batch_item);
+		}
 	}
 
-	void label::set_font(std::shared_ptr<type::font> font)
+	void label::set_text(std::string_view text)
 	{
-		m_text_object->set_font(std::move(font));
+		if (m_layout.get_content() != text)
+		{
+			m_layout.set_content(text);
+			update_geometry();
+		}
+
 		recalculate_min_size();
 	}
 
-	std::shared_ptr<type::font> label::get_font() const noexcept
+	void label::set_font(std::shared_ptr<type::font> font)
 	{
-		return m_text_object->get_font();
+		if (m_font != font)
+		{
+			m_font = std::move(font);
+
+			if (m_font)
+			{
+				// Regenerate geometry each time font texture is resized, as glyph texture coordinates may have changed
+				m_font_texture_resized_subscription = m_font->get_texture_resized_channel().subscribe
+				(
+					[&](const auto&)
+					{
+						m_layout.update_texture_coordinates();
+						update_geometry();
+					}
+				);
+			}
+			else
+			{
+				m_font_texture_resized_subscription.reset();
+			}
+
+			m_layout.set_font(m_font.get());
+			update_geometry();
+		}
+
+		recalculate_min_size();
 	}
 
 	void label::set_material(std::shared_ptr<render::material> material)
 	{
-		m_text_object->set_material(std::move(material));
+		m_batch_item.material = std::move(material);
+		invalidate_batch_item();
 	}
 
 	void label::set_color(const math::fvec4& color)
@@ -49,7 +82,7 @@ namespace engine::ui
 			}
 			else
 			{
-				m_text_object->set_color({m_color[0], m_color[1], m_color[2], get_effective_opacity()});
+				update_color();
 			}
 		}
 	}
@@ -59,11 +92,6 @@ namespace engine::ui
 		set_color({color[0], color[1], color[2], get_opacity()});
 	}
 
-	const std::string& label::get_text() const noexcept
-	{
-		return m_text_object->get_content();
-	}
-
 	void label::set_text_refresher(std::function<std::string(const label&)> refresher)
 	{
 		m_text_refresher = std::move(refresher);
@@ -77,14 +105,19 @@ namespace engine::ui
 		}
 	}
 
-	void label::add_to_scene(scene::collection& scene)
+	void label::add_to_batch(batch& batch)
 	{
-		scene.add_object(*m_text_object);
+		m_batch = &batch;
+		m_batch->insert(m_batch_item);
 	}
 
-	void label::remove_from_scene(scene::collection& scene)
+	void label::remove_from_batch(batch& batch)
 	{
-		scene.remove_object(*m_text_object);
+		batch.erase(m_batch_item);
+		if (m_batch == &batch)
+		{
+			m_batch = nullptr;
+		}
 	}
 
 	void label::bounds_recalculated()
@@ -95,43 +128,76 @@ namespace engine::ui
 	void label::effective_opacity_changed()
 	{
 		m_color[3] = get_opacity();
-		m_text_object->set_color({m_color[0], m_color[1], m_color[2], get_effective_opacity()});
+		update_color();
+	}
+
+	void label::update_geometry()
+	{
+		// Copy text vertices into the batch item
+		const auto& vertices = m_layout.get_vertices();
+		m_batch_item.vertex_count = m_layout.get_vertex_count();
+		m_batch_item.vertices.assign(vertices.begin(), vertices.begin() + m_batch_item.vertex_count * type::floats_per_text_vertex);
+		m_layout.clear_modified_ranges();
+
+		// Text bounds affect the text position
+		reposition_text();
+	}
+
+	void label::update_color()
+	{
+		const float opacity = get_effective_opacity();
+		m_layout.set_color({m_color[0], m_color[1], m_color[2], opacity});
+
+		// Fully transparent labels are skipped by the batch
+		m_batch_item.visible = opacity > 0.0f;
+
+		update_geometry();
 	}
 
 	void label::reposition_text()
 	{
+		const auto& text_bounds = m_layout.get_bounds();
 		auto translation = get_bounds().min;
 
-		translation.x() -= m_text_object->get_local_bounds().min.x();
+		translation.x() -= text_bounds.min.x();
 
-		if (auto font = m_text_object->get_font())
+		if (m_font)
 		{
-			const auto& metrics = font->get_metrics();
+			const auto& metrics = m_font->get_metrics();
 			translation.y() -= metrics.descent;
 		}
 		else
 		{
-			translation.y() -= m_text_object->get_local_bounds().min.y();
+			translation.y() -= text_bounds.min.y();
 		}
 
-		m_text_object->set_translation({math::round(translation.x()), math::round(translation.y()), m_text_object->get_translation().z()});
+		m_batch_item.translation = math::fvec2{math::round(translation.x()), math::round(translation.y())} + m_layout.get_origin();
+		invalidate_batch_item();
 	}
 
 	void label::recalculate_min_size()
 	{
-		if (auto font = m_text_object->get_font())
+		if (m_font)
 		{
-			const auto& metrics = font->get_metrics();
+			const auto& metrics = m_font->get_metrics();
 
 			// Without internal leading
-			set_min_size({m_text_object->get_bounds().size().x(), math::round(metrics.em_size)});
+			set_min_size({m_layout.get_bounds().size().x(), math::round(metrics.em_size)});
 
 			// With internal leading
-			//set_min_size({m_text_object->get_bounds().size().x(), math::round(metrics.ascent - metrics.descent)});
+			//set_min_size({m_layout.get_bounds().size().x(), math::round(metrics.ascent - metrics.descent)});
 		}
 		else
 		{
-			set_min_size(math::fvec2(m_text_object->get_bounds().size()));
+			set_min_size(m_layout.get_bounds().size());
+		}
+	}
+
+	void label::invalidate_batch_item()
+	{
+		if (m_batch)
+		{
+			m_batch->invalidate(m_batch_item);
 		}
 	}
 }
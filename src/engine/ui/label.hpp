@@ -4,9 +4,13 @@
 #pragma once
 
 #include <engine/ui/element.hpp>
-#include <engine/scene/text.hpp>
+#include <engine/ui/batch-builder.hpp>
 #include <engine/type/font.hpp>
+#include <engine/type/text-layout.hpp>
+#include <engine/event/subscription.hpp>
 #include <memory>
+#include <string>
+#include <string_view>
 
 namespace engine::ui
 {
@@ -18,7 +22,7 @@ namespace engine::ui
 		label();
 
 		/// Destructs an label.
-		~label() override = default;
+		~label() override;
 
 		[[nodiscard]] inline constexpr element_type get_type() const noexcept override
 		{
@@ -34,7 +38,10 @@ namespace engine::ui
 		void set_font(std::shared_ptr<type::font> font);
 
 		/// Returns the label font.
-		[[nodiscard]] std::shared_ptr<type::font> get_font() const noexcept;
+		[[nodiscard]] inline const std::shared_ptr<type::font>& get_font() const noexcept
+		{
+			return m_font;
+		}
 
 		/// Sets the label material.
 		/// @param material Label material.
@@ -49,7 +56,10 @@ namespace engine::ui
 		void set_color(const math::fvec3& color);
 
 		/// Returns the label text.
-		[[nodiscard]] const std::string& get_text() const noexcept;
+		[[nodiscard]] inline const std::string& get_text() const noexcept
+		{
+			return m_layout.get_content();
+		}
 
 		/// Returns the label color and opacity.
 		[[nodiscard]] inline constexpr const math::fvec4& get_color() const noexcept
@@ -57,10 +67,10 @@ namespace engine::ui
 			return m_color;
 		}
 
-		/// Returns the label text scene object.
-		[[nodiscard]] inline const auto& get_scene_object() const noexcept
+		/// Returns the bounds of the label text, relative to the label text origin.
+		[[nodiscard]] inline constexpr const auto& get_text_bounds() const noexcept
 		{
-			return *m_text_object;
+			return m_layout.get_bounds();
 		}
 
 		/// Sets the function used to refresh the label text.
@@ -71,15 +81,22 @@ namespace engine::ui
 		void refresh_text();
 
 	private:
-		void add_to_scene(scene::collection& scene) override;
-		void remove_from_scene(scene::collection& scene) override;
+		void add_to_batch(batch& batch) override;
+		void remove_from_batch(batch& batch) override;
 		void bounds_recalculated() override;
 		void effective_opacity_changed() override;
+		void update_geometry();
+		void update_color();
 		void reposition_text();
 		void recalculate_min_size();
+		void invalidate_batch_item();
 
 		math::fvec4 m_color{1.0f, 0.0f, 1.0f, 1.0f};
-		std::unique_ptr<scene::text> m_text_object;
+		std::shared_ptr<type::font> m_font;
+		std::shared_ptr<event::subscription> m_font_texture_resized_subscription;
+		type::text_layout m_layout;
+		batch_item m_batch_item;
+		batch* m_batch{nullptr};
 		std::function<std::string(const label&)> m_text_refresher;
 	};
 }
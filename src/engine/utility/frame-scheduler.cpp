@@ -22,6 +22,12 @@ namespace engine
 		m_frame_end_time = clock_type::now();
 		m_frame_duration = m_frame_end_time - m_frame_start_time;
 
+		if (m_fast_forward)
+		{
+			fast_forward_tick();
+			return;
+		}
+
 		// Idle until the minimum frame duration has passed
 		if (m_frame_duration < m_min_frame_duration)
 		{
@@ -43,6 +49,7 @@ namespace engine
 		m_accumulated_time += math::min(m_max_frame_duration, m_frame_duration);
 
 		// Start measuring duration of next frame
+		measure_simulation_rate();
 		m_frame_start_time = m_frame_end_time;
 
 		// Perform fixed-rate updates
@@ -58,11 +65,57 @@ namespace engine
 		m_variable_update_callback(m_fixed_update_time, m_fixed_update_interval, m_accumulated_time);
 	}
 
+	void frame_scheduler::fast_forward_tick()
+	{
+		// Start measuring duration of next frame
+		measure_simulation_rate();
+		m_frame_start_time = m_frame_end_time;
+
+		// Perform fixed-rate updates back-to-back until the fast-forward frame duration has elapsed
+		const time_point_type frame_deadline = m_frame_start_time + m_fast_forward_frame_duration;
+		do
+		{
+			m_fixed_update_callback(m_fixed_update_time, m_fixed_update_interval);
+			m_fixed_update_time += m_fixed_update_interval;
+
+			// Return to real time once the fast-forward end time has been reached
+			if (m_fixed_update_time >= m_fast_forward_end_time)
+			{
+				set_fast_forward(false);
+				break;
+			}
+		}
+		while (clock_type::now() < frame_deadline);
+
+		// Perform variable-rate update without interpolation
+		m_accumulated_time = {};
+		m_variable_update_callback(m_fixed_update_time, m_fixed_update_interval, m_accumulated_time);
+	}
+
+	void frame_scheduler::measure_simulation_rate() noexcept
+	{
+		if (m_frame_duration > duration_type::zero())
+		{
+			m_simulation_rate = std::chrono::duration<double>(m_fixed_update_time - m_frame_start_fixed_update_time) / std::chrono::duration<double>(m_frame_duration);
+		}
+		m_frame_start_fixed_update_time = m_fixed_update_time;
+	}
+
+	void frame_scheduler::set_fast_forward(bool enabled) noexcept
+	{
+		if (m_fast_forward != enabled)
+		{
+			m_fast_forward = enabled;
+			refresh();
+		}
+	}
+
 	void frame_scheduler::refresh() noexcept
 	{
 		m_accumulated_time = {};
 		m_frame_duration = {};
 		m_frame_start_time = clock_type::now();
+		m_frame_start_fixed_update_time = m_fixed_update_time;
 	}
 
 	void frame_scheduler::reset() noexcept
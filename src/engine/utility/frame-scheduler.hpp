@@ -40,6 +40,7 @@ namespace engine
 		frame_scheduler() noexcept;
 
 		/// Performs any scheduled fixed-rate updates followed by a single variable-rate update.
+		/// @details In fast-forward mode, fixed-rate updates are performed back-to-back until the fast-forward frame duration has elapsed, followed by a single variable-rate update with no accumulated time.
 		/// @warning Both the fixed-rate and variable-rate update callbacks must be valid when calling `tick()`.
 		void tick();
 
@@ -70,6 +71,25 @@ namespace engine
 			m_max_frame_duration = duration;
 		}
 
+		/// Enables or disables fast-forward mode, in which fixed-rate updates are performed as quickly as possible rather than in real time, and variable-rate updates are performed at a reduced rate.
+		/// @param enabled `true` to enable fast-forward mode, `false` to return to real time.
+		/// @note Fast-forward mode ignores the minimum and maximum frame durations. Changing modes refreshes the scheduler.
+		void set_fast_forward(bool enabled) noexcept;
+
+		/// Sets the real duration of fast-forward frames, which is the interval between variable-rate updates in fast-forward mode.
+		/// @param duration Fast-forward frame duration. At least one fixed-rate update is performed per fast-forward frame.
+		inline void set_fast_forward_frame_duration(duration_type duration) noexcept
+		{
+			m_fast_forward_frame_duration = duration;
+		}
+
+		/// Sets the elapsed fixed-rate update time (`t`) at which fast-forward mode is automatically disabled.
+		/// @param time Fast-forward end time, or `duration_type::max()` to fast-forward indefinitely.
+		inline void set_fast_forward_end_time(duration_type time) noexcept
+		{
+			m_fast_forward_end_time = time;
+		}
+
 		/// Sets the fixed-rate update callback.
 		/// @param callback Fixed-rate update callback.
 		inline void set_fixed_update_callback(fixed_update_callback_type&& callback) noexcept
@@ -114,6 +134,31 @@ namespace engine
 			return m_frame_duration;
 		}
 
+		/// Returns the ratio of elapsed fixed-rate update time to elapsed real time over the previous frame.
+		/// @details This is the number of simulated seconds per real second, which is about `1` in real time and greater in fast-forward mode.
+		[[nodiscard]] inline double get_simulation_rate() const noexcept
+		{
+			return m_simulation_rate;
+		}
+
+		/// Returns `true` if fast-forward mode is enabled, `false` otherwise.
+		[[nodiscard]] inline bool is_fast_forward() const noexcept
+		{
+			return m_fast_forward;
+		}
+
+		/// Returns the real duration of fast-forward frames.
+		[[nodiscard]] inline duration_type get_fast_forward_frame_duration() const noexcept
+		{
+			return m_fast_forward_frame_duration;
+		}
+
+		/// Returns the elapsed fixed-rate update time at which fast-forward mode is automatically disabled.
+		[[nodiscard]] inline duration_type get_fast_forward_end_time() const noexcept
+		{
+			return m_fast_forward_end_time;
+		}
+
 		/// Returns the minimum frame duration.
 		[[nodiscard]] inline duration_type get_min_frame_duration() const noexcept
 		{
@@ -145,6 +190,12 @@ namespace engine
 		}
 
 	private:
+		/// Performs a frame in fast-forward mode.
+		void fast_forward_tick();
+
+		/// Measures the simulation rate over the previous frame.
+		void measure_simulation_rate() noexcept;
+
 		duration_type m_fixed_update_time{};
 		duration_type m_accumulated_time{};
 
@@ -157,6 +208,13 @@ namespace engine
 
 		duration_type m_fixed_update_interval{};
 
+		duration_type m_frame_start_fixed_update_time{};
+		double m_simulation_rate{};
+
+		bool m_fast_forward{false};
+		duration_type m_fast_forward_frame_duration{std::chrono::milliseconds(100)};
+		duration_type m_fast_forward_end_time{duration_type::max()};
+
 		fixed_update_callback_type m_fixed_update_callback;
 		variable_update_callback_type m_variable_update_callback;
 	};
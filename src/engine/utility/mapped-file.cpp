@@ -0,0 +1,130 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#if defined(_WIN32)
+	#define WIN32_LEAN_AND_MEAN
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+	#include <cerrno>
+#endif
+#include <engine/utility/mapped-file.hpp>
+#include <system_error>
+
+namespace engine
+{
+	mapped_file::mapped_file(const std::filesystem::path& path)
+	{
+#if defined(_WIN32)
+
+		const auto throw_last_error = [&]()
+		{
+			std::error_code ec(static_cast<int>(GetLastError()), std::system_category());
+			if (m_mapping_handle)
+			{
+				CloseHandle(m_mapping_handle);
+			}
+			if (m_file_handle && m_file_handle != INVALID_HANDLE_VALUE)
+			{
+				CloseHandle(m_file_handle);
+			}
+			throw std::filesystem::filesystem_error("Failed to map file", path, ec);
+		};
+
+		m_file_handle = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+		if (m_file_handle == INVALID_HANDLE_VALUE)
+		{
+			throw_last_error();
+		}
+
+		LARGE_INTEGER file_size{};
+		if (!GetFileSizeEx(m_file_handle, &file_size))
+		{
+			throw_last_error();
+		}
+		m_size = static_cast<usize>(file_size.QuadPart);
+
+		if (m_size)
+		{
+			m_mapping_handle = CreateFileMappingW(m_file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (!m_mapping_handle)
+			{
+				throw_last_error();
+			}
+
+			m_data = static_cast<const std::byte*>(MapViewOfFile(m_mapping_handle, FILE_MAP_READ, 0, 0, 0));
+			if (!m_data)
+			{
+				throw_last_error();
+			}
+		}
+
+#else
+
+		const int fd = ::open(path.c_str(), O_RDONLY);
+		if (fd < 0)
+		{
+			throw std::filesystem::filesystem_error("Failed to open file", path, std::error_code(errno, std::generic_category()));
+		}
+
+		struct stat file_status{};
+		if (::fstat(fd, &file_status) != 0)
+		{
+			const int error = errno;
+			::close(fd);
+			throw std::filesystem::filesystem_error("Failed to stat file", path, std::error_code(error, std::generic_category()));
+		}
+		m_size = static_cast<usize>(file_status.st_size);
+
+		if (m_size)
+		{
+			void* address = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (address == MAP_FAILED)
+			{
+				const int error = errno;
+				::close(fd);
+				throw std::filesystem::filesystem_error("Failed to map file", path, std::error_code(error, std::generic_category()));
+			}
+
+			// Mapped files are typically accessed sparsely
+			::madvise(address, m_size, MADV_RANDOM);
+
+			m_data = static_cast<const std::byte*>(address);
+		}
+
+		// The mapping remains valid after the file descriptor is closed
+		::close(fd);
+
+#endif
+	}
+
+	mapped_file::~mapped_file()
+	{
+#if defined(_WIN32)
+
+		if (m_data)
+		{
+			UnmapViewOfFile(m_data);
+		}
+		if (m_mapping_handle)
+		{
+			CloseHandle(m_mapping_handle);
+		}
+		if (m_file_handle && m_file_handle != INVALID_HANDLE_VALUE)
+		{
+			CloseHandle(m_file_handle);
+		}
+
+#else
+
+		if (m_data)
+		{
+			::munmap(const_cast<std::byte*>(m_data), m_size);
+		}
+
+#endif
+	}
+}
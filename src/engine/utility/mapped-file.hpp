@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <engine/utility/sized-types.hpp>
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+namespace engine
+{
+	/// Read-only memory-mapped file.
+	/// @details Pages of the file are loaded by the operating system on first access, so mapping a large file costs neither time nor resident memory until its contents are read.
+	class mapped_file
+	{
+	public:
+		/// Maps a file into memory.
+		/// @param path Path to the file to map.
+		/// @exception std::filesystem::filesystem_error Failed to open or map file.
+		explicit mapped_file(const std::filesystem::path& path);
+
+		/// Unmaps the file.
+		~mapped_file();
+
+		/// Returns the mapped contents of the file.
+		[[nodiscard]] inline std::span<const std::byte> data() const noexcept
+		{
+			return {m_data, m_size};
+		}
+
+		/// Returns the size of the file, in bytes.
+		[[nodiscard]] inline usize size() const noexcept
+		{
+			return m_size;
+		}
+
+	private:
+		mapped_file(const mapped_file&) = delete;
+		mapped_file(mapped_file&&) = delete;
+		mapped_file& operator=(const mapped_file&) = delete;
+		mapped_file& operator=(mapped_file&&) = delete;
+
+		const std::byte* m_data{};
+		usize m_size{};
+
+		#if defined(_WIN32)
+			void* m_file_handle{};
+			void* m_mapping_handle{};
+		#endif
+	};
+}
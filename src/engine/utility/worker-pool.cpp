@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <engine/utility/worker-pool.hpp>
+#include <engine/debug/profiler.hpp>
+#include <algorithm>
+
+namespace engine
+{
+	worker_pool::worker_pool(usize thread_count)
+	{
+		if (!thread_count)
+		{
+			thread_count = std::max(std::thread::hardware_concurrency(), 1u);
+		}
+
+		m_workers.reserve(thread_count - 1);
+		for (usize i = 1; i < thread_count; ++i)
+		{
+			m_workers.emplace_back(std::bind_front(&worker_pool::work, this), i);
+		}
+	}
+
+	worker_pool::~worker_pool()
+	{
+		for (auto& worker: m_workers)
+		{
+			worker.request_stop();
+		}
+		m_workers.clear();
+	}
+
+	void worker_pool::parallel_for(usize count, const function_type& function)
+	{
+		if (!count)
+		{
+			return;
+		}
+
+		m_function = &function;
+		m_count = count;
+		m_next_index.store(0, std::memory_order_relaxed);
+
+		// Process single iterations on the calling thread only
+		if (m_workers.empty() || count == 1)
+		{
+			run_tasks(0);
+			return;
+		}
+
+		// Wake worker threads
+		{
+			std::lock_guard lock(m_mutex);
+			++m_generation;
+			m_busy_worker_count = m_workers.size();
+		}
+		m_condition.notify_all();
+
+		run_tasks(0);
+
+		// Wait for worker threads to finish
+		std::unique_lock lock(m_mutex);
+		m_done_condition.wait(lock, [&]{return !m_busy_worker_count;});
+	}
+
+	void worker_pool::run_tasks(usize thread_index)
+	{
+		debug::profile_scope profile("worker_pool::run_tasks");
+
+		for (usize i = m_next_index.fetch_add(1, std::memory_order_relaxed); i < m_count; i = m_next_index.fetch_add(1, std::memory_order_relaxed))
+		{
+			(*m_function)(i, thread_index);
+		}
+	}
+
+	void worker_pool::work(std::stop_token stop_token, usize thread_index)
+	{
+		u64 generation = 0;
+		while (true)
+		{
+			{
+				std::unique_lock lock(m_mutex);
+				if (!m_condition.wait(lock, stop_token, [&]{return m_generation != generation;}))
+				{
+					return;
+				}
+				generation = m_generation;
+			}
+
+			run_tasks(thread_index);
+
+			{
+				std::lock_guard lock(m_mutex);
+				if (!--m_busy_worker_count)
+				{
+					m_done_condition.notify_one();
+				}
+			}
+		}
+	}
+}
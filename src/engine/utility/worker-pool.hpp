@@ -0,0 +1,66 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <engine/utility/sized-types.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+namespace engine
+{
+	/// Pool of persistent worker threads which process data-parallel loops together with the calling thread.
+	class worker_pool
+	{
+	public:
+		/// Loop body function type.
+		/// @details The first parameter is the loop index and the second parameter is the index of the thread which processes it, on `[0, get_thread_count())`. The calling thread has index `0`.
+		using function_type = std::function<void(usize, usize)>;
+
+		/// Constructs a worker pool and starts its threads.
+		/// @param thread_count Number of threads which process loops, including the calling thread. If `0`, the number of hardware threads will be used.
+		explicit worker_pool(usize thread_count = 0);
+
+		/// Stops the worker threads.
+		~worker_pool();
+
+		worker_pool(const worker_pool&) = delete;
+		worker_pool(worker_pool&&) = delete;
+		worker_pool& operator=(const worker_pool&) = delete;
+		worker_pool& operator=(worker_pool&&) = delete;
+
+		/// Calls a function for each index on `[0, count)` across the worker threads and the calling thread, and returns once all calls have finished.
+		/// @param count Number of indices.
+		/// @param function Function to call.
+		/// @warning Not reentrant, and must not be called concurrently from multiple threads.
+		void parallel_for(usize count, const function_type& function);
+
+		/// Returns the number of threads which process loops, including the calling thread.
+		[[nodiscard]] inline usize get_thread_count() const noexcept
+		{
+			return m_workers.size() + 1;
+		}
+
+	private:
+		/// Claims and processes indices of the current loop.
+		void run_tasks(usize thread_index);
+
+		/// Worker thread loop.
+		void work(std::stop_token stop_token, usize thread_index);
+
+		std::mutex m_mutex;
+		std::condition_variable_any m_condition;
+		std::condition_variable m_done_condition;
+		const function_type* m_function{nullptr};
+		usize m_count{0};
+		std::atomic<usize> m_next_index{0};
+		u64 m_generation{0};
+		usize m_busy_worker_count{0};
+		std::vector<std::jthread> m_workers;
+	};
+}
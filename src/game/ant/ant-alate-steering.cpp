@@ -0,0 +1,38 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "game/ant/ant-alate-steering.hpp"
+#include "game/systems/steering-system.hpp"
+#include <engine/math/quaternion.hpp>
+#include <engine/math/functions.hpp>
+
+steering_component make_alate_steering(const math::fvec3& swarm_center)
+{
+	::steering_component steering;
+	steering.agent.mass = 1.0f;
+	steering.agent.position = swarm_center;
+	steering.agent.velocity = {0, 0, 0};
+	steering.agent.acceleration = {0, 0, 0};
+	steering.agent.max_force = 4.0f;
+	steering.agent.max_speed = 5.0f;
+	steering.agent.max_speed_squared = steering.agent.max_speed * steering.agent.max_speed;
+	steering.agent.orientation = math::identity<math::fquat>;
+	steering.agent.forward = steering.agent.orientation * steering_system::global_forward;
+	steering.agent.up = steering.agent.orientation * steering_system::global_up;
+	steering.wander_weight = 1.0f;
+	steering.wander_noise = math::radians(2000.0f);
+	steering.wander_distance = 10.0f;
+	steering.wander_radius = 8.0f;
+	steering.wander_angle = 0.0f;
+	steering.wander_angle2 = 0.0f;
+	steering.seek_weight = 0.2f;
+	steering.seek_target = swarm_center;
+	steering.flee_weight = 0.0f;
+	steering.separation_weight = 0.5f;
+	steering.cohesion_weight = 0.0f;
+	steering.alignment_weight = 0.0f;
+	steering.neighbor_radius = 3.0f;
+	steering.sum_weights = steering.wander_weight + steering.seek_weight + steering.flee_weight + steering.separation_weight + steering.cohesion_weight + steering.alignment_weight;
+	
+	return steering;
+}
@@ -0,0 +1,17 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef ANTKEEPER_GAME_ANT_ALATE_STEERING_HPP
+#define ANTKEEPER_GAME_ANT_ALATE_STEERING_HPP
+
+#include "game/components/steering-component.hpp"
+#include <engine/math/vector.hpp>
+
+using namespace engine;
+
+/// Constructs the steering component of an alate in a nuptial flight swarm.
+/// @param swarm_center Point which the alate seeks.
+/// @return Steering component with wander, seek, and flocking behaviors. The agent position is left for the caller to set.
+[[nodiscard]] steering_component make_alate_steering(const math::fvec3& swarm_center);
+
+#endif // ANTKEEPER_GAME_ANT_ALATE_STEERING_HPP
@@ -3,6 +3,7 @@
 
 #include <random>
 #include "game/ant/ant-swarm.hpp"
+#include "game/ant/ant-alate-steering.hpp"
 #include "game/components/transform-component.hpp"
 #include "game/components/steering-component.hpp"
 #include "game/components/scene-object-component.hpp"
@@ -10,7 +11,6 @@
 #include "game/components/winged-locomotion-component.hpp"
 #include "game/components/rigid-body-component.hpp"
 #include "game/components/ant-caste-component.hpp"
-#include "game/systems/steering-system.hpp"
 #include <engine/scene/static-mesh.hpp>
 #include <engine/resources/resource-manager.hpp>
 #include <engine/math/quaternion.hpp>
@@ -69,26 +69,7 @@ entity::id create_ant_swarm(::game& ctx)
 	std::shared_ptr<render::model> queen_model = ctx.resource_manager->load<render::model>("queen-boid.mdl");
 	
 	// Init steering component
-	::steering_component steering;
-	steering.agent.mass = 1.0f;
-	steering.agent.velocity = {0, 0, 0};
-	steering.agent.acceleration = {0, 0, 0};
-	steering.agent.max_force = 4.0f;
-	steering.agent.max_speed = 5.0f;
-	steering.agent.max_speed_squared = steering.agent.max_speed * steering.agent.max_speed;
-	steering.agent.orientation = math::identity<math::fquat>;
-	steering.agent.forward = steering.agent.orientation * steering_system::global_forward;
-	steering.agent.up = steering.agent.orientation * steering_system::global_up;
-	steering.wander_weight = 1.0f;
-	steering.wander_noise = math::radians(2000.0f);
-	steering.wander_distance = 10.0f;
-	steering.wander_radius = 8.0f;
-	steering.wander_angle = 0.0f;
-	steering.wander_angle2 = 0.0f;
-	steering.seek_weight = 0.2f;
-	steering.seek_target = swarm_center;
-	steering.flee_weight = 0.0f;
-	steering.sum_weights = steering.wander_weight + steering.seek_weight + steering.flee_weight;
+	auto steering = make_alate_steering(swarm_center);
 	
 	// Init rigid body
 	physics::rigid_body rigid_body;
@@ -0,0 +1,40 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef ANTKEEPER_GAME_ANIMATION_LOD_COMPONENT_HPP
+#define ANTKEEPER_GAME_ANIMATION_LOD_COMPONENT_HPP
+
+#include <engine/utility/sized-types.hpp>
+
+using namespace engine;
+
+/// Animation levels of detail, in order of decreasing detail.
+enum class animation_lod: u8
+{
+	/// Bone poses are interpolated every frame and IK is solved every fixed update.
+	full,
+
+	/// Bone poses are interpolated every second frame and IK is solved every second fixed update.
+	reduced,
+
+	/// Bone poses are snapped to the current state every fourth frame and IK is not solved.
+	minimal,
+
+	/// Bone poses are not updated and IK is not solved.
+	frozen
+};
+
+/// Number of animation levels of detail.
+inline constexpr usize animation_lod_count = 4;
+
+/// Animation level of detail of a skeletal mesh, selected by the animation system according to its projected size.
+struct animation_lod_component
+{
+	/// Current level of detail.
+	animation_lod lod{animation_lod::full};
+
+	/// Offset which staggers the throttled updates of entities across frames.
+	u8 phase{};
+};
+
+#endif // ANTKEEPER_GAME_ANIMATION_LOD_COMPONENT_HPP
@@ -4,10 +4,14 @@
 #ifndef ANTKEEPER_GAME_NAVMESH_AGENT_COMPONENT_HPP
 #define ANTKEEPER_GAME_NAVMESH_AGENT_COMPONENT_HPP
 
+#include <engine/ai/navmesh-flow-field.hpp>
 #include <engine/geom/brep/mesh.hpp>
 #include <engine/geom/brep/feature.hpp>
 #include <engine/entity/id.hpp>
 #include <engine/math/vector.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <memory>
+#include <vector>
 
 using namespace engine;
 
@@ -24,6 +28,12 @@ struct navmesh_agent_component
 	
 	/// Smooth interpolated surface normal at the agent position.
 	math::fvec3 surface_normal{};
+	
+	/// Indices of the faces toward which the agent is steered by a shared flow field, or empty if the agent is steered by its target direction. The flow field must be reset when the goal faces change.
+	std::vector<u32> goal_faces;
+	
+	/// Flow field which steers the agent, or `nullptr` if the agent is steered by its target direction. Agents with goal faces are given a flow field by the locomotion system. Face indices of the flow field must match those of the mesh.
+	std::shared_ptr<const ai::navmesh_flow_field> flow_field;
 };
 
 #endif // ANTKEEPER_GAME_NAVMESH_AGENT_COMPONENT_HPP
@@ -0,0 +1,23 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef ANTKEEPER_GAME_NAVMESH_COMPONENT_HPP
+#define ANTKEEPER_GAME_NAVMESH_COMPONENT_HPP
+
+#include <engine/ai/navmesh-graph.hpp>
+#include <engine/geom/brep/mesh.hpp>
+#include <memory>
+
+using namespace engine;
+
+/// Traversal data of a navmesh entity, built from the mesh collider of the entity when an agent first traverses it.
+struct navmesh_component
+{
+	/// Mesh from which the traversal data was built. Holding the mesh ensures that no other mesh can be allocated at its address while the data exists.
+	std::shared_ptr<const geom::brep::mesh> mesh;
+	
+	/// Packed per-face graph of the mesh, which agents traverse and over which flow fields are built.
+	std::shared_ptr<const ai::navmesh_graph> graph;
+};
+
+#endif // ANTKEEPER_GAME_NAVMESH_COMPONENT_HPP
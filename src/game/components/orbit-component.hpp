@@ -22,6 +22,9 @@ struct orbit_component
 	
 	/// Cartesian position of the orbit, w.r.t. the ICRF frame.
 	math::dvec3 position;
+	
+	/// Cartesian velocity of the orbit, w.r.t. the ICRF frame, in meters per second.
+	math::dvec3 velocity;
 };
 
 #endif // ANTKEEPER_GAME_ORBIT_COMPONENT_HPP
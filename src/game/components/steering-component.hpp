@@ -28,6 +28,12 @@ struct steering_component
 	// Flee behavior
 	float flee_weight;
 	
+	// Flocking behaviors
+	float separation_weight;
+	float cohesion_weight;
+	float alignment_weight;
+	float neighbor_radius;
+	
 	/// Sum of steering behavior weights
 	float sum_weights;
 };
@@ -167,6 +167,9 @@ void reset_control_profile(::control_profile& profile)
 	// Adjust time
 	mappings.emplace("adjust_time"_fnv1a32, std::make_unique<input::key_mapping>(nullptr, input::scancode::t, input::modifier_key::none, false));
 	
+	// Toggle fast-forward
+	mappings.emplace("toggle_fast_forward"_fnv1a32, std::make_unique<input::key_mapping>(nullptr, input::scancode::f10, input::modifier_key::none, false));
+	
 	// Terminal keys
 	mappings.emplace("terminal_up"_fnv1a32, std::make_unique<input::key_mapping>(nullptr, input::scancode::up, input::modifier_key::none, true));
 	mappings.emplace("terminal_down"_fnv1a32, std::make_unique<input::key_mapping>(nullptr, input::scancode::down, input::modifier_key::none, true));
@@ -301,6 +304,7 @@ void apply_control_profile(::game& ctx, const ::control_profile& profile, bool k
 	add_mappings(ctx.debug_action_map, ctx.toggle_debug_ui_action, "toggle_debug"_fnv1a32);
 	add_mappings(ctx.debug_action_map, ctx.adjust_exposure_action, "adjust_exposure"_fnv1a32);
 	add_mappings(ctx.debug_action_map, ctx.adjust_time_action, "adjust_time"_fnv1a32);
+	add_mappings(ctx.debug_action_map, ctx.toggle_fast_forward_action, "toggle_fast_forward"_fnv1a32);
 	
 	// Terminal controls
 	clear_mappings(ctx.terminal_action_map);
@@ -406,6 +410,7 @@ void update_control_profile(::game& ctx, ::control_profile& profile)
 	add_mappings(ctx.debug_action_map, ctx.toggle_debug_ui_action, "toggle_debug"_fnv1a32);
 	add_mappings(ctx.debug_action_map, ctx.adjust_exposure_action, "adjust_exposure"_fnv1a32);
 	add_mappings(ctx.debug_action_map, ctx.adjust_time_action, "adjust_time"_fnv1a32);
+	add_mappings(ctx.debug_action_map, ctx.toggle_fast_forward_action, "toggle_fast_forward"_fnv1a32);
 	
 	// Terminal controls
 	add_mappings(ctx.terminal_action_map, ctx.terminal_up_action, "terminal_up"_fnv1a32);
@@ -29,6 +29,19 @@ void setup_debug_controls(::game& ctx)
 		)
 	);
 	
+	// Toggle fast-forward
+	ctx.event_subscriptions.emplace_back
+	(
+		ctx.toggle_fast_forward_action.get_activated_channel().subscribe
+		(
+			[&](const auto&)
+			{
+				ctx.frame_scheduler.set_fast_forward_end_time(engine::frame_scheduler::duration_type::max());
+				ctx.frame_scheduler.set_fast_forward(!ctx.frame_scheduler.is_fast_forward());
+			}
+		)
+	);
+	
 	ctx.event_subscriptions.emplace_back
 	(
 		ctx.input_manager->get_event_dispatcher().subscribe<input::mouse_moved_event>
@@ -68,4 +81,5 @@ void disable_debug_controls(::game& ctx)
 	ctx.toggle_debug_ui_action.reset();
 	ctx.adjust_exposure_action.reset();
 	ctx.adjust_time_action.reset();
+	ctx.toggle_fast_forward_action.reset();
 }
@@ -43,10 +43,12 @@ int shell_buffer::sync()
 		this->str(std::string{string_view});
 		this->pubseekoff(0, std::ios_base::end);
 		
+		// Text lines are spaced by the rounded linespace
 		const auto& font_metrics =  m_text_object->get_font()->get_metrics();
+		const auto line_advance = math::round(font_metrics.linespace);
 		auto translation = m_text_object->get_translation();
-		translation.x() = math::round(font_metrics.linespace);
-		translation.y() = math::round((line_count + 1) * font_metrics.linespace - font_metrics.descent);
+		translation.x() = line_advance;
+		translation.y() = math::round((line_count + 1) * line_advance - font_metrics.descent);
 		m_text_object->set_translation(translation);
 	}
 	
@@ -14,8 +14,11 @@ extern "C"
 #include "game/strings.hpp"
 #include <engine/config.hpp>
 #include <engine/debug/log.hpp>
+#include <engine/debug/profiler.hpp>
 #include <engine/script/script-error.hpp>
 #include <engine/utility/sized-types.hpp>
+#include <chrono>
+#include <format>
 
 using namespace engine;
 
@@ -46,7 +49,7 @@ namespace
 		usize len = 0;
 		const char* value = luaL_tolstring(L, 3, &len);
 		
-		(*ctx->string_map)[key] = std::string(value, len);
+		ctx->string_overrides[hash::fnv1a32<char>(std::string_view{key})] = std::string(value, len);
 
 		return 0;
 	}
@@ -69,6 +72,34 @@ namespace
 
 		lua_setglobal(L, "string");
 	}
+
+	int lua_profile(lua_State* L)
+	{
+		if constexpr (!debug::g_profiler_enabled)
+		{
+			return luaL_error(L, "profiler compiled out");
+		}
+
+		lua_getglobal(L, "ctx");
+		game* ctx = static_cast<game*>(lua_touserdata(L, -1));
+		lua_pop(L, 1);
+
+		const lua_Integer frame_count = luaL_optinteger(L, 1, 60);
+		luaL_argcheck(L, frame_count > 0, 1, "frame count must be positive");
+
+		// Determine timestamped profile filename
+		const auto time = std::chrono::floor<std::chrono::milliseconds>(std::chrono::system_clock::now());
+		ctx->profile_capture_path = ctx->profiles_path / std::format("{0}-profile-{1:%Y%m%d}T{1:%H%M%S}Z.json", config::application_slug, time);
+
+		// Begin capture, which is written to the profile file once the frames have elapsed
+		ctx->profile_capture_events.clear();
+		ctx->profile_capture_frame_count = static_cast<usize>(frame_count);
+
+		const std::string path_string = ctx->profile_capture_path.string();
+		lua_pushlstring(L, path_string.c_str(), path_string.length());
+
+		return 1;
+	}
 }
 
 shell::shell(game* ctx):
@@ -86,6 +117,9 @@ shell::shell(game* ctx):
 	lua_setglobal(lua, "version");
 
 	register_string(lua);
+
+	lua_pushcfunction(lua, lua_profile);
+	lua_setglobal(lua, "profile");
 }
 
 shell::~shell()
@@ -6,9 +6,14 @@
 #include "game/strings.hpp"
 #include <engine/hash/fnv.hpp>
 #include <engine/type/font.hpp>
+#include <engine/type/font-cache.hpp>
 #include <engine/resources/resource-manager.hpp>
+#include <engine/debug/log.hpp>
 #include <engine/render/material.hpp>
 #include <engine/gl/shader-template.hpp>
+#include <filesystem>
+#include <format>
+#include <string>
 
 using namespace engine;
 using namespace engine::hash::literals;
@@ -32,8 +37,70 @@ void build_font_material(render::material& material, const type::font& font, std
 	}
 }
 
+namespace
+{
+	/// Returns the path to the font cache file of a font, relative to the shared config directory.
+	[[nodiscard]] std::filesystem::path font_cache_path(const type::font& font)
+	{
+		return std::format("cache/fonts/{:016x}.glyphs", font.get_cache_key());
+	}
+	
+	/// Imports previously rasterized glyphs into a font, if its font cache file exists.
+	void load_font_cache(::game& ctx, type::font& font)
+	{
+		const auto path = font_cache_path(font);
+		if (!std::filesystem::exists(ctx.shared_config_path / path))
+		{
+			return;
+		}
+		
+		if (auto cache = ctx.resource_manager->load<type::font_cache>(path))
+		{
+			try
+			{
+				const auto glyph_count = font.import_cache(*cache);
+				debug::log_debug("Imported {} glyphs from font cache \"{}\"", glyph_count, path.string());
+			}
+			catch (const std::exception& e)
+			{
+				debug::log_warning("Failed to import font cache \"{}\": {}", path.string(), e.what());
+			}
+		}
+	}
+}
+
+void save_font_caches(::game& ctx)
+{
+	for (const auto& font: {ctx.debug_font, ctx.menu_font, ctx.title_font})
+	{
+		// Skip fonts which rasterized no glyphs beyond those imported from their font cache
+		if (!font || !font->get_rasterized_glyph_count())
+		{
+			continue;
+		}
+		
+		const auto path = font_cache_path(*font);
+		
+		try
+		{
+			std::filesystem::create_directories((ctx.shared_config_path / path).parent_path());
+		}
+		catch (const std::filesystem::filesystem_error& e)
+		{
+			debug::log_warning("Failed to create font cache directory: {}", e.what());
+			continue;
+		}
+		
+		ctx.resource_manager->set_write_path(ctx.shared_config_path);
+		ctx.resource_manager->save(font->export_cache(), path);
+	}
+}
+
 void load_fonts(::game& ctx)
 {
+	// Save glyphs rasterized by the previous fonts, if any
+	save_font_caches(ctx);
+	
 	const auto& language = (*ctx.languages)[ctx.language_tag];
 	
 	// Load dyslexia-friendly typeface (if enabled)
@@ -79,6 +146,7 @@ void load_fonts(::game& ctx)
 	if (auto it = ctx.typefaces.find("monospace"_fnv1a32); it != ctx.typefaces.end())
 	{
 		ctx.debug_font = std::make_shared<type::font>(it->second, ctx.debug_font_size_pt * pt_to_px);
+		load_font_cache(ctx, *ctx.debug_font);
 		build_font_material(*ctx.debug_font_material, *ctx.debug_font, font_shader_template);
 	}
 	
@@ -86,6 +154,20 @@ void load_fonts(::game& ctx)
 	if (auto it = ctx.typefaces.find("sans_serif"_fnv1a32); it != ctx.typefaces.end())
 	{
 		ctx.menu_font = std::make_shared<type::font>(it->second, ctx.menu_font_size_pt * pt_to_px);
+		load_font_cache(ctx, *ctx.menu_font);
+		
+		// Cache the glyphs of all strings up front, in one batch, rather than as menus are opened
+		if (ctx.string_map)
+		{
+			std::string text;
+			for (usize i = 0; i < ctx.string_map->size(); ++i)
+			{
+				text += ctx.string_map->value_at(i);
+			}
+			
+			ctx.menu_font->cache_glyphs(text);
+		}
+		
 		build_font_material(*ctx.menu_font_material, *ctx.menu_font, font_shader_template);
 	}
 	
@@ -93,6 +175,7 @@ void load_fonts(::game& ctx)
 	if (auto it = ctx.typefaces.find("serif"_fnv1a32); it != ctx.typefaces.end())
 	{
 		ctx.title_font = std::make_shared<type::font>(it->second, ctx.title_font_size_pt * pt_to_px);
+		load_font_cache(ctx, *ctx.title_font);
 		build_font_material(*ctx.title_font_material, *ctx.title_font, font_shader_template);
 	}
 }
@@ -8,4 +8,8 @@
 
 void load_fonts(::game& ctx);
 
+/// Saves the glyphs rasterized by the current fonts to font cache files, so they can be imported rather than rasterized on subsequent loads.
+/// @param ctx Game context.
+void save_font_caches(::game& ctx);
+
 #endif // ANTKEEPER_GAME_FONTS_HPP
@@ -5,10 +5,6 @@
 #include <nlohmann/json.hpp>
 #include <entt/entt.hpp>
 
-// Prevent cxxopts from using RTTI
-#define CXXOPTS_NO_RTTI
-#include <cxxopts.hpp>
-
 #include "game/game.hpp"
 #include "game/debug/shell.hpp"
 #include "game/debug/shell-buffer.hpp"
@@ -18,6 +14,7 @@
 #include "game/fonts.hpp"
 #include "game/graphics.hpp"
 #include "game/menu.hpp"
+#include "game/options.hpp"
 #include "game/settings.hpp"
 #include "game/strings.hpp"
 #include "game/world.hpp"
@@ -45,6 +42,7 @@
 #include "game/components/gravity-component.hpp"
 #include "game/components/time-component.hpp"
 #include "game/components/tag-component.hpp"
+#include "game/utility/time.hpp"
 #include <engine/config.hpp>
 #include <engine/gl/framebuffer.hpp>
 #include <engine/gl/pixel-format.hpp>
@@ -71,6 +69,7 @@
 #include <engine/script/script-global-module.hpp>
 #include <engine/audio/sound-wave.hpp>
 #include <engine/debug/log.hpp>
+#include <engine/debug/profiler.hpp>
 #include <engine/resources/resource-manager.hpp>
 #include <engine/ui/range.hpp>
 #include <engine/ui/label.hpp>
@@ -83,15 +82,58 @@
 #include <engine/animation/ease.hpp>
 #include <engine/animation/animation-sequence.hpp>
 #include <engine/math/functions.hpp>
+#include <algorithm>
 #include <filesystem>
+#include <fstream>
+#include <format>
 #include <functional>
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <chrono>
 
 using namespace engine;
 using namespace engine::hash::literals;
 
+namespace
+{
+	/// Formats the scopes with the greatest total duration, one per line.
+	/// @param events Profile events of one frame.
+	/// @param max_line_count Maximum number of scopes to format.
+	/// @return Formatted scopes.
+	[[nodiscard]] std::string format_profile_summary(std::span<const debug::profile_event> events, usize max_line_count)
+	{
+		// Sum durations of scopes with the same name
+		std::vector<std::pair<std::string_view, i64>> totals;
+		for (const auto& event: events)
+		{
+			const std::string_view name = event.name;
+			auto it = std::ranges::find(totals, name, &std::pair<std::string_view, i64>::first);
+			if (it == totals.end())
+			{
+				totals.emplace_back(name, event.end - event.begin);
+			}
+			else
+			{
+				it->second += event.end - event.begin;
+			}
+		}
+		
+		// Sort scopes by descending total duration
+		const usize line_count = std::min(max_line_count, totals.size());
+		std::ranges::partial_sort(totals, totals.begin() + static_cast<std::ptrdiff_t>(line_count), std::ranges::greater{}, &std::pair<std::string_view, i64>::second);
+		
+		std::string summary;
+		for (usize i = 0; i < line_count; ++i)
+		{
+			summary += std::format("\n{:6.03f}ms {}", static_cast<double>(totals[i].second) * 1e-6, totals[i].first);
+		}
+		
+		return summary;
+	}
+}
+
 game::game(int argc, const char* const* argv)
 {
 	// Boot process
@@ -129,6 +171,9 @@ game::~game()
 		state_machine.pop();
 	}
 	
+	// Save rasterized glyphs
+	save_font_caches(*this);
+	
 	// Update window settings
 	const auto& windowed_position = window->get_windowed_position();
 	const auto& windowed_size = window->get_windowed_size();
@@ -168,18 +213,11 @@ void game::parse_options(int argc, const char* const* argv)
 	// Parse command-line options with cxxopts
 	try
 	{
-		cxxopts::Options options(config::application_name, config::application_name);
-		options.add_options()
-			("c,continue", "Continues from the last save")
-			("d,data", "Sets the data package path", cxxopts::value<std::string>())
-			("f,fullscreen", "Starts in fullscreen mode")
-			("n,new-game", "Starts a new game")
-			("q,quick-start", "Skips to the main menu")
-			("r,reset", "Resets all settings to default")
-			("v,v-sync", "Enables or disables v-sync", cxxopts::value<int>())
-			("w,windowed", "Starts in windowed mode");
+		auto options = make_options();
 		auto result = options.parse(argc, argv);
 		
+		// --binary-log is read by main(), before the game is constructed
+		
 		// --continue
 		if (result.count("continue"))
 		{
@@ -192,6 +230,12 @@ void game::parse_options(int argc, const char* const* argv)
 			option_data = result["data"].as<std::string>();
 		}
 		
+		// --fast-forward
+		if (result.count("fast-forward"))
+		{
+			option_fast_forward = result["fast-forward"].as<double>();
+		}
+		
 		// --fullscreen
 		if (result.count("fullscreen"))
 		{
@@ -271,6 +315,7 @@ void game::setup_resources()
 	shared_config_path = paths::shared_config_directory_path() / config::application_name;
 	saves_path = shared_config_path / "saves";
 	screenshots_path = shared_config_path / "gallery";
+	profiles_path = shared_config_path / "profiles";
 	controls_path = shared_config_path / "controls";
 	
 	// Log paths
@@ -285,6 +330,7 @@ void game::setup_resources()
 	config_paths.push_back(shared_config_path);
 	config_paths.push_back(saves_path);
 	config_paths.push_back(screenshots_path);
+	config_paths.push_back(profiles_path);
 	config_paths.push_back(controls_path);
 	for (const auto& path: config_paths)
 	{
@@ -600,7 +646,7 @@ void game::load_language()
 	languages = resource_manager->load<json>("localization/languages.json");
 	
 	// Load language string map
-	string_map = resource_manager->load<json>(std::format("localization/strings.{}.json", language_tag));
+	string_map = resource_manager->load<i18n::packed_string_map>(std::format("localization/strings.{}.bin", language_tag));
 	
 	// Change window title
 	const std::string window_title = get_string(*this, "window_title");
@@ -1031,6 +1077,8 @@ void game::setup_systems()
 	
 	// Setup locomotion system
 	auto locomotion_system = std::make_shared<::locomotion_system>();
+	m_navmesh_flow_field_cache = std::make_shared<ai::navmesh_flow_field_cache>();
+	locomotion_system->set_flow_field_cache(m_navmesh_flow_field_cache);
 	
 	// Setup IK system
 	auto ik_system = std::make_shared<::ik_system>();
@@ -1042,7 +1090,8 @@ void game::setup_systems()
 	auto metamorphosis_system = std::make_shared<::metamorphosis_system>();
 	
 	// Setup animation system
-	auto animation_system = std::make_shared<::animation_system>(*entity_registry);
+	m_animation_system = std::make_shared<::animation_system>(*entity_registry);
+	m_animation_system->set_camera(exterior_camera.get());
 	
 	// Setup physics system
 	m_physics_system = std::make_shared<::physics_system>();
@@ -1068,7 +1117,7 @@ void game::setup_systems()
 	
 	// Setup astronomy system
 	m_astronomy_system = std::make_shared<::astronomy_system>(*entity_registry);
-	m_astronomy_system->set_transmittance_samples(16);
+	m_astronomy_system->set_transmittance_samples(40);
 	m_astronomy_system->set_sky_pass(sky_pass.get());
 	
 	// Setup render system
@@ -1084,7 +1133,7 @@ void game::setup_systems()
 	// Order fixed-rate updates
 	m_fixed_update_systems =
 	{
-		animation_system,
+		m_animation_system,
 		m_physics_system,
 		terrain_system,
 		collision_system,
@@ -1109,7 +1158,7 @@ void game::setup_systems()
 	m_variable_update_systems =
 	{
 		frame_interpolation_system,
-		animation_system,
+		m_animation_system,
 		camera_system,
 		m_render_system,
 	};
@@ -1272,6 +1321,7 @@ void game::setup_timing()
 	read_or_write_setting(*this, "fixed_update_rate", fixed_update_rate);
 	read_or_write_setting(*this, "max_frame_rate", max_frame_rate);
 	read_or_write_setting(*this, "limit_frame_rate", limit_frame_rate);
+	read_or_write_setting(*this, "fast_forward_frame_rate", fast_forward_frame_rate);
 	
 	const auto fixed_update_interval = std::chrono::duration_cast<engine::frame_scheduler::duration_type>(std::chrono::duration<double>(1.0 / fixed_update_rate));
 	const auto min_frame_duration = (limit_frame_rate) ? std::chrono::duration_cast<engine::frame_scheduler::duration_type>(std::chrono::duration<double>(1.0 / max_frame_rate)) : frame_scheduler::duration_type::zero();
@@ -1281,6 +1331,7 @@ void game::setup_timing()
 	frame_scheduler.set_fixed_update_interval(fixed_update_interval);
 	frame_scheduler.set_min_frame_duration(min_frame_duration);
 	frame_scheduler.set_max_frame_duration(max_frame_duration);
+	frame_scheduler.set_fast_forward_frame_duration(std::chrono::duration_cast<engine::frame_scheduler::duration_type>(std::chrono::duration<double>(1.0 / fast_forward_frame_rate)));
 	frame_scheduler.set_fixed_update_callback(std::bind_front(&game::fixed_update, this));
 	frame_scheduler.set_variable_update_callback(std::bind_front(&game::variable_update, this));
 	
@@ -1290,6 +1341,47 @@ void game::setup_timing()
 	debug::log_debug("Setting up timing... OK");
 }
 
+void game::update_profiler()
+{
+	if constexpr (!debug::g_profiler_enabled)
+	{
+		return;
+	}
+	
+	auto& profiler = debug::default_profiler();
+	
+	// Collect events recorded since the previous collection
+	profile_events.clear();
+	profiler.collect(profile_events);
+	
+	// Accumulate events of a capture in progress
+	if (profile_capture_frame_count)
+	{
+		profile_capture_events.insert(profile_capture_events.end(), profile_events.begin(), profile_events.end());
+		
+		// Write captured events to a trace file once the capture is complete
+		if (!--profile_capture_frame_count)
+		{
+			const std::string profile_capture_path_string = profile_capture_path.string();
+			std::ofstream stream(profile_capture_path);
+			if (stream)
+			{
+				debug::write_chrome_trace(stream, profile_capture_events);
+				debug::log_info("Saved {} profile events to \"{}\"", profile_capture_events.size(), profile_capture_path_string);
+			}
+			else
+			{
+				debug::log_error("Failed to save profile to \"{}\"", profile_capture_path_string);
+			}
+			
+			profile_capture_events.clear();
+		}
+	}
+	
+	// Record scopes only while they are displayed or captured
+	profiler.set_enabled(debug_ui_visible || profile_capture_frame_count);
+}
+
 void game::fixed_update(engine::frame_scheduler::duration_type fixed_update_time, engine::frame_scheduler::duration_type fixed_update_interval)
 {
 	const float t = std::chrono::duration<float>(fixed_update_time).count();
@@ -1306,6 +1398,7 @@ void game::fixed_update(engine::frame_scheduler::duration_type fixed_update_time
 	}
 	
 	// Update systems
+	debug::profile_scope profile("game::fixed_update");
 	for (const auto& system: m_fixed_update_systems)
 	{
 		system->fixed_update(*entity_registry, t, dt);
@@ -1318,17 +1411,23 @@ void game::variable_update(engine::frame_scheduler::duration_type fixed_update_t
 	const float dt = std::chrono::duration<float>(fixed_update_interval).count();
 	const float alpha = static_cast<float>(std::chrono::duration<double, engine::frame_scheduler::duration_type::period>{accumulated_time} / fixed_update_interval);
 	
+	// Collect profile events of the previous frame
+	update_profiler();
+	
 	// Sample average frame duration
 	const float average_frame_ms = average_frame_duration(std::chrono::duration<float, std::milli>(frame_scheduler.get_frame_duration()).count());
 	const float average_frame_fps = 1000.0f / average_frame_ms;
 	
-	// Update frame rate display
-	frame_time_text->set_content(std::format("{:5.02f}ms / {:5.02f} FPS", average_frame_ms, average_frame_fps));
+	// Update frame rate, animation LOD, and simulation rate display
+	const auto& lod_counts = m_animation_system->get_lod_counts();
+	const double simulation_rate = frame_scheduler.get_simulation_rate();
+	frame_time_text->set_content(std::format("{:5.02f}ms / {:5.02f} FPS\nAnimation LODs: {} / {} / {} / {}\nSimulation: {:.01f}x ({:.0f} game s/s){}", average_frame_ms, average_frame_fps, lod_counts[0], lod_counts[1], lod_counts[2], lod_counts[3], simulation_rate, simulation_rate * get_time_scale(*entity_registry), frame_scheduler.is_fast_forward() ? " >>" : "") + format_profile_summary(profile_events, 8));
 	
 	// Process input events
 	input_manager->update();
 
 	// Update systems
+	debug::profile_scope profile("game::variable_update");
 	for (const auto& system: m_variable_update_systems)
 	{
 		system->variable_update(*entity_registry, t, dt, alpha);
@@ -1346,6 +1445,15 @@ void game::execute()
 	debug::log_debug("Entered main loop");
 
 	frame_scheduler.refresh();
+	
+	// Fast-forward by the number of seconds given on the command line
+	if (option_fast_forward)
+	{
+		const auto duration = std::chrono::duration_cast<engine::frame_scheduler::duration_type>(std::chrono::duration<double>(*option_fast_forward));
+		debug::log_info("Fast-forwarding {} seconds", *option_fast_forward);
+		frame_scheduler.set_fast_forward_end_time(frame_scheduler.get_fixed_update_time() + duration);
+		frame_scheduler.set_fast_forward(true);
+	}
 
 	while (!closed)
 	{
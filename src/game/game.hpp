@@ -10,12 +10,14 @@
 #include "game/ecoregion.hpp"
 #include "game/states/game-state.hpp"
 #include "game/systems/component-system.hpp"
+#include <engine/ai/navmesh-flow-field.hpp>
 #include <engine/gl/framebuffer.hpp>
 #include <engine/gl/texture.hpp>
 #include <engine/render/anti-aliasing-method.hpp>
 #include <engine/render/material-variable.hpp>
 #include <engine/render/material.hpp>
 #include <engine/event/subscription.hpp>
+#include <engine/i18n/packed-string-map.hpp>
 #include <engine/i18n/string-map.hpp>
 #include <engine/script/script-context.hpp>
 #include <engine/entity/id.hpp>
@@ -35,6 +37,7 @@
 #include <engine/utility/state-machine.hpp>
 #include <engine/utility/frame-scheduler.hpp>
 #include <engine/utility/sized-types.hpp>
+#include <engine/debug/profiler.hpp>
 #include <engine/scene/text.hpp>
 #include <engine/scene/directional-light.hpp>
 #include <engine/scene/rectangle-light.hpp>
@@ -75,6 +78,7 @@ namespace engine::render
 
 class shell;
 class shell_buffer;
+class animation_system;
 class astronomy_system;
 class atmosphere_system;
 class blackbody_system;
@@ -105,6 +109,7 @@ public:
 	// Command-line options
 	std::optional<bool> option_continue;
 	std::optional<std::string> option_data;
+	std::optional<double> option_fast_forward;
 	std::optional<bool> option_fullscreen;
 	std::optional<bool> option_new_game;
 	std::optional<bool> option_quick_start;
@@ -120,6 +125,7 @@ public:
 	std::filesystem::path shared_config_path;
 	std::filesystem::path saves_path;
 	std::filesystem::path screenshots_path;
+	std::filesystem::path profiles_path;
 	std::filesystem::path controls_path;
 	
 	// Persistent settings
@@ -152,7 +158,8 @@ public:
 	// Localization and internationalization
 	std::shared_ptr<json> languages;
 	std::string language_tag;
-	std::shared_ptr<json> string_map;
+	std::shared_ptr<i18n::packed_string_map> string_map;
+	i18n::string_map string_overrides;
 	
 	// Fonts
 	std::unordered_map<hash::fnv32_t, std::shared_ptr<type::typeface>> typefaces;
@@ -223,6 +230,7 @@ public:
 	input::action toggle_debug_ui_action;
 	input::action adjust_exposure_action;
 	input::action adjust_time_action;
+	input::action toggle_fast_forward_action;
 	
 	input::action_map terminal_action_map;
 	input::action terminal_up_action;
@@ -271,6 +279,10 @@ public:
 	// Debugging
 	bool debug_ui_visible{false};
 	std::unique_ptr<scene::text> frame_time_text;
+	std::vector<debug::profile_event> profile_events;
+	std::vector<debug::profile_event> profile_capture_events;
+	usize profile_capture_frame_count{0};
+	std::filesystem::path profile_capture_path;
 	bool terminal_enabled{false};
 	std::string command_line;
 	usize command_line_cursor{};
@@ -391,6 +403,7 @@ public:
 	entity::id active_camera_eid{entt::null};
 	
 	// Systems
+	std::shared_ptr<animation_system> m_animation_system;
 	std::shared_ptr<constraint_system> m_constraint_system;
 	std::shared_ptr<physics_system> m_physics_system;
 	std::shared_ptr<render_system> m_render_system;
@@ -398,6 +411,7 @@ public:
 	std::shared_ptr<atmosphere_system> m_atmosphere_system;
 	std::shared_ptr<astronomy_system> m_astronomy_system;
 	std::shared_ptr<orbit_system> m_orbit_system;
+	std::shared_ptr<ai::navmesh_flow_field_cache> m_navmesh_flow_field_cache;
 	std::vector<std::shared_ptr<fixed_update_system>> m_fixed_update_systems;
 	std::vector<std::shared_ptr<variable_update_system>> m_variable_update_systems;
 	
@@ -405,6 +419,7 @@ public:
 	float fixed_update_rate{60.0};
 	float max_frame_rate{120.0};
 	bool limit_frame_rate{false};
+	float fast_forward_frame_rate{10.0};
 	engine::frame_scheduler frame_scheduler;
 	math::moving_average<float> average_frame_duration;
 	
@@ -429,6 +444,7 @@ private:
 	void setup_scripting();
 	void setup_debugging();
 	void setup_timing();
+	void update_profiler();
 	
 	void fixed_update(engine::frame_scheduler::duration_type fixed_update_time, engine::frame_scheduler::duration_type fixed_update_interval);
 	void variable_update(engine::frame_scheduler::duration_type fixed_update_time, engine::frame_scheduler::duration_type fixed_update_interval, engine::frame_scheduler::duration_type accumulated_time);
@@ -187,6 +187,7 @@ static bool load_component_orbit(entity::archetype& archetype, const json& eleme
 	component.ephemeris_index = -1;
 	component.scale = 1.0;
 	component.position = {0, 0, 0};
+	component.velocity = {0, 0, 0};
 	
 	if (element.contains("ephemeris_index"))
 		component.ephemeris_index = element["ephemeris_index"].get<int>();
@@ -2,16 +2,23 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include "game/game.hpp"
+#include "game/options.hpp"
 #include <engine/config.hpp>
 #include <engine/utility/json.hpp>
 #include <engine/utility/paths.hpp>
+#include <engine/debug/binary-log.hpp>
 #include <engine/debug/console-log.hpp>
 #include <engine/debug/file-log.hpp>
 #include <engine/debug/crash-reporter.hpp>
 #include <engine/debug/log.hpp>
 #include <engine/utility/sized-types.hpp>
 #include <chrono>
+#include <exception>
+#include <memory>
 #include <set>
+#include <string>
+#include <string_view>
+#include <utility>
 
 using namespace engine;
 
@@ -36,9 +43,22 @@ int main(int argc, char* argv[])
 	// Determine path to log archive
 	const std::filesystem::path log_archive_path = shared_config_directory / config::application_name / "logs";
 	
-	// Determine log file prefix
+	// Detect binary log option, which must be known before the log file is opened. Malformed command lines are reported by the game
+	bool binary_log_enabled = false;
+	try
+	{
+		auto options = make_options();
+		options.allow_unrecognised_options();
+		binary_log_enabled = options.parse(argc, argv).count("binary-log") > 0;
+	}
+	catch (const std::exception&)
+	{}
+	
+	// Determine log file prefix and extensions
 	const std::string log_stem_prefix = std::format("{}-log-", config::application_slug);
-	const std::string log_extension = ".tsv";
+	constexpr std::string_view text_log_extension = ".tsv";
+	constexpr std::string_view binary_log_extension = ".aklog";
+	const std::string_view log_extension = binary_log_enabled ? binary_log_extension : text_log_extension;
 	
 	// Set up log archive
 	bool log_archive_exists = false;
@@ -59,10 +79,18 @@ int main(int argc, char* argv[])
 
 	// Open file log
 	std::unique_ptr<debug::file_log> file_log;
+	std::unique_ptr<debug::binary_log> binary_log;
 	if (config::debug_log_archive_capacity && log_archive_exists)
 	{
 		const auto log_filename = std::format("{0}{1:%Y%m%d}T{1:%H%M%S}Z{2}", log_stem_prefix, std::chrono::floor<std::chrono::seconds>(launch_time), log_extension);
-		file_log = std::make_unique<debug::file_log>(log_archive_path / log_filename);
+		if (binary_log_enabled)
+		{
+			binary_log = std::make_unique<debug::binary_log>(log_archive_path / log_filename);
+		}
+		else
+		{
+			file_log = std::make_unique<debug::file_log>(log_archive_path / log_filename);
+		}
 	}
 	
 	// Start marker
@@ -79,15 +107,20 @@ int main(int argc, char* argv[])
 	{
 		try
 		{
-			// Detect and sort archived logs
-			std::set<std::filesystem::path> log_archive;
+			// Detect archived logs of both formats, sorted by the timestamps in their stems
+			std::set<std::pair<std::string, std::filesystem::path>> log_archive;
 			for (const auto& entry: std::filesystem::directory_iterator{log_archive_path})
 			{
-				if (entry.is_regular_file() &&
-					entry.path().extension() == log_extension &&
-					entry.path().stem().string().starts_with(log_stem_prefix))
+				if (!entry.is_regular_file())
+				{
+					continue;
+				}
+				
+				const auto extension = entry.path().extension();
+				std::string stem = entry.path().stem().string();
+				if ((extension == text_log_extension || extension == binary_log_extension) && stem.starts_with(log_stem_prefix))
 				{
-					log_archive.emplace(entry.path());
+					log_archive.emplace(std::move(stem), entry.path());
 				}
 			}
 			
@@ -98,9 +131,9 @@ int main(int argc, char* argv[])
 			{
 				for (usize i = log_archive.size(); i > config::debug_log_archive_capacity; --i)
 				{
-					if (std::filesystem::remove(*log_archive.begin()))
+					if (std::filesystem::remove(log_archive.begin()->second))
 					{
-						debug::log_debug("Deleted expired log file \"{}\"", log_archive.begin()->string());
+						debug::log_debug("Deleted expired log file \"{}\"", log_archive.begin()->second.string());
 					}
 
 					log_archive.erase(log_archive.begin());
@@ -1669,7 +1669,7 @@ namespace
 				ctx.language_tag = language_it.key();
 
 				// Load language strings
-				ctx.string_map = ctx.resource_manager->load<json>(std::format("localization/strings.{}.json", ctx.language_tag));
+				ctx.string_map = ctx.resource_manager->load<i18n::packed_string_map>(std::format("localization/strings.{}.bin", ctx.language_tag));
 
 				// Update language tag settings
 				(*ctx.settings)["language_tag"] = ctx.language_tag;
@@ -0,0 +1,26 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "game/options.hpp"
+#include <engine/config.hpp>
+#include <string>
+
+using namespace engine;
+
+cxxopts::Options make_options()
+{
+	cxxopts::Options options(config::application_name, config::application_name);
+	options.add_options()
+		("b,binary-log", "Writes the log archive in binary format")
+		("c,continue", "Continues from the last save")
+		("d,data", "Sets the data package path", cxxopts::value<std::string>())
+		("F,fast-forward", "Fast-forwards the simulation by a number of seconds", cxxopts::value<double>())
+		("f,fullscreen", "Starts in fullscreen mode")
+		("n,new-game", "Starts a new game")
+		("q,quick-start", "Skips to the main menu")
+		("r,reset", "Resets all settings to default")
+		("v,v-sync", "Enables or disables v-sync", cxxopts::value<int>())
+		("w,windowed", "Starts in windowed mode");
+	
+	return options;
+}
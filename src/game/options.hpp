@@ -0,0 +1,14 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef ANTKEEPER_GAME_OPTIONS_HPP
+#define ANTKEEPER_GAME_OPTIONS_HPP
+
+// Prevent cxxopts from using RTTI
+#define CXXOPTS_NO_RTTI
+#include <cxxopts.hpp>
+
+/// Returns the command-line options of the game.
+[[nodiscard]] cxxopts::Options make_options();
+
+#endif // ANTKEEPER_GAME_OPTIONS_HPP
@@ -1,17 +1,24 @@
 // SPDX-FileCopyrightText: 2025 C. J. Howard
 // SPDX-License-Identifier: GPL-3.0-or-later
 
-#include <nlohmann/json.hpp>
 #include "game/strings.hpp"
+#include <engine/hash/fnv.hpp>
 #include <format>
 
 std::string get_string(const ::game& ctx, std::string_view key)
 {
-	if (auto it = ctx.string_map->find(key); it != ctx.string_map->end())
+	const auto key_hash = hash::fnv1a32<char>(key);
+	
+	if (auto it = ctx.string_overrides.find(key_hash); it != ctx.string_overrides.end())
+	{
+		return it->second;
+	}
+	
+	if (ctx.string_map)
 	{
-		if (it->is_string())
+		if (const auto value = ctx.string_map->find(key_hash))
 		{
-			return it->get<std::string>();
+			return std::string(*value);
 		}
 	}
 	
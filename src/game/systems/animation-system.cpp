@@ -7,6 +7,8 @@
 #include "game/components/pose-component.hpp"
 #include "game/components/scene-object-component.hpp"
 #include "game/components/animation-component.hpp"
+#include "game/components/animation-lod-component.hpp"
+#include <engine/debug/profiler.hpp>
 #include <engine/animation/bone.hpp>
 #include <engine/math/functions.hpp>
 #include <engine/scene/skeletal-mesh.hpp>
@@ -19,11 +21,21 @@ animation_system::animation_system(entity::registry& registry):
 	m_registry(registry)
 {
 	m_registry.on_construct<animation_component>().connect<&animation_system::on_animation_construct>(this);
+	m_registry.on_construct<pose_component>().connect<&animation_system::on_pose_construct>(this);
+	m_registry.on_update<pose_component>().connect<&animation_system::on_pose_update>(this);
+	
+	// Add animation LODs to entities which were posed before the system was constructed
+	for (auto entity_id: m_registry.view<pose_component>(entt::exclude<animation_lod_component>))
+	{
+		on_pose_construct(m_registry, entity_id);
+	}
 }
 
 animation_system::~animation_system()
 {
 	m_registry.on_construct<animation_component>().disconnect<&animation_system::on_animation_construct>(this);
+	m_registry.on_construct<pose_component>().disconnect<&animation_system::on_pose_construct>(this);
+	m_registry.on_update<pose_component>().disconnect<&animation_system::on_pose_update>(this);
 }
 
 void animation_system::fixed_update(entity::registry&, float, float)
@@ -31,7 +43,23 @@ void animation_system::fixed_update(entity::registry&, float, float)
 
 void animation_system::variable_update(entity::registry& registry, float t, float dt, float alpha)
 {
-	auto pose_group = registry.group<pose_component>(entt::get<scene_object_component>);
+	debug::profile_scope profile("animation_system::variable_update");
+
+	++m_frame_index;
+
+	auto pose_group = registry.group<pose_component>(entt::get<scene_object_component, animation_lod_component>);
+
+	// Select animation LODs from the projected sizes of skeletal meshes
+	m_lod_counts = {};
+	for (auto entity_id: pose_group)
+	{
+		auto& lod = pose_group.get<animation_lod_component>(entity_id);
+		const auto& skeletal_mesh = static_cast<const scene::skeletal_mesh&>(*pose_group.get<scene_object_component>(entity_id).object);
+
+		lod.lod = select_lod(skeletal_mesh);
+		++m_lod_counts[static_cast<usize>(lod.lod)];
+	}
+
 	std::for_each
 	(
 		std::execution::par_unseq,
@@ -39,11 +67,35 @@ void animation_system::variable_update(entity::registry& registry, float t, floa
 		pose_group.end(),
 		[&](auto entity_id)
 		{
+			const auto& lod = pose_group.get<animation_lod_component>(entity_id);
+			const auto lod_frame_index = m_frame_index + lod.phase;
+
+			// Throttle pose updates according to LOD, staggered across frames
+			if (lod.lod == animation_lod::frozen ||
+				(lod.lod == animation_lod::reduced && lod_frame_index % 2) ||
+				(lod.lod == animation_lod::minimal && lod_frame_index % 4))
+			{
+				return;
+			}
+
 			auto& pose = pose_group.get<pose_component>(entity_id);
 			auto& scene = pose_group.get<scene_object_component>(entity_id);
 			
 			auto& skeletal_mesh = static_cast<scene::skeletal_mesh&>(*scene.object);
-			for (usize i = 0; i < skeletal_mesh.get_skeleton()->bones().size(); ++i)
+			const auto bone_count = skeletal_mesh.get_skeleton()->bones().size();
+
+			if (lod.lod == animation_lod::minimal)
+			{
+				// Snap bone pose to current state
+				for (usize i = 0; i < bone_count; ++i)
+				{
+					skeletal_mesh.get_pose().set_relative_transform(i, pose.current_pose.get_relative_transform(i));
+				}
+
+				return;
+			}
+
+			for (usize i = 0; i < bone_count; ++i)
 			{
 				const auto& previous_transform = pose.previous_pose.get_relative_transform(i);
 				const auto& current_transform = pose.current_pose.get_relative_transform(i);
@@ -83,3 +135,71 @@ void animation_system::on_animation_construct(entity::registry& registry, entity
 	// Init animation player context
 	animation.player.context() = {entt::handle(registry, entity)};
 }
+
+void animation_system::on_pose_construct(entity::registry& registry, entity::id entity)
+{
+	// Stagger throttled pose updates by entity
+	registry.emplace_or_replace<animation_lod_component>(entity, animation_lod::full, static_cast<u8>(entt::to_entity(entity)));
+}
+
+void animation_system::on_pose_update(entity::registry& registry, entity::id entity)
+{
+	// Add an animation LOD if the pose was replaced or patched onto an entity which missed the construct signal
+	if (!registry.all_of<animation_lod_component>(entity))
+	{
+		on_pose_construct(registry, entity);
+	}
+}
+
+void animation_system::set_camera(const scene::camera* camera)
+{
+	m_camera = camera;
+}
+
+void animation_system::set_lod_thresholds(const std::array<float, animation_lod_count - 1>& thresholds)
+{
+	m_lod_thresholds = thresholds;
+}
+
+animation_lod animation_system::select_lod(const scene::skeletal_mesh& skeletal_mesh) const
+{
+	if (!m_camera)
+	{
+		return animation_lod::full;
+	}
+
+	// Freeze skeletal meshes outside of the view frustum
+	const auto& bounds = skeletal_mesh.get_bounds();
+	if (!m_camera->get_view_frustum().intersects(bounds))
+	{
+		return animation_lod::frozen;
+	}
+
+	// Measure diameter of the bounding sphere, as a fraction of the viewport height
+	const float diameter = math::length(bounds.size());
+	float projected_size;
+	if (m_camera->is_orthographic())
+	{
+		projected_size = diameter / math::abs(m_camera->get_clip_top() - m_camera->get_clip_bottom());
+	}
+	else
+	{
+		const float distance = math::length(bounds.center() - m_camera->get_translation());
+		if (distance <= diameter * 0.5f)
+		{
+			return animation_lod::full;
+		}
+
+		projected_size = diameter / (2.0f * distance * math::tan(m_camera->get_vertical_fov() * 0.5f));
+	}
+
+	for (usize i = 0; i < m_lod_thresholds.size(); ++i)
+	{
+		if (projected_size >= m_lod_thresholds[i])
+		{
+			return static_cast<animation_lod>(i);
+		}
+	}
+
+	return animation_lod::frozen;
+}
@@ -6,7 +6,12 @@
 
 #include "game/systems/fixed-update-system.hpp"
 #include "game/systems/variable-update-system.hpp"
+#include "game/components/animation-lod-component.hpp"
 #include <engine/entity/id.hpp>
+#include <engine/scene/camera.hpp>
+#include <engine/scene/skeletal-mesh.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <array>
 #include <memory>
 #include <vector>
 
@@ -24,12 +29,36 @@ public:
 	void fixed_update(entity::registry& registry, float t, float dt) override;
 	void variable_update(entity::registry& registry, float t, float dt, float alpha) override;
 
+	/// Sets the camera from which the projected sizes of skeletal meshes are measured.
+	/// @param camera Camera from which animation levels of detail are selected, or `nullptr` to animate all skeletal meshes at full detail.
+	void set_camera(const scene::camera* camera);
+
+	/// Sets the projected size thresholds of the animation levels of detail.
+	/// @param thresholds Minimum projected sizes of the `full`, `reduced`, and `minimal` levels of detail, as fractions of the viewport height, in descending order. Skeletal meshes smaller than the last threshold, or outside of the view frustum, are frozen.
+	void set_lod_thresholds(const std::array<float, animation_lod_count - 1>& thresholds);
+
+	/// Returns the number of skeletal meshes animated at each level of detail in the last variable update, indexed by animation_lod.
+	[[nodiscard]] inline const std::array<usize, animation_lod_count>& get_lod_counts() const noexcept
+	{
+		return m_lod_counts;
+	}
+
 private:
 	void on_animation_construct(entity::registry& registry, entity::id entity);
+	void on_pose_construct(entity::registry& registry, entity::id entity);
+	void on_pose_update(entity::registry& registry, entity::id entity);
+
+	/// Selects the animation level of detail of a skeletal mesh.
+	[[nodiscard]] animation_lod select_lod(const scene::skeletal_mesh& skeletal_mesh) const;
 
 	entity::registry& m_registry;
 	float m_previous_render_time{};
 	float m_render_time{};
+
+	const scene::camera* m_camera{};
+	std::array<float, animation_lod_count - 1> m_lod_thresholds{0.05f, 0.01f, 0.0025f};
+	std::array<usize, animation_lod_count> m_lod_counts{};
+	usize m_frame_index{};
 };
 
 #endif // ANTKEEPER_GAME_ANIMATION_SYSTEM_HPP
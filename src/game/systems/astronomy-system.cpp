@@ -7,8 +7,7 @@
 #include "game/components/transform-component.hpp"
 #include "game/components/diffuse-reflector-component.hpp"
 #include "game/utility/time.hpp"
-#include <engine/geom/intersection.hpp>
-#include <engine/geom/primitives/sphere.hpp>
+#include <engine/debug/profiler.hpp>
 #include <engine/physics/orbit/frame.hpp>
 #include <engine/physics/time.hpp>
 #include <engine/physics/light/photometry.hpp>
@@ -72,6 +71,8 @@ astronomy_system::~astronomy_system()
 
 void astronomy_system::fixed_update(entity::registry& registry, float, float dt)
 {
+	debug::profile_scope profile("astronomy_system::fixed_update");
+	
 	const auto time_scale = get_time_scale(registry);
 	const auto astronomical_time_scale = time_scale / physics::time::seconds_per_day<double>;
 
@@ -109,6 +110,12 @@ void astronomy_system::fixed_update(entity::registry& registry, float, float dt)
 	// Update ICRF to EUS transformation
 	update_icrf_to_eus(*reference_body, *reference_orbit);
 	
+	// Rebuild transmittance LUT if the atmosphere has changed since it was last built
+	if (reference_atmosphere && m_transmittance_lut_dirty)
+	{
+		rebuild_transmittance_lut(*reference_body, *reference_atmosphere);
+	}
+	
 	// Set the transform component translations of orbiting bodies to their topocentric positions
 	registry.view<celestial_body_component, orbit_component, transform_component>().each
 	(
@@ -166,11 +173,8 @@ void astronomy_system::fixed_update(entity::registry& registry, float, float dt)
 		math::dvec3 observer_blackbody_transmitted_illuminance = observer_blackbody_illuminance;
 		if (reference_atmosphere)
 		{
-			// Construct ray at observer pointing towards the blackbody
-			const geom::ray<double, 3> ray = {{0, 0, 0}, observer_blackbody_direction_eus};
-			
-			// Integrate atmospheric spectral transmittance factor between observer and blackbody
-			math::dvec3 transmittance = integrate_transmittance(*observer, *reference_body, *reference_atmosphere, ray);
+			// Look up atmospheric spectral transmittance factor between observer and blackbody
+			const math::dvec3 transmittance = lookup_transmittance(*observer, *reference_body, *reference_atmosphere, observer_blackbody_direction_eus);
 
 			// Attenuate illuminance from blackbody reaching observer by spectral transmittance factor
 			observer_blackbody_transmitted_illuminance *= transmittance;
@@ -252,8 +256,7 @@ void astronomy_system::fixed_update(entity::registry& registry, float, float dt)
 			math::dvec3 observer_reflector_transmittance = {1, 1, 1};
 			if (reference_atmosphere)
 			{
-				// const geom::ray<double, 3> ray = {{0, 0, 0}, observer_reflector_direction_eus};
-				// observer_reflector_transmittance = integrate_transmittance(*observer, *reference_body, *reference_atmosphere, ray);
+				observer_reflector_transmittance = lookup_transmittance(*observer, *reference_body, *reference_atmosphere, observer_reflector_direction_eus);
 			}
 			
 			// Measure luminance of observer reference body as seen by reflector
@@ -262,11 +265,12 @@ void astronomy_system::fixed_update(entity::registry& registry, float, float dt)
 			// Measure illuminance from observer reference body reaching reflector
 			const math::dvec3 reflector_observer_illuminance = reflector_observer_luminance * reflector_observer_solid_angle;
 			
-			// Measure luminance of reflector as seen by observer
-			const math::dvec3 observer_reflector_luminance = (reflector_blackbody_illuminance * observer_reflector_phase_factor + reflector_observer_illuminance) * reflector.albedo * observer_reflector_transmittance * math::inv_pi<double>;
+			// Measure luminance of reflector as seen by observer, before atmospheric extinction
+			const math::dvec3 observer_reflector_exoatmospheric_luminance = (reflector_blackbody_illuminance * observer_reflector_phase_factor + reflector_observer_illuminance) * reflector.albedo * math::inv_pi<double>;
 			
-			// Measure illuminance from reflector reaching observer
-			const math::dvec3 observer_reflector_illuminance = observer_reflector_luminance * observer_reflector_solid_angle;
+			// Measure illuminance from reflector reaching observer, before and after atmospheric extinction
+			const math::dvec3 observer_reflector_exoatmospheric_illuminance = observer_reflector_exoatmospheric_luminance * observer_reflector_solid_angle;
+			const math::dvec3 observer_reflector_illuminance = observer_reflector_exoatmospheric_illuminance * observer_reflector_transmittance;
 			
 			if (m_sky_pass)
 			{
@@ -277,7 +281,7 @@ void astronomy_system::fixed_update(entity::registry& registry, float, float dt)
 				m_sky_pass->set_moon_sunlight_illuminance(math::fvec3(reflector_blackbody_illuminance * observer_reflector_transmittance));
 				m_sky_pass->set_moon_planetlight_direction(math::fvec3(observer_reflector_direction_eus));
 				m_sky_pass->set_moon_planetlight_illuminance(math::fvec3(reflector_observer_illuminance * observer_reflector_transmittance));
-				m_sky_pass->set_moon_illuminance(math::fvec3(observer_reflector_illuminance / observer_reflector_transmittance), math::fvec3(observer_reflector_illuminance));
+				m_sky_pass->set_moon_illuminance(math::fvec3(observer_reflector_exoatmospheric_illuminance), math::fvec3(observer_reflector_illuminance));
 			}
 			
 			if (m_moon_light)
@@ -331,6 +335,13 @@ void astronomy_system::set_observer(entity::id eid)
 void astronomy_system::set_transmittance_samples(usize samples)
 {
 	m_transmittance_samples = samples;
+	m_transmittance_lut_dirty = true;
+}
+
+void astronomy_system::set_transmittance_lut_resolution(const math::vec2<usize>& resolution)
+{
+	m_transmittance_lut_resolution = resolution;
+	m_transmittance_lut_dirty = true;
 }
 
 void astronomy_system::set_sun_light(scene::directional_light* light)
@@ -463,6 +474,9 @@ void astronomy_system::observer_modified()
 
 void astronomy_system::reference_body_modified()
 {
+	// Transmittance LUT depends on the radius of the reference body
+	m_transmittance_lut_dirty = true;
+	
 	// Get pointer to reference celestial body
 	const auto reference_body = m_registry.try_get<celestial_body_component>(m_reference_body_eid);
 	
@@ -493,7 +507,7 @@ void astronomy_system::reference_orbit_modified()
 
 void astronomy_system::reference_atmosphere_modified()
 {
-
+	m_transmittance_lut_dirty = true;
 }
 
 void astronomy_system::update_bcbf_to_eus(const ::observer_component& observer, const ::celestial_body_component& body)
@@ -541,63 +555,43 @@ void astronomy_system::update_icrf_to_eus(const ::celestial_body_component& body
 	}
 }
 
-math::dvec3 astronomy_system::integrate_transmittance(const ::observer_component& observer, const ::celestial_body_component& body, const ::atmosphere_component& atmosphere, geom::ray<double, 3> ray) const
+void astronomy_system::rebuild_transmittance_lut(const ::celestial_body_component& body, const ::atmosphere_component& atmosphere)
 {
-	math::dvec3 transmittance = {1, 1, 1};
+	physics::gas::transmittance_lut::profile profile;
+	profile.planet_radius = body.radius;
+	profile.upper_limit = atmosphere.upper_limit;
+	profile.rayleigh_scale_height = atmosphere.rayleigh_scale_height;
+	profile.mie_scale_height = atmosphere.mie_scale_height;
+	profile.ozone_lower_limit = atmosphere.ozone_lower_limit;
+	profile.ozone_upper_limit = atmosphere.ozone_upper_limit;
+	profile.ozone_mode = atmosphere.ozone_mode;
 	
-	// Make ray height relative to center of reference body
-	ray.origin.y() += body.radius + observer.elevation;
-	
-	// Construct sphere representing upper limit of the atmosphere
-	geom::sphere<double> atmosphere_sphere;
-	atmosphere_sphere.center = {0, 0, 0};
-	atmosphere_sphere.radius = body.radius + atmosphere.upper_limit;
+	m_transmittance_lut.build(profile, m_transmittance_lut_resolution, m_transmittance_samples);
+	m_transmittance_lut_dirty = false;
+}
+
+math::dvec3 astronomy_system::lookup_transmittance(const ::observer_component& observer, const ::celestial_body_component& body, const ::atmosphere_component& atmosphere, const math::dvec3& direction) const
+{
+	// Up is +Y in the EUS frame
+	const double radius = body.radius + observer.elevation;
+	const double cos_view_zenith = direction.y();
 	
-	// Check for intersection between the ray and atmosphere
-	auto intersection = geom::intersection(ray, atmosphere_sphere);
-	if (intersection && std::get<1>(*intersection) > 0.0)
+	// Look up column densities of atmospheric particles along the ray
+	const auto densities = m_transmittance_lut.lookup(radius, cos_view_zenith);
+	if (!densities)
 	{
-		// Determine height at ray origin and cosine of the angle between the ray direction and local zenith direction at ray origin
-		const double height = math::length(ray.origin);
-		const double cos_view_zenith = math::dot(ray.direction, ray.origin) / height;
-		
-		// Precalculate terms re-used in sample height calculation
-		const double sqr_height = height * height;
-		const double height_cos_view_zenith = height * cos_view_zenith;
-		const double two_height_cos_view_zenith = 2.0 * height_cos_view_zenith;
-		
-		// Get distance to upper limit of atmosphere
-		const double sample_end_distance = std::get<1>(*intersection);
-		
-		// Integrate atmospheric particle densities
-		math::dvec3 densities{};
-		double previous_sample_distance = 0.0;
-		for (usize i = 0; i < m_transmittance_samples; ++i)
-		{
-			// Determine distance along sample ray to sample point and length of the sample
-			const double sample_distance = (static_cast<double>(i) + 0.5) / static_cast<double>(m_transmittance_samples) * sample_end_distance;
-			const double sample_length = sample_distance - previous_sample_distance;
-			previous_sample_distance = sample_distance;
-			
-			// Calculate sample elevation
-			const double sample_height = math::sqrt(sample_distance * sample_distance + sqr_height + two_height_cos_view_zenith * sample_distance);
-			const double sample_elevation = sample_height - body.radius;
-			
-			// Weigh and sum atmospheric particle densities at sample elevation
-			densities.x() += physics::gas::atmosphere::density::exponential(1.0, sample_elevation, atmosphere.rayleigh_scale_height) * sample_length;
-			densities.y() += physics::gas::atmosphere::density::exponential(1.0, sample_elevation, atmosphere.mie_scale_height) * sample_length;
-			densities.x() += physics::gas::atmosphere::density::triangular(1.0, sample_elevation, atmosphere.ozone_lower_limit, atmosphere.ozone_upper_limit, atmosphere.ozone_mode) * sample_length;
-		}
-		
-		// Calculate extinction coefficients from integrated atmospheric particle densities
-		const math::dvec3 extinction = densities.x() * atmosphere.rayleigh_scattering +
-			densities.y() * atmosphere.mie_extinction +
-			densities.z() * atmosphere.ozone_absorption;
-		
-		// Calculate transmittance factor from extinction coefficients
-		transmittance = {math::exp(-extinction.x()), math::exp(-extinction.y()), math::exp(-extinction.z())};
+		// Ray is occluded by the reference body
+		return {0, 0, 0};
 	}
 	
+	// Calculate extinction coefficients from integrated atmospheric particle densities
+	const math::dvec3 extinction = densities->x() * atmosphere.rayleigh_scattering +
+		densities->y() * atmosphere.mie_extinction +
+		densities->z() * atmosphere.ozone_absorption;
+	
+	// Calculate transmittance factor from extinction coefficients
+	const math::dvec3 transmittance = {math::exp(-extinction.x()), math::exp(-extinction.y()), math::exp(-extinction.z())};
+	
 	// Scatter in BT.709, then convert to BT.2020
 	return color::bt2020<double>.xyz_to_rgb(color::bt709<double>.rgb_to_xyz(transmittance));
 }
@@ -13,8 +13,8 @@
 #include <engine/scene/directional-light.hpp>
 #include <engine/math/vector.hpp>
 #include <engine/math/se3.hpp>
-#include <engine/geom/primitives/ray.hpp>
 #include <engine/render/passes/sky-pass.hpp>
+#include <engine/physics/gas/transmittance-lut.hpp>
 #include <engine/utility/sized-types.hpp>
 
 using namespace engine;
@@ -36,10 +36,14 @@ public:
 	/// @param eid Entity ID of the observer.
 	void set_observer(entity::id eid);
 	
-	/// Sets the number of samples to take when integrating atmospheric transmittance.
+	/// Sets the number of samples to take when integrating each entry of the atmospheric transmittance LUT.
 	/// @param samples Number of integration samples.
 	void set_transmittance_samples(usize samples);
 	
+	/// Sets the resolution of the atmospheric transmittance LUT.
+	/// @param resolution Resolution of the transmittance LUT, in view zenith angle and height.
+	void set_transmittance_lut_resolution(const math::vec2<usize>& resolution);
+	
 	void set_sun_light(scene::directional_light* light);
 	void set_moon_light(scene::directional_light* light);
 	void set_starlight_illuminance(const math::dvec3& illuminance);
@@ -78,11 +82,13 @@ private:
 	/// Updates the ICRF to EUS transformation.
 	void update_icrf_to_eus(const ::celestial_body_component& body, const ::orbit_component& orbit);
 	
-	/// Integrates a transmittance factor due to atmospheric extinction along a ray.
-	/// @param ray Ray to cast, in the EUS frame.
-	/// @param samples Number of samples to integrate.
+	/// Rebuilds the atmospheric transmittance LUT from the density profile of the reference body's atmosphere.
+	void rebuild_transmittance_lut(const ::celestial_body_component& body, const ::atmosphere_component& atmosphere);
+	
+	/// Looks up a transmittance factor due to atmospheric extinction along a ray from the observer.
+	/// @param direction Direction of the ray, in the EUS frame.
 	/// @return Spectral transmittance factor.
-	[[nodiscard]] math::dvec3 integrate_transmittance(const ::observer_component& observer, const ::celestial_body_component& body, const ::atmosphere_component& atmosphere, geom::ray<double, 3> ray) const;
+	[[nodiscard]] math::dvec3 lookup_transmittance(const ::observer_component& observer, const ::celestial_body_component& body, const ::atmosphere_component& atmosphere, const math::dvec3& direction) const;
 	
 	entity::registry& m_registry;
 
@@ -92,8 +98,17 @@ private:
 	/// Time since epoch, in centuries.
 	double m_time_centuries{};
 	
-	/// Number of transmittance integration samples.
-	usize m_transmittance_samples{};
+	/// Number of transmittance integration samples per LUT entry.
+	usize m_transmittance_samples{physics::gas::transmittance_lut::default_sample_count};
+	
+	/// Resolution of the transmittance LUT.
+	math::vec2<usize> m_transmittance_lut_resolution{physics::gas::transmittance_lut::default_resolution};
+	
+	/// Column densities of the reference body's atmosphere, from which transmittance is looked up rather than integrated each update.
+	physics::gas::transmittance_lut m_transmittance_lut;
+	
+	/// `true` if the transmittance LUT must be rebuilt before its next use, `false` otherwise.
+	bool m_transmittance_lut_dirty{true};
 	
 	/// Entity ID of the observer.
 	entity::id m_observer_eid{entt::null};
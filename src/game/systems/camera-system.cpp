@@ -6,6 +6,7 @@
 #include "game/components/autofocus-component.hpp"
 #include "game/components/spring-arm-component.hpp"
 #include "game/components/scene-object-component.hpp"
+#include <engine/debug/profiler.hpp>
 #include <engine/animation/ease.hpp>
 #include <engine/math/functions.hpp>
 #include <engine/math/projection.hpp>
@@ -17,6 +18,8 @@ void camera_system::fixed_update(entity::registry&, float, float)
 
 void camera_system::variable_update(entity::registry& registry, float t, float dt, float alpha)
 {
+	debug::profile_scope profile("camera_system::variable_update");
+	
 	const double variable_update_time = t + dt * alpha;
 	const double variable_timestep = math::max(0.0, variable_update_time - m_variable_update_time);
 	m_variable_update_time = variable_update_time;
@@ -5,27 +5,27 @@
 #include "game/systems/collision-system.hpp"
 #include "game/components/transform-component.hpp"
 #include "game/components/picking-component.hpp"
+#include <engine/debug/profiler.hpp>
 #include <engine/geom/intersection.hpp>
 #include <engine/geom/primitives/plane.hpp>
+#include <algorithm>
 #include <limits>
 
-void collision_system::fixed_update(entity::registry&, float, float)
-{}
-
-entity::id collision_system::pick_nearest(const entity::registry& registry, const geom::ray<float, 3>& ray, u32 flags)
+void collision_system::fixed_update(entity::registry& registry, float, float)
 {
-	entity::id nearest_eid = entt::null;
-	float nearest_distance = std::numeric_limits<float>::infinity();
+	debug::profile_scope profile("collision_system::fixed_update");
+	
+	m_picking_spheres.clear();
+	m_picking_centers.clear();
+	m_picking_flags.clear();
+	m_picking_eids.clear();
+	m_max_picking_radius = 0.0f;
 	
 	// For each entity with picking and transform components
 	registry.view<const picking_component, const transform_component>().each
 	(
 		[&](entity::id entity_id, const auto& picking, const auto& transform)
 		{
-			// Skip entity if picking flags don't match
-			if (!~(flags | picking.flags))
-				return;
-			
 			// Transform picking sphere
 			const geom::sphere<float> sphere =
 			{
@@ -33,16 +33,50 @@ entity::id collision_system::pick_nearest(const entity::registry& registry, cons
 				picking.sphere.radius * math::max_element(transform.world.scale)
 			};
 			
+			m_picking_spheres.emplace_back(sphere);
+			m_picking_centers.emplace_back(sphere.center);
+			m_picking_flags.emplace_back(picking.flags);
+			m_picking_eids.emplace_back(entity_id);
+			m_max_picking_radius = std::max(m_max_picking_radius, sphere.radius);
+		}
+	);
+	
+	// Size grid cells to about the diameter of the largest picking sphere
+	const float cell_size = std::max(m_max_picking_radius * 2.0f, 1e-3f);
+	if (m_picking_grid.get_cell_size() != cell_size)
+	{
+		m_picking_grid.set_cell_size(cell_size);
+	}
+	
+	// Rebuild spatial index of picking spheres
+	m_picking_grid.build(m_picking_centers);
+}
+
+entity::id collision_system::pick_nearest(const geom::ray<float, 3>& ray, u32 flags) const
+{
+	entity::id nearest_eid = entt::null;
+	float nearest_distance = std::numeric_limits<float>::infinity();
+	
+	// For each picking sphere whose center may be within the largest picking radius of the ray
+	m_picking_grid.for_each_near_ray
+	(
+		ray,
+		m_max_picking_radius,
+		[&](u32 index)
+		{
+			// Skip entity if picking flags don't match
+			if (!~(flags | m_picking_flags[index]))
+				return;
+			
 			// Test for intersection between ray and sphere
-			auto result = geom::intersection(ray, sphere);
+			auto result = geom::intersection(ray, m_picking_spheres[index]);
 			if (result)
 			{
 				float t0 = std::get<0>(*result);
-				// float t1 = std::get<1>(*result);
 				
 				if (t0 < nearest_distance)
 				{
-					nearest_eid = entity_id;
+					nearest_eid = m_picking_eids[index];
 					nearest_distance = t0;
 				}
 			}
@@ -52,42 +86,22 @@ entity::id collision_system::pick_nearest(const entity::registry& registry, cons
 	return nearest_eid;
 }
 
-entity::id collision_system::pick_nearest(const entity::registry& registry, const math::fvec3& origin, const math::fvec3& normal, u32 flags)
+entity::id collision_system::pick_nearest(const math::fvec3& origin, const math::fvec3& normal, u32 flags) const
 {
-	entity::id nearest_eid = entt::null;
-	float nearest_sqr_distance = std::numeric_limits<float>::infinity();
-	
 	// Construct picking plane
 	const geom::plane<float> picking_plane = geom::plane<float>(origin, normal);
 	
-	// For each entity with picking and transform components
-	registry.view<const picking_component, const transform_component>().each
+	// Find the nearest picking sphere center which matches the picking flags and has a non-negative distance from the picking plane
+	geom::spatial_grid::neighbor nearest;
+	const auto count = m_picking_grid.find_nearest
 	(
-		[&](entity::id entity_id, const auto& picking, const auto& transform)
+		origin,
+		{&nearest, 1},
+		[&](u32 index)
 		{
-			// Skip entity if picking flags don't match
-			if (!~(flags | picking.flags))
-				return;
-			
-			// Transform picking sphere center
-			math::fvec3 picking_sphere_center = transform.world * picking.sphere.center;
-			
-			// Skip entity if picking sphere center has negative distance from picking plane
-			if (picking_plane.distance(picking_sphere_center) < 0.0f)
-				return;
-			
-			// Measure distance from picking plane origin to picking sphere center
-			const float sqr_distance = math::sqr_distance(picking_sphere_center, origin);
-			
-			// Check if entity is nearer than the current nearest entity
-			if (sqr_distance < nearest_sqr_distance)
-			{
-				nearest_eid = entity_id;
-				nearest_sqr_distance = sqr_distance;
-			}
+			return ~(flags | m_picking_flags[index]) && picking_plane.distance(m_picking_centers[index]) >= 0.0f;
 		}
 	);
 	
-	return nearest_eid;
+	return count ? m_picking_eids[nearest.index] : entity::id{entt::null};
 }
-
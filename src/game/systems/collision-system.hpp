@@ -6,8 +6,11 @@
 
 #include "game/systems/fixed-update-system.hpp"
 #include <engine/geom/primitives/ray.hpp>
+#include <engine/geom/primitives/sphere.hpp>
+#include <engine/geom/spatial-grid.hpp>
 #include <engine/entity/id.hpp>
 #include <engine/utility/sized-types.hpp>
+#include <vector>
 
 using namespace engine;
 
@@ -16,20 +19,43 @@ class collision_system: public fixed_update_system
 {
 public:
 	~collision_system() override = default;
+	
+	/// Rebuilds the spatial index of picking spheres.
 	void fixed_update(entity::registry& registry, float t, float dt) override;
 	
 	/// Picks the nearest entity with the specified picking flags that intersects a ray.
 	/// @param ray Picking ray.
 	/// @param flags Picking flags.
 	/// @return ID of the picked entity, or `entt::null` if no entity was picked.
-	[[nodiscard]] static entity::id pick_nearest(const entity::registry& registry, const geom::ray<float, 3>& ray, u32 flags);
+	/// @note Picking spheres are positioned as of the last fixed update.
+	[[nodiscard]] entity::id pick_nearest(const geom::ray<float, 3>& ray, u32 flags) const;
 	
 	/// Picks the nearest entity with the specified picking flags that has a non-negative distance from a plane.
 	/// @param origin Origin of the picking plane.
 	/// @param normal Picking plane normal direction.
 	/// @param flags Picking flags.
 	/// @return ID of the picked entity, or `entt::null` if no entity was picked.
-	[[nodiscard]] static entity::id pick_nearest(const entity::registry& registry, const math::fvec3& origin, const math::fvec3& normal, u32 flags);
+	/// @note Picking spheres are positioned as of the last fixed update.
+	[[nodiscard]] entity::id pick_nearest(const math::fvec3& origin, const math::fvec3& normal, u32 flags) const;
+	
+private:
+	/// Spatial index of picking sphere centers.
+	geom::spatial_grid m_picking_grid;
+	
+	/// World-space picking spheres, with the same indices as the grid.
+	std::vector<geom::sphere<float>> m_picking_spheres;
+	
+	/// Picking sphere centers, with the same indices as the grid.
+	std::vector<math::fvec3> m_picking_centers;
+	
+	/// Picking flags, with the same indices as the grid.
+	std::vector<u32> m_picking_flags;
+	
+	/// Picking entity IDs, with the same indices as the grid.
+	std::vector<entity::id> m_picking_eids;
+	
+	/// Radius of the largest picking sphere.
+	float m_max_picking_radius{0.0f};
 };
 
 
@@ -4,6 +4,7 @@
 #include <entt/entt.hpp>
 #include "game/systems/constraint-system.hpp"
 #include "game/components/constraint-stack-component.hpp"
+#include <engine/debug/profiler.hpp>
 #include <engine/math/quaternion.hpp>
 #include <engine/math/basis.hpp>
 
@@ -24,6 +25,8 @@ constraint_system::~constraint_system()
 
 void constraint_system::fixed_update(entity::registry& registry, float, float dt)
 {
+	debug::profile_scope profile("constraint_system::fixed_update");
+	
 	// For each entity with transform and constraint stack components
 	registry.view<transform_component, constraint_stack_component>().each
 	(
@@ -5,9 +5,12 @@
 #include "game/systems/frame-interpolation-system.hpp"
 #include "game/components/rigid-body-component.hpp"
 #include "game/components/scene-object-component.hpp"
+#include <engine/debug/profiler.hpp>
 
 void frame_interpolation_system::variable_update(entity::registry& registry, float, float, float alpha)
 {
+	debug::profile_scope profile("frame_interpolation_system::variable_update");
+
 	registry.view<scene_object_component, const rigid_body_component>().each
 	(
 		[alpha](auto, auto& scene, const auto& rigid_body)
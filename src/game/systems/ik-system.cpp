@@ -5,12 +5,19 @@
 #include <entt/entt.hpp>
 #include "game/systems/ik-system.hpp"
 #include "game/components/ik-component.hpp"
+#include "game/components/animation-lod-component.hpp"
+#include <engine/debug/profiler.hpp>
 #include <engine/entity/id.hpp>
 #include <algorithm>
 
 void ik_system::fixed_update(entity::registry& registry, float, float)
 {
+	debug::profile_scope profile("ik_system::fixed_update");
+
+	++m_tick_index;
+
 	auto view = registry.view<ik_component>();
+	const auto& const_registry = registry;
 	std::for_each
 	(
 		std::execution::par_unseq,
@@ -18,6 +25,17 @@ void ik_system::fixed_update(entity::registry& registry, float, float)
 		view.end(),
 		[&](auto entity_id)
 		{
+			// Skip or throttle IK according to animation LOD
+			if (const auto lod = const_registry.try_get<animation_lod_component>(entity_id))
+			{
+				if (lod->lod == animation_lod::minimal ||
+					lod->lod == animation_lod::frozen ||
+					(lod->lod == animation_lod::reduced && (m_tick_index + lod->phase) % 2))
+				{
+					return;
+				}
+			}
+			
 			const auto& component = view.get<ik_component>(entity_id);
 			
 			component.rig->solve();
@@ -5,6 +5,7 @@
 #define ANTKEEPER_GAME_IK_SYSTEM_HPP
 
 #include "game/systems/fixed-update-system.hpp"
+#include <engine/utility/sized-types.hpp>
 
 class ik_system:
 	public fixed_update_system
@@ -12,6 +13,9 @@ class ik_system:
 public:
 	~ik_system() override = default;
 	void fixed_update(entity::registry& registry, float t, float dt) override;
+
+private:
+	usize m_tick_index{};
 };
 
 #endif // ANTKEEPER_GAME_IK_SYSTEM_HPP
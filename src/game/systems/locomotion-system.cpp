@@ -7,67 +7,168 @@
 #include "game/components/legged-locomotion-component.hpp"
 #include "game/components/winged-locomotion-component.hpp"
 #include "game/components/navmesh-agent-component.hpp"
+#include "game/components/navmesh-component.hpp"
 #include "game/components/rigid-body-component.hpp"
+#include <engine/debug/profiler.hpp>
 #include <engine/animation/skeleton.hpp>
 #include <engine/math/functions.hpp>
 #include <engine/debug/log.hpp>
 #include <engine/entity/id.hpp>
 #include <engine/ai/navmesh.hpp>
+#include <engine/physics/kinematics/colliders/mesh-collider.hpp>
 #include <engine/utility/sized-types.hpp>
+#include <algorithm>
 #include <string>
+#include <tuple>
+#include <utility>
+#include <variant>
 
 using namespace engine;
 
+namespace
+{
+	/// Returns `true` if a navmesh agent is located on a face of a navmesh.
+	[[nodiscard]] bool is_on_navmesh_face(const navmesh_agent_component& navmesh_agent) noexcept
+	{
+		const auto face = std::get_if<geom::brep::face*>(&navmesh_agent.feature);
+		return navmesh_agent.mesh && face && *face;
+	}
+	
+	/// Turns an agent toward its target direction.
+	void steer(legged_locomotion_component& locomotion, physics::rigid_body& rigid_body, float dt)
+	{
+		const auto max_steering_angle = locomotion.max_angular_frequency * dt;
+		
+		const auto current_direction = rigid_body.get_orientation() * math::fvec3{0, 0, 1};
+		
+		math::fquat steering_rotation;
+		const auto cos_target_direction = math::dot(current_direction, locomotion.target_direction);
+		if (cos_target_direction < -0.999f)
+		{
+			steering_rotation = math::axis_angle_to_quat(rigid_body.get_orientation() * math::fvec3{0, 1, 0}, max_steering_angle);
+		}
+		else
+		{
+			steering_rotation = math::rotate_towards(current_direction, locomotion.target_direction, max_steering_angle);
+		}
+		
+		rigid_body.set_orientation(math::normalize(steering_rotation * rigid_body.get_orientation()));
+	}
+}
+
 void locomotion_system::fixed_update(entity::registry& registry, float t, float dt)
 {
+	debug::profile_scope profile("locomotion_system::fixed_update");
+	
+	if (m_flow_field_cache)
+	{
+		m_flow_field_cache->update(m_flow_field_face_budget);
+		m_flow_field_cache->remove_unused();
+	}
+	
 	update_legged(registry, t, dt);
 	update_winged(registry, t, dt);
 }
 
+void locomotion_system::set_flow_field_cache(std::shared_ptr<ai::navmesh_flow_field_cache> cache)
+{
+	m_flow_field_cache = std::move(cache);
+}
+
+void locomotion_system::set_flow_field_face_budget(usize count)
+{
+	m_flow_field_face_budget = count;
+}
+
 void locomotion_system::update_legged(entity::registry& registry, float, float dt)
 {
 	auto legged_group = registry.group<legged_locomotion_component>(entt::get<navmesh_agent_component, rigid_body_component, pose_component>);
+	
+	// Gather agents on navmeshes, grouped by navmesh
+	m_navmesh_traversers.clear();
 	for (auto entity_id: legged_group)
 	{
-		auto& locomotion = legged_group.get<legged_locomotion_component>(entity_id);
+		const auto& navmesh_agent = legged_group.get<navmesh_agent_component>(entity_id);
+		if (is_on_navmesh_face(navmesh_agent))
+		{
+			m_navmesh_traversers.emplace_back(navmesh_agent.navmesh_eid, navmesh_agent.mesh, entity_id);
+		}
+	}
+	std::sort
+	(
+		m_navmesh_traversers.begin(),
+		m_navmesh_traversers.end(),
+		[](const auto& a, const auto& b)
+		{
+			return std::tie(a.navmesh_eid, a.mesh) < std::tie(b.navmesh_eid, b.mesh);
+		}
+	);
+	
+	// Steer and move agents on navmeshes, one navmesh at a time
+	for (auto batch_begin = m_navmesh_traversers.begin(); batch_begin != m_navmesh_traversers.end();)
+	{
+		const auto batch_end = std::find_if
+		(
+			batch_begin,
+			m_navmesh_traversers.end(),
+			[&](const auto& traverser)
+			{
+				return traverser.navmesh_eid != batch_begin->navmesh_eid || traverser.mesh != batch_begin->mesh;
+			}
+		);
 		
-		float cos_target_direction{};
-		if (locomotion.speed != 0.0f)
+		// Get navmesh graph, skipping agents on meshes which no longer belong to their navmesh
+		auto& mesh = *batch_begin->mesh;
+		const auto navmesh = get_navmesh(registry, batch_begin->navmesh_eid, mesh);
+		if (!navmesh)
 		{
-			auto& rigid_body = *legged_group.get<rigid_body_component>(entity_id).body;
+			batch_begin = batch_end;
+			continue;
+		}
+		const auto& navmesh_graph = *navmesh->graph;
+		
+		// Get navmesh transform
+		const auto navmesh_transform = registry.get<rigid_body_component>(batch_begin->navmesh_eid).body->get_transform();
+		
+		for (auto traverser = batch_begin; traverser != batch_end; ++traverser)
+		{
+			auto& locomotion = legged_group.get<legged_locomotion_component>(traverser->entity_id);
+			auto& navmesh_agent = legged_group.get<navmesh_agent_component>(traverser->entity_id);
+			auto& agent_rigid_body = *legged_group.get<rigid_body_component>(traverser->entity_id).body;
 			
-			const auto max_steering_angle = locomotion.max_angular_frequency * dt;
+			const auto face_index = static_cast<u32>(std::get<geom::brep::face*>(navmesh_agent.feature)->index());
+			
+			// Discard flow fields built over a different navmesh
+			if (navmesh_agent.flow_field && navmesh_agent.flow_field->get_graph() != navmesh->graph)
+			{
+				navmesh_agent.flow_field.reset();
+			}
 			
-			const auto current_direction = rigid_body.get_orientation() * math::fvec3{0, 0, 1};
+			// Get shared flow field toward goal faces from cache
+			if (!navmesh_agent.flow_field && !navmesh_agent.goal_faces.empty() && m_flow_field_cache)
+			{
+				navmesh_agent.flow_field = m_flow_field_cache->get(navmesh->graph, navmesh_agent.goal_faces);
+			}
 			
-			math::fquat steering_rotation;
-			cos_target_direction = math::dot(current_direction, locomotion.target_direction);
-			if (cos_target_direction < -0.999f)
+			// Take target direction from flow field
+			if (navmesh_agent.flow_field)
 			{
-				steering_rotation = math::axis_angle_to_quat(rigid_body.get_orientation() * math::fvec3{0, 1, 0}, max_steering_angle);
+				const auto& flow_direction = navmesh_agent.flow_field->direction(face_index);
+				if (flow_direction != math::fvec3{})
+				{
+					// Transform flow direction from navmesh-space to world-space
+					locomotion.target_direction = navmesh_transform.rotation * flow_direction;
+				}
 			}
-			else
+			
+			if (locomotion.speed == 0.0f)
 			{
-				steering_rotation = math::rotate_towards(current_direction, locomotion.target_direction, max_steering_angle);
+				continue;
 			}
 			
-			rigid_body.set_orientation(math::normalize(steering_rotation * rigid_body.get_orientation()));
-		}
-		
-		auto& navmesh_agent = legged_group.get<navmesh_agent_component>(entity_id);
-
-		geom::brep::face** face = std::get_if<geom::brep::face*>(&navmesh_agent.feature);
-		
-		// Traverse navmesh
-		if (locomotion.speed != 0.0f/* && cos_target_direction >= 0.0f*/ && face)
-		{
-			// Get agent rigid body
-			auto& agent_rigid_body = *legged_group.get<rigid_body_component>(entity_id).body;
-			const auto& agent_transform = agent_rigid_body.get_transform();
+			steer(locomotion, agent_rigid_body, dt);
 			
-			// Get navmesh rigid body
-			auto& navmesh_rigid_body = *registry.get<rigid_body_component>(navmesh_agent.navmesh_eid).body;
-			const auto& navmesh_transform = navmesh_rigid_body.get_transform();
+			const auto& agent_transform = agent_rigid_body.get_transform();
 			
 			// Determine start and end points of traversal
 			const auto traversal_direction = agent_transform.rotation * math::fvec3{0, 0, 1};
@@ -80,38 +181,38 @@ void locomotion_system::update_legged(entity::registry& registry, float, float d
 			
 			// Traverse navmesh
 			// NOTE: if the navmesh has a nonuniform scale, the traversal will be skewed
-			auto traversal = ai::traverse_navmesh(*navmesh_agent.mesh, *face, traversal_start, traversal_end);
+			auto traversal = ai::traverse_navmesh(navmesh_graph, face_index, traversal_start, traversal_end);
 			
 			// Transform traversal end point from navmesh-space world-space
 			traversal.closest_point = navmesh_transform.translation + (navmesh_transform.rotation * (navmesh_transform.scale * traversal.closest_point));
 			
 			// Update navmesh agent face
-			navmesh_agent.feature = traversal.feature;
-
-			face = std::get_if<geom::brep::face*>(&navmesh_agent.feature);
-			if (face)
-			{
-				// Interpolate navmesh vertex normals
-				const auto& vertex_normals = navmesh_agent.mesh->vertices().attributes().at<math::fvec3>("normal");
-				auto loop = (*face)->loops().begin();
-				const auto& na = vertex_normals[loop->vertex()->index()];
-				const auto& nb = vertex_normals[(++loop)->vertex()->index()];
-				const auto& nc = vertex_normals[(++loop)->vertex()->index()];
-				const auto& uvw = traversal.barycentric;
-				navmesh_agent.surface_normal = math::normalize(na * uvw.x() + nb * uvw.y() + nc * uvw.z());
-				
-				// Transform surface normal from navmesh-space to world-space
-				navmesh_agent.surface_normal = math::normalize(navmesh_transform.rotation * (navmesh_agent.surface_normal / navmesh_transform.scale));
-			}
+			navmesh_agent.feature = mesh.faces()[traversal.face];
 			
-			// const auto& face_normals = navmesh_agent.mesh->faces().attributes().at<math::fvec3>("normal");
-			// navmesh_agent.surface_normal = face_normals[navmesh_agent.face->index()];
+			// Interpolate navmesh vertex normals
+			navmesh_agent.surface_normal = ai::navmesh_surface_normal(navmesh_graph.faces()[traversal.face], traversal.barycentric);
+			
+			// Transform surface normal from navmesh-space to world-space
+			navmesh_agent.surface_normal = math::normalize(navmesh_transform.rotation * (navmesh_agent.surface_normal / navmesh_transform.scale));
 			
 			// Update agent rigid body
+			const auto agent_rotation = agent_transform.rotation;
 			agent_rigid_body.set_position(traversal.closest_point);
-			// agent_rigid_body.set_position(traversal_ray.extrapolate(locomotion.speed * dt));
-			// agent_rigid_body.set_orientation(math::normalize(math::rotation(rigid_body_transform.rotation * math::fvec3{0, 1, 0}, navmesh_agent.surface_normal) * rigid_body_transform.rotation));
-			agent_rigid_body.set_orientation(math::normalize(math::rotation(agent_transform.rotation * math::fvec3{0, 1, 0}, navmesh_agent.surface_normal) * agent_transform.rotation));
+			agent_rigid_body.set_orientation(math::normalize(math::rotation(agent_rotation * math::fvec3{0, 1, 0}, navmesh_agent.surface_normal) * agent_rotation));
+		}
+		
+		batch_begin = batch_end;
+	}
+	
+	for (auto entity_id: legged_group)
+	{
+		auto& locomotion = legged_group.get<legged_locomotion_component>(entity_id);
+		
+		// Steer agents which are not on a navmesh
+		const auto& navmesh_agent = legged_group.get<navmesh_agent_component>(entity_id);
+		if (locomotion.speed != 0.0f && !is_on_navmesh_face(navmesh_agent))
+		{
+			steer(locomotion, *legged_group.get<rigid_body_component>(entity_id).body, dt);
 		}
 		
 		// Animate legs
@@ -191,6 +292,36 @@ void locomotion_system::update_legged(entity::registry& registry, float, float d
 	}
 }
 
+const navmesh_component* locomotion_system::get_navmesh(entity::registry& registry, entity::id navmesh_eid, const geom::brep::mesh& mesh)
+{
+	// Only the mesh collider of the navmesh entity can be traversed
+	const auto rigid_body = registry.try_get<rigid_body_component>(navmesh_eid);
+	if (!rigid_body || !rigid_body->body)
+	{
+		return nullptr;
+	}
+	const auto& collider = rigid_body->body->get_collider();
+	if (!collider || collider->type() != physics::collider_type::mesh)
+	{
+		return nullptr;
+	}
+	const auto& collider_mesh = static_cast<const physics::mesh_collider&>(*collider).get_mesh();
+	if (collider_mesh.get() != &mesh)
+	{
+		return nullptr;
+	}
+	
+	// Rebuild traversal data if the collider mesh was replaced or its faces changed
+	auto& navmesh = registry.get_or_emplace<navmesh_component>(navmesh_eid);
+	if (navmesh.mesh != collider_mesh || navmesh.graph->size() != mesh.faces().size())
+	{
+		navmesh.mesh = collider_mesh;
+		navmesh.graph = std::make_shared<ai::navmesh_graph>(mesh);
+	}
+	
+	return &navmesh;
+}
+
 void locomotion_system::update_winged(entity::registry& registry, float, float)
 {
 	auto winged_group = registry.group<winged_locomotion_component>(entt::get<rigid_body_component>);
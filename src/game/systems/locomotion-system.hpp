@@ -5,6 +5,13 @@
 #define ANTKEEPER_GAME_LOCOMOTION_SYSTEM_HPP
 
 #include "game/systems/fixed-update-system.hpp"
+#include "game/components/navmesh-component.hpp"
+#include <engine/ai/navmesh-flow-field.hpp>
+#include <engine/entity/id.hpp>
+#include <engine/geom/brep/mesh.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <memory>
+#include <vector>
 
 class locomotion_system:
 	public fixed_update_system
@@ -13,9 +20,36 @@ public:
 	~locomotion_system() override = default;
 	void fixed_update(entity::registry& registry, float t, float dt) override;
 	
+	/// Sets the cache of flow fields which steer navmesh agents. Agents with goal faces are given flow fields from the cache, and incomplete flow fields in the cache are built at the start of each fixed update.
+	/// @param cache Navmesh flow field cache, or `nullptr` to disable flow field construction.
+	void set_flow_field_cache(std::shared_ptr<ai::navmesh_flow_field_cache> cache);
+	
+	/// Sets the maximum number of faces settled in each incomplete flow field per fixed update.
+	/// @param count Maximum number of faces.
+	void set_flow_field_face_budget(usize count);
+	
 private:
+	/// Navmesh agent which traverses a navmesh in the current update.
+	struct navmesh_traverser
+	{
+		entity::id navmesh_eid;
+		geom::brep::mesh* mesh;
+		entity::id entity_id;
+	};
+	
 	void update_legged(entity::registry& registry, float t, float dt);
 	void update_winged(entity::registry& registry, float t, float dt);
+	
+	/// Returns the navmesh component of a navmesh entity, building it if it is missing or was built from a different mesh.
+	/// @param registry Entity registry.
+	/// @param navmesh_eid Entity ID of the navmesh.
+	/// @param mesh Mesh through which agents are navigating.
+	/// @return Navmesh component, or `nullptr` if @p mesh is not the mesh collider of the navmesh entity.
+	[[nodiscard]] const navmesh_component* get_navmesh(entity::registry& registry, entity::id navmesh_eid, const geom::brep::mesh& mesh);
+	
+	std::vector<navmesh_traverser> m_navmesh_traversers;
+	std::shared_ptr<ai::navmesh_flow_field_cache> m_flow_field_cache;
+	usize m_flow_field_face_budget{16384};
 };
 
 #endif // ANTKEEPER_GAME_LOCOMOTION_SYSTEM_HPP
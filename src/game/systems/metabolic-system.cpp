@@ -6,9 +6,12 @@
 #include "game/components/isometric-growth-component.hpp"
 #include "game/components/rigid-body-component.hpp"
 #include "game/utility/time.hpp"
+#include <engine/debug/profiler.hpp>
 
 void metabolic_system::fixed_update(entity::registry& registry, float, float dt)
 {
+	debug::profile_scope profile("metabolic_system::fixed_update");
+	
 	// Scale timestep
 	const auto time_scale = get_time_scale(registry);
 	const auto scaled_timestep = dt * time_scale;
@@ -11,6 +11,7 @@
 #include "game/components/scene-object-component.hpp"
 #include "game/components/ant-genome-component.hpp"
 #include "game/utility/time.hpp"
+#include <engine/debug/profiler.hpp>
 #include <engine/debug/log.hpp>
 #include <engine/hash/fnv.hpp>
 #include <engine/scene/skeletal-mesh.hpp>
@@ -23,6 +24,8 @@ using namespace engine::hash::literals;
 
 void metamorphosis_system::fixed_update(entity::registry& registry, float, float dt)
 {
+	debug::profile_scope profile("metamorphosis_system::fixed_update");
+	
 	// Scale timestep
 	const auto time_scale = get_time_scale(registry);
 	const auto scaled_timestep = dt * time_scale;
@@ -4,8 +4,10 @@
 #include <entt/entt.hpp>
 #include "game/systems/orbit-system.hpp"
 #include "game/utility/time.hpp"
+#include <engine/debug/profiler.hpp>
 #include <engine/physics/orbit/orbit.hpp>
 #include <engine/physics/time.hpp>
+#include <algorithm>
 
 orbit_system::orbit_system(entity::registry& registry):
 	m_registry(registry)
@@ -22,6 +24,8 @@ orbit_system::~orbit_system()
 
 void orbit_system::fixed_update(entity::registry& registry, float, float dt)
 {
+	debug::profile_scope profile("orbit_system::fixed_update");
+	
 	// Scale timestep
 	const auto time_scale = get_time_scale(registry);
 	const auto astronomical_time_scale = time_scale / physics::time::seconds_per_day<double>;
@@ -34,10 +38,26 @@ void orbit_system::fixed_update(entity::registry& registry, float, float dt)
 		return;
 	}
 	
-	// Calculate positions of ephemeris items, in meters
-	for (auto i: m_ephemeris_indices)
+	// Rebuild evaluator if the set of tracked ephemeris items has changed
+	if (m_evaluator_dirty)
+	{
+		std::vector<usize> items(m_ephemeris_indices.begin(), m_ephemeris_indices.end());
+		std::sort(items.begin(), items.end());
+		m_evaluator = physics::orbit::ephemeris_evaluator(m_ephemeris, std::move(items));
+		m_evaluated_positions.resize(m_evaluator.item_count());
+		m_evaluated_velocities.resize(m_evaluator.item_count());
+		m_evaluator_dirty = false;
+	}
+	
+	// Calculate positions and velocities of all tracked ephemeris items in one pass
+	m_evaluator.evaluate(m_time, m_evaluated_positions, m_evaluated_velocities);
+	
+	// Convert positions from kilometers to meters, and velocities from kilometers per day to meters per second
+	const auto& items = m_evaluator.items();
+	for (usize i = 0; i < items.size(); ++i)
 	{
-		m_positions[i] = m_ephemeris->trajectories[i].position(m_time) * 1000.0;
+		m_positions[items[i]] = m_evaluated_positions[i] * 1000.0;
+		m_velocities[items[i]] = m_evaluated_velocities[i] * (1000.0 / physics::time::seconds_per_day<double>);
 	}
 	
 	// Propagate orbits
@@ -46,22 +66,26 @@ void orbit_system::fixed_update(entity::registry& registry, float, float dt)
 		[&](entity::id, auto& orbit)
 		{
 			orbit.position = m_positions[orbit.ephemeris_index] * orbit.scale;
+			orbit.velocity = m_velocities[orbit.ephemeris_index] * orbit.scale;
 			
 			entity::id parent_id = orbit.parent;
 			while (parent_id != entt::null)
 			{
 				const orbit_component& parent_orbit = registry.get<orbit_component>(parent_id);
 				orbit.position += m_positions[parent_orbit.ephemeris_index] * parent_orbit.scale;
+				orbit.velocity += m_velocities[parent_orbit.ephemeris_index] * parent_orbit.scale;
 				parent_id = parent_orbit.parent;
 			}
 		}
 	);
 }
 
-void orbit_system::set_ephemeris(std::shared_ptr<physics::orbit::ephemeris<double>> ephemeris)
+void orbit_system::set_ephemeris(std::shared_ptr<physics::orbit::paged_ephemeris> ephemeris)
 {
 	m_ephemeris = ephemeris;
-	m_positions.resize(m_ephemeris ? m_ephemeris->trajectories.size() : 0);
+	m_positions.resize(m_ephemeris ? m_ephemeris->item_count() : 0);
+	m_velocities.resize(m_positions.size());
+	m_evaluator_dirty = true;
 }
 
 void orbit_system::set_time(double time)
@@ -72,11 +96,19 @@ void orbit_system::set_time(double time)
 void orbit_system::on_orbit_construct(entity::registry& registry, entity::id entity_id)
 {
 	const ::orbit_component& component = registry.get<::orbit_component>(entity_id);
-	m_ephemeris_indices.insert(component.ephemeris_index);
+	track_ephemeris_index(component.ephemeris_index);
 }
 
 void orbit_system::on_orbit_update(entity::registry& registry, entity::id entity_id)
 {
 	const ::orbit_component& component = registry.get<::orbit_component>(entity_id);
-	m_ephemeris_indices.insert(component.ephemeris_index);
+	track_ephemeris_index(component.ephemeris_index);
+}
+
+void orbit_system::track_ephemeris_index(int index)
+{
+	if (index >= 0 && m_ephemeris_indices.insert(index).second)
+	{
+		m_evaluator_dirty = true;
+	}
 }
@@ -6,7 +6,8 @@
 
 #include "game/components/orbit-component.hpp"
 #include "game/systems/fixed-update-system.hpp"
-#include <engine/physics/orbit/ephemeris.hpp>
+#include <engine/physics/orbit/ephemeris-evaluator.hpp>
+#include <engine/physics/orbit/paged-ephemeris.hpp>
 #include <engine/math/vector.hpp>
 #include <engine/entity/id.hpp>
 #include <unordered_set>
@@ -28,16 +29,22 @@ public:
 	
 	/// Sets the ephemeris used to calculate orbital positions.
 	/// @param ephemeris Ephemeris.
-	void set_ephemeris(std::shared_ptr<physics::orbit::ephemeris<double>> ephemeris);
+	void set_ephemeris(std::shared_ptr<physics::orbit::paged_ephemeris> ephemeris);
 	
 private:
 	void on_orbit_construct(entity::registry& registry, entity::id entity_id);
 	void on_orbit_update(entity::registry& registry, entity::id entity_id);
+	void track_ephemeris_index(int index);
 	
 	entity::registry& m_registry;
-	std::shared_ptr<physics::orbit::ephemeris<double>> m_ephemeris;
+	std::shared_ptr<physics::orbit::paged_ephemeris> m_ephemeris;
+	physics::orbit::ephemeris_evaluator m_evaluator;
+	bool m_evaluator_dirty{false};
 	double m_time{0.0};
 	std::vector<math::dvec3> m_positions;
+	std::vector<math::dvec3> m_velocities;
+	std::vector<math::dvec3> m_evaluated_positions;
+	std::vector<math::dvec3> m_evaluated_velocities;
 	std::unordered_set<int> m_ephemeris_indices;
 };
 
@@ -8,6 +8,7 @@
 #include "game/components/rigid-body-constraint-component.hpp"
 #include "game/components/transform-component.hpp"
 #include "game/components/gravity-component.hpp"
+#include <engine/debug/profiler.hpp>
 #include <engine/physics/kinematics/colliders/plane-collider.hpp>
 #include <engine/physics/kinematics/colliders/sphere-collider.hpp>
 #include <engine/physics/kinematics/colliders/box-collider.hpp>
@@ -54,6 +55,8 @@ physics_system::physics_system()
 
 void physics_system::fixed_update(entity::registry& registry, float, float dt)
 {
+	debug::profile_scope profile("physics_system::fixed_update");
+	
 	detect_collisions_broad(registry);
 	detect_collisions_narrow();
 	solve_constraints(registry, dt);
@@ -5,6 +5,7 @@
 #include "game/components/transform-component.hpp"
 #include "game/components/rigid-body-component.hpp"
 #include "game/components/scene-object-component.hpp"
+#include <engine/debug/profiler.hpp>
 #include <engine/math/quaternion.hpp>
 #include <engine/math/transform.hpp>
 #include <engine/utility/sized-types.hpp>
@@ -102,6 +103,8 @@ render_system::~render_system()
 
 void render_system::fixed_update(entity::registry& registry, float, float)
 {
+	debug::profile_scope profile("render_system::fixed_update");
+	
 	// Update scene object transforms
 	for (auto entity_id: m_transformed_scene_object_components)
 	{
@@ -114,6 +117,8 @@ void render_system::fixed_update(entity::registry& registry, float, float)
 
 void render_system::variable_update(entity::registry&, float t, float dt, float alpha)
 {
+	debug::profile_scope profile("render_system::variable_update");
+	
 	if (m_renderer)
 	{
 		for (auto it = m_layers.rbegin(); it != m_layers.rend(); ++it)
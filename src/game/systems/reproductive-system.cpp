@@ -12,6 +12,7 @@
 #include "game/components/time-component.hpp"
 #include "game/utility/physics.hpp"
 #include "game/utility/time.hpp"
+#include <engine/debug/profiler.hpp>
 #include <engine/scene/static-mesh.hpp>
 #include <engine/debug/log.hpp>
 #include <engine/math/functions.hpp>
@@ -26,6 +27,8 @@
 
 void reproductive_system::fixed_update(entity::registry& registry, float, float dt)
 {
+	debug::profile_scope profile("reproductive_system::fixed_update");
+
 	const float time_scale = get_time_scale(registry);
 	const float scaled_timestep = dt * time_scale;
 
@@ -5,9 +5,12 @@
 #include "game/systems/spatial-system.hpp"
 #include "game/components/transform-component.hpp"
 #include "game/components/constraint-stack-component.hpp"
+#include <engine/debug/profiler.hpp>
 
 void spatial_system::fixed_update(entity::registry& registry, float, float)
 {
+	debug::profile_scope profile("spatial_system::fixed_update");
+
 	// TODO: Only update world transforms if the local transform has changed
 	const auto view = registry.view<transform_component>(entt::exclude<constraint_stack_component>);
 	for (auto entity_id: view)
@@ -7,26 +7,68 @@
 #include "game/components/rigid-body-component.hpp"
 #include "game/systems/steering-system.hpp"
 #include "game/components/steering-component.hpp"
+#include <engine/debug/profiler.hpp>
 #include <engine/entity/id.hpp>
+#include <engine/ai/steering/behavior/alignment.hpp>
+#include <engine/ai/steering/behavior/cohesion.hpp>
 #include <engine/ai/steering/behavior/seek.hpp>
+#include <engine/ai/steering/behavior/separation.hpp>
 #include <engine/ai/steering/behavior/wander.hpp>
 #include <engine/math/functions.hpp>
 #include <engine/math/quaternion.hpp>
 #include <engine/math/basis.hpp>
+#include <algorithm>
 
 void steering_system::fixed_update(entity::registry& registry, float, float dt)
 {
-	registry.group<steering_component>(entt::get<transform_component, winged_locomotion_component, rigid_body_component>).each
+	debug::profile_scope profile("steering_system::fixed_update");
+	
+	auto group = registry.group<steering_component>(entt::get<transform_component, winged_locomotion_component, rigid_body_component>);
+	
+	// Update agent parameters and gather agents
+	m_agents.clear();
+	m_agent_positions.clear();
+	float max_neighbor_radius = 0.0f;
+	group.each
 	(
-		[&](entity::id entity_id, auto& steering, auto& transform, auto&, const auto& body_component)
+		[&](auto& steering, const auto& transform, const auto&, const auto& body_component)
 		{
 			auto& agent = steering.agent;
-			auto& body = *body_component.body;
-			
-			// Update agent parameters
 			agent.position = transform.local.translation;
 			agent.orientation = transform.local.rotation;
-			agent.velocity = body.get_linear_velocity();
+			agent.velocity = body_component.body->get_linear_velocity();
+			
+			m_agents.emplace_back(agent);
+			m_agent_positions.emplace_back(agent.position);
+			
+			if (steering.separation_weight || steering.cohesion_weight || steering.alignment_weight)
+			{
+				max_neighbor_radius = std::max(max_neighbor_radius, steering.neighbor_radius);
+			}
+		}
+	);
+	
+	// Rebuild spatial index of agents, if any agents flock
+	if (max_neighbor_radius > 0.0f)
+	{
+		if (m_agent_grid.get_cell_size() != max_neighbor_radius)
+		{
+			m_agent_grid.set_cell_size(max_neighbor_radius);
+		}
+		m_agent_grid.build(m_agent_positions);
+	}
+	else
+	{
+		m_agent_grid.clear();
+	}
+	
+	usize agent_index = 0;
+	group.each
+	(
+		[&](entity::id entity_id, auto& steering, auto&, auto&, const auto&)
+		{
+			auto& agent = steering.agent;
+			const auto& agent_snapshot = m_agents[agent_index++];
 			
 			// Accumulate steering forces
 			math::fvec3 force = {0, 0, 0};
@@ -39,6 +81,25 @@ void steering_system::fixed_update(entity::registry& registry, float, float dt)
 			{
 				force += ai::steering::behavior::seek(agent, steering.seek_target) * steering.seek_weight;
 			}
+			if ((steering.separation_weight || steering.cohesion_weight || steering.alignment_weight) && steering.neighbor_radius > 0.0f)
+			{
+				// Find neighbors
+				m_neighbors.clear();
+				m_agent_grid.find_in_radius(agent.position, steering.neighbor_radius, m_neighbors);
+				
+				if (steering.separation_weight)
+				{
+					force += ai::steering::behavior::separation(agent_snapshot, m_agents, m_neighbors) * steering.separation_weight;
+				}
+				if (steering.cohesion_weight)
+				{
+					force += ai::steering::behavior::cohesion(agent_snapshot, m_agents, m_neighbors) * steering.cohesion_weight;
+				}
+				if (steering.alignment_weight)
+				{
+					force += ai::steering::behavior::alignment(agent_snapshot, m_agents, m_neighbors) * steering.alignment_weight;
+				}
+			}
 			
 			// Normalize force
 			if (steering.sum_weights)
@@ -5,7 +5,11 @@
 #define ANTKEEPER_GAME_STEERING_SYSTEM_HPP
 
 #include "game/systems/fixed-update-system.hpp"
+#include <engine/ai/steering/agent.hpp>
+#include <engine/geom/spatial-grid.hpp>
 #include <engine/math/vector.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <vector>
 
 using namespace engine;
 
@@ -19,6 +23,13 @@ public:
 	static inline constexpr math::fvec3 global_forward{0.0f, 0.0f, -1.0f};
 	static inline constexpr math::fvec3 global_up{0.0f, 1.0f, 0.0f};
 	static inline constexpr math::fvec3 global_right{1.0f, 0.0f, 0.0f};
+	
+private:
+	/// Spatial index of agent positions, rebuilt every fixed update for flocking behaviors.
+	geom::spatial_grid m_agent_grid;
+	std::vector<ai::steering::agent> m_agents;
+	std::vector<math::fvec3> m_agent_positions;
+	std::vector<u32> m_neighbors;
 };
 
 #endif // ANTKEEPER_GAME_STEERING_SYSTEM_HPP
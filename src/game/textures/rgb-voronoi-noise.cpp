@@ -5,12 +5,13 @@
 #include <stb/stb_image_write.h>
 #include "game/textures/rgb-voronoi-noise.hpp"
 #include <engine/debug/log.hpp>
-#include <engine/noise/voronoi.hpp>
+#include <engine/noise/batch.hpp>
 #include <engine/math/functions.hpp>
 #include <engine/math/vector.hpp>
 #include <engine/utility/sized-types.hpp>
 #include <algorithm>
 #include <fstream>
+#include <vector>
 
 using namespace engine;
 
@@ -28,23 +29,25 @@ void generate_rgb_voronoi_noise(std::filesystem::path path, float frequency)
 	auto thread_worker = [&](int start_y, int end_y)
 	{
 		std::byte* pixel = image_data.get() + start_y * image_width * image_bpp;
-		math::fvec2 position;
+		std::vector<u32> row_ids(image_width);
 
 		for (int y = start_y; y < end_y; ++y)
 		{
-			position.y() = static_cast<float>(y) * scale.y();
+			// Evaluate a row of cells at once
+			noise::batch::voronoi_f1_grid
+			(
+				{0.0f, static_cast<float>(y) * scale.y()},
+				scale,
+				{static_cast<u32>(image_width), 1},
+				1.0f,
+				{frequency, frequency},
+				{},
+				{},
+				row_ids
+			);
 
-			for (int x = 0; x < image_width; ++x)
+			for (const auto f1_id: row_ids)
 			{
-				position.x() = static_cast<float>(x) * scale.x();
-
-				const auto
-				[
-					f1_sqr_distance,
-					f1_displacement,
-					f1_id
-				] = noise::voronoi_f1<float, 2>(position, 1.0f, {frequency, frequency});
-
 				*(pixel++) = static_cast<std::byte>(f1_id & 255);
 				*(pixel++) = static_cast<std::byte>((f1_id >> 8) & 255);
 				*(pixel++) = static_cast<std::byte>((f1_id >> 16) & 255);
@@ -21,7 +21,7 @@
 #include <engine/gl/vertex-buffer.hpp>
 #include <engine/physics/light/photometry.hpp>
 #include <engine/physics/light/vmag.hpp>
-#include <engine/physics/orbit/ephemeris.hpp>
+#include <engine/physics/orbit/paged-ephemeris.hpp>
 #include <engine/physics/orbit/frame.hpp>
 #include <engine/physics/time.hpp>
 #include <engine/render/material.hpp>
@@ -223,7 +223,7 @@ namespace world
 
 	void load_ephemeris(::game& ctx)
 	{
-		ctx.m_orbit_system->set_ephemeris(ctx.resource_manager->load<physics::orbit::ephemeris<double>>("de421.eph"));
+		ctx.m_orbit_system->set_ephemeris(ctx.resource_manager->load<physics::orbit::paged_ephemeris>("de421.eph"));
 	}
 
 	void create_stars(::game& ctx)
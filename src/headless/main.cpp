@@ -0,0 +1,189 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <entt/entt.hpp>
+#include "headless/scenario.hpp"
+#include "game/systems/behavior-system.hpp"
+#include "game/systems/collision-system.hpp"
+#include "game/systems/constraint-system.hpp"
+#include "game/systems/ik-system.hpp"
+#include "game/systems/locomotion-system.hpp"
+#include "game/systems/metabolic-system.hpp"
+#include "game/systems/metamorphosis-system.hpp"
+#include "game/systems/physics-system.hpp"
+#include "game/systems/reproductive-system.hpp"
+#include "game/systems/spatial-system.hpp"
+#include "game/systems/steering-system.hpp"
+#include "game/systems/terrain-system.hpp"
+#include <engine/ai/navmesh-flow-field.hpp>
+#include <engine/config.hpp>
+#include <engine/debug/console-log.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <cxxopts.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <print>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace engine;
+
+namespace
+{
+	using clock_type = std::chrono::steady_clock;
+
+	/// Fixed-update system and its accumulated timings.
+	struct timed_system
+	{
+		std::string_view name;
+		std::shared_ptr<fixed_update_system> system;
+		clock_type::duration total{};
+		clock_type::duration max{};
+
+		/// `false` if the scenario has no entities on which the system operates, in which case its timings only measure the cost of an empty update.
+		bool populated{true};
+	};
+}
+
+int main(int argc, char* argv[])
+{
+	// Open console log
+	#if !defined(NDEBUG)
+		debug::console_log console_log;
+	#endif
+
+	scenario_parameters parameters;
+	usize tick_count = 600;
+	usize warmup_tick_count = 10;
+	double fixed_update_rate = 60.0;
+
+	// Parse command-line options
+	try
+	{
+		cxxopts::Options options(std::string(config::application_slug) + "-headless", std::string(config::application_name) + " headless simulation runner");
+		options.add_options()
+			("a,agents", "Sets the number of flying agents", cxxopts::value<usize>()->default_value(std::to_string(parameters.agent_count)))
+			("l,walkers", "Sets the number of legged agents", cxxopts::value<usize>()->default_value(std::to_string(parameters.walker_count)))
+			("t,ticks", "Sets the number of timed fixed updates", cxxopts::value<usize>()->default_value(std::to_string(tick_count)))
+			("w,warmup", "Sets the number of untimed fixed updates which precede the timed updates", cxxopts::value<usize>()->default_value(std::to_string(warmup_tick_count)))
+			("r,rate", "Sets the fixed update rate, in hertz", cxxopts::value<double>()->default_value(std::to_string(fixed_update_rate)))
+			("s,seed", "Sets the scenario random seed", cxxopts::value<u32>()->default_value(std::to_string(parameters.seed)))
+			("terrain-resolution", "Sets the number of terrain quads along each axis", cxxopts::value<u32>()->default_value(std::to_string(parameters.terrain_resolution)))
+			("time-scale", "Sets the simulation time scale", cxxopts::value<float>()->default_value(std::to_string(parameters.time_scale)))
+			("h,help", "Prints usage");
+		auto result = options.parse(argc, argv);
+
+		if (result.count("help"))
+		{
+			std::println("{}", options.help());
+			return EXIT_SUCCESS;
+		}
+
+		parameters.agent_count = result["agents"].as<usize>();
+		parameters.walker_count = result["walkers"].as<usize>();
+		parameters.seed = result["seed"].as<u32>();
+		parameters.terrain_resolution = result["terrain-resolution"].as<u32>();
+		parameters.time_scale = result["time-scale"].as<float>();
+		tick_count = result["ticks"].as<usize>();
+		warmup_tick_count = result["warmup"].as<usize>();
+		fixed_update_rate = result["rate"].as<double>();
+	}
+	catch (const std::exception& e)
+	{
+		std::println(stderr, "Failed to parse command-line options: {}", e.what());
+		return EXIT_FAILURE;
+	}
+
+	// Load scenario
+	entity::registry registry;
+	const auto load_start = clock_type::now();
+	load_scenario(registry, parameters);
+	const auto load_duration = clock_type::now() - load_start;
+
+	// Set up locomotion system, which steers legged agents along flow fields as in the game
+	auto locomotion_system = std::make_shared<::locomotion_system>();
+	locomotion_system->set_flow_field_cache(std::make_shared<ai::navmesh_flow_field_cache>());
+
+	// Set up simulation systems, in the same order as the game's fixed-rate updates. Systems which only present the simulation are omitted. Systems whose entities require a data package run on empty sets
+	std::vector<timed_system> systems =
+	{
+		{"physics", std::make_shared<::physics_system>()},
+		{"terrain", std::make_shared<::terrain_system>()},
+		{"collision", std::make_shared<::collision_system>()},
+		{"behavior", std::make_shared<::behavior_system>(), {}, {}, false},
+		{"steering", std::make_shared<::steering_system>()},
+		{"locomotion", locomotion_system},
+		{"ik", std::make_shared<::ik_system>(), {}, {}, false},
+		{"reproductive", std::make_shared<::reproductive_system>(), {}, {}, false},
+		{"metabolic", std::make_shared<::metabolic_system>(), {}, {}, false},
+		{"metamorphosis", std::make_shared<::metamorphosis_system>(), {}, {}, false},
+		{"spatial", std::make_shared<::spatial_system>()},
+		{"constraint", std::make_shared<::constraint_system>(registry)}
+	};
+
+	// Run fixed updates
+	const float dt = static_cast<float>(1.0 / fixed_update_rate);
+	clock_type::duration total_duration{};
+	for (usize i = 0; i < warmup_tick_count + tick_count; ++i)
+	{
+		const float t = static_cast<float>(i) * dt;
+		const bool timed = i >= warmup_tick_count;
+
+		const auto tick_start = clock_type::now();
+		auto system_start = tick_start;
+		for (auto& entry: systems)
+		{
+			entry.system->fixed_update(registry, t, dt);
+
+			const auto system_end = clock_type::now();
+			if (timed)
+			{
+				const auto duration = system_end - system_start;
+				entry.total += duration;
+				entry.max = std::max(entry.max, duration);
+			}
+			system_start = system_end;
+		}
+
+		if (timed)
+		{
+			total_duration += system_start - tick_start;
+		}
+	}
+
+	// Print report
+	using milliseconds = std::chrono::duration<double, std::milli>;
+	using microseconds = std::chrono::duration<double, std::micro>;
+	const double total_ms = milliseconds(total_duration).count();
+	const double simulated_seconds = static_cast<double>(tick_count) * static_cast<double>(dt);
+
+	std::println("scenario: {} flying agents, {} legged agents, {}x{} terrain, seed {}", parameters.agent_count, parameters.walker_count, parameters.terrain_resolution, parameters.terrain_resolution, parameters.seed);
+	std::println("load: {:.2f} ms", milliseconds(load_duration).count());
+	std::println("ticks: {} timed, {} warmup, {:.1f} Hz", tick_count, warmup_tick_count, fixed_update_rate);
+	std::println("");
+	std::println("{:<16}{:>12}{:>14}{:>14}{:>9}", "system", "total (ms)", "mean (us)", "max (us)", "share");
+	for (const auto& entry: systems)
+	{
+		const double system_ms = milliseconds(entry.total).count();
+		std::println
+		(
+			"{:<16}{:>12.2f}{:>14.2f}{:>14.2f}{:>8.1f}%{}",
+			entry.name,
+			system_ms,
+			tick_count ? microseconds(entry.total).count() / static_cast<double>(tick_count) : 0.0,
+			microseconds(entry.max).count(),
+			total_ms > 0.0 ? system_ms / total_ms * 100.0 : 0.0,
+			entry.populated ? "" : "  (no entities)"
+		);
+	}
+	std::println("{:<16}{:>12.2f}{:>14.2f}", "total", total_ms, tick_count ? total_ms * 1000.0 / static_cast<double>(tick_count) : 0.0);
+	std::println("");
+	std::println("simulation rate: {:.1f}x real time", total_ms > 0.0 ? simulated_seconds * 1000.0 / total_ms : 0.0);
+	std::println("state hash: {:016x}", hash_scenario_state(registry));
+
+	return EXIT_SUCCESS;
+}
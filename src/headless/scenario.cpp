@@ -0,0 +1,346 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <entt/entt.hpp>
+#include "headless/scenario.hpp"
+#include "game/ant/ant-alate-steering.hpp"
+#include "game/ant/ant-skeleton.hpp"
+#include "game/components/legged-locomotion-component.hpp"
+#include "game/components/navmesh-agent-component.hpp"
+#include "game/components/picking-component.hpp"
+#include "game/components/pose-component.hpp"
+#include "game/components/rigid-body-component.hpp"
+#include "game/components/steering-component.hpp"
+#include "game/components/transform-component.hpp"
+#include "game/components/winged-locomotion-component.hpp"
+#include "game/utility/time.hpp"
+#include <engine/animation/locomotion/gait.hpp>
+#include <engine/animation/skeleton.hpp>
+#include <engine/geom/brep/mesh.hpp>
+#include <engine/hash/fnv.hpp>
+#include <engine/physics/kinematics/colliders/mesh-collider.hpp>
+#include <engine/math/functions.hpp>
+#include <engine/math/quaternion.hpp>
+#include <engine/debug/log.hpp>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace engine::geom;
+
+namespace
+{
+	/// Generates a uniformly-distributed random point in a unit sphere.
+	template <class URBG>
+	[[nodiscard]] math::fvec3 sphere_random(URBG& urbg)
+	{
+		// Rejection sampling, rather than distribution classes, keeps the sequence identical across standard libraries
+		const auto uniform = [&]()
+		{
+			return static_cast<float>(urbg() >> 8) * (2.0f / static_cast<float>(1u << 24)) - 1.0f;
+		};
+
+		for (;;)
+		{
+			const math::fvec3 point = {uniform(), uniform(), uniform()};
+			if (math::sqr_length(point) <= 1.0f)
+			{
+				return point;
+			}
+		}
+	}
+
+	/// Skeleton and locomotion poses shared by every legged agent.
+	struct walker_rig
+	{
+		animation::skeleton skeleton{25};
+		std::unique_ptr<animation::skeleton_pose> midstance_pose;
+		std::unique_ptr<animation::skeleton_pose> midswing_pose;
+		std::unique_ptr<animation::skeleton_pose> liftoff_pose;
+		std::unique_ptr<animation::skeleton_pose> touchdown_pose;
+	};
+
+	/// Builds a six-legged skeleton, with the bone names of an ant skeleton, from fixed dimensions rather than ant phenome models.
+	[[nodiscard]] std::shared_ptr<walker_rig> make_walker_rig()
+	{
+		auto rig = std::make_shared<walker_rig>();
+		auto& bones = rig->skeleton.bones();
+		auto& rest_pose = rig->skeleton.rest_pose();
+
+		bones.at(0).rename("mesosoma");
+
+		// Pro-, meso-, and metathoracic legs, each a chain of coxa, femur, tibia, and tarsomere
+		constexpr std::array<const char*, 3> leg_prefixes = {"pro", "meso", "meta"};
+		constexpr std::array<const char*, 4> segment_names = {"coxa", "femur", "tibia", "tarsomere1"};
+		constexpr std::array<float, 4> segment_lengths = {0.0f, 0.1f, 0.3f, 0.3f};
+		usize bone_index = 1;
+		for (usize leg = 0; leg < 6; ++leg)
+		{
+			const bool left = leg % 2 == 0;
+			const float side = left ? 1.0f : -1.0f;
+
+			for (usize segment = 0; segment < 4; ++segment, ++bone_index)
+			{
+				auto& bone = bones.at(bone_index);
+				bone.rename(std::string(leg_prefixes[leg / 2]) + segment_names[segment] + (left ? "_l" : "_r"));
+				bone.reparent(segment ? &bones.at(bone_index - 1) : &bones.at(0));
+
+				auto transform = math::identity<math::transform<float>>;
+				if (segment)
+				{
+					transform.translation = {side * segment_lengths[segment], 0.0f, 0.0f};
+				}
+				else
+				{
+					transform.translation = {side * 0.15f, 0.0f, 0.3f - static_cast<float>(leg / 2) * 0.3f};
+				}
+				rest_pose.set_relative_transform(bone_index, transform);
+			}
+		}
+
+		rest_pose.set_relative_transform(0, math::identity<math::transform<float>>);
+		rest_pose.update();
+
+		rig->midstance_pose = generate_ant_midstance_pose(rig->skeleton);
+		rig->midswing_pose = generate_ant_midswing_pose(rig->skeleton);
+		rig->liftoff_pose = generate_ant_liftoff_pose(rig->skeleton);
+		rig->touchdown_pose = generate_ant_touchdown_pose(rig->skeleton);
+
+		return rig;
+	}
+
+	/// Creates a terrain entity with a heightfield mesh collider.
+	/// @return Entity ID of the terrain.
+	entity::id create_terrain(entity::registry& registry, const scenario_parameters& parameters)
+	{
+		const u32 quads = std::max(parameters.terrain_resolution, 1u);
+		const u32 vertices_per_row = quads + 1;
+		const float spacing = parameters.terrain_size / static_cast<float>(quads);
+		const float origin = parameters.terrain_size * -0.5f;
+
+		auto mesh = std::make_shared<brep::mesh>();
+		auto& vertex_positions = static_cast<brep::attribute<math::fvec3>&>(*mesh->vertices().attributes().emplace<math::fvec3>("position"));
+
+		// Build vertices from a sum of sinusoids
+		for (u32 z = 0; z < vertices_per_row; ++z)
+		{
+			for (u32 x = 0; x < vertices_per_row; ++x)
+			{
+				auto vertex = mesh->vertices().emplace_back();
+
+				auto& position = vertex_positions[vertex->index()];
+				position.x() = origin + static_cast<float>(x) * spacing;
+				position.z() = origin + static_cast<float>(z) * spacing;
+				position.y() = 2.0f * std::sin(position.x() * 0.05f) * std::cos(position.z() * 0.04f) + 0.5f * std::sin(position.x() * 0.31f + position.z() * 0.17f);
+			}
+		}
+
+		// Build two triangles per quad
+		for (u32 z = 0; z < quads; ++z)
+		{
+			for (u32 x = 0; x < quads; ++x)
+			{
+				auto a = mesh->vertices()[usize{z} * vertices_per_row + x];
+				auto b = mesh->vertices()[a->index() + vertices_per_row];
+				auto c = mesh->vertices()[a->index() + 1];
+				auto d = mesh->vertices()[b->index() + 1];
+
+				brep::vertex* abc[3] = {a, b, c};
+				brep::vertex* cbd[3] = {c, b, d};
+
+				mesh->faces().emplace_back(abc);
+				mesh->faces().emplace_back(cbd);
+			}
+		}
+
+		auto rigid_body = std::make_unique<physics::rigid_body>();
+		rigid_body->set_mass(0.0f);
+		rigid_body->set_collider(std::make_shared<physics::mesh_collider>(mesh));
+
+		const auto terrain_eid = registry.create();
+		registry.emplace<rigid_body_component>(terrain_eid, std::move(rigid_body));
+
+		debug::log_info("Generated terrain with {} faces", mesh->faces().size());
+
+		return terrain_eid;
+	}
+
+	/// Creates legged agents on the terrain navmesh, which walk toward the corners of the terrain along shared flow fields.
+	void create_walkers(entity::registry& registry, const scenario_parameters& parameters, entity::id terrain_eid)
+	{
+		if (!parameters.walker_count)
+		{
+			return;
+		}
+
+		auto& mesh = *static_cast<const physics::mesh_collider&>(*registry.get<rigid_body_component>(terrain_eid).body->get_collider()).get_mesh();
+		const auto& vertex_positions = mesh.vertices().attributes().at<math::fvec3>("position");
+
+		// Goal faces in each corner of the terrain
+		const u32 quads = std::max(parameters.terrain_resolution, 1u);
+		const u32 corner = quads > 2 ? quads - 2 : 0;
+		const std::array<u32, 4> goal_faces =
+		{
+			2 * (std::min(1u, corner) * quads + std::min(1u, corner)),
+			2 * (std::min(1u, corner) * quads + corner),
+			2 * (corner * quads + std::min(1u, corner)),
+			2 * (corner * quads + corner)
+		};
+
+		const auto rig = make_walker_rig();
+		const auto& bones = rig->skeleton.bones();
+
+		// Init pose component
+		::pose_component pose;
+		pose.current_pose = rig->skeleton.rest_pose();
+		pose.previous_pose = pose.current_pose;
+
+		// Init legged locomotion component, with poses which keep the rig alive
+		::legged_locomotion_component locomotion;
+		locomotion.midstance_pose = std::shared_ptr<animation::skeleton_pose>(rig, rig->midstance_pose.get());
+		locomotion.midswing_pose = std::shared_ptr<animation::skeleton_pose>(rig, rig->midswing_pose.get());
+		locomotion.liftoff_pose = std::shared_ptr<animation::skeleton_pose>(rig, rig->liftoff_pose.get());
+		locomotion.touchdown_pose = std::shared_ptr<animation::skeleton_pose>(rig, rig->touchdown_pose.get());
+		locomotion.body_bone = bones.at("mesosoma").index();
+		locomotion.tip_bones =
+		{
+			bones.at("protarsomere1_l").index(),
+			bones.at("mesotarsomere1_l").index(),
+			bones.at("metatarsomere1_l").index(),
+			bones.at("protarsomere1_r").index(),
+			bones.at("mesotarsomere1_r").index(),
+			bones.at("metatarsomere1_r").index()
+		};
+		locomotion.leg_bone_count = 4;
+		locomotion.gait = std::make_shared<animation::gait>();
+		locomotion.gait->frequency = 4.0f;
+		locomotion.gait->steps.resize(6);
+		for (usize i = 0; i < 6; ++i)
+		{
+			const float duty_factors[3] = {0.52f, 0.62f, 0.54f};
+			auto& step = locomotion.gait->steps[i];
+			step.duty_factor = duty_factors[i % 3];
+			step.delay = (i % 2) ? 0.5f : 0.0f;
+		}
+		locomotion.standing_height = 0.1f;
+		locomotion.stride_length = 0.4f;
+		locomotion.max_angular_frequency = math::radians(360.0f);
+		locomotion.speed = 2.0f;
+		locomotion.target_direction = {0.0f, 0.0f, 1.0f};
+
+		// Init navmesh agent component
+		::navmesh_agent_component navmesh_agent;
+		navmesh_agent.navmesh_eid = terrain_eid;
+		navmesh_agent.mesh = &mesh;
+		navmesh_agent.surface_normal = {0.0f, 1.0f, 0.0f};
+
+		// Init rigid body
+		physics::rigid_body rigid_body;
+		rigid_body.set_mass(0.0f);
+
+		std::mt19937 rng(parameters.seed ^ 0x9e3779b9u);
+		for (usize i = 0; i < parameters.walker_count; ++i)
+		{
+			// Place agent at the centroid of a random face
+			auto face = mesh.faces()[rng() % mesh.faces().size()];
+			math::fvec3 centroid = {0.0f, 0.0f, 0.0f};
+			for (const auto loop: face->loops())
+			{
+				centroid += vertex_positions[loop->vertex()->index()];
+			}
+			centroid /= 3.0f;
+
+			auto transform = math::identity<math::transform<float>>;
+			transform.translation = centroid;
+			rigid_body.set_transform(transform);
+			rigid_body.set_previous_transform(transform);
+
+			navmesh_agent.feature = face;
+			navmesh_agent.goal_faces = {goal_faces[i % goal_faces.size()]};
+
+			const auto walker_eid = registry.create();
+			registry.emplace<::navmesh_agent_component>(walker_eid, navmesh_agent);
+			registry.emplace<::pose_component>(walker_eid, pose);
+			registry.emplace<::legged_locomotion_component>(walker_eid, locomotion);
+			registry.emplace<::rigid_body_component>(walker_eid, std::make_unique<physics::rigid_body>(rigid_body));
+		}
+
+		debug::log_info("Generated {} legged agents", parameters.walker_count);
+	}
+
+	/// Creates a swarm of flying agents.
+	void create_swarm(entity::registry& registry, const scenario_parameters& parameters)
+	{
+		const math::fvec3 swarm_center = {0.0f, parameters.swarm_radius + 10.0f, 0.0f};
+
+		std::mt19937 rng(parameters.seed);
+
+		// Init transform component
+		::transform_component transform;
+		transform.local = math::identity<math::transform<float>>;
+		transform.world = transform.local;
+
+		// Init picking component
+		::picking_component picking;
+		picking.sphere = {math::fvec3{0, 0, 0}, 1.0f};
+		picking.flags = 0b01;
+
+		// Init steering component, with the same parameters as the alates of a nuptial flight
+		auto steering = make_alate_steering(swarm_center);
+
+		// Init rigid body
+		physics::rigid_body rigid_body;
+		rigid_body.set_mass(1.0f);
+
+		for (usize i = 0; i < parameters.agent_count; ++i)
+		{
+			// Generate random position in swarm sphere
+			steering.agent.position = swarm_center + sphere_random(rng) * parameters.swarm_radius;
+			transform.local.translation = steering.agent.position;
+			transform.world = transform.local;
+			rigid_body.set_transform(transform.local);
+			rigid_body.set_previous_transform(transform.local);
+
+			const auto agent_eid = registry.create();
+			registry.emplace<::steering_component>(agent_eid, steering);
+			registry.emplace<::rigid_body_component>(agent_eid, std::make_unique<physics::rigid_body>(rigid_body));
+			registry.emplace<::winged_locomotion_component>(agent_eid);
+			registry.emplace<::transform_component>(agent_eid, transform);
+			registry.emplace<::picking_component>(agent_eid, picking);
+		}
+
+		debug::log_info("Generated swarm of {} agents", parameters.agent_count);
+	}
+}
+
+void load_scenario(entity::registry& registry, const scenario_parameters& parameters)
+{
+	set_time_scale(registry, parameters.time_scale);
+	const auto terrain_eid = create_terrain(registry, parameters);
+	create_walkers(registry, parameters, terrain_eid);
+	create_swarm(registry, parameters);
+}
+
+u64 hash_scenario_state(const entity::registry& registry)
+{
+	std::vector<u32> words;
+
+	const auto view = registry.view<const rigid_body_component>();
+	for (const auto entity_id: view)
+	{
+		const auto& body = *view.get<const rigid_body_component>(entity_id).body;
+		for (const auto& vector: {body.get_position(), body.get_linear_velocity()})
+		{
+			for (usize i = 0; i < 3; ++i)
+			{
+				words.emplace_back(std::bit_cast<u32>(vector[i]));
+			}
+		}
+	}
+
+	return static_cast<u64>(hash::fnv1a64<u32>(words));
+}
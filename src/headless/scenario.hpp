@@ -0,0 +1,48 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef ANTKEEPER_HEADLESS_SCENARIO_HPP
+#define ANTKEEPER_HEADLESS_SCENARIO_HPP
+
+#include <engine/entity/registry.hpp>
+#include <engine/utility/sized-types.hpp>
+
+using namespace engine;
+
+/// Parameters of a procedurally-generated headless scenario.
+struct scenario_parameters
+{
+	/// Number of flying agents.
+	usize agent_count{10000};
+
+	/// Number of legged agents on the terrain navmesh.
+	usize walker_count{1000};
+
+	/// Radius of the sphere in which agents are spawned, in meters.
+	float swarm_radius{50.0f};
+
+	/// Number of terrain quads along each horizontal axis.
+	u32 terrain_resolution{128};
+
+	/// Edge length of the terrain, in meters.
+	float terrain_size{200.0f};
+
+	/// Time scale, in simulated seconds per real-time second.
+	float time_scale{1.0f};
+
+	/// Seed of the random number generator which places agents.
+	u32 seed{0};
+};
+
+/// Populates a registry with a scenario which requires no window, graphics context, audio device, or data package.
+/// @param registry Entity registry.
+/// @param parameters Scenario parameters.
+/// @details The scenario consists of a heightfield terrain with a mesh collider, legged agents which walk over the terrain as a navmesh toward its corners along shared flow fields, and a swarm of flying agents which wander, seek the swarm center, and separate from their neighbors. Behavior, IK, reproductive, metabolic, and metamorphosis entities require a data package, so the scenario has none.
+void load_scenario(entity::registry& registry, const scenario_parameters& parameters);
+
+/// Hashes the positions and velocities of all rigid bodies in a registry, so that runs can be checked for determinism.
+/// @param registry Entity registry.
+/// @return 64-bit FNV-1a hash of the rigid body states.
+[[nodiscard]] u64 hash_scenario_state(const entity::registry& registry);
+
+#endif // ANTKEEPER_HEADLESS_SCENARIO_HPP
@@ -0,0 +1,126 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "test.hpp"
+#include <engine/animation/animation-curve.hpp>
+#include <engine/animation/baked-clip.hpp>
+#include <random>
+#include <vector>
+
+using namespace engine;
+using namespace engine::animation;
+
+namespace
+{
+	/// Generates a linear curve with random keyframes, and a baked clip with one translation track of three copies of the curve.
+	void make_curve_and_clip(animation_curve& curve, baked_clip& clip, baked_interpolation interpolation)
+	{
+		std::mt19937 rng(7);
+		std::uniform_real_distribution<float> value_distribution(-1.0f, 1.0f);
+		std::uniform_real_distribution<float> step_distribution(0.01f, 0.1f);
+
+		std::vector<float> times;
+		std::vector<float> values;
+		float time = 0.0f;
+		for (int i = 0; i < 50; ++i)
+		{
+			times.emplace_back(time);
+			values.emplace_back(value_distribution(rng));
+			curve.keyframes().emplace(times.back(), values.back());
+			time += step_distribution(rng);
+		}
+
+		if (interpolation == baked_interpolation::constant)
+		{
+			curve.interpolator() = interpolate_keyframes_constant;
+		}
+
+		for (int i = 0; i < 3; ++i)
+		{
+			clip.add_channel(times, values, interpolation);
+		}
+		clip.add_track("root/translation", 0);
+	}
+}
+
+int main(int, char*[])
+{
+	test_suite suite;
+
+	suite.tests.emplace_back("Baked clip matches curve", []()
+	{
+		animation_curve curve;
+		baked_clip clip;
+		make_curve_and_clip(curve, clip, baked_interpolation::linear);
+		ASSERT_EQ(clip.duration(), curve.duration());
+
+		std::vector<u32> cursors(clip.channels().size());
+		std::vector<math::transform<float>> pose(1, math::identity<math::transform<float>>);
+
+		// Monotonic playback, including times outside of the key range
+		for (float t = -0.5f; t < clip.duration() + 0.5f; t += 0.0137f)
+		{
+			clip.sample(t, cursors, pose);
+			ASSERT_NEAR(pose[0].translation.x(), curve.evaluate(t), 1e-5f);
+		}
+
+		// Random seeking
+		std::mt19937 rng(11);
+		std::uniform_real_distribution<float> time_distribution(-0.1f, clip.duration() + 0.1f);
+		for (int i = 0; i < 1000; ++i)
+		{
+			const float t = time_distribution(rng);
+			clip.sample(t, cursors, pose);
+			ASSERT_NEAR(pose[0].translation.z(), curve.evaluate(t), 1e-5f);
+		}
+	});
+
+	suite.tests.emplace_back("Baked clip constant interpolation", []()
+	{
+		animation_curve curve;
+		baked_clip clip;
+		make_curve_and_clip(curve, clip, baked_interpolation::constant);
+
+		std::vector<u32> cursors(clip.channels().size());
+		std::vector<math::transform<float>> pose(1, math::identity<math::transform<float>>);
+		for (float t = 0.001f; t < clip.duration(); t += 0.0137f)
+		{
+			clip.sample(t, cursors, pose);
+			ASSERT_EQ(pose[0].translation.y(), curve.evaluate(t));
+		}
+	});
+
+	suite.tests.emplace_back("Baked clip track validation", []()
+	{
+		baked_clip clip;
+		const float times[] = {0.0f, 1.0f};
+		const float values[] = {0.0f, 1.0f};
+		clip.add_channel(times, values);
+		ASSERT_EQ(clip.tracks().size(), 0);
+
+		bool threw = false;
+		try
+		{
+			clip.add_track("root/translation", 0);
+		}
+		catch (const std::out_of_range&)
+		{
+			threw = true;
+		}
+		ASSERT(threw);
+		ASSERT_EQ(clip.tracks().size(), 0);
+
+		threw = false;
+		try
+		{
+			clip.add_track("root/color", 0);
+		}
+		catch (const std::invalid_argument&)
+		{
+			threw = true;
+		}
+		ASSERT(threw);
+	});
+
+	return suite.run();
+}
@@ -0,0 +1,355 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "test.hpp"
+#include <engine/audio/sound-stream.hpp>
+#include <engine/audio/sound-system.hpp>
+#include <engine/audio/streaming-sound-que.hpp>
+#include <engine/resources/deserialize-context.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace engine;
+using namespace engine::audio;
+
+namespace
+{
+	/// Returns a test sample value.
+	[[nodiscard]] i16 make_sample(usize frame, usize channel)
+	{
+		return static_cast<i16>(static_cast<int>((frame * 31 + channel * 7) % 20000) - 10000);
+	}
+
+	/// Makes 16-bit PCM WAV file data with test samples.
+	[[nodiscard]] std::vector<std::byte> make_wav(u16 channels, u32 sample_rate, usize frame_count)
+	{
+		const u32 data_size = static_cast<u32>(frame_count * channels * sizeof(i16));
+		const u32 byte_rate = sample_rate * channels * sizeof(i16);
+		const u16 block_align = static_cast<u16>(channels * sizeof(i16));
+		const u16 bits_per_sample = 16;
+		const u16 pcm_format = 1;
+		const u32 fmt_size = 16;
+		const u32 riff_size = 36 + data_size;
+
+		std::vector<std::byte> data;
+		const auto write = [&](const void* bytes, usize size)
+		{
+			const auto offset = data.size();
+			data.resize(offset + size);
+			std::memcpy(data.data() + offset, bytes, size);
+		};
+
+		write("RIFF", 4);
+		write(&riff_size, 4);
+		write("WAVE", 4);
+		write("fmt ", 4);
+		write(&fmt_size, 4);
+		write(&pcm_format, 2);
+		write(&channels, 2);
+		write(&sample_rate, 4);
+		write(&byte_rate, 4);
+		write(&block_align, 2);
+		write(&bits_per_sample, 2);
+		write("data", 4);
+		write(&data_size, 4);
+
+		for (usize i = 0; i < frame_count; ++i)
+		{
+			for (usize j = 0; j < channels; ++j)
+			{
+				const auto sample = make_sample(i, j);
+				write(&sample, sizeof(sample));
+			}
+		}
+
+		return data;
+	}
+
+	/// File in memory which counts the bytes read from it.
+	class memory_file: public resources::deserialize_context
+	{
+	public:
+		explicit memory_file(std::vector<std::byte> data):
+			m_data(std::move(data))
+		{}
+
+		[[nodiscard]] const std::filesystem::path& path() const noexcept override
+		{
+			return m_path;
+		}
+
+		[[nodiscard]] std::filesystem::path native_path() const override
+		{
+			return {};
+		}
+
+		[[nodiscard]] bool error() const noexcept override
+		{
+			return false;
+		}
+
+		[[nodiscard]] bool eof() const noexcept override
+		{
+			return m_position == m_data.size();
+		}
+
+		[[nodiscard]] usize size() const noexcept override
+		{
+			return m_data.size();
+		}
+
+		[[nodiscard]] usize tell() const override
+		{
+			return m_position;
+		}
+
+		void seek(usize offset) override
+		{
+			m_position = std::min(offset, m_data.size());
+		}
+
+		usize read8(std::byte* data, usize count) override
+		{
+			count = std::min(count, m_data.size() - m_position);
+			std::memcpy(data, m_data.data() + m_position, count);
+			m_position += count;
+			m_bytes_read += count;
+			return count;
+		}
+
+		usize read16_le(std::byte*, usize) override
+		{
+			throw std::runtime_error("Not implemented");
+		}
+
+		usize read16_be(std::byte*, usize) override
+		{
+			throw std::runtime_error("Not implemented");
+		}
+
+		usize read32_le(std::byte*, usize) override
+		{
+			throw std::runtime_error("Not implemented");
+		}
+
+		usize read32_be(std::byte*, usize) override
+		{
+			throw std::runtime_error("Not implemented");
+		}
+
+		usize read64_le(std::byte*, usize) override
+		{
+			throw std::runtime_error("Not implemented");
+		}
+
+		usize read64_be(std::byte*, usize) override
+		{
+			throw std::runtime_error("Not implemented");
+		}
+
+		/// Returns the total number of bytes read.
+		[[nodiscard]] inline usize get_bytes_read() const noexcept
+		{
+			return m_bytes_read;
+		}
+
+	private:
+		std::vector<std::byte> m_data;
+		std::filesystem::path m_path;
+		usize m_position{0};
+		usize m_bytes_read{0};
+	};
+
+	/// Renders samples with a loopback sound system, updating a streaming sound que between blocks.
+	/// @return Sum of absolute rendered sample values.
+	usize render(sound_system& system, streaming_sound_que& que, usize frame_count)
+	{
+		std::vector<i16> samples(512 * 2);
+		usize energy = 0;
+
+		for (usize i = 0; i < frame_count; i += 512)
+		{
+			system.render(samples);
+			que.update();
+
+			for (auto sample: samples)
+			{
+				energy += static_cast<usize>(sample < 0 ? -sample : sample);
+			}
+		}
+
+		return energy;
+	}
+}
+
+int main(int, char*[])
+{
+	test_suite suite;
+
+	suite.tests.emplace_back("Sound stream decoding", []()
+	{
+		const usize frame_count = 100000;
+		const sound_stream stream(make_wav(2, 22050, frame_count));
+		ASSERT_EQ(stream.get_channels(), 2);
+		ASSERT_EQ(stream.get_sample_rate(), 22050);
+		ASSERT_EQ(stream.get_frame_count(), frame_count);
+		ASSERT_NEAR(stream.get_duration(), static_cast<float>(frame_count) / 22050.0f, 1e-4f);
+
+		// Decode in uneven chunks
+		auto decoder = stream.open_decoder();
+		std::vector<i16> samples(777 * 2);
+		usize frame = 0;
+		while (const auto frames_read = decoder->read(samples))
+		{
+			for (usize i = 0; i < frames_read; ++i)
+			{
+				ASSERT_EQ(samples[i * 2], make_sample(frame + i, 0));
+				ASSERT_EQ(samples[i * 2 + 1], make_sample(frame + i, 1));
+			}
+			frame += frames_read;
+		}
+		ASSERT_EQ(frame, frame_count);
+
+		// Seek
+		decoder->seek(54321);
+		ASSERT_EQ(decoder->read(samples), 777);
+		ASSERT_EQ(samples[0], make_sample(54321, 0));
+		ASSERT_EQ(samples[777 * 2 - 1], make_sample(54321 + 776, 1));
+
+		// Unrecognized format
+		bool threw = false;
+		try
+		{
+			sound_stream invalid_stream(std::vector<std::byte>(64, std::byte{0}));
+		}
+		catch (const std::runtime_error&)
+		{
+			threw = true;
+		}
+		ASSERT(threw);
+	});
+
+	suite.tests.emplace_back("Sound stream from file", []()
+	{
+		const usize frame_count = 100000;
+		auto file = std::make_shared<memory_file>(make_wav(2, 22050, frame_count));
+		const sound_stream stream(file);
+		ASSERT_EQ(stream.get_frame_count(), frame_count);
+		ASSERT_EQ(stream.get_size(), file->size());
+
+		// WAV data is not held in memory, and only its header has been read
+		ASSERT_EQ(stream.get_resident_size(), usize{0});
+		ASSERT_LT(file->get_bytes_read(), file->size() / 2);
+
+		// Decoders sharing the file read from their own positions
+		auto a = stream.open_decoder();
+		auto b = stream.open_decoder();
+		b->seek(50000);
+		std::vector<i16> samples(1000 * 2);
+		for (usize frame = 0; frame < 50000; frame += 1000)
+		{
+			ASSERT_EQ(a->read(samples), usize{1000});
+			ASSERT_EQ(samples[0], make_sample(frame, 0));
+			ASSERT_EQ(b->read(samples), usize{1000});
+			ASSERT_EQ(samples[1999], make_sample(50000 + frame + 999, 1));
+		}
+		ASSERT_EQ(a->read(samples), usize{1000});
+		ASSERT_EQ(samples[0], make_sample(50000, 0));
+		ASSERT_EQ(b->read(samples), usize{0});
+	});
+
+	suite.tests.emplace_back("Streaming sound que playback", []()
+	{
+		sound_system system(sound_device_type::loopback);
+
+		const usize frame_count = sound_system::loopback_sample_rate;
+		auto stream = std::make_shared<sound_stream>(make_wav(1, sound_system::loopback_sample_rate, frame_count));
+
+		streaming_sound_que que(stream);
+		ASSERT(que.is_stopped());
+		ASSERT_EQ(que.get_playback_position_frames(), 0);
+
+		que.play();
+		ASSERT(que.is_playing());
+
+		// Render until the end of the stream. Rendering is faster than real time, so the decode thread may fall behind and cause gaps in playback
+		const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+		usize energy = 0;
+		usize rendered_frame_count = 0;
+		while (que.is_playing() && std::chrono::steady_clock::now() < deadline)
+		{
+			energy += render(system, que, 512);
+			rendered_frame_count += 512;
+			std::this_thread::yield();
+		}
+		ASSERT(que.is_stopped());
+		ASSERT_GE(rendered_frame_count, frame_count);
+		ASSERT_GT(energy, 0);
+
+		// Replay from the beginning
+		que.play();
+		ASSERT(que.is_playing());
+		ASSERT_LT(que.get_playback_position_frames(), streaming_sound_que::frames_per_buffer);
+	});
+
+	suite.tests.emplace_back("Streaming sound que seeking and looping", []()
+	{
+		sound_system system(sound_device_type::loopback);
+
+		const usize frame_count = sound_system::loopback_sample_rate / 2;
+		auto stream = std::make_shared<sound_stream>(make_wav(2, sound_system::loopback_sample_rate, frame_count));
+
+		streaming_sound_que que(stream);
+		que.set_looping(true);
+		que.play();
+
+		// Loop past the end of the stream several times
+		render(system, que, frame_count * 5);
+		ASSERT(que.is_playing());
+		ASSERT_LT(que.get_playback_position_frames(), frame_count);
+
+		// Seek while playing
+		que.seek_frames(12345);
+		ASSERT(que.is_playing());
+		ASSERT_EQ(que.get_playback_position_frames(), 12345);
+
+		// Pause
+		que.pause();
+		ASSERT(que.is_paused());
+		const auto paused_position = que.get_playback_position_frames();
+		render(system, que, 4096);
+		ASSERT_EQ(que.get_playback_position_frames(), paused_position);
+
+		// Seek while paused, then resume
+		que.seek_seconds(0.25f);
+		ASSERT(que.is_paused());
+		ASSERT_EQ(que.get_playback_position_frames(), sound_system::loopback_sample_rate / 4);
+		que.play();
+		ASSERT(que.is_playing());
+
+		// Stop and rewind
+		que.stop();
+		ASSERT(que.is_stopped());
+		ASSERT_EQ(que.get_playback_position_frames(), 0);
+
+		// Seek out of range
+		bool threw = false;
+		try
+		{
+			que.seek_frames(frame_count + 1);
+		}
+		catch (const std::out_of_range&)
+		{
+			threw = true;
+		}
+		ASSERT(threw);
+	});
+
+	return suite.run();
+}
@@ -0,0 +1,225 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "test.hpp"
+#include <engine/ai/bt/bt.hpp>
+#include <engine/ai/bt/compiled-tree.hpp>
+#include <engine/ai/bt/scheduler.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace engine;
+namespace bt = engine::ai::bt;
+
+namespace
+{
+	/// Blackboard of a test agent.
+	struct blackboard
+	{
+		int hunger{0};
+		int steps{0};
+		int meals{0};
+		int ticks{0};
+	};
+
+	/// Owns the nodes of a pointer behavior tree.
+	class tree_builder
+	{
+	public:
+		template <class Node>
+		Node* make()
+		{
+			auto node = std::make_unique<Node>();
+			auto pointer = node.get();
+			m_nodes.emplace_back(std::move(node));
+			return pointer;
+		}
+
+		bt::action<blackboard>* make_action(bt::action<blackboard>::function_type function)
+		{
+			auto node = make<bt::action<blackboard>>();
+			node->function = std::move(function);
+			return node;
+		}
+
+		bt::condition<blackboard>* make_condition(bt::condition<blackboard>::predicate_type predicate)
+		{
+			auto node = make<bt::condition<blackboard>>();
+			node->predicate = std::move(predicate);
+			return node;
+		}
+
+	private:
+		std::vector<std::unique_ptr<bt::node<blackboard>>> m_nodes;
+	};
+
+	/// Builds a tree which eats when hungry, and otherwise walks for three ticks.
+	[[nodiscard]] bt::node<blackboard>* make_forager_tree(tree_builder& builder)
+	{
+		auto eat = builder.make<bt::sequence<blackboard>>();
+		eat->children.emplace_back(builder.make_condition([](const blackboard& b){return b.hunger > 2;}));
+		eat->children.emplace_back(builder.make_action([](blackboard& b){b.hunger = 0; ++b.meals; return bt::status::success;}));
+
+		auto walk = builder.make<bt::sequence<blackboard>>();
+		walk->children.emplace_back(builder.make_action([](blackboard& b){++b.hunger; return bt::status::success;}));
+		walk->children.emplace_back(builder.make_action([](blackboard& b){return ++b.steps % 3 ? bt::status::running : bt::status::success;}));
+
+		auto root = builder.make<bt::selector<blackboard>>();
+		root->children.emplace_back(eat);
+		root->children.emplace_back(walk);
+		return root;
+	}
+}
+
+int main(int, char*[])
+{
+	test_suite suite;
+
+	suite.tests.emplace_back("Compiled behavior tree", []()
+	{
+		tree_builder builder;
+		auto succeed = builder.make_action([](blackboard&){return bt::status::success;});
+		auto fail = builder.make_action([](blackboard&){return bt::status::failure;});
+		auto count = builder.make_action([](blackboard& b){++b.ticks; return bt::status::success;});
+
+		auto inverter = builder.make<bt::inverter<blackboard>>();
+		inverter->child = fail;
+		auto repeater = builder.make<bt::repeater<blackboard>>();
+		repeater->child = count;
+		repeater->n = 4;
+		auto succeeder = builder.make<bt::succeeder<blackboard>>();
+		succeeder->child = fail;
+
+		auto sequence = builder.make<bt::sequence<blackboard>>();
+		sequence->children = {inverter, repeater, succeeder, succeed};
+		auto selector = builder.make<bt::selector<blackboard>>();
+		selector->children = {fail, sequence, count};
+
+		// Nodes are stored in pre-order
+		const bt::compiled_tree<blackboard> tree(*selector);
+		ASSERT_EQ(tree.size(), usize{11});
+		ASSERT(tree.nodes()[0].type == bt::node_type::selector);
+		ASSERT_EQ(tree.nodes()[0].end, u32{11});
+		ASSERT(tree.nodes()[2].type == bt::node_type::sequence);
+		ASSERT_EQ(tree.nodes()[2].end, u32{10});
+		ASSERT(tree.nodes()[5].type == bt::node_type::repeater);
+		ASSERT_EQ(tree.nodes()[5].argument, u32{4});
+
+		// Compiled and pointer trees agree
+		blackboard compiled_blackboard;
+		blackboard pointer_blackboard;
+		u32 running_node = bt::compiled_tree<blackboard>::no_node;
+		ASSERT(tree.tick(compiled_blackboard, running_node) == bt::status::success);
+		ASSERT(selector->execute(pointer_blackboard) == bt::status::success);
+		ASSERT_EQ(compiled_blackboard.ticks, 4);
+		ASSERT_EQ(pointer_blackboard.ticks, 4);
+		ASSERT_EQ(running_node, bt::compiled_tree<blackboard>::no_node);
+
+		// Empty trees fail
+		ASSERT(bt::compiled_tree<blackboard>{}.tick(compiled_blackboard, running_node) == bt::status::failure);
+	});
+
+	suite.tests.emplace_back("Compiled behavior tree resumption", []()
+	{
+		tree_builder builder;
+		const bt::compiled_tree<blackboard> tree(*make_forager_tree(builder));
+
+		blackboard b;
+		u32 running_node = bt::compiled_tree<blackboard>::no_node;
+
+		// The walk resumes at its running step, without getting hungrier
+		ASSERT(tree.tick(b, running_node) == bt::status::running);
+		ASSERT(running_node != bt::compiled_tree<blackboard>::no_node);
+		ASSERT(tree.tick(b, running_node) == bt::status::running);
+		ASSERT(tree.tick(b, running_node) == bt::status::success);
+		ASSERT_EQ(b.hunger, 1);
+		ASSERT_EQ(b.steps, 3);
+		ASSERT_EQ(running_node, bt::compiled_tree<blackboard>::no_node);
+
+		// Walks until hungry, then eats
+		for (int i = 0; i < 6; ++i)
+		{
+			tree.tick(b, running_node);
+		}
+		ASSERT_EQ(b.hunger, 3);
+		ASSERT(tree.tick(b, running_node) == bt::status::success);
+		ASSERT_EQ(b.meals, 1);
+		ASSERT_EQ(b.hunger, 0);
+	});
+
+	suite.tests.emplace_back("Behavior tree scheduler", []()
+	{
+		tree_builder builder;
+		auto count = builder.make_action([](blackboard& b){++b.ticks; return bt::status::success;});
+		const auto counter = std::make_shared<const bt::compiled_tree<blackboard>>(*count);
+		const auto forager = std::make_shared<const bt::compiled_tree<blackboard>>(*make_forager_tree(builder));
+
+		for (const usize thread_count: {usize{1}, usize{4}})
+		{
+			bt::scheduler<blackboard> scheduler(thread_count);
+			const u32 counter_index = scheduler.add_tree(counter);
+			const u32 forager_index = scheduler.add_tree(forager);
+			for (usize i = 0; i < 1000; ++i)
+			{
+				scheduler.add_agent(i % 2 ? forager_index : counter_index, {});
+			}
+
+			// Agents are ticked in round-robin time slices
+			ASSERT_EQ(scheduler.update(300), usize{300});
+			ASSERT_EQ(scheduler.context(299).ticks, 0);
+			ASSERT_EQ(scheduler.context(298).ticks, 1);
+			ASSERT_EQ(scheduler.context(300).ticks, 0);
+			ASSERT(scheduler.get_status(299) == bt::status::running);
+			for (usize i = 0; i < 3; ++i)
+			{
+				scheduler.update(300);
+			}
+			ASSERT_EQ(scheduler.context(0).ticks, 2);
+			ASSERT_EQ(scheduler.context(198).ticks, 2);
+			ASSERT_EQ(scheduler.context(200).ticks, 1);
+			ASSERT_EQ(scheduler.context(998).ticks, 1);
+			ASSERT_EQ(scheduler.context(1).steps, 2);
+
+			// Removed agents are replaced by the last agent
+			scheduler.remove_agent(0);
+			ASSERT_EQ(scheduler.size(), usize{999});
+			ASSERT_EQ(scheduler.get_agent_tree(0), forager_index);
+			ASSERT_EQ(scheduler.update(), usize{999});
+		}
+	});
+
+	suite.tests.emplace_back("Behavior tree compilation errors", []()
+	{
+		tree_builder builder;
+		auto inverter = builder.make<bt::inverter<blackboard>>();
+		inverter->child = nullptr;
+		auto empty_action = builder.make<bt::action<blackboard>>();
+
+		bool rejected = false;
+		try
+		{
+			const bt::compiled_tree<blackboard> tree(*inverter);
+		}
+		catch (const std::invalid_argument&)
+		{
+			rejected = true;
+		}
+		ASSERT(rejected);
+
+		rejected = false;
+		try
+		{
+			const bt::compiled_tree<blackboard> tree(*empty_action);
+		}
+		catch (const std::invalid_argument&)
+		{
+			rejected = true;
+		}
+		ASSERT(rejected);
+	});
+
+	return suite.run();
+}
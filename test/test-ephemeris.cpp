@@ -0,0 +1,137 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "test.hpp"
+#include <engine/physics/orbit/ephemeris-evaluator.hpp>
+#include <engine/physics/orbit/paged-ephemeris.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace engine;
+using namespace engine::physics::orbit;
+
+namespace
+{
+	constexpr usize record_count = 8;
+	constexpr usize record_size = 14 * 3 * 4 + 10 * 3 * 2 + 6 * 3;
+	constexpr double record_duration = 32.0;
+
+	/// Constructs a paged ephemeris of three items with random coefficients and differing subinterval counts.
+	std::shared_ptr<paged_ephemeris> make_ephemeris()
+	{
+		auto records = std::make_shared<std::vector<double>>(record_count * record_size);
+		std::mt19937 rng(42);
+		std::uniform_real_distribution<double> distribution(-1000.0, 1000.0);
+		for (auto& a: *records)
+		{
+			a = distribution(rng);
+		}
+
+		std::vector<paged_ephemeris::item_layout> items
+		{
+			{0, 14, 4},
+			{14 * 3 * 4, 10, 2},
+			{14 * 3 * 4 + 10 * 3 * 2, 6, 1}
+		};
+
+		return std::make_shared<paged_ephemeris>
+		(
+			0.0,
+			record_duration * record_count,
+			record_duration,
+			record_count,
+			record_size,
+			std::move(items),
+			false,
+			[records](usize record, std::span<std::byte> buffer)
+			{
+				std::memcpy(buffer.data(), records->data() + record * record_size, buffer.size_bytes());
+			}
+		);
+	}
+}
+
+int main(int, char*[])
+{
+	test_suite suite;
+
+	suite.tests.emplace_back("Evaluator positions", []()
+	{
+		const auto ephemeris = make_ephemeris();
+		ephemeris_evaluator evaluator(ephemeris, {2, 0, 1});
+
+		std::vector<math::dvec3> positions(3);
+		for (double t = -10.0; t < ephemeris->end_time() + 10.0; t += 0.37)
+		{
+			evaluator.evaluate(t, positions);
+			for (usize i = 0; i < 3; ++i)
+			{
+				const auto expected = ephemeris->position(evaluator.items()[i], t);
+				for (usize j = 0; j < 3; ++j)
+				{
+					ASSERT_NEAR(positions[i][j], expected[j], 1e-6);
+				}
+			}
+		}
+	});
+
+	suite.tests.emplace_back("Evaluator velocities", []()
+	{
+		const auto ephemeris = make_ephemeris();
+		ephemeris_evaluator evaluator(ephemeris, {0, 1, 2});
+
+		std::vector<math::dvec3> positions(3);
+		std::vector<math::dvec3> velocities(3);
+		std::vector<math::dvec3> positions_a(3);
+		std::vector<math::dvec3> positions_b(3);
+
+		// Compare against central differences, away from subinterval boundaries
+		constexpr double h = 1e-5;
+		for (double t = 1.0; t < ephemeris->end_time(); t += 8.0)
+		{
+			evaluator.evaluate(t, positions, velocities);
+			evaluator.evaluate(t - h, positions_a);
+			evaluator.evaluate(t + h, positions_b);
+			for (usize i = 0; i < 3; ++i)
+			{
+				for (usize j = 0; j < 3; ++j)
+				{
+					const double expected = (positions_b[i][j] - positions_a[i][j]) / (2.0 * h);
+					ASSERT_NEAR(velocities[i][j], expected, 1e-2 * std::max(1.0, std::abs(expected)));
+				}
+			}
+		}
+	});
+
+	suite.tests.emplace_back("Evaluator sampling", []()
+	{
+		const auto ephemeris = make_ephemeris();
+		ephemeris_evaluator evaluator(ephemeris, {0, 1, 2});
+
+		// Sample a single record, which contains four subintervals of the first item
+		std::vector<double> times(64);
+		for (usize i = 0; i < times.size(); ++i)
+		{
+			times[i] = record_duration * 3.0 + record_duration * static_cast<double>(i) / static_cast<double>(times.size());
+		}
+
+		std::vector<math::dvec3> positions(times.size() * 3);
+		evaluator.sample(times, positions);
+		ASSERT_EQ(evaluator.block_build_count(), 4);
+
+		for (usize i = 0; i < times.size(); ++i)
+		{
+			for (usize j = 0; j < 3; ++j)
+			{
+				const auto expected = ephemeris->position(j, times[i]);
+				ASSERT_NEAR(positions[i * 3 + j].x(), expected.x(), 1e-6);
+			}
+		}
+	});
+
+	return suite.run();
+}
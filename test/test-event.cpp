@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "test.hpp"
+#include <engine/event/event.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace engine::event;
+
+namespace
+{
+	struct int_message
+	{
+		int value;
+	};
+
+	struct string_message
+	{
+		std::string value;
+	};
+}
+
+int main(int, char*[])
+{
+	test_suite suite;
+
+	suite.tests.emplace_back("Dispatcher subscribe/unsubscribe", []()
+	{
+		dispatcher d;
+		std::vector<int> received;
+
+		auto a = d.subscribe<int_message>([&](const auto& m){received.push_back(m.value);});
+		auto b = d.subscribe<int_message>([&](const auto& m){received.push_back(m.value * 10);});
+		d.dispatch(int_message{1});
+		ASSERT_EQ(received, (std::vector<int>{1, 10}));
+
+		a->unsubscribe();
+		d.dispatch(int_message{2});
+		ASSERT_EQ(received, (std::vector<int>{1, 10, 20}));
+
+		b.reset();
+		d.dispatch(int_message{3});
+		d.dispatch(string_message{"unsubscribed type"});
+		ASSERT_EQ(received.size(), 3);
+	});
+
+	suite.tests.emplace_back("Dispatcher unsubscribe during dispatch", []()
+	{
+		dispatcher d;
+		int calls = 0;
+
+		std::shared_ptr<subscription> self;
+		self = d.subscribe<int_message>([&](const auto&){++calls; self->unsubscribe();});
+		auto other = d.subscribe<int_message>([&](const auto&){++calls;});
+
+		d.dispatch(int_message{0});
+		ASSERT_EQ(calls, 2);
+
+		d.dispatch(int_message{0});
+		ASSERT_EQ(calls, 3);
+	});
+
+	suite.tests.emplace_back("Queue FIFO order across types", []()
+	{
+		queue q;
+		std::string received;
+
+		auto a = q.subscribe<int_message>([&](const auto& m){received += std::to_string(m.value);});
+		auto b = q.subscribe<string_message>([&](const auto& m){received += m.value;});
+
+		// Enqueue enough messages to wrap and grow the ring buffers
+		for (int i = 0; i < 40; ++i)
+		{
+			q.enqueue(int_message{i % 10});
+			q.enqueue(string_message{","});
+		}
+		ASSERT(!q.empty());
+		ASSERT(received.empty());
+
+		q.flush();
+		ASSERT(q.empty());
+		ASSERT_EQ(received.size(), 80);
+		ASSERT_EQ(received.substr(0, 8), "0,1,2,3,");
+
+		// Messages enqueued during a flush are dispatched by the same flush
+		received.clear();
+		auto c = q.subscribe<int_message>([&](const auto& m){if (m.value < 3) q.enqueue(int_message{m.value + 1});});
+		q.enqueue(int_message{0});
+		q.flush();
+		ASSERT_EQ(received, "0123");
+
+		q.enqueue(int_message{7});
+		q.clear();
+		q.flush();
+		ASSERT_EQ(received, "0123");
+	});
+
+	return suite.run();
+}
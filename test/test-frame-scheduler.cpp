@@ -0,0 +1,63 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "test.hpp"
+#include <engine/utility/frame-scheduler.hpp>
+#include <chrono>
+
+using namespace engine;
+using namespace std::chrono_literals;
+
+int main(int, char*[])
+{
+	test_suite suite;
+
+	suite.tests.emplace_back("Frame scheduler fast-forward", []()
+	{
+		frame_scheduler scheduler;
+		scheduler.set_fixed_update_interval(std::chrono::duration_cast<frame_scheduler::duration_type>(1ms));
+		scheduler.set_max_frame_duration(std::chrono::duration_cast<frame_scheduler::duration_type>(15ms));
+
+		int fixed_update_count = 0;
+		int variable_update_count = 0;
+		bool interpolated = false;
+		scheduler.set_fixed_update_callback([&](auto, auto){++fixed_update_count;});
+		scheduler.set_variable_update_callback([&](auto, auto, auto at)
+		{
+			++variable_update_count;
+			interpolated = interpolated || at != frame_scheduler::duration_type::zero();
+		});
+
+		// Fast-forward one simulated minute, with a variable-rate update every 5 real milliseconds
+		scheduler.set_fast_forward_frame_duration(std::chrono::duration_cast<frame_scheduler::duration_type>(5ms));
+		scheduler.set_fast_forward_end_time(std::chrono::duration_cast<frame_scheduler::duration_type>(60s));
+		scheduler.set_fast_forward(true);
+		ASSERT(scheduler.is_fast_forward());
+		while (scheduler.is_fast_forward())
+		{
+			scheduler.tick();
+		}
+
+		// Fast-forward stops at the end time, without interpolated variable-rate updates
+		ASSERT(scheduler.get_fixed_update_time() >= std::chrono::duration_cast<frame_scheduler::duration_type>(60s));
+		ASSERT(scheduler.get_fixed_update_time() < std::chrono::duration_cast<frame_scheduler::duration_type>(60s + 1ms));
+		ASSERT_EQ(fixed_update_count, 60000);
+		ASSERT_LT(variable_update_count, fixed_update_count / 4);
+		ASSERT(!interpolated);
+
+		// Updates are performed much faster than real time
+		scheduler.set_fast_forward_end_time(frame_scheduler::duration_type::max());
+		scheduler.set_fast_forward(true);
+		scheduler.tick();
+		scheduler.tick();
+		ASSERT_GT(scheduler.get_simulation_rate(), 10.0);
+
+		// Real time is capped by the maximum frame duration
+		scheduler.set_fast_forward(false);
+		fixed_update_count = 0;
+		scheduler.tick();
+		ASSERT(fixed_update_count <= 15);
+	});
+
+	return suite.run();
+}
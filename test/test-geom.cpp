@@ -2,13 +2,36 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include "test.hpp"
+#include <engine/geom/hyperoctree.hpp>
+#include <engine/geom/linear-hyperoctree.hpp>
 #include <engine/geom/primitives/hypersphere.hpp>
+#include <engine/geom/rect-pack.hpp>
+#include <engine/geom/spatial-grid.hpp>
 #include <engine/math/constants.hpp>
+#include <algorithm>
+#include <random>
+#include <vector>
 
 using namespace engine::geom;
 using namespace engine::geom::primitives;
 using namespace engine::math;
 
+namespace
+{
+	/// Generates random points in a cube.
+	[[nodiscard]] std::vector<fvec3> make_random_points(std::size_t count, float extent)
+	{
+		std::mt19937 rng(7);
+		std::uniform_real_distribution<float> distribution(-extent, extent);
+		std::vector<fvec3> points(count);
+		for (auto& point: points)
+		{
+			point = {distribution(rng), distribution(rng), distribution(rng)};
+		}
+		return points;
+	}
+}
+
 int main(int, char*[])
 {
 	test_suite suite;
@@ -30,5 +53,234 @@ int main(int, char*[])
 		ASSERT_NEAR(h5.volume(), 8.0f * pi<float> * pi<float> / 15.0f * r * r * r * r * r, 1e-6);
 	});
 
+	suite.tests.emplace_back("Rect pack grow", []()
+	{
+		rect_pack<unsigned int> pack({16, 16});
+
+		// Fill the pack
+		std::vector<uvec2> positions;
+		for (unsigned int i = 0; i < 4; ++i)
+		{
+			auto node = pack.insert({8, 8});
+			ASSERT(node != nullptr);
+			positions.emplace_back(node->bounds.min);
+		}
+		ASSERT(pack.insert({8, 8}) == nullptr);
+
+		// Grow the pack and fill the new space
+		pack.grow({32, 16});
+		ASSERT_EQ(pack.front().bounds.max.x(), 32u);
+		ASSERT_EQ(pack.front().bounds.max.y(), 16u);
+		for (unsigned int i = 0; i < 4; ++i)
+		{
+			auto node = pack.insert({8, 8});
+			ASSERT(node != nullptr);
+			ASSERT(node->bounds.min.x() >= 16u);
+			positions.emplace_back(node->bounds.min);
+		}
+		ASSERT(pack.insert({8, 8}) == nullptr);
+
+		// Previously inserted rects must keep their positions
+		const auto& old_root = *pack.front().children[0];
+		ASSERT_EQ(old_root.bounds.max.x(), 16u);
+		ASSERT_EQ(old_root.children[0]->bounds.min, positions[0]);
+
+		// Growing in both dimensions
+		pack.grow({64, 64});
+		ASSERT(pack.insert({32, 48}) != nullptr);
+		ASSERT(pack.insert({64, 16}) == nullptr);
+	});
+
+	suite.tests.emplace_back("Spatial grid radius query", []()
+	{
+		// Cells are dense when the points are compact, and hashed when they are sparse
+		std::vector<engine::u32> found;
+		for (const float extent: {10.0f, 200.0f})
+		{
+			const auto points = make_random_points(2000, extent);
+			spatial_grid grid(1.5f);
+			grid.build(points);
+			ASSERT_EQ(grid.size(), points.size());
+
+			for (const auto& query: make_random_points(50, extent * 1.2f))
+			{
+				for (const float radius: {0.5f, 2.0f, 5.0f, extent * 0.1f})
+				{
+					found.clear();
+					grid.find_in_radius(query, radius, found);
+					std::sort(found.begin(), found.end());
+
+					std::vector<engine::u32> expected;
+					for (engine::u32 i = 0; i < points.size(); ++i)
+					{
+						if (sqr_distance(points[i], query) <= radius * radius)
+						{
+							expected.emplace_back(i);
+						}
+					}
+					ASSERT(found == expected);
+				}
+			}
+		}
+
+		// Empty grids find nothing
+		spatial_grid grid;
+		grid.build({});
+		found.clear();
+		grid.find_in_radius({0, 0, 0}, 100.0f, found);
+		ASSERT(found.empty());
+	});
+
+	suite.tests.emplace_back("Spatial grid nearest query", []()
+	{
+		const auto points = make_random_points(2000, 10.0f);
+		std::vector<spatial_grid::neighbor> expected(points.size());
+		spatial_grid::neighbor found[8];
+
+		// Cells are dense when large, and hashed when small
+		for (const float cell_size: {1.0f, 0.25f})
+		{
+			spatial_grid grid(cell_size);
+			grid.build(points);
+
+			for (const auto& query: make_random_points(50, 30.0f))
+			{
+				for (engine::u32 i = 0; i < points.size(); ++i)
+				{
+					expected[i] = {i, sqr_distance(points[i], query)};
+				}
+				std::sort(expected.begin(), expected.end(), [](const auto& a, const auto& b){return a.sqr_distance < b.sqr_distance;});
+
+				// k-nearest
+				ASSERT_EQ(grid.find_nearest(query, found), std::size(found));
+				for (std::size_t i = 0; i < std::size(found); ++i)
+				{
+					ASSERT_EQ(found[i].index, expected[i].index);
+				}
+
+				// Filtered nearest
+				const auto count = grid.find_nearest(query, {found, 1}, [](engine::u32 index){return index % 2;});
+				ASSERT_EQ(count, std::size_t{1});
+				ASSERT_EQ(found[0].index, std::find_if(expected.begin(), expected.end(), [](const auto& n){return n.index % 2;})->index);
+
+				// Maximum radius
+				const float max_radius = std::sqrt(expected[2].sqr_distance) + 1e-4f;
+				ASSERT_EQ(grid.find_nearest(query, found, max_radius), std::size_t{3});
+			}
+		}
+	});
+
+	suite.tests.emplace_back("Spatial grid ray query", []()
+	{
+		const auto points = make_random_points(2000, 10.0f);
+		spatial_grid grid(0.5f);
+		grid.build(points);
+
+		std::mt19937 rng(11);
+		std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+		std::vector<unsigned char> visited(points.size());
+		for (int i = 0; i < 50; ++i)
+		{
+			ray<float, 3> r;
+			r.origin = {distribution(rng) * 20.0f, distribution(rng) * 20.0f, distribution(rng) * 20.0f};
+			r.direction = normalize(fvec3{distribution(rng), distribution(rng), distribution(rng)});
+			if (i == 0)
+			{
+				r.direction = {0, 0, 1};
+			}
+
+			std::fill(visited.begin(), visited.end(), 0);
+			grid.for_each_near_ray(r, 0.4f, [&](engine::u32 index)
+			{
+				// Each point is visited once
+				ASSERT_EQ(visited[index], 0);
+				visited[index] = 1;
+			});
+
+			// Every point within the radius of the ray is visited
+			for (std::size_t j = 0; j < points.size(); ++j)
+			{
+				const float t = std::max(dot(points[j] - r.origin, r.direction), 0.0f);
+				if (sqr_distance(points[j], r.extrapolate(t)) <= 0.4f * 0.4f)
+				{
+					ASSERT_EQ(visited[j], 1);
+				}
+			}
+		}
+	});
+
+	suite.tests.emplace_back("Linear hyperoctree", []()
+	{
+		using tree_type = linear_hyperoctree<engine::u32, 3>;
+		using reference_type = hyperoctree<engine::u32, 3, hyperoctree_order::dfs_pre>;
+
+		// Random nodes at various depths
+		std::mt19937 rng(3);
+		std::vector<engine::u32> nodes;
+		for (int i = 0; i < 500; ++i)
+		{
+			const engine::u32 depth = 1 + rng() % tree_type::max_depth;
+			const engine::u32 location = rng() & ((engine::u32{1} << (depth * 3)) - 1);
+			nodes.emplace_back(tree_type::node(depth, location));
+		}
+
+		// Batch insertion matches insertion into an ordered hyperoctree
+		tree_type tree;
+		reference_type reference;
+		tree.insert(std::span<const engine::u32>(nodes).first(250));
+		for (std::size_t i = 0; i < nodes.size(); ++i)
+		{
+			reference.insert(nodes[i]);
+			if (i >= 250)
+			{
+				tree.insert(nodes[i]);
+			}
+		}
+		ASSERT_EQ(tree.size(), reference.size());
+		ASSERT(std::equal(tree.begin(), tree.end(), reference.begin(), reference.end()));
+		ASSERT(tree_type(nodes).size() == tree.size());
+
+		// Lookup
+		for (const auto node: nodes)
+		{
+			ASSERT(tree.contains(node));
+			ASSERT_EQ(tree.is_leaf(node), reference.is_leaf(node));
+			ASSERT_EQ(*tree.find(node), node);
+
+			// The subtree of a node is contiguous
+			const auto subtree = tree.subtree(node);
+			ASSERT_EQ(subtree.front(), node);
+			ASSERT_EQ(subtree.data() - tree.nodes().data(), static_cast<std::ptrdiff_t>(tree.rank(node)));
+			for (const auto descendant: subtree)
+			{
+				ASSERT_EQ(tree_type::ancestor(descendant, tree_type::depth(node)), node);
+			}
+		}
+		ASSERT_EQ(tree.subtree(tree_type::root).size(), tree.size());
+
+		// The containing node of a location is its deepest contained ancestor
+		for (int i = 0; i < 200; ++i)
+		{
+			const auto location = tree_type::node(tree_type::max_depth, rng() & ((engine::u32{1} << (tree_type::max_depth * 3)) - 1));
+			const auto container = tree.find_container(location);
+			ASSERT_EQ(tree_type::ancestor(location, tree_type::depth(container)), container);
+			ASSERT(tree.is_leaf(container) || container == location);
+		}
+
+		// Batch erasure matches erasure from an ordered hyperoctree
+		std::vector<engine::u32> erased(nodes.begin(), nodes.begin() + 100);
+		erased.emplace_back(tree_type::root);
+		tree.erase(erased);
+		for (const auto node: erased)
+		{
+			reference.erase(node);
+		}
+		ASSERT_EQ(tree.size(), reference.size());
+		ASSERT(std::equal(tree.begin(), tree.end(), reference.begin(), reference.end()));
+
+		tree.erase(tree_type::child(tree_type::root, 0));
+		ASSERT_EQ(tree.size(), std::size_t{1});
+	});
+
 	return suite.run();
 }
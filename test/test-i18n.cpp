@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "test.hpp"
+#include <engine/i18n/packed-string-map.hpp>
+#include <engine/hash/fnv.hpp>
+#include <cstring>
+#include <format>
+#include <memory>
+#include <stdexcept>
+
+using namespace engine;
+
+namespace
+{
+	/// Builds a string map of numbered keys.
+	[[nodiscard]] i18n::string_map make_string_map(usize count)
+	{
+		i18n::string_map map;
+		for (usize i = 0; i < count; ++i)
+		{
+			const auto key = std::format("key_{}", i);
+			map[hash::fnv1a32<char>(key)] = i % 7 ? std::format("value {} é中", i) : std::string{};
+		}
+		return map;
+	}
+
+	/// Returns `true` if loading a blob is rejected.
+	[[nodiscard]] bool is_rejected(std::unique_ptr<std::byte[]> blob, usize size)
+	{
+		try
+		{
+			const i18n::packed_string_map map(std::move(blob), size);
+		}
+		catch (const std::invalid_argument&)
+		{
+			return true;
+		}
+		return false;
+	}
+
+	/// Copies the blob of a packed string map.
+	[[nodiscard]] std::unique_ptr<std::byte[]> copy_blob(const i18n::packed_string_map& map, usize size)
+	{
+		auto blob = std::make_unique<std::byte[]>(size);
+		std::memcpy(blob.get(), map.blob().data(), size);
+		return blob;
+	}
+}
+
+int main(int, char*[])
+{
+	test_suite suite;
+
+	suite.tests.emplace_back("Packed string map lookup", []()
+	{
+		for (const usize count: {usize{0}, usize{1}, usize{5}, usize{1000}})
+		{
+			const auto map = make_string_map(count);
+			const i18n::packed_string_map packed(map);
+			ASSERT_EQ(packed.size(), count);
+			ASSERT_EQ(packed.empty(), count == 0);
+
+			for (const auto& [key, value]: map)
+			{
+				const auto found = packed.find(key);
+				ASSERT(found.has_value());
+				ASSERT(*found == value);
+				ASSERT_EQ(found->data()[found->size()], '\0');
+			}
+
+			ASSERT(!packed.contains(hash::fnv1a32<char>(std::string_view{"missing"})));
+
+			// Entries enumerate every string once
+			usize total_size = 0;
+			for (usize i = 0; i < packed.size(); ++i)
+			{
+				ASSERT(packed.value_at(i) == map.at(packed.key_at(i)));
+				total_size += packed.value_at(i).size();
+			}
+			usize expected_size = 0;
+			for (const auto& [key, value]: map)
+			{
+				expected_size += value.size();
+			}
+			ASSERT_EQ(total_size, expected_size);
+		}
+
+		const i18n::packed_string_map empty;
+		ASSERT(empty.empty());
+		ASSERT(!empty.find(hash::fnv1a32<char>(std::string_view{"key_0"})));
+	});
+
+	suite.tests.emplace_back("Packed string map blobs", []()
+	{
+		const auto map = make_string_map(100);
+		const i18n::packed_string_map packed(map);
+		const usize size = packed.blob().size();
+
+		// Loading a blob yields the same map
+		const i18n::packed_string_map loaded(copy_blob(packed, size), size);
+		ASSERT_EQ(loaded.size(), packed.size());
+		for (const auto& [key, value]: map)
+		{
+			ASSERT(loaded.find(key) == value);
+		}
+
+		// Malformed blobs are rejected
+		ASSERT(is_rejected(copy_blob(packed, size), size - 1));
+		ASSERT(is_rejected(copy_blob(packed, packed.index_size() - 4), packed.index_size() - 4));
+		ASSERT(is_rejected(copy_blob(packed, 8), 8));
+
+		auto corrupt = copy_blob(packed, size);
+		corrupt[1] = std::byte{0};
+		ASSERT(is_rejected(std::move(corrupt), size));
+	});
+
+	return suite.run();
+}
@@ -0,0 +1,225 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "test.hpp"
+#include <engine/animation/ik/solvers/batched-ccd-ik-solver.hpp>
+#include <engine/animation/skeleton.hpp>
+#include <engine/math/euler-angles.hpp>
+#include <engine/math/quaternion.hpp>
+#include <random>
+#include <vector>
+
+using namespace engine;
+using namespace engine::animation;
+
+namespace
+{
+	/// Generates a random unit quaternion.
+	math::fquat random_rotation(std::mt19937& rng)
+	{
+		std::normal_distribution<float> distribution;
+		return math::normalize(math::fquat{distribution(rng), distribution(rng), distribution(rng), distribution(rng)});
+	}
+
+	/// Constructs a skeleton with a single chain of bones.
+	skeleton make_chain_skeleton(usize bone_count)
+	{
+		skeleton chain_skeleton(bone_count);
+		for (usize i = 1; i < bone_count; ++i)
+		{
+			chain_skeleton.bones()[i].reparent(&chain_skeleton.bones()[i - 1]);
+		}
+
+		return chain_skeleton;
+	}
+
+	/// Sets up a chain of three unit-length bones along the y-axis, with a goal at a random reachable position.
+	math::fvec3 setup_chain(batched_ccd_ik_solver& solver, usize chain, std::mt19937& rng)
+	{
+		std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+		solver.set_base_transform(chain, math::identity<math::transform<float>>);
+		for (usize i = 0; i < 3; ++i)
+		{
+			auto transform = math::identity<math::transform<float>>;
+			transform.translation = {0.0f, i ? 1.0f : 0.0f, 0.0f};
+			solver.set_bone_transform(chain, i, transform);
+		}
+		solver.set_effector_position(chain, {0.0f, 1.0f, 0.0f});
+
+		math::fvec3 goal;
+		do
+		{
+			goal = math::fvec3{distribution(rng), distribution(rng), distribution(rng)} * 2.5f;
+		}
+		while (math::length(goal) < 0.5f || math::length(goal) > 2.5f);
+		solver.set_goal_center(chain, goal);
+
+		return goal;
+	}
+}
+
+int main(int, char*[])
+{
+	test_suite suite;
+
+	suite.tests.emplace_back("Batched Euler IK constraint", []()
+	{
+		constexpr math::rotation_sequence sequences[] =
+		{
+			math::rotation_sequence::zxz, math::rotation_sequence::xyx, math::rotation_sequence::yzy,
+			math::rotation_sequence::zyz, math::rotation_sequence::xzx, math::rotation_sequence::yxy,
+			math::rotation_sequence::xyz, math::rotation_sequence::yzx, math::rotation_sequence::zxy,
+			math::rotation_sequence::xzy, math::rotation_sequence::zyx, math::rotation_sequence::yxz
+		};
+
+		std::mt19937 rng(1);
+		const auto chain_skeleton = make_chain_skeleton(1);
+		batched_ccd_ik_solver solver(chain_skeleton, 0, 0);
+
+		for (const auto sequence: sequences)
+		{
+			euler_ik_constraint constraint;
+			constraint.set_rotation_sequence(sequence);
+			constraint.set_min_angles({-0.5f, -1.0f, -0.25f});
+			constraint.set_max_angles({1.0f, 0.5f, 0.75f});
+			solver.set_constraint(0, constraint);
+
+			for (usize i = 0; i < 256; ++i)
+			{
+				math::fquat expected[batched_ccd_ik_solver::lane_width];
+				float w[batched_ccd_ik_solver::lane_width];
+				float x[batched_ccd_ik_solver::lane_width];
+				float y[batched_ccd_ik_solver::lane_width];
+				float z[batched_ccd_ik_solver::lane_width];
+				for (usize j = 0; j < batched_ccd_ik_solver::lane_width; ++j)
+				{
+					expected[j] = random_rotation(rng);
+					w[j] = expected[j].w();
+					x[j] = expected[j].x();
+					y[j] = expected[j].y();
+					z[j] = expected[j].z();
+					constraint.solve(expected[j]);
+				}
+
+				solver.constrain(0, w, x, y, z);
+
+				for (usize j = 0; j < batched_ccd_ik_solver::lane_width; ++j)
+				{
+					ASSERT_NEAR(w[j], expected[j].w(), 1e-4f);
+					ASSERT_NEAR(x[j], expected[j].x(), 1e-4f);
+					ASSERT_NEAR(y[j], expected[j].y(), 1e-4f);
+					ASSERT_NEAR(z[j], expected[j].z(), 1e-4f);
+				}
+			}
+		}
+	});
+
+	suite.tests.emplace_back("Batched swing-twist IK constraint", []()
+	{
+		std::mt19937 rng(2);
+		const auto chain_skeleton = make_chain_skeleton(1);
+		batched_ccd_ik_solver solver(chain_skeleton, 0, 0);
+
+		swing_twist_ik_constraint constraint;
+		constraint.set_twist_limit(-0.5f, 0.75f);
+		solver.set_constraint(0, constraint);
+
+		for (usize i = 0; i < 1024; ++i)
+		{
+			math::fquat expected[batched_ccd_ik_solver::lane_width];
+			float w[batched_ccd_ik_solver::lane_width];
+			float x[batched_ccd_ik_solver::lane_width];
+			float y[batched_ccd_ik_solver::lane_width];
+			float z[batched_ccd_ik_solver::lane_width];
+			for (usize j = 0; j < batched_ccd_ik_solver::lane_width; ++j)
+			{
+				expected[j] = random_rotation(rng);
+				w[j] = expected[j].w();
+				x[j] = expected[j].x();
+				y[j] = expected[j].y();
+				z[j] = expected[j].z();
+				constraint.solve(expected[j]);
+			}
+
+			solver.constrain(0, w, x, y, z);
+
+			for (usize j = 0; j < batched_ccd_ik_solver::lane_width; ++j)
+			{
+				ASSERT_NEAR(w[j], expected[j].w(), 1e-5f);
+				ASSERT_NEAR(x[j], expected[j].x(), 1e-5f);
+				ASSERT_NEAR(y[j], expected[j].y(), 1e-5f);
+				ASSERT_NEAR(z[j], expected[j].z(), 1e-5f);
+			}
+		}
+	});
+
+	suite.tests.emplace_back("Batched CCD IK convergence", []()
+	{
+		std::mt19937 rng(3);
+		const auto chain_skeleton = make_chain_skeleton(3);
+		batched_ccd_ik_solver solver(chain_skeleton, 0, 2);
+		ASSERT_EQ(solver.get_bone_count(), 3);
+
+		constexpr float goal_radius = 0.02f;
+		solver.set_goal_radius(goal_radius);
+		solver.set_max_iterations(100);
+
+		// Use a chain count which is not a multiple of the lane width
+		constexpr usize chain_count = 63;
+		solver.resize(chain_count);
+		std::vector<math::fvec3> goals(chain_count);
+		for (usize i = 0; i < chain_count; ++i)
+		{
+			goals[i] = setup_chain(solver, i, rng);
+		}
+
+		// Make one goal unreachable
+		solver.set_goal_center(5, {0.0f, 10.0f, 0.0f});
+
+		solver.solve();
+
+		usize converged_count = 0;
+		for (usize i = 0; i < chain_count; ++i)
+		{
+			converged_count += solver.is_converged(i);
+		}
+		ASSERT(!solver.is_converged(5));
+		ASSERT(converged_count >= chain_count - 4);
+
+		// Lanes must be solved independently of the other lanes in their group
+		std::mt19937 single_rng(3);
+		batched_ccd_ik_solver single_solver(chain_skeleton, 0, 2);
+		single_solver.set_goal_radius(goal_radius);
+		single_solver.set_max_iterations(100);
+		single_solver.resize(1);
+		for (usize i = 0; i < chain_count; ++i)
+		{
+			setup_chain(single_solver, 0, single_rng);
+			if (i == 5)
+			{
+				single_solver.set_goal_center(0, {0.0f, 10.0f, 0.0f});
+			}
+
+			single_solver.solve();
+
+			ASSERT_EQ(single_solver.is_converged(0), solver.is_converged(i));
+			for (usize j = 0; j < 3; ++j)
+			{
+				const auto a = single_solver.get_bone_rotation(0, j);
+				const auto b = solver.get_bone_rotation(i, j);
+				ASSERT_EQ(a.w(), b.w());
+				ASSERT_EQ(a.x(), b.x());
+				ASSERT_EQ(a.y(), b.y());
+				ASSERT_EQ(a.z(), b.z());
+			}
+
+			if (solver.is_converged(i))
+			{
+				ASSERT(math::distance(solver.get_effector_position(i), goals[i]) <= goal_radius * 1.01f);
+			}
+		}
+	});
+
+	return suite.run();
+}
@@ -0,0 +1,97 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "test.hpp"
+#include <engine/debug/binary-log.hpp>
+#include <engine/debug/file-log.hpp>
+#include <engine/debug/log-message-severity.hpp>
+#include <engine/debug/logger.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace engine;
+
+namespace
+{
+	/// Reads a file into a string.
+	[[nodiscard]] std::string read_file(const std::filesystem::path& path)
+	{
+		std::ifstream stream(path, std::ios::binary);
+		return {std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()};
+	}
+}
+
+int main(int, char*[])
+{
+	test_suite suite;
+
+	suite.tests.emplace_back("Binary log round trip", []()
+	{
+		const auto directory = std::filesystem::temp_directory_path();
+		const auto tsv_path = directory / "antkeeper-test-log.tsv";
+		const auto binary_path = directory / "antkeeper-test-log.aklog";
+
+		// Log the same messages to both sinks
+		{
+			debug::file_log file_log(tsv_path);
+			debug::binary_log binary_log(binary_path);
+
+			auto& logger = debug::default_logger();
+			logger.log(debug::log_message_severity::trace, "trace");
+			logger.log(debug::log_message_severity::info, "tab\tand unicode 🐜");
+			logger.log(debug::log_message_severity::info, "same location");
+			logger.log(debug::log_message_severity::info, "same location");
+			logger.log(debug::log_message_severity::warning, "");
+			logger.log(debug::log_message_severity::error, std::string(300, 'x'));
+			std::thread([&]()
+			{
+				logger.log(debug::log_message_severity::fatal, "other thread");
+			}).join();
+		}
+
+		// Decode binary log
+		std::ifstream binary_stream(binary_path, std::ios::binary);
+		std::ostringstream decoded;
+		ASSERT_EQ(debug::binary_log_to_tsv(binary_stream, decoded), usize{7});
+		binary_stream.close();
+
+		// Decoded binary log matches the text log
+		const std::string tsv = read_file(tsv_path);
+		ASSERT(!tsv.empty());
+		ASSERT_EQ(decoded.str(), tsv);
+
+		// A truncated final record is ignored
+		const std::string binary = read_file(binary_path);
+		std::istringstream truncated_stream(binary.substr(0, binary.size() - 4));
+		std::ostringstream truncated_decoded;
+		ASSERT_EQ(debug::binary_log_to_tsv(truncated_stream, truncated_decoded), usize{6});
+		ASSERT(tsv.starts_with(truncated_decoded.str()));
+
+		std::filesystem::remove(tsv_path);
+		std::filesystem::remove(binary_path);
+	});
+
+	suite.tests.emplace_back("Binary log header", []()
+	{
+		std::istringstream stream("not a binary log");
+		std::ostringstream output;
+
+		bool threw = false;
+		try
+		{
+			debug::binary_log_to_tsv(stream, output);
+		}
+		catch (const std::runtime_error&)
+		{
+			threw = true;
+		}
+		ASSERT(threw);
+	});
+
+	return suite.run();
+}
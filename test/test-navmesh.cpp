@@ -0,0 +1,398 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "test.hpp"
+#include <engine/ai/navmesh.hpp>
+#include <engine/ai/navmesh-flow-field.hpp>
+#include <engine/ai/navmesh-graph.hpp>
+#include <engine/ai/navmesh-path.hpp>
+#include <engine/ai/navmesh-path-service.hpp>
+#include <engine/geom/brep/mesh.hpp>
+#include <engine/math/vector.hpp>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <random>
+#include <tuple>
+#include <vector>
+
+using namespace engine;
+
+namespace
+{
+	/// Builds a flat grid mesh of unit cells on the XY plane, with two triangles per open cell.
+	/// @param width Number of cells on the X-axis.
+	/// @param height Number of cells on the Y-axis.
+	/// @param is_blocked Returns `true` if a cell should be left out of the mesh.
+	[[nodiscard]] std::unique_ptr<geom::brep::mesh> make_grid_mesh(u32 width, u32 height, const std::function<bool(u32, u32)>& is_blocked)
+	{
+		auto mesh_ptr = std::make_unique<geom::brep::mesh>();
+		auto& mesh = *mesh_ptr;
+		for (u32 i = 0; i < (width + 1) * (height + 1); ++i)
+		{
+			mesh.vertices().emplace_back();
+		}
+
+		auto& positions = static_cast<geom::brep::attribute<math::fvec3>&>(*mesh.vertices().attributes().emplace<math::fvec3>("position"));
+		for (u32 y = 0; y <= height; ++y)
+		{
+			for (u32 x = 0; x <= width; ++x)
+			{
+				positions[y * (width + 1) + x] = {static_cast<float>(x), static_cast<float>(y), 0.0f};
+			}
+		}
+
+		for (u32 y = 0; y < height; ++y)
+		{
+			for (u32 x = 0; x < width; ++x)
+			{
+				if (is_blocked(x, y))
+				{
+					continue;
+				}
+
+				auto v00 = mesh.vertices()[y * (width + 1) + x];
+				auto v10 = mesh.vertices()[y * (width + 1) + x + 1];
+				auto v01 = mesh.vertices()[(y + 1) * (width + 1) + x];
+				auto v11 = mesh.vertices()[(y + 1) * (width + 1) + x + 1];
+
+				geom::brep::vertex* lower[] = {v00, v10, v11};
+				geom::brep::vertex* upper[] = {v00, v11, v01};
+				mesh.faces().emplace_back(lower);
+				mesh.faces().emplace_back(upper);
+			}
+		}
+
+		return mesh_ptr;
+	}
+
+	/// Builds a flat grid navmesh graph.
+	/// @see make_grid_mesh()
+	[[nodiscard]] ai::navmesh_graph make_grid_navmesh(u32 width, u32 height, const std::function<bool(u32, u32)>& is_blocked)
+	{
+		return ai::navmesh_graph(*make_grid_mesh(width, height, is_blocked));
+	}
+
+	/// Builds a mesh of a unit floor quad on the XY plane which folds up into a unit wall quad on the XZ plane at `y = 1`.
+	[[nodiscard]] std::unique_ptr<geom::brep::mesh> make_folded_mesh()
+	{
+		auto mesh = std::make_unique<geom::brep::mesh>();
+		const math::fvec3 vertex_positions[] = {{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}, {1, 1, 1}, {0, 1, 1}};
+		for (usize i = 0; i < 6; ++i)
+		{
+			mesh->vertices().emplace_back();
+		}
+
+		auto& positions = static_cast<geom::brep::attribute<math::fvec3>&>(*mesh->vertices().attributes().emplace<math::fvec3>("position"));
+		for (usize i = 0; i < 6; ++i)
+		{
+			positions[i] = vertex_positions[i];
+		}
+
+		const usize face_vertices[4][3] = {{0, 1, 2}, {0, 2, 3}, {3, 2, 4}, {3, 4, 5}};
+		for (const auto& indices: face_vertices)
+		{
+			geom::brep::vertex* vertices[] = {mesh->vertices()[indices[0]], mesh->vertices()[indices[1]], mesh->vertices()[indices[2]]};
+			mesh->faces().emplace_back(vertices);
+		}
+
+		return mesh;
+	}
+
+}
+
+int main(int, char*[])
+{
+	test_suite suite;
+
+	suite.tests.emplace_back("Navmesh graph", []()
+	{
+		const auto graph = make_grid_navmesh(2, 1, [](u32, u32){return false;});
+		ASSERT_EQ(graph.size(), usize{4});
+
+		usize interior_edge_count = 0;
+		for (const auto& face: graph.faces())
+		{
+			ASSERT_NEAR(face.normal.z(), 1.0f, 1e-6f);
+			for (usize i = 0; i < 3; ++i)
+			{
+				if (face.neighbors[i] == ai::navmesh_graph::no_face)
+				{
+					continue;
+				}
+
+				// Adjacency is symmetric
+				const auto& neighbor = graph.faces()[face.neighbors[i]];
+				ASSERT(std::ranges::count(neighbor.neighbors, static_cast<u32>(&face - graph.faces().data())) == 1);
+				++interior_edge_count;
+			}
+		}
+
+		// Two cell diagonals and the edge between the cells, counted from both sides
+		ASSERT_EQ(interior_edge_count, usize{6});
+	});
+
+	suite.tests.emplace_back("Navmesh geometry", []()
+	{
+		const ai::navmesh_graph graph(*make_grid_mesh(3, 2, [](u32, u32){return false;}));
+		ASSERT_EQ(graph.size(), usize{12});
+
+		for (const auto& face: graph.faces())
+		{
+			ASSERT_NEAR(face.normal.z(), 1.0f, 1e-6f);
+
+			// Edge directions run between consecutive vertices, and rotations across a flat grid are identities
+			for (usize j = 0; j < 3; ++j)
+			{
+				ASSERT_NEAR(math::dot(face.edge_directions[j], math::normalize(face.vertices[(j + 1) % 3] - face.vertices[j])), 1.0f, 1e-6f);
+				ASSERT_NEAR(face.edge_rotations[j].w(), 1.0f, 1e-6f);
+			}
+
+			// Without vertex normals, the surface normal is the face normal
+			ASSERT_NEAR(ai::navmesh_surface_normal(face, {0.2f, 0.3f, 0.5f}).z(), 1.0f, 1e-6f);
+
+			// Barycentric coordinates of the vertices and centroid
+			for (usize j = 0; j < 3; ++j)
+			{
+				const auto uvw = ai::navmesh_barycentric(face, face.vertices[j]);
+				for (usize k = 0; k < 3; ++k)
+				{
+					ASSERT_NEAR(uvw[k], j == k ? 1.0f : 0.0f, 1e-5f);
+				}
+			}
+			const auto uvw = ai::navmesh_barycentric(face, face.centroid);
+			ASSERT_NEAR(uvw.x(), 1.0f / 3.0f, 1e-5f);
+			ASSERT_NEAR(uvw.y(), 1.0f / 3.0f, 1e-5f);
+		}
+	});
+
+	suite.tests.emplace_back("Navmesh traversal", []()
+	{
+		const ai::navmesh_graph grid(*make_grid_mesh(4, 4, [](u32, u32){return false;}));
+
+		// Crossing several faces of a flat grid reaches the end point
+		const math::fvec3 start = {0.75f, 0.25f, 0.0f};
+		const math::fvec3 end = {3.3f, 2.6f, 0.0f};
+		auto traversal = ai::traverse_navmesh(grid, 0, start, end);
+		ASSERT_NEAR(math::distance(traversal.closest_point, end), 0.0f, 1e-5f);
+		ASSERT(traversal.face != 0);
+		const auto& end_face = grid.faces()[traversal.face];
+		const auto reconstructed = end_face.vertices[0] * traversal.barycentric.x() + end_face.vertices[1] * traversal.barycentric.y() + end_face.vertices[2] * traversal.barycentric.z();
+		ASSERT_NEAR(math::distance(reconstructed, end), 0.0f, 1e-5f);
+		for (usize i = 0; i < 3; ++i)
+		{
+			ASSERT_GE(traversal.barycentric[i], -1e-5f);
+		}
+
+		// Traversal stops at the boundary
+		traversal = ai::traverse_navmesh(grid, 0, start, {-2.0f, 0.5f, 0.0f});
+		ASSERT_NEAR(traversal.closest_point.x(), 0.0f, 1e-5f);
+		ASSERT_NEAR(traversal.closest_point.z(), 0.0f, 1e-5f);
+
+		// Traversal over a fold continues up the wall
+		const ai::navmesh_graph folded(*make_folded_mesh());
+		traversal = ai::traverse_navmesh(folded, 0, {0.6f, 0.5f, 0.0f}, {0.6f, 1.8f, 0.0f});
+		ASSERT(traversal.face == 2 || traversal.face == 3);
+		ASSERT_NEAR(math::distance(traversal.closest_point, math::fvec3{0.6f, 1.0f, 0.8f}), 0.0f, 1e-5f);
+		ASSERT_NEAR(ai::navmesh_surface_normal(folded.faces()[traversal.face], traversal.barycentric).y(), -1.0f, 1e-5f);
+	});
+
+	suite.tests.emplace_back("Navmesh path", []()
+	{
+		// Straight corridors are crossed in a straight line
+		{
+			const auto graph = make_grid_navmesh(8, 1, [](u32, u32){return false;});
+			const auto path = ai::find_navmesh_path(graph, {0, {0.5f, 0.25f, 0.0f}, 15, {7.5f, 0.75f, 0.0f}});
+			ASSERT_EQ(path.points.size(), usize{2});
+			ASSERT_EQ(path.faces.size(), usize{14});
+			ASSERT_EQ(path.faces.front(), 0u);
+			ASSERT_EQ(path.faces.back(), 15u);
+		}
+
+		// Paths around an L-shaped corridor turn at its inner corner
+		{
+			const auto graph = make_grid_navmesh(4, 4, [](u32 x, u32 y){return x && y;});
+
+			const u32 start_face = 13;
+			const u32 goal_face = 6;
+			const auto path = ai::find_navmesh_path(graph, {start_face, {0.25f, 3.5f, 0.0f}, goal_face, {3.5f, 0.25f, 0.0f}});
+			ASSERT_EQ(path.points.size(), usize{3});
+			ASSERT_NEAR(path.points[1].x(), 1.0f, 1e-6f);
+			ASSERT_NEAR(path.points[1].y(), 1.0f, 1e-6f);
+
+			// And in the opposite direction
+			const auto reverse_path = ai::find_navmesh_path(graph, {goal_face, {3.5f, 0.25f, 0.0f}, start_face, {0.25f, 3.5f, 0.0f}});
+			ASSERT_EQ(reverse_path.points.size(), usize{3});
+			ASSERT_NEAR(reverse_path.points[1].x(), 1.0f, 1e-6f);
+			ASSERT_NEAR(reverse_path.points[1].y(), 1.0f, 1e-6f);
+		}
+
+		// Disconnected faces are unreachable
+		{
+			const auto graph = make_grid_navmesh(3, 1, [](u32 x, u32){return x == 1;});
+			const auto path = ai::find_navmesh_path(graph, {0, {0.5f, 0.25f, 0.0f}, 2, {2.5f, 0.25f, 0.0f}});
+			ASSERT(path.empty());
+			ASSERT(path.faces.empty());
+		}
+	});
+
+	suite.tests.emplace_back("Navmesh path service", []()
+	{
+		// Grid with pillars
+		auto graph = std::make_shared<ai::navmesh_graph>(make_grid_navmesh(32, 32, [](u32 x, u32 y){return x % 4 == 2 && y % 4 == 2;}));
+
+		std::mt19937 rng(7);
+		std::uniform_int_distribution<u32> face_distribution(0, static_cast<u32>(graph->size() - 1));
+		std::vector<ai::navmesh_path_request> requests;
+		for (usize i = 0; i < 200; ++i)
+		{
+			const auto start_face = face_distribution(rng);
+			const auto goal_face = i % 4 ? face_distribution(rng) : requests.empty() ? start_face : requests.back().goal_face;
+			requests.push_back({start_face, graph->faces()[start_face].centroid, goal_face, graph->faces()[goal_face].centroid});
+		}
+
+		ai::navmesh_path_service service(graph, 4);
+		ASSERT_EQ(service.get_thread_count(), usize{4});
+
+		for (int pass = 0; pass < 2; ++pass)
+		{
+			for (usize i = 0; i < requests.size(); ++i)
+			{
+				ASSERT_EQ(service.request(requests[i]), i);
+			}
+			service.update();
+			ASSERT_EQ(service.results().size(), requests.size());
+
+			// Batched results match single queries
+			for (usize i = 0; i < requests.size(); ++i)
+			{
+				const auto expected = ai::find_navmesh_path(*graph, requests[i]);
+				ASSERT(service.result(i).faces == expected.faces);
+				ASSERT(service.result(i).points == expected.points);
+				ASSERT(!expected.empty());
+			}
+
+			// Corridors of the first pass are reused by the second
+			ASSERT_EQ(service.get_cache_hit_count(), pass ? requests.size() : usize{0});
+		}
+
+		// Without a cache, every query is searched
+		service.set_cache_capacity(0);
+		ASSERT_EQ(service.get_cache_size(), usize{0});
+		service.request(requests.front());
+		service.update();
+		ASSERT_EQ(service.get_cache_hit_count(), usize{0});
+		ASSERT(service.result(0).faces == ai::find_navmesh_path(*graph, requests.front()).faces);
+	});
+
+	suite.tests.emplace_back("Navmesh flow field", []()
+	{
+		// Grid with pillars and a walled-off corner
+		auto graph = std::make_shared<ai::navmesh_graph>(make_grid_navmesh(16, 16, [](u32 x, u32 y){return (x % 4 == 2 && y % 4 == 2) || (x == 13 && y >= 13) || (y == 13 && x >= 13);}));
+		const u32 goal_faces[] = {0, 1, 40};
+
+		ai::navmesh_flow_field field(graph, goal_faces);
+		ASSERT(!field.is_complete());
+		ASSERT(field.update());
+
+		// Incremental builds match complete builds
+		ai::navmesh_flow_field incremental_field(graph, goal_faces);
+		usize update_count = 0;
+		while (!incremental_field.update(37))
+		{
+			++update_count;
+		}
+		ASSERT_GT(update_count, usize{1});
+		ASSERT(std::ranges::equal(incremental_field.distances(), field.distances()));
+		ASSERT(std::ranges::equal(incremental_field.directions(), field.directions()));
+
+		const auto faces = graph->faces();
+		for (u32 i = 0; i < faces.size(); ++i)
+		{
+			const auto& direction = field.direction(i);
+			const auto& face = faces[i];
+
+			// Faces in the walled-off corner are unreachable
+			if (face.centroid.x() > 13.0f && face.centroid.y() > 13.0f)
+			{
+				ASSERT(std::isinf(field.distance(i)));
+				ASSERT(direction == math::fvec3{});
+				continue;
+			}
+
+			if (std::ranges::count(goal_faces, i))
+			{
+				ASSERT_EQ(field.distance(i), 0.0f);
+				ASSERT(direction == math::fvec3{});
+				continue;
+			}
+
+			// Directions are unit vectors in the plane of the face, which lead to a nearer neighbor
+			ASSERT_NEAR(math::length(direction), 1.0f, 1e-5f);
+			ASSERT_NEAR(direction.z(), 0.0f, 1e-6f);
+			bool descends = false;
+			for (const auto neighbor: face.neighbors)
+			{
+				if (neighbor != ai::navmesh_graph::no_face && field.distance(neighbor) < field.distance(i) && math::dot(direction, faces[neighbor].centroid - face.centroid) > 0.0f)
+				{
+					descends = true;
+				}
+			}
+			ASSERT(descends);
+		}
+
+		// Flow fields are cached by their set of goal faces
+		ai::navmesh_flow_field_cache cache(2);
+		const u32 reordered_goal_faces[] = {40, 0, 1, 0};
+		const auto cached_field = cache.get(graph, goal_faces);
+		ASSERT(cache.get(graph, reordered_goal_faces) == cached_field);
+		const u32 other_goal_faces[] = {100};
+		std::ignore = cache.get(graph, other_goal_faces);
+		ASSERT_EQ(cache.size(), usize{2});
+
+		cache.update();
+		ASSERT(cached_field->is_complete());
+		ASSERT(std::ranges::equal(cached_field->directions(), field.directions()));
+
+		cache.remove_unused();
+		ASSERT_EQ(cache.size(), usize{1});
+	});
+
+	suite.tests.emplace_back("Navmesh flow field cache", []()
+	{
+		// Two navmeshes share one cache
+		const auto open_graph = std::make_shared<const ai::navmesh_graph>(make_grid_navmesh(12, 12, [](u32, u32){return false;}));
+		const auto pillar_graph = std::make_shared<const ai::navmesh_graph>(make_grid_navmesh(12, 12, [](u32 x, u32 y){return x % 3 == 1 && y % 3 == 1;}));
+		const u32 goal_faces[] = {0};
+
+		ai::navmesh_flow_field_cache cache(2);
+		const auto open_field = cache.get(open_graph, goal_faces);
+		const auto pillar_field = cache.get(pillar_graph, goal_faces);
+		ASSERT(open_field != pillar_field);
+		ASSERT(open_field->get_graph() == open_graph);
+		ASSERT(pillar_field->get_graph() == pillar_graph);
+		ASSERT_EQ(cache.size(), usize{2});
+
+		// Interleaved requests and budgeted updates complete the fields of both navmeshes
+		for (usize i = 0; i < 1000 && !(open_field->is_complete() && pillar_field->is_complete()); ++i)
+		{
+			ASSERT(cache.get(open_graph, goal_faces) == open_field);
+			ASSERT(cache.get(pillar_graph, goal_faces) == pillar_field);
+			cache.update(16);
+		}
+		ASSERT(open_field->is_complete());
+		ASSERT(pillar_field->is_complete());
+		ASSERT_EQ(cache.size(), usize{2});
+
+		// Complete fields match fields built outside the cache
+		ai::navmesh_flow_field open_reference(open_graph, goal_faces);
+		ai::navmesh_flow_field pillar_reference(pillar_graph, goal_faces);
+		ASSERT(open_reference.update());
+		ASSERT(pillar_reference.update());
+		ASSERT(std::ranges::equal(open_field->directions(), open_reference.directions()));
+		ASSERT(std::ranges::equal(pillar_field->directions(), pillar_reference.directions()));
+	});
+
+	return suite.run();
+}
@@ -0,0 +1,211 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "test.hpp"
+#include <engine/noise/noise.hpp>
+#include <engine/math/simd/isa.hpp>
+#include <engine/math/vector.hpp>
+#include <random>
+#include <vector>
+
+using namespace engine;
+using namespace engine::math::simd;
+
+namespace
+{
+	/// Number of scattered positions, which is not a multiple of any packet width.
+	constexpr usize position_count = 1021;
+
+	/// Returns the instruction sets supported by the processor.
+	std::vector<isa> get_supported_isas()
+	{
+		if (get_supported_isa() == isa::avx2)
+		{
+			return {isa::sse2, isa::avx2};
+		}
+		return {isa::sse2};
+	}
+
+	/// Generates scattered positions, followed by closely spaced runs of positions which share noise cells.
+	template <usize N>
+	std::vector<math::vector<float, N>> make_positions()
+	{
+		std::mt19937 rng(static_cast<unsigned>(N));
+		std::uniform_real_distribution<float> distribution(-100.0f, 100.0f);
+
+		std::vector<math::vector<float, N>> positions(position_count);
+		for (usize i = 0; i < position_count; ++i)
+		{
+			for (usize j = 0; j < N; ++j)
+			{
+				positions[i][j] = i < position_count / 2 ? distribution(rng) : positions[i - 1][j] + 0.01f * static_cast<float>(j + 1);
+			}
+		}
+		positions[position_count / 2] = {};
+		return positions;
+	}
+
+	/// Returns the positions of a grid, calculated as in the batch grid functions.
+	template <usize N>
+	std::vector<math::vector<float, N>> make_grid_positions(const math::vector<float, N>& origin, const math::vector<float, N>& spacing, const math::vector<u32, N>& size)
+	{
+		std::vector<math::vector<float, N>> positions;
+		math::vector<u32, N> index{};
+		for (;;)
+		{
+			math::vector<float, N> position;
+			for (usize i = 0; i < N; ++i)
+			{
+				position[i] = origin[i] + static_cast<float>(index[i]) * spacing[i];
+			}
+			positions.emplace_back(position);
+
+			usize axis = 0;
+			for (; axis < N && ++index[axis] == size[axis]; ++axis)
+			{
+				index[axis] = 0;
+			}
+			if (axis == N)
+			{
+				return positions;
+			}
+		}
+	}
+
+	/// Checks batch Voronoi F1 results against scalar results. Cell IDs may only differ where two cells are equidistant within rounding.
+	template <usize N>
+	void check_voronoi_f1(const std::vector<math::vector<float, N>>& positions, const math::vector<float, N>& tiling, const std::vector<float>& sqr_distances, const std::vector<math::vector<float, N>>& displacements, const std::vector<u32>& ids)
+	{
+		for (usize i = 0; i < positions.size(); ++i)
+		{
+			const auto [sqr_distance, displacement, id] = noise::voronoi_f1<float, N>(positions[i], 0.75f, tiling);
+			ASSERT_NEAR(sqr_distances[i], sqr_distance, 1e-4f);
+			if (ids[i] == id)
+			{
+				for (usize j = 0; j < N; ++j)
+				{
+					ASSERT_NEAR(displacements[i][j], displacement[j], 1e-4f);
+				}
+			}
+		}
+	}
+
+	template <usize N>
+	void test_simplex()
+	{
+		const auto positions = make_positions<N>();
+		std::vector<float> values(position_count);
+		for (const auto value: get_supported_isas())
+		{
+			set_isa(value);
+			noise::batch::simplex(positions, values);
+			for (usize i = 0; i < position_count; ++i)
+			{
+				const float expected = noise::simplex<float, N>(positions[i]);
+				ASSERT_NEAR(values[i], expected, 1e-4f);
+			}
+
+			noise::batch::fbm(positions, 5, 2.0f, 0.5f, values);
+			for (usize i = 0; i < position_count; ++i)
+			{
+				const float expected = noise::fbm<float, N>(positions[i], 5, 2.0f, 0.5f);
+				ASSERT_NEAR(values[i], expected, 1e-4f);
+			}
+		}
+	}
+
+	template <usize N>
+	void test_voronoi_f1()
+	{
+		const auto positions = make_positions<N>();
+		std::vector<float> sqr_distances(position_count);
+		std::vector<math::vector<float, N>> displacements(position_count);
+		std::vector<u32> ids(position_count);
+
+		math::vector<float, N> tiling{};
+		tiling[0] = 16.0f;
+
+		for (const auto value: get_supported_isas())
+		{
+			set_isa(value);
+			for (const auto& t: {math::vector<float, N>{}, tiling})
+			{
+				noise::batch::voronoi_f1(positions, 0.75f, t, sqr_distances, displacements, ids);
+				check_voronoi_f1(positions, t, sqr_distances, displacements, ids);
+			}
+
+			// Outputs are optional
+			std::vector<u32> only_ids(position_count);
+			noise::batch::voronoi_f1(positions, 0.75f, tiling, {}, {}, only_ids);
+			ASSERT(only_ids == ids);
+		}
+	}
+
+	template <usize N>
+	void test_grids(const math::vector<u32, N>& size)
+	{
+		math::vector<float, N> origin;
+		math::vector<float, N> spacing;
+		for (usize i = 0; i < N; ++i)
+		{
+			origin[i] = -3.7f + static_cast<float>(i);
+			spacing[i] = 0.13f * static_cast<float>(i + 1);
+		}
+
+		const auto positions = make_grid_positions(origin, spacing, size);
+		std::vector<float> expected(positions.size());
+		std::vector<float> values(positions.size());
+		std::vector<float> sqr_distances(positions.size());
+		std::vector<math::vector<float, N>> displacements(positions.size());
+		std::vector<u32> ids(positions.size());
+		const math::vector<float, N> tiling{};
+
+		for (const auto value: get_supported_isas())
+		{
+			set_isa(value);
+
+			noise::batch::simplex_grid(origin, spacing, size, values);
+			noise::batch::simplex(positions, expected);
+			for (usize i = 0; i < positions.size(); ++i)
+			{
+				ASSERT_NEAR(values[i], expected[i], 1e-5f);
+			}
+
+			noise::batch::fbm_grid(origin, spacing, size, 4, 2.0f, 0.5f, values);
+			noise::batch::fbm(positions, 4, 2.0f, 0.5f, expected);
+			for (usize i = 0; i < positions.size(); ++i)
+			{
+				ASSERT_NEAR(values[i], expected[i], 1e-4f);
+			}
+
+			noise::batch::voronoi_f1_grid(origin, spacing, size, 0.75f, tiling, sqr_distances, displacements, ids);
+			check_voronoi_f1(positions, tiling, sqr_distances, displacements, ids);
+		}
+	}
+}
+
+int main(int, char*[])
+{
+	test_suite suite;
+
+	suite.tests.emplace_back("Batch simplex noise and fBm", []()
+	{
+		test_simplex<2>();
+		test_simplex<3>();
+	});
+
+	suite.tests.emplace_back("Batch Voronoi noise", []()
+	{
+		test_voronoi_f1<2>();
+		test_voronoi_f1<3>();
+	});
+
+	suite.tests.emplace_back("Batch noise grids", []()
+	{
+		test_grids<2>({37, 11});
+		test_grids<3>({13, 5, 3});
+		set_isa(get_supported_isa());
+	});
+
+	return suite.run();
+}
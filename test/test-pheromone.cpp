@@ -0,0 +1,181 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "test.hpp"
+#include <engine/ai/pheromone-field.hpp>
+#include <engine/math/simd/isa.hpp>
+#include <engine/math/vector.hpp>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+using namespace engine;
+
+namespace
+{
+	/// Returns the total concentration of a channel over every cell of a field.
+	[[nodiscard]] double total_concentration(const ai::pheromone_field& field, usize channel)
+	{
+		const auto size = field.get_size();
+		double total = 0.0;
+		for (u32 z = 0; z < size.z(); ++z)
+		{
+			for (u32 y = 0; y < size.y(); ++y)
+			{
+				for (u32 x = 0; x < size.x(); ++x)
+				{
+					total += field.get_concentration(channel, {static_cast<int>(x), static_cast<int>(y), static_cast<int>(z)});
+				}
+			}
+		}
+		return total;
+	}
+
+	/// Returns the concentrations of a channel over every cell of a field.
+	[[nodiscard]] std::vector<float> concentrations(const ai::pheromone_field& field, usize channel)
+	{
+		const auto size = field.get_size();
+		std::vector<float> values;
+		for (u32 z = 0; z < size.z(); ++z)
+		{
+			for (u32 y = 0; y < size.y(); ++y)
+			{
+				for (u32 x = 0; x < size.x(); ++x)
+				{
+					values.emplace_back(field.get_concentration(channel, {static_cast<int>(x), static_cast<int>(y), static_cast<int>(z)}));
+				}
+			}
+		}
+		return values;
+	}
+
+	/// Returns `true` if constructing a pheromone field with the given arguments is rejected.
+	[[nodiscard]] bool is_rejected(float cell_size, const math::uvec3& size, std::span<const ai::pheromone_channel> channels)
+	{
+		try
+		{
+			const ai::pheromone_field field({}, cell_size, size, channels, 1);
+		}
+		catch (const std::invalid_argument&)
+		{
+			return true;
+		}
+		return false;
+	}
+}
+
+int main(int, char*[])
+{
+	test_suite suite;
+
+	suite.tests.emplace_back("Pheromone diffusion", []()
+	{
+		const ai::pheromone_channel channels[] = {{0.5f, 0.0f}, {0.0f, 0.0f}};
+		ai::pheromone_field field({}, 1.0f, {24, 24, 24}, channels, 2);
+		ASSERT_EQ(field.get_size().x(), 24u);
+
+		const math::fvec3 source{7.5f, 7.5f, 7.5f};
+		field.deposit(0, source, 1000.0f);
+		field.deposit(1, source, 5.0f);
+
+		// Depositing on a tile corner allocates the three tiles which share its faces
+		ASSERT_EQ(field.get_tile_count(), usize{4});
+
+		for (int i = 0; i < 20; ++i)
+		{
+			field.update(0.25f);
+		}
+
+		// Pheromone spreads into neighboring tiles and is conserved across tile boundaries
+		ASSERT_GT(field.get_tile_count(), usize{1});
+		const double total = total_concentration(field, 0);
+		ASSERT_NEAR(total, 1000.0, 0.5);
+		ASSERT_GT(field.get_concentration(0, {8, 7, 7}), 0.0f);
+		ASSERT_LT(field.sample(0, source), 1000.0f);
+
+		// Channels without diffusion stay in place
+		ASSERT_NEAR(field.sample(1, source), 5.0f, 1e-6f);
+
+		// Gradients point toward the source
+		const auto gradient = field.gradient(0, {10.5f, 7.5f, 7.5f});
+		ASSERT_LT(gradient.x(), 0.0f);
+		ASSERT_NEAR(gradient.y(), 0.0f, 1e-4f);
+
+		// Long timesteps are divided into stable substeps
+		field.update(10.0f);
+		for (const float value: concentrations(field, 0))
+		{
+			ASSERT_GE(value, 0.0f);
+		}
+		const double total_after_long_step = total_concentration(field, 0);
+		ASSERT_NEAR(total_after_long_step, 1000.0, 1.0);
+	});
+
+	suite.tests.emplace_back("Pheromone evaporation", []()
+	{
+		const ai::pheromone_channel channels[] = {{0.0f, 0.5f}};
+		ai::pheromone_field field({-1.0f, -1.0f, -1.0f}, 0.5f, {16, 16, 16}, channels, 1);
+
+		field.deposit(0, {0.0f, 0.0f, 0.0f}, 2.0f);
+		field.deposit(0, {100.0f, 0.0f, 0.0f}, 2.0f);
+		ASSERT_EQ(field.get_tile_count(), usize{1});
+		ASSERT_EQ(field.sample(0, {0.1f, 0.1f, 0.1f}), 2.0f);
+
+		field.update(1.0f);
+		ASSERT_NEAR(field.sample(0, {0.0f, 0.0f, 0.0f}), 2.0f * std::exp(-0.5f), 1e-5f);
+
+		// Idle tiles are released
+		for (int i = 0; i < 30; ++i)
+		{
+			field.update(1.0f);
+		}
+		ASSERT_EQ(field.get_tile_count(), usize{0});
+		ASSERT_EQ(field.sample(0, {0.0f, 0.0f, 0.0f}), 0.0f);
+	});
+
+	suite.tests.emplace_back("Pheromone kernels", []()
+	{
+		if (math::simd::get_supported_isa() != math::simd::isa::avx2)
+		{
+			return;
+		}
+
+		// Every instruction set gives the same field
+		const ai::pheromone_channel channels[] = {{0.3f, 0.1f}, {0.1f, 0.2f}};
+		std::vector<float> results[2];
+		for (const auto isa: {math::simd::isa::sse2, math::simd::isa::avx2})
+		{
+			math::simd::set_isa(isa);
+
+			ai::pheromone_field field({}, 1.0f, {16, 16, 16}, channels, 1);
+			for (int i = 0; i < 10; ++i)
+			{
+				field.deposit(0, {3.5f + i, 4.5f, 8.5f}, 10.0f);
+				field.deposit(1, {12.5f, 3.5f + i, 7.5f}, 10.0f);
+				field.update(0.5f);
+			}
+
+			auto values = concentrations(field, 0);
+			const auto values_1 = concentrations(field, 1);
+			values.insert(values.end(), values_1.begin(), values_1.end());
+			results[isa == math::simd::isa::avx2] = std::move(values);
+		}
+		math::simd::set_isa(math::simd::get_supported_isa());
+
+		for (usize i = 0; i < results[0].size(); ++i)
+		{
+			ASSERT_NEAR(results[0][i], results[1][i], 1e-4f);
+		}
+	});
+
+	suite.tests.emplace_back("Pheromone field arguments", []()
+	{
+		const ai::pheromone_channel channels[] = {{0.1f, 0.1f}};
+		ASSERT(is_rejected(0.0f, {8, 8, 8}, channels));
+		ASSERT(is_rejected(1.0f, {8, 0, 8}, channels));
+		ASSERT(is_rejected(1.0f, {8, 8, 8}, {}));
+		ASSERT(!is_rejected(1.0f, {1, 1, 1}, channels));
+	});
+
+	return suite.run();
+}
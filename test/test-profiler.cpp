@@ -0,0 +1,122 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "test.hpp"
+#include <engine/debug/profiler.hpp>
+#include <engine/utility/worker-pool.hpp>
+#include <engine/utility/sized-types.hpp>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace engine;
+
+int main(int, char*[])
+{
+	test_suite suite;
+
+	suite.tests.emplace_back("Profiler", []()
+	{
+		debug::profiler profiler;
+		const auto t0 = profiler.get_epoch();
+		std::vector<debug::profile_event> events;
+
+		// Nothing is collected before recording
+		ASSERT_EQ(profiler.collect(events), usize{0});
+
+		// Events are collected in recording order
+		profiler.record("inner", t0 + std::chrono::microseconds(1), t0 + std::chrono::microseconds(2), 1);
+		profiler.record("outer", t0, t0 + std::chrono::microseconds(3), 0);
+		ASSERT_EQ(profiler.collect(events), usize{2});
+		ASSERT_EQ(std::string_view(events[0].name), std::string_view("inner"));
+		ASSERT_EQ(events[0].begin, 1000);
+		ASSERT_EQ(events[0].end, 2000);
+		ASSERT_EQ(events[0].depth, u32{1});
+		ASSERT_EQ(std::string_view(events[1].name), std::string_view("outer"));
+		ASSERT_EQ(events[1].thread, events[0].thread);
+
+		// Events are collected once
+		ASSERT_EQ(profiler.collect(events), usize{0});
+
+		// Events which overflow the ring buffer are dropped
+		events.clear();
+		for (usize i = 0; i < debug::profiler::buffer_capacity + 10; ++i)
+		{
+			profiler.record("overflow", t0 + std::chrono::nanoseconds(i), t0 + std::chrono::nanoseconds(i + 1), 0);
+		}
+		ASSERT_EQ(profiler.collect(events), debug::profiler::buffer_capacity);
+		ASSERT_EQ(profiler.get_dropped_event_count(), u64{10});
+		ASSERT_EQ(events.front().begin, 10);
+
+		// Each thread records to its own buffer
+		events.clear();
+		worker_pool pool(4);
+		pool.parallel_for(400, [&](usize, usize)
+		{
+			profiler.record("task", profiler.get_epoch(), debug::profiler::clock_type::now(), 0);
+		});
+		ASSERT_EQ(profiler.collect(events), usize{400});
+		for (usize i = 1; i < events.size(); ++i)
+		{
+			ASSERT(events[i - 1].thread <= events[i].thread);
+		}
+	});
+
+	suite.tests.emplace_back("Profile scope", []()
+	{
+		if constexpr (!debug::g_profiler_enabled)
+		{
+			return;
+		}
+
+		auto& profiler = debug::default_profiler();
+		std::vector<debug::profile_event> events;
+		profiler.collect(events);
+		events.clear();
+
+		// Scopes are not recorded while the profiler is disabled
+		profiler.set_enabled(false);
+		{
+			debug::profile_scope scope("disabled");
+		}
+		ASSERT_EQ(profiler.collect(events), usize{0});
+
+		// Nested scopes are recorded with their depth, innermost first
+		profiler.set_enabled(true);
+		{
+			debug::profile_scope outer("outer");
+			{
+				debug::profile_scope inner("inner");
+			}
+		}
+		profiler.set_enabled(false);
+		ASSERT_EQ(profiler.collect(events), usize{2});
+		ASSERT_EQ(std::string_view(events[0].name), std::string_view("inner"));
+		ASSERT_EQ(events[0].depth, u32{1});
+		ASSERT_EQ(std::string_view(events[1].name), std::string_view("outer"));
+		ASSERT_EQ(events[1].depth, u32{0});
+		ASSERT(events[1].begin <= events[0].begin);
+		ASSERT(events[1].end >= events[0].end);
+	});
+
+	suite.tests.emplace_back("Chrome trace", []()
+	{
+		const std::vector<debug::profile_event> events =
+		{
+			{"a \"quoted\" name", 1000, 3500, 0, 0},
+			{"b", 2000, 3000, 1, 1}
+		};
+
+		std::ostringstream stream;
+		debug::write_chrome_trace(stream, events);
+		const std::string trace = stream.str();
+
+		ASSERT(trace.starts_with("{"));
+		ASSERT(trace.contains("\"traceEvents\":["));
+		ASSERT(trace.contains("{\"name\":\"a \\\"quoted\\\" name\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":1.000,\"dur\":2.500}"));
+		ASSERT(trace.contains("{\"name\":\"b\",\"ph\":\"X\",\"pid\":0,\"tid\":1,\"ts\":2.000,\"dur\":1.000}"));
+	});
+
+	return suite.run();
+}
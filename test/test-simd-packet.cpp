@@ -0,0 +1,322 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "test.hpp"
+#include <engine/math/simd/batch.hpp>
+#include <engine/math/simd/isa.hpp>
+#include <engine/math/simd/matrix-packet.hpp>
+#include <engine/math/simd/quaternion-packet.hpp>
+#include <engine/math/simd/vector-packet.hpp>
+#include <engine/math/basis.hpp>
+#include <engine/math/matrix.hpp>
+#include <engine/math/quaternion.hpp>
+#include <engine/math/vector.hpp>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace engine;
+using namespace engine::math::simd;
+
+namespace
+{
+	/// Generates a random vector.
+	math::fvec3 random_vector(std::mt19937& rng)
+	{
+		std::uniform_real_distribution<float> distribution(-10.0f, 10.0f);
+		return {distribution(rng), distribution(rng), distribution(rng)};
+	}
+
+	/// Generates a random unit quaternion.
+	math::fquat random_rotation(std::mt19937& rng)
+	{
+		std::normal_distribution<float> distribution;
+		return math::normalize(math::fquat{distribution(rng), distribution(rng), distribution(rng), distribution(rng)});
+	}
+
+	/// Generates a random affine transformation matrix.
+	math::fmat4 random_transform(std::mt19937& rng)
+	{
+		const auto r = math::basis_from_quat(random_rotation(rng));
+		const auto t = random_vector(rng);
+
+		math::fmat4 m = math::fmat4::identity();
+		for (usize i = 0; i < 3; ++i)
+		{
+			for (usize j = 0; j < 3; ++j)
+			{
+				m[i][j] = r[i][j];
+			}
+			m[3][i] = t[i];
+		}
+		return m;
+	}
+
+	template <class T>
+	void assert_elements_near(const T& a, const T& b, float tolerance)
+	{
+		const auto x = reinterpret_cast<const float*>(&a);
+		const auto y = reinterpret_cast<const float*>(&b);
+		for (usize i = 0; i < sizeof(T) / sizeof(float); ++i)
+		{
+			ASSERT_NEAR(x[i], y[i], tolerance);
+		}
+	}
+
+	/// Returns the instruction sets supported by the processor.
+	std::vector<isa> get_supported_isas()
+	{
+		if (get_supported_isa() == isa::avx2)
+		{
+			return {isa::sse2, isa::avx2};
+		}
+		return {isa::sse2};
+	}
+
+	/// Checks packet arithmetic and transposed loads and stores against scalar math.
+	template <usize W>
+	void test_packets()
+	{
+		std::mt19937 rng(W);
+
+		// Vector round trip, including partial packets
+		std::vector<math::fvec3> v3(W);
+		std::vector<math::fvec4> v4(W);
+		for (usize i = 0; i < W; ++i)
+		{
+			v3[i] = random_vector(rng);
+			v4[i] = {v3[i][0], v3[i][1], v3[i][2], static_cast<float>(i)};
+		}
+		for (usize count = 1; count <= W; ++count)
+		{
+			std::vector<math::fvec3> out3(W, math::fvec3{-1.0f, -1.0f, -1.0f});
+			std::vector<math::fvec4> out4(W, math::fvec4{-1.0f, -1.0f, -1.0f, -1.0f});
+			store_vector_packet(load_vector_packet<W>(v3.data(), count), out3.data(), count);
+			store_vector_packet(load_vector_packet<W>(v4.data(), count), out4.data(), count);
+			for (usize i = 0; i < W; ++i)
+			{
+				ASSERT(out3[i] == (i < count ? v3[i] : math::fvec3{-1.0f, -1.0f, -1.0f}));
+				ASSERT(out4[i] == (i < count ? v4[i] : math::fvec4{-1.0f, -1.0f, -1.0f, -1.0f}));
+			}
+		}
+
+		// Vector functions
+		std::vector<math::fvec3> w3(W);
+		for (auto& w: w3)
+		{
+			w = random_vector(rng);
+		}
+		const auto a = load_vector_packet<W>(v3.data());
+		const auto b = load_vector_packet<W>(w3.data());
+		float t_lanes[W];
+		for (usize i = 0; i < W; ++i)
+		{
+			t_lanes[i] = static_cast<float>(i) / static_cast<float>(W);
+		}
+		const auto t = load_packet<W>(t_lanes);
+
+		std::vector<math::fvec3> sum(W), cross_product(W), normalized(W), interpolated(W);
+		float dot_product[W];
+		float lengths[W];
+		store_vector_packet(a + b, sum.data());
+		store_vector_packet(cross(a, b), cross_product.data());
+		store_vector_packet(normalize(a), normalized.data());
+		store_vector_packet(lerp(a, b, t), interpolated.data());
+		store_packet(dot(a, b), dot_product);
+		store_packet(length(a), lengths);
+		for (usize i = 0; i < W; ++i)
+		{
+			assert_elements_near(sum[i], v3[i] + w3[i], 1e-5f);
+			assert_elements_near(cross_product[i], math::cross(v3[i], w3[i]), 1e-3f);
+			assert_elements_near(normalized[i], math::normalize(v3[i]), 1e-5f);
+			assert_elements_near(interpolated[i], math::lerp(v3[i], w3[i], t_lanes[i]), 1e-4f);
+			ASSERT_NEAR(dot_product[i], math::dot(v3[i], w3[i]), 1e-3f);
+			ASSERT_NEAR(lengths[i], math::length(v3[i]), 1e-4f);
+		}
+
+		// Lane selection
+		float selected[W];
+		store_packet(select(less_than(t, make_packet<W>(0.5f)), make_packet<W>(1.0f), make_packet<W>(2.0f)), selected);
+		for (usize i = 0; i < W; ++i)
+		{
+			ASSERT_EQ(selected[i], t_lanes[i] < 0.5f ? 1.0f : 2.0f);
+		}
+		ASSERT(any(greater_than(t, make_packet<W>(0.5f))));
+		ASSERT(!any(greater_than(t, make_packet<W>(1.0f))));
+
+		// Rounding
+		float rounded[W];
+		float truncated[W];
+		const auto r = t * make_packet<W>(-7.0f) + make_packet<W>(3.0f);
+		float r_lanes[W];
+		store_packet(r, r_lanes);
+		store_packet(floor(r), rounded);
+		store_packet(trunc(r), truncated);
+		for (usize i = 0; i < W; ++i)
+		{
+			ASSERT_EQ(rounded[i], std::floor(r_lanes[i]));
+			ASSERT_EQ(truncated[i], std::trunc(r_lanes[i]));
+		}
+		ASSERT(all_equal(r, r));
+		ASSERT(!all_equal(r, t));
+		ASSERT_EQ(first_lane(r), r_lanes[0]);
+
+		// Integer packets
+		u32 u_lanes[W];
+		for (usize i = 0; i < W; ++i)
+		{
+			u_lanes[i] = static_cast<u32>(rng());
+			r_lanes[i] = static_cast<float>(u_lanes[i] >> 8) - 65536.0f;
+		}
+		upacket<W> u = to_upacket(load_packet<W>(r_lanes));
+		u32 stored[W];
+		store_packet(u, stored);
+		for (usize i = 0; i < W; ++i)
+		{
+			ASSERT_EQ(stored[i], static_cast<u32>(static_cast<i64>(r_lanes[i])));
+		}
+
+		u = u * make_upacket<W>(747796405u) + make_upacket<W>(2891336453u);
+		store_packet(u, u_lanes);
+		u32 products[W];
+		u32 high_products[W];
+		u32 shifted[W];
+		float converted[W];
+		store_packet(u * u, products);
+		store_packet(mul_hi(u, make_upacket<W>(0xaaaaaaab)), high_products);
+		store_packet(u ^ (u >> 16), shifted);
+		store_packet(to_fpacket(u), converted);
+		for (usize i = 0; i < W; ++i)
+		{
+			ASSERT_EQ(products[i], u_lanes[i] * u_lanes[i]);
+			ASSERT_EQ(high_products[i], static_cast<u32>((u64{u_lanes[i]} * 0xaaaaaaab) >> 32));
+			ASSERT_EQ(shifted[i], u_lanes[i] ^ (u_lanes[i] >> 16));
+			ASSERT_EQ(converted[i], static_cast<float>(u_lanes[i]));
+		}
+
+		// Quaternion functions
+		std::vector<math::fquat> p(W), q(W), product(W), blended(W);
+		std::vector<math::fvec3> rotated(W);
+		for (usize i = 0; i < W; ++i)
+		{
+			p[i] = random_rotation(rng);
+			q[i] = random_rotation(rng);
+		}
+		const auto qp = load_quaternion_packet<W>(p.data());
+		const auto qq = load_quaternion_packet<W>(q.data());
+		store_quaternion_packet(qp * qq, product.data());
+		store_quaternion_packet(nlerp(qp, qq, t), blended.data());
+		store_vector_packet(qp * a, rotated.data());
+		for (usize i = 0; i < W; ++i)
+		{
+			assert_elements_near(product[i], p[i] * q[i], 1e-5f);
+			assert_elements_near(blended[i], math::nlerp(p[i], q[i], t_lanes[i]), 1e-5f);
+			assert_elements_near(rotated[i], p[i] * v3[i], 1e-4f);
+		}
+
+		// Matrix functions
+		std::vector<math::fmat4> m(W), n(W), matrix_product(W), transposed(W);
+		for (usize i = 0; i < W; ++i)
+		{
+			m[i] = random_transform(rng);
+			n[i] = random_transform(rng);
+		}
+		const auto mp = load_matrix_packet<W>(m.data());
+		store_matrix_packet(mul(mp, load_matrix_packet<W>(n.data())), matrix_product.data());
+		store_matrix_packet(transpose(mp), transposed.data());
+		for (usize i = 0; i < W; ++i)
+		{
+			assert_elements_near(matrix_product[i], m[i] * n[i], 1e-3f);
+			assert_elements_near(transposed[i], math::transpose(m[i]), 0.0f);
+		}
+	}
+}
+
+int main(int, char*[])
+{
+	test_suite suite;
+
+	suite.tests.emplace_back("Four-lane packets", []()
+	{
+		test_packets<4>();
+	});
+
+	suite.tests.emplace_back("Eight-lane packets", []()
+	{
+		test_packets<8>();
+	});
+
+	suite.tests.emplace_back("Batch functions", []()
+	{
+		std::mt19937 rng(42);
+
+		for (const auto selected_isa: get_supported_isas())
+		{
+			set_isa(selected_isa);
+			ASSERT(get_isa() == selected_isa);
+
+			// Sizes cover empty batches, partial packets, and multiple full packets of both widths
+			for (const usize count: {0, 1, 3, 4, 7, 8, 13, 64})
+			{
+				std::vector<math::fmat4> m(count), n(count), matrix_products(count);
+				std::vector<math::fquat> p(count), q(count), quaternion_products(count), blended(count);
+				std::vector<math::fvec3> v(count), points(count), rotated(count), normalized(count);
+				for (usize i = 0; i < count; ++i)
+				{
+					m[i] = random_transform(rng);
+					n[i] = random_transform(rng);
+					p[i] = random_rotation(rng);
+					q[i] = random_rotation(rng);
+					v[i] = random_vector(rng);
+				}
+
+				batch::transform_points(m, v, points);
+				batch::multiply_matrices(m, n, matrix_products);
+				batch::multiply_quaternions(p, q, quaternion_products);
+				batch::rotate_vectors(p, v, rotated);
+				batch::normalize_vectors(v, normalized);
+				batch::nlerp_quaternions(p, q, 0.25f, blended);
+
+				for (usize i = 0; i < count; ++i)
+				{
+					const auto point = m[i] * math::fvec4{v[i][0], v[i][1], v[i][2], 1.0f};
+					assert_elements_near(points[i], math::fvec3{point[0], point[1], point[2]}, 1e-4f);
+					assert_elements_near(matrix_products[i], m[i] * n[i], 1e-3f);
+					assert_elements_near(quaternion_products[i], p[i] * q[i], 1e-5f);
+					assert_elements_near(rotated[i], p[i] * v[i], 1e-4f);
+					assert_elements_near(normalized[i], math::normalize(v[i]), 1e-5f);
+					assert_elements_near(blended[i], math::nlerp(p[i], q[i], 0.25f), 1e-5f);
+				}
+
+				// In-place
+				batch::normalize_vectors(v, v);
+				ASSERT(v == normalized);
+			}
+		}
+
+		set_isa(get_supported_isa());
+	});
+
+	suite.tests.emplace_back("ISA selection", []()
+	{
+		set_isa(isa::sse2);
+		ASSERT(get_isa() == isa::sse2);
+
+		bool threw = false;
+		try
+		{
+			set_isa(isa::avx2);
+		}
+		catch (const std::invalid_argument&)
+		{
+			threw = true;
+		}
+		ASSERT(threw == (get_supported_isa() != isa::avx2));
+
+		set_isa(get_supported_isa());
+		ASSERT(get_isa() == get_supported_isa());
+	});
+
+	return suite.run();
+}
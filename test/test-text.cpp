@@ -0,0 +1,487 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "test.hpp"
+#include <engine/type/font-cache.hpp>
+#include <engine/type/text-layout.hpp>
+#include <engine/resources/deserialize-context.hpp>
+#include <engine/resources/deserialize-error.hpp>
+#include <engine/resources/deserializer.hpp>
+#include <engine/resources/serialize-context.hpp>
+#include <engine/resources/serializer.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <format>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace engine;
+using namespace engine::type;
+
+namespace
+{
+	/// Monospaced ASCII font without a typeface or texture.
+	class test_font
+	{
+	public:
+		test_font()
+		{
+			m_metrics.linespace = 14.6f;
+
+			for (char32_t code = 0; code < 128; ++code)
+			{
+				auto& g = m_glyphs[code];
+				g.horizontal_bearings = {1.0f, 10.0f};
+				g.horizontal_advance = 8.4f;
+				g.bitmap_dimensions = {7, 11};
+				g.bitmap_position = {(code % 16) * 8, (code / 16) * 12};
+			}
+		}
+
+		[[nodiscard]] const font_metrics& get_metrics() const noexcept
+		{
+			return m_metrics;
+		}
+
+		usize cache_glyphs(std::u32string_view text)
+		{
+			cached_character_count += text.size();
+			return 0;
+		}
+
+		[[nodiscard]] const glyph* get_cached_glyph(char32_t code) const
+		{
+			auto it = m_glyphs.find(code);
+			return it != m_glyphs.end() ? &it->second : &m_glyphs.at(0);
+		}
+
+		[[nodiscard]] math::fvec2 get_kerning(char32_t first, char32_t second) const
+		{
+			return {(first == U'A' && second == U'V') ? -1.5f : 0.0f, 0.0f};
+		}
+
+		[[nodiscard]] math::uvec2 get_texture_dimensions() const
+		{
+			return texture_dimensions;
+		}
+
+		math::uvec2 texture_dimensions{128, 128};
+		usize cached_character_count{0};
+
+	private:
+		font_metrics m_metrics{};
+		std::unordered_map<char32_t, glyph> m_glyphs;
+	};
+
+	using quad = std::array<float, 4>;
+
+	/// Returns the upper-left corner and texture coordinates of each non-degenerate quad of a text layout, relative to its origin, sorted.
+	[[nodiscard]] std::vector<quad> get_quads(const basic_text_layout<test_font>& layout)
+	{
+		std::vector<quad> quads;
+		const auto origin = layout.get_origin();
+		const float* v = layout.get_vertices().data();
+		for (usize i = 0; i < layout.get_vertex_count(); i += vertices_per_text_character)
+		{
+			const float* quad_vertex = v + i * floats_per_text_vertex;
+			if (quad_vertex[7] != 0.0f)
+			{
+				quads.push_back({quad_vertex[0] + origin.x(), quad_vertex[1] + origin.y(), quad_vertex[2], quad_vertex[3]});
+			}
+		}
+		std::sort(quads.begin(), quads.end());
+		return quads;
+	}
+
+	/// Returns `true` if an incrementally updated layout matches a layout of the same content laid out from scratch.
+	[[nodiscard]] bool matches_full_layout(const basic_text_layout<test_font>& layout, test_font& font)
+	{
+		basic_text_layout<test_font> full_layout;
+		full_layout.set_font(&font);
+		full_layout.set_color(layout.get_color());
+		full_layout.set_content(layout.get_content());
+
+		return get_quads(layout) == get_quads(full_layout) &&
+			layout.get_bounds().min == full_layout.get_bounds().min &&
+			layout.get_bounds().max == full_layout.get_bounds().max;
+	}
+
+	/// Returns the number of modified vertices.
+	[[nodiscard]] usize count_modified_vertices(const basic_text_layout<test_font>& layout)
+	{
+		usize count = 0;
+		for (const auto& [first, last]: layout.get_modified_ranges())
+		{
+			count += last - first;
+		}
+		return count;
+	}
+
+	/// Returns a window of console lines.
+	[[nodiscard]] std::string console_text(usize first_line, usize line_count)
+	{
+		std::string text;
+		for (usize i = first_line; i < first_line + line_count; ++i)
+		{
+			text += std::format("{}[{:04}] AVATAR loaded in {} ms", i == first_line ? "" : "\n", i, i * 7 % 100);
+		}
+		return text;
+	}
+
+	/// Copies words between buffers, reversing the bytes of each word if @p endian is not the native byte order.
+	void copy_words(std::byte* destination, const std::byte* source, usize count, usize word_size, std::endian endian)
+	{
+		std::memcpy(destination, source, count * word_size);
+		if (endian != std::endian::native)
+		{
+			for (usize i = 0; i < count; ++i)
+			{
+				std::reverse(destination + i * word_size, destination + (i + 1) * word_size);
+			}
+		}
+	}
+
+	/// Serialize context which writes to memory.
+	class memory_writer: public resources::serialize_context
+	{
+	public:
+		[[nodiscard]] const std::filesystem::path& path() const noexcept override
+		{
+			return m_path;
+		}
+
+		[[nodiscard]] bool error() const noexcept override
+		{
+			return false;
+		}
+
+		usize write8(const std::byte* data, usize count) override
+		{
+			return write(data, count, 1, std::endian::native);
+		}
+
+		usize write16_le(const std::byte* data, usize count) override
+		{
+			return write(data, count, 2, std::endian::little);
+		}
+
+		usize write16_be(const std::byte* data, usize count) override
+		{
+			return write(data, count, 2, std::endian::big);
+		}
+
+		usize write32_le(const std::byte* data, usize count) override
+		{
+			return write(data, count, 4, std::endian::little);
+		}
+
+		usize write32_be(const std::byte* data, usize count) override
+		{
+			return write(data, count, 4, std::endian::big);
+		}
+
+		usize write64_le(const std::byte* data, usize count) override
+		{
+			return write(data, count, 8, std::endian::little);
+		}
+
+		usize write64_be(const std::byte* data, usize count) override
+		{
+			return write(data, count, 8, std::endian::big);
+		}
+
+		/// Returns the written data.
+		[[nodiscard]] inline const std::vector<std::byte>& data() const noexcept
+		{
+			return m_data;
+		}
+
+	private:
+		usize write(const std::byte* data, usize count, usize word_size, std::endian endian)
+		{
+			const auto offset = m_data.size();
+			m_data.resize(offset + count * word_size);
+			copy_words(m_data.data() + offset, data, count, word_size, endian);
+			return count;
+		}
+
+		std::vector<std::byte> m_data;
+		std::filesystem::path m_path;
+	};
+
+	/// Deserialize context which reads from memory. Reads past the end of the data are truncated.
+	class memory_reader: public resources::deserialize_context
+	{
+	public:
+		explicit memory_reader(std::vector<std::byte> data):
+			m_data(std::move(data))
+		{}
+
+		[[nodiscard]] const std::filesystem::path& path() const noexcept override
+		{
+			return m_path;
+		}
+
+		[[nodiscard]] std::filesystem::path native_path() const override
+		{
+			return {};
+		}
+
+		[[nodiscard]] bool error() const noexcept override
+		{
+			return false;
+		}
+
+		[[nodiscard]] bool eof() const noexcept override
+		{
+			return m_position == m_data.size();
+		}
+
+		[[nodiscard]] usize size() const noexcept override
+		{
+			return m_data.size();
+		}
+
+		[[nodiscard]] usize tell() const override
+		{
+			return m_position;
+		}
+
+		void seek(usize offset) override
+		{
+			m_position = std::min(offset, m_data.size());
+		}
+
+		usize read8(std::byte* data, usize count) override
+		{
+			return read(data, count, 1, std::endian::native);
+		}
+
+		usize read16_le(std::byte* data, usize count) override
+		{
+			return read(data, count, 2, std::endian::little);
+		}
+
+		usize read16_be(std::byte* data, usize count) override
+		{
+			return read(data, count, 2, std::endian::big);
+		}
+
+		usize read32_le(std::byte* data, usize count) override
+		{
+			return read(data, count, 4, std::endian::little);
+		}
+
+		usize read32_be(std::byte* data, usize count) override
+		{
+			return read(data, count, 4, std::endian::big);
+		}
+
+		usize read64_le(std::byte* data, usize count) override
+		{
+			return read(data, count, 8, std::endian::little);
+		}
+
+		usize read64_be(std::byte* data, usize count) override
+		{
+			return read(data, count, 8, std::endian::big);
+		}
+
+	private:
+		usize read(std::byte* data, usize count, usize word_size, std::endian endian)
+		{
+			count = std::min(count, (m_data.size() - m_position) / word_size);
+			copy_words(data, m_data.data() + m_position, count, word_size, endian);
+			m_position += count * word_size;
+			return count;
+		}
+
+		std::vector<std::byte> m_data;
+		std::filesystem::path m_path;
+		usize m_position{0};
+	};
+
+	/// Serializes a font cache to memory.
+	[[nodiscard]] std::vector<std::byte> save_font_cache(const font_cache& cache)
+	{
+		memory_writer writer;
+		resources::serializer<font_cache>().serialize(cache, writer);
+		return writer.data();
+	}
+
+	/// Deserializes a font cache from memory.
+	/// @return `true` if the font cache was loaded, or `false` if it was rejected.
+	[[nodiscard]] bool load_font_cache(std::vector<std::byte> data, font_cache& cache)
+	{
+		memory_reader reader(std::move(data));
+		try
+		{
+			resources::deserializer<font_cache>().deserialize(cache, reader);
+		}
+		catch (const resources::deserialize_error&)
+		{
+			return false;
+		}
+		return true;
+	}
+}
+
+int main(int, char*[])
+{
+	test_suite suite;
+
+	suite.tests.emplace_back("Text layout edits", []()
+	{
+		test_font font;
+		basic_text_layout<test_font> layout;
+		layout.set_font(&font);
+		layout.set_color({1.0f, 1.0f, 0.0f, 1.0f});
+
+		const std::string contents[] =
+		{
+			"12.34ms / 81.03 FPS\nAnimation LODs: 1 / 2 / 3 / 4",
+			"12.51ms / 79.94 FPS\nAnimation LODs: 1 / 2 / 3 / 4",
+			"9.87ms / 101.32 FPS\nAnimation LODs: 10 / 2 / 3 / 4",
+			"9.87ms / 101.32 FPS\nInserted line\nAnimation LODs: 10 / 2 / 3 / 4",
+			"AVAVAV\n\n\nAnimation LODs: 10 / 2 / 3 / 4\n",
+			"",
+			"  \t\n a\n",
+			"A very long line which does not fit in the vertex range of the line it replaces\nAnimation LODs: 10 / 2 / 3 / 4"
+		};
+
+		for (const auto& content: contents)
+		{
+			layout.set_content(content);
+			ASSERT(matches_full_layout(layout, font));
+		}
+
+		// Atlas growth
+		font.texture_dimensions = {256, 128};
+		layout.update_texture_coordinates();
+		ASSERT(matches_full_layout(layout, font));
+
+		// Color change
+		layout.set_color({1.0f, 0.0f, 0.0f, 0.5f});
+		ASSERT(matches_full_layout(layout, font));
+	});
+
+	suite.tests.emplace_back("Text layout scroll", []()
+	{
+		test_font font;
+		basic_text_layout<test_font> layout;
+		layout.set_font(&font);
+		layout.set_content(console_text(0, 100));
+		layout.clear_modified_ranges();
+		const auto vertex_count = layout.get_vertex_count();
+
+		for (usize i = 1; i < 5000; ++i)
+		{
+			font.cached_character_count = 0;
+			layout.set_content(console_text(i, 100));
+
+			// Only the new line is shaped, and only the vertices of the removed and added lines are modified
+			ASSERT(font.cached_character_count < 64);
+			ASSERT(count_modified_vertices(layout) <= 2 * 64 * vertices_per_text_character || layout.get_origin().y() == 0.0f);
+			layout.clear_modified_ranges();
+
+			if (i % 97 == 0)
+			{
+				ASSERT(matches_full_layout(layout, font));
+			}
+		}
+
+		// Freed vertex ranges are reused
+		ASSERT(layout.get_vertex_count() <= vertex_count * 2);
+		ASSERT_EQ(layout.get_line_count(), 100u);
+	});
+
+	suite.tests.emplace_back("Font cache round trip", []()
+	{
+		font_cache cache;
+		cache.key = 0x0123456789abcdef;
+		cache.texture_dimensions = {512, 256};
+		for (char32_t code: {U'A', U'g', U'\u00e9', U'\U0001f41c'})
+		{
+			glyph g;
+			g.dimensions = {6.5f, 9.25f};
+			g.horizontal_bearings = {0.5f, static_cast<float>(code % 13)};
+			g.horizontal_advance = 7.75f;
+			g.vertical_bearings = {-3.25f, 1.0f};
+			g.vertical_advance = 14.5f;
+			g.bitmap_dimensions = {7, static_cast<u32>(code % 5 + 3)};
+			g.bitmap_bearings = {-1, static_cast<i32>(code % 11)};
+			g.bitmap_data = std::make_unique<std::byte[]>(g.bitmap_dimensions.x() * g.bitmap_dimensions.y());
+			for (usize i = 0; i < g.bitmap_dimensions.x() * g.bitmap_dimensions.y(); ++i)
+			{
+				g.bitmap_data[i] = static_cast<std::byte>(code * 31 + i * 7);
+			}
+			cache.glyphs.emplace_back(code, std::move(g));
+		}
+
+		// Glyph metrics and bitmaps, from which the font atlas is rebuilt, are restored
+		const auto data = save_font_cache(cache);
+		font_cache loaded;
+		ASSERT(load_font_cache(data, loaded));
+		ASSERT_EQ(loaded.key, cache.key);
+		ASSERT(loaded.texture_dimensions == cache.texture_dimensions);
+		ASSERT_EQ(loaded.glyphs.size(), cache.glyphs.size());
+		for (usize i = 0; i < cache.glyphs.size(); ++i)
+		{
+			const auto& [code, g] = cache.glyphs[i];
+			const auto& [loaded_code, loaded_g] = loaded.glyphs[i];
+			ASSERT(loaded_code == code);
+			ASSERT(loaded_g.dimensions == g.dimensions);
+			ASSERT(loaded_g.horizontal_bearings == g.horizontal_bearings);
+			ASSERT_EQ(loaded_g.horizontal_advance, g.horizontal_advance);
+			ASSERT(loaded_g.vertical_bearings == g.vertical_bearings);
+			ASSERT_EQ(loaded_g.vertical_advance, g.vertical_advance);
+			ASSERT(loaded_g.bitmap_dimensions == g.bitmap_dimensions);
+			ASSERT(loaded_g.bitmap_bearings == g.bitmap_bearings);
+			ASSERT(std::equal(g.bitmap_data.get(), g.bitmap_data.get() + g.bitmap_dimensions.x() * g.bitmap_dimensions.y(), loaded_g.bitmap_data.get()));
+		}
+
+		// Saving the loaded cache reproduces the file
+		ASSERT(save_font_cache(loaded) == data);
+	});
+
+	suite.tests.emplace_back("Font cache rejection", []()
+	{
+		font_cache cache;
+		cache.key = 42;
+		cache.texture_dimensions = {64, 64};
+		glyph g;
+		g.bitmap_dimensions = {4, 4};
+		g.bitmap_data = std::make_unique<std::byte[]>(16);
+		cache.glyphs.emplace_back(U'x', std::move(g));
+		const auto data = save_font_cache(cache);
+
+		font_cache loaded;
+		ASSERT(load_font_cache(data, loaded));
+
+		// Corrupt file identifier
+		auto corrupt = data;
+		corrupt[0] ^= std::byte{0xff};
+		ASSERT(!load_font_cache(corrupt, loaded));
+
+		// Stale format version
+		auto stale = data;
+		const u32 stale_version = font_cache_version + 1;
+		copy_words(stale.data() + 4, reinterpret_cast<const std::byte*>(&stale_version), 1, 4, std::endian::little);
+		ASSERT(!load_font_cache(stale, loaded));
+
+		// Glyph count larger than the file
+		auto overcounted = data;
+		const u32 glyph_count = 1000;
+		copy_words(overcounted.data() + 16, reinterpret_cast<const std::byte*>(&glyph_count), 1, 4, std::endian::little);
+		ASSERT(!load_font_cache(overcounted, loaded));
+
+		// Truncated bitmap
+		ASSERT(!load_font_cache({data.begin(), data.end() - 1}, loaded));
+	});
+
+	return suite.run();
+}
@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: 2025 C. J. Howard
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "test.hpp"
+#include <engine/ui/batch-builder.hpp>
+#include <memory>
+#include <vector>
+
+using namespace engine;
+using namespace engine::ui;
+
+namespace
+{
+	/// Makes a batch item with a single triangle.
+	[[nodiscard]] batch_item make_item(std::shared_ptr<render::material> material, float depth, math::fvec2 translation)
+	{
+		batch_item item;
+		item.vertex_count = 3;
+		item.vertices.assign(item.vertex_count * floats_per_batch_vertex, 1.0f);
+		item.vertices[0] = 0.0f;
+		item.vertices[1] = 0.0f;
+		item.material = std::move(material);
+		item.depth = depth;
+		item.translation = translation;
+		return item;
+	}
+}
+
+int main(int, char*[])
+{
+	test_suite suite;
+
+	suite.tests.emplace_back("Batch ranges", []()
+	{
+		auto material_a = std::make_shared<render::material>();
+		auto material_b = std::make_shared<render::material>();
+
+		std::vector<batch_item> items;
+		items.emplace_back(make_item(material_a, 0.0f, {}));
+		items.emplace_back(make_item(material_b, 0.0f, {}));
+		items.emplace_back(make_item(material_a, 0.0f, {}));
+		items.emplace_back(make_item(material_b, 0.0f, {}));
+		items.emplace_back(make_item(material_a, -99.0f, {}));
+
+		batch_builder builder;
+		for (auto& item: items)
+		{
+			builder.insert(item);
+		}
+
+		// Items with the same material and depth are merged, and ranges are sorted by depth
+		const auto& modified = builder.build();
+		ASSERT_EQ(modified.size(), 1u);
+		ASSERT_EQ(modified[0].first, 0u);
+		ASSERT_EQ(modified[0].second, 15u);
+		ASSERT_EQ(builder.get_vertex_count(), 15u);
+		ASSERT_EQ(builder.get_ranges().size(), 3u);
+		ASSERT_EQ(builder.get_ranges()[0].depth, -99.0f);
+		ASSERT_EQ(builder.get_ranges()[0].vertex_count, 3u);
+		ASSERT_EQ(builder.get_ranges()[1].vertex_count, 6u);
+		ASSERT_EQ(builder.get_ranges()[2].vertex_count, 6u);
+
+		// Invisible items are skipped
+		items[1].visible = false;
+		builder.invalidate(items[1]);
+		builder.build();
+		ASSERT_EQ(builder.get_vertex_count(), 12u);
+		ASSERT_EQ(builder.get_ranges().size(), 3u);
+
+		// Erased items are skipped
+		builder.erase(items[3]);
+		builder.build();
+		ASSERT_EQ(builder.get_vertex_count(), 9u);
+		ASSERT_EQ(builder.get_ranges().size(), 2u);
+		ASSERT_EQ(builder.size(), 4u);
+	});
+
+	suite.tests.emplace_back("Batch partial update", []()
+	{
+		auto material = std::make_shared<render::material>();
+
+		std::vector<batch_item> items;
+		for (int i = 0; i < 4; ++i)
+		{
+			items.emplace_back(make_item(material, 0.0f, {static_cast<float>(i) * 10.0f, 0.0f}));
+		}
+
+		batch_builder builder;
+		for (auto& item: items)
+		{
+			builder.insert(item);
+		}
+		builder.build();
+
+		// Nothing modified
+		ASSERT(builder.build().empty());
+
+		// Moving an item rewrites its vertices only
+		items[2].translation = {100.0f, 50.0f};
+		builder.invalidate(items[2]);
+		const auto modified = builder.build();
+		ASSERT_EQ(modified.size(), 1u);
+		ASSERT_EQ(modified[0].second - modified[0].first, 3u);
+
+		const float* v = builder.get_vertices().data() + modified[0].first * floats_per_batch_vertex;
+		ASSERT_EQ(v[0], 100.0f);
+		ASSERT_EQ(v[1], 50.0f);
+		ASSERT_EQ(builder.get_bounds().max.x(), 101.0f);
+		ASSERT_EQ(builder.get_ranges().size(), 1u);
+	});
+
+	return suite.run();
+}
@@ -0,0 +1,119 @@
+# SPDX-FileCopyrightText: 2025 C. J. Howard
+# SPDX-License-Identifier: GPL-3.0-or-later
+
+import argparse
+import datetime
+import struct
+import sys
+
+# Log message severity strings, indexed by severity.
+SEVERITIES = ['trace', 'debug', 'info', 'warning', 'error', 'fatal']
+
+# Binary log record kinds.
+RECORD_MESSAGE = 0
+RECORD_LOCATION = 1
+RECORD_THREAD = 2
+RECORD_TIME_ZONE = 3
+
+# Reads an unsigned LEB128 varint, returning the value and the offset of the following byte.
+def read_varint(data, offset):
+    value = 0
+    shift = 0
+    while True:
+        byte = data[offset]
+        offset += 1
+        value |= (byte & 0x7f) << shift
+        if byte < 0x80:
+            return value, offset
+        shift += 7
+
+# Reads a zigzag-encoded signed varint.
+def read_signed_varint(data, offset):
+    value, offset = read_varint(data, offset)
+    return (value >> 1) ^ -(value & 1), offset
+
+# Reads a size-prefixed UTF-8 string.
+def read_string(data, offset):
+    size, offset = read_varint(data, offset)
+    return data[offset:offset + size].decode('utf-8', errors='replace'), offset + size
+
+# Formats a time, in milliseconds since the Unix epoch, in the same way as the text log.
+def format_time(time_ms, utc_offset_s):
+    tz = datetime.timezone(datetime.timedelta(seconds=utc_offset_s))
+    time = datetime.datetime(1970, 1, 1, tzinfo=datetime.timezone.utc) + datetime.timedelta(milliseconds=time_ms)
+    return time.astimezone(tz).isoformat(timespec='milliseconds')
+
+# Decodes a binary log into TSV rows.
+def decode(data):
+    if len(data) < 16 or data[0:4] != b'AKBL':
+        raise ValueError('not a binary log file')
+    version, time_ms = struct.unpack_from('<Lq', data, 4)
+    if version != 1:
+        raise ValueError(f'unsupported binary log version {version}')
+
+    locations = {}
+    threads = {}
+    utc_offset_s = 0
+    offset = 16
+
+    while offset < len(data):
+        tag = data[offset]
+        offset += 1
+        kind = tag >> 4
+
+        if kind == RECORD_MESSAGE:
+            delta_ms, offset = read_signed_varint(data, offset)
+            location_id, offset = read_varint(data, offset)
+            thread_id, offset = read_varint(data, offset)
+            message, offset = read_string(data, offset)
+            time_ms += delta_ms
+            severity = tag & 0xf
+            file_name, line = locations[location_id]
+            yield (
+                format_time(time_ms, utc_offset_s),
+                SEVERITIES[severity] if severity < len(SEVERITIES) else 'unknown',
+                file_name,
+                str(line),
+                threads[thread_id],
+                message
+            )
+        elif kind == RECORD_LOCATION:
+            location_id, offset = read_varint(data, offset)
+            line, offset = read_varint(data, offset)
+            file_name, offset = read_string(data, offset)
+            locations[location_id] = (file_name, line)
+        elif kind == RECORD_THREAD:
+            thread_id, offset = read_varint(data, offset)
+            threads[thread_id], offset = read_string(data, offset)
+        elif kind == RECORD_TIME_ZONE:
+            utc_offset_s, offset = read_signed_varint(data, offset)
+        else:
+            raise ValueError(f'unknown record kind {kind} at offset {offset - 1}')
+
+if __name__ == "__main__":
+
+    # Parse arguments
+    parser = argparse.ArgumentParser(description='Convert a binary log file to the TSV log format.')
+    parser.add_argument('input_file', help='Input file')
+    parser.add_argument('output_file', help='Output file')
+    args = parser.parse_args()
+
+    with open(args.input_file, 'rb') as file:
+        data = file.read()
+
+    # Decode records, tolerating a truncated final record
+    rows = []
+    try:
+        for row in decode(data):
+            rows.append(row)
+    except IndexError:
+        print(f"warning: \"{args.input_file}\" is truncated after {len(rows)} messages", file=sys.stderr)
+    except ValueError as e:
+        print(f"error: \"{args.input_file}\": {e}", file=sys.stderr)
+        sys.exit(1)
+
+    # Output TSV in the same layout as the text log
+    with open(args.output_file, 'w', encoding='utf-8', newline='') as file:
+        file.write('time\tseverity\tfile\tline\tthread\tmessage')
+        for row in rows:
+            file.write('\n' + '\t'.join(row))
@@ -4,37 +4,98 @@
 import argparse
 import csv
 import struct
+import sys
 from functools import reduce
 
+# Packed string map identifier ("AKSM") and format version. Must match engine/i18n/packed-string-map.hpp.
+MAGIC = 0x4d534b41
+VERSION = 1
+
+# Average number of keys per bucket.
+KEYS_PER_BUCKET = 4
+
 # 32-bit FNV-1a hash function.
 def fnv1a32(data):
     return reduce(lambda h, b: (h ^ b) * 16777619 & 0xffffffff, data, 2166136261)
 
+# Hash function of packed string maps (MurmurHash3 finalizer of the seeded key).
+def packed_hash(key, seed):
+    h = key ^ (seed * 0x9e3779b9 & 0xffffffff)
+    h ^= h >> 16
+    h = h * 0x85ebca6b & 0xffffffff
+    h ^= h >> 13
+    h = h * 0xc2b2ae35 & 0xffffffff
+    h ^= h >> 16
+    return h
+
+# Builds a minimal perfect hash by finding a displacement for each bucket of keys, largest buckets first.
+# Returns the bucket displacements and the key in each slot.
+def build_perfect_hash(keys):
+    entry_count = len(keys)
+    bucket_count = (entry_count + KEYS_PER_BUCKET - 1) // KEYS_PER_BUCKET
+
+    buckets = [[] for _ in range(bucket_count)]
+    for key in keys:
+        buckets[packed_hash(key, 0) % bucket_count].append(key)
+
+    displacements = [0] * bucket_count
+    slots = [None] * entry_count
+    for bucket_index in sorted(range(bucket_count), key=lambda i: -len(buckets[i])):
+        bucket = buckets[bucket_index]
+        if not bucket:
+            break
+        displacement = 1
+        while True:
+            bucket_slots = [packed_hash(key, displacement) % entry_count for key in bucket]
+            if len(set(bucket_slots)) == len(bucket_slots) and all(slots[slot] is None for slot in bucket_slots):
+                break
+            displacement += 1
+        for key, slot in zip(bucket, bucket_slots):
+            slots[slot] = key
+        displacements[bucket_index] = displacement
+
+    return displacements, slots
+
 if __name__ == "__main__":
-    
+
     # Parse arguments
-    parser = argparse.ArgumentParser(description='Generate a binary string map from a CSV file for the given language.')
+    parser = argparse.ArgumentParser(description='Generate a packed binary string map from a CSV file for the given language.')
     parser.add_argument('input_file', help='Input file')
     parser.add_argument('language_tag', help='Language tag')
     parser.add_argument('output_file', help='Output file')
     args = parser.parse_args()
-    
+
     # Build string dict, setting empty values to $key
     with open(args.input_file, 'r', encoding='utf-8') as file:
-        strings = {row['key']: row[args.language_tag] for row in csv.DictReader(file) if row['key']}
+        csv_reader = csv.DictReader(file)
+        if args.language_tag not in csv_reader.fieldnames:
+            print(f"error: language \"{args.language_tag}\" not found in \"{args.input_file}\"")
+            sys.exit(1)
+        strings = {row['key']: row[args.language_tag] for row in csv_reader if row['key']}
     strings = {k: '$' + k if not v else v for k, v in strings.items()}
-    
-    # Hash string keys, encode string values in UTF-8, calculate sizes of UTF-8 string values
-    keys = [fnv1a32(k.encode('utf-8')) for k in strings.keys()]
-    values = [v.encode('utf-8') for v in strings.values()]
-    sizes = [len(v) for v in values]
-    
-    # Pack UTF-8 string values into bytestring
-    values = b''.join(values)
-    
+
+    # Hash string keys and encode string values in UTF-8
+    values = {}
+    for k, v in strings.items():
+        key = fnv1a32(k.encode('utf-8'))
+        if key in values:
+            print(f"error: hash of key \"{k}\" collides with another key")
+            sys.exit(1)
+        values[key] = v.encode('utf-8')
+
+    displacements, slots = build_perfect_hash(list(values.keys()))
+
+    # Pack entries and UTF-8 string values, in slot order
+    entries = b''
+    pool = b''
+    for key in slots:
+        entries += struct.pack('<3L', key, len(pool), len(values[key]))
+        pool += values[key] + b'\0'
+
     # Generate output file
     with open(args.output_file, 'wb') as file:
-        file.write(struct.pack('<L', len(values)) + values + struct.pack('<L', len(keys)))
-        for key, size in zip(keys, sizes):
-            file.write(struct.pack('<2L', key, size))
-    
+        file.write(struct.pack('<4L', MAGIC, VERSION, len(slots), len(displacements)))
+        file.write(struct.pack(f'<{len(displacements)}L', *displacements))
+        file.write(entries)
+        file.write(pool)
+